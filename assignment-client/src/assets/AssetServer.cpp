@@ -22,6 +22,7 @@
 #include <QtCore/QDirIterator>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QSaveFile>
 #include <QtCore/QString>
@@ -113,11 +114,12 @@ QString getBakeMapping(const AssetUtils::AssetHash& hash, const QString& relativ
 
 const QString ASSET_SERVER_LOGGING_TARGET_NAME = "asset-server";
 
-void AssetServer::bakeAsset(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath) {
+void AssetServer::bakeAsset(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath,
+                            BakePriority priority) {
     qDebug() << "Starting bake for: " << assetPath << assetHash;
     auto it = _pendingBakes.find(assetHash);
     if (it == _pendingBakes.end()) {
-        auto task = std::make_shared<BakeAssetTask>(assetHash, assetPath, filePath);
+        auto task = std::make_shared<BakeAssetTask>(assetHash, assetPath, filePath, priority);
         task->setAutoDelete(false);
         _pendingBakes[assetHash] = task;
 
@@ -125,12 +127,58 @@ void AssetServer::bakeAsset(const AssetUtils::AssetHash& assetHash, const AssetU
         connect(task.get(), &BakeAssetTask::bakeFailed, this, &AssetServer::handleFailedBake);
         connect(task.get(), &BakeAssetTask::bakeAborted, this, &AssetServer::handleAbortedBake);
 
-        _bakingTaskPool.start(task.get());
+        _bakingTaskPool.start(task.get(), (int)priority);
     } else {
         qDebug() << "Already in queue";
+        prioritizeBake(assetHash, priority);
     }
 }
 
+void AssetServer::prioritizeBake(const AssetUtils::AssetHash& assetHash, BakePriority priority) {
+    auto it = _pendingBakes.find(assetHash);
+    if (it == _pendingBakes.end() || (*it)->getPriority() >= priority) {
+        return;
+    }
+
+    // QThreadPool can't re-order its queue, so take the task back out and queue it again at the new priority
+    auto task = it->get();
+    if (_bakingTaskPool.tryTake(task)) {
+        qDebug() << "Raising bake priority for" << task->getAssetPath() << "to" << (int)priority;
+        task->setPriority(priority);
+        _bakingTaskPool.start(task, (int)priority);
+    }
+}
+
+void AssetServer::cancelBake(const AssetUtils::AssetHash& assetHash) {
+    auto it = _pendingBakes.find(assetHash);
+    if (it == _pendingBakes.end()) {
+        return;
+    }
+
+    if (_bakingTaskPool.tryTake(it->get())) {
+        qDebug() << "Removing queued bake for" << assetHash;
+        _pendingBakes.erase(it);
+    } else {
+        // the task is already running, handleAbortedBake drops it from our pending bakes once the oven is gone
+        qDebug() << "Aborting bake for" << assetHash;
+        it.value()->abort();
+    }
+}
+
+void AssetServer::recordBakeTimings(const AssetUtils::AssetHash& assetHash, const QString& result) {
+    auto it = _pendingBakes.find(assetHash);
+    if (it == _pendingBakes.end()) {
+        return;
+    }
+
+    static const size_t MAX_RECENT_BAKE_TIMINGS = 10;
+    _recentBakeTimings.push_back({ (*it)->getAssetPath(), result, (*it)->getQueuedMSecs(), (*it)->getBakeMSecs() });
+    if (_recentBakeTimings.size() > MAX_RECENT_BAKE_TIMINGS) {
+        _recentBakeTimings.pop_front();
+    }
+    ++_completedBakes;
+}
+
 QString AssetServer::getPathToAssetHash(const AssetUtils::AssetHash& assetHash) {
     return _filesDirectory.absoluteFilePath(assetHash);
 }
@@ -189,10 +237,10 @@ void AssetServer::bakeAssets() {
     }
 }
 
-void AssetServer::maybeBake(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash) {
+void AssetServer::maybeBake(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash, BakePriority priority) {
     if (needsToBeBaked(path, hash)) {
         qDebug() << "Queuing bake of: " << path;
-        bakeAsset(hash, path, getPathToAssetHash(hash));
+        bakeAsset(hash, path, getPathToAssetHash(hash), priority);
     }
 }
 
@@ -424,6 +472,21 @@ void AssetServer::completeSetup() {
         return;
     }
 
+    static const QString MAX_CONCURRENT_BAKES_OPTION = "max_concurrent_bakes";
+    auto maxConcurrentBakes = assetServerObject[MAX_CONCURRENT_BAKES_OPTION].toInt(1);
+    if (maxConcurrentBakes < 1) {
+        maxConcurrentBakes = 1;
+    }
+    _bakingTaskPool.setMaxThreadCount(maxConcurrentBakes);
+
+    static const QString BAKE_NICENESS_OPTION = "bake_niceness";
+    static const int DEFAULT_BAKE_NICENESS = 0;
+    static const int MAX_BAKE_NICENESS = 19;
+    auto bakeNiceness = std::min(std::max(assetServerObject[BAKE_NICENESS_OPTION].toInt(DEFAULT_BAKE_NICENESS), 0), MAX_BAKE_NICENESS);
+    BakeAssetTask::setOvenNiceness(bakeNiceness);
+
+    qCInfo(asset_server) << "Baking up to" << maxConcurrentBakes << "assets at a time with niceness" << bakeNiceness;
+
     // load whatever mappings we currently have from the local file
     if (loadMappingsFromFile()) {
         qCInfo(asset_server) << "Serving files from: " << _filesDirectory.path();
@@ -639,6 +702,9 @@ void AssetServer::handleGetMappingOperation(ReceivedMessage& message, NLPacketLi
 
         // check if we should re-direct to a baked asset
         auto originalAssetHash = it->second;
+
+        // a client is waiting on this asset, so if it is still queued for baking move it to the front
+        prioritizeBake(originalAssetHash, BakePriority::Requested);
         QString redirectedAssetHash;
         quint8 wasRedirected = false;
         bool bakingDisabled = false;
@@ -692,7 +758,7 @@ void AssetServer::handleGetMappingOperation(ReceivedMessage& message, NLPacketLi
 
                 writeMetaFile(originalAssetHash, needsBakingMeta);
                 if (!bakingDisabled) {
-                    maybeBake(assetPath, originalAssetHash);
+                    maybeBake(assetPath, originalAssetHash, BakePriority::Requested);
                 }
             }
         }
@@ -957,6 +1023,29 @@ void AssetServer::sendStatsPacket() {
         serverStats[uuid] = nodeStats;
     });
 
+    int bakesRunning = 0;
+    for (auto& task : _pendingBakes) {
+        bakesRunning += task->isBaking() ? 1 : 0;
+    }
+
+    QJsonArray recentBakes;
+    for (auto& timings : _recentBakeTimings) {
+        QJsonObject bakeStats;
+        bakeStats["1. Path"] = timings.path;
+        bakeStats["2. Result"] = timings.result;
+        bakeStats["3. Queued (ms)"] = timings.queuedMSecs;
+        bakeStats["4. Baking (ms)"] = timings.bakeMSecs;
+        recentBakes.append(bakeStats);
+    }
+
+    QJsonObject bakingStats;
+    bakingStats["1. Queued, Not Started"] = _pendingBakes.size() - bakesRunning;
+    bakingStats["2. Running"] = bakesRunning;
+    bakingStats["3. Max Concurrent"] = _bakingTaskPool.maxThreadCount();
+    bakingStats["4. Completed"] = _completedBakes;
+    bakingStats["5. Recent Bakes"] = recentBakes;
+    serverStats["Baking"] = bakingStats;
+
     // send off the stats packets
     ThreadedAssignment::addPacketStatsAndSendStatsPacket(serverStats);
 }
@@ -1074,7 +1163,7 @@ bool AssetServer::setMapping(AssetUtils::AssetPath path, AssetUtils::AssetHash h
     if (writeMappingsToFile()) {
         // persistence succeeded, we are good to go
         qCDebug(asset_server) << "Set mapping:" << path << "=>" << hash;
-        maybeBake(path, hash);
+        maybeBake(path, hash, BakePriority::RecentlyUploaded);
         return true;
     } else {
         // failed to persist this mapping to file - put back the old one in our in-memory representation
@@ -1097,6 +1186,9 @@ bool pathIsFolder(const AssetUtils::AssetPath& path) {
 void AssetServer::removeBakedPathsForDeletedAsset(AssetUtils::AssetHash hash) {
     // we deleted the file with this hash
 
+    // there's no point finishing a bake for it, its results would just be removed again
+    cancelBake(hash);
+
     // check if we had baked content for that file that should also now be removed
     // by calling deleteMappings for the hidden baked content folder for this hash
     AssetUtils::AssetPathList hiddenBakedFolder { AssetUtils::HIDDEN_BAKED_CONTENT_FOLDER + hash + "/" };
@@ -1309,6 +1401,7 @@ void AssetServer::handleFailedBake(QString originalAssetHash, QString assetPath,
 
     writeMetaFile(originalAssetHash, meta);
 
+    recordBakeTimings(originalAssetHash, "failed");
     _pendingBakes.remove(originalAssetHash);
 }
 
@@ -1332,6 +1425,7 @@ void AssetServer::handleCompletedBake(QString originalAssetHash, QString origina
 
         writeMetaFile(originalAssetHash, meta);
 
+        recordBakeTimings(originalAssetHash, errorCompletingBake ? "failed" : "baked");
         _pendingBakes.remove(originalAssetHash);
     };
 
@@ -1341,6 +1435,14 @@ void AssetServer::handleCompletedBake(QString originalAssetHash, QString origina
 
     qDebug() << "Completing bake for " << originalAssetHash;
 
+    auto pendingBake = _pendingBakes.find(originalAssetHash);
+    if (pendingBake != _pendingBakes.end() && (*pendingBake)->wasAborted()) {
+        // the original asset was deleted or replaced since the oven finished, so don't map what it baked
+        PathUtils::deleteMyTemporaryDir(QDir(bakedTempOutputDir).dirName());
+        handleAbortedBake(originalAssetHash, originalAssetPath);
+        return;
+    }
+
     // Find the directory containing the baked content
     QDir outputDir(bakedTempOutputDir);
     QString outputDirName = outputDir.dirName();
@@ -1465,6 +1567,7 @@ void AssetServer::handleAbortedBake(QString originalAssetHash, QString assetPath
     qDebug() << "Aborted bake:" << originalAssetHash;
 
     // for an aborted bake we don't do anything but remove the BakeAssetTask from our pending bakes
+    recordBakeTimings(originalAssetHash, "aborted");
     _pendingBakes.remove(originalAssetHash);
 }
 
@@ -1580,7 +1683,7 @@ bool AssetServer::setBakingEnabled(const AssetUtils::AssetPathList& paths, bool
             if (enabled && currentlyDisabled) {
                 QStringList bakedMappings{ bakedMapping };
                 deleteMappings(bakedMappings);
-                maybeBake(path, hash);
+                maybeBake(path, hash, BakePriority::RecentlyUploaded);
                 qDebug() << "Enabled baking for" << path;
             } else if (!enabled && !currentlyDisabled) {
                 removeBakedPathsForDeletedAsset(hash);
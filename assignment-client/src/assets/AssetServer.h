@@ -12,6 +12,8 @@
 #ifndef hifi_AssetServer_h
 #define hifi_AssetServer_h
 
+#include <deque>
+
 #include <QtCore/QDir>
 #include <QtCore/QThreadPool>
 #include <QRunnable>
@@ -22,6 +24,7 @@
 #include "ReceivedMessage.h"
 
 #include "RegisteredMetaTypes.h"
+#include "BakeAssetTask.h"
 
 using BakeVersion = int;
 static const BakeVersion INITIAL_BAKE_VERSION = 0;
@@ -68,8 +71,6 @@ struct AssetMeta {
     QString redirectTarget;
 };
 
-class BakeAssetTask;
-
 class AssetServer : public ThreadedAssignment {
     Q_OBJECT
 public:
@@ -130,11 +131,21 @@ private:
     std::pair<AssetUtils::BakingStatus, QString> getAssetStatus(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash);
 
     void bakeAssets();
-    void maybeBake(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash);
+    void maybeBake(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash,
+                   BakePriority priority = BakePriority::Backlog);
     void createEmptyMetaFile(const AssetUtils::AssetHash& hash);
     bool hasMetaFile(const AssetUtils::AssetHash& hash);
     bool needsToBeBaked(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& assetHash);
-    void bakeAsset(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath);
+    void bakeAsset(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath,
+                   BakePriority priority);
+
+    /// Move a queued bake ahead of lower priority bakes, does nothing if it is already running
+    void prioritizeBake(const AssetUtils::AssetHash& assetHash, BakePriority priority);
+
+    /// Drop a queued bake or abort a running one, used when the original asset goes away
+    void cancelBake(const AssetUtils::AssetHash& assetHash);
+
+    void recordBakeTimings(const AssetUtils::AssetHash& assetHash, const QString& result);
 
     /// Move baked content for asset to baked directory and update baked status
     void handleCompletedBake(QString originalAssetHash, QString assetPath, QString bakedTempOutputDir);
@@ -159,6 +170,15 @@ private:
     QHash<AssetUtils::AssetHash, std::shared_ptr<BakeAssetTask>> _pendingBakes;
     QThreadPool _bakingTaskPool;
 
+    struct BakeTimings {
+        AssetUtils::AssetPath path;
+        QString result;
+        qint64 queuedMSecs;
+        qint64 bakeMSecs;
+    };
+    std::deque<BakeTimings> _recentBakeTimings;
+    int _completedBakes { 0 };
+
     QMutex _queuedRequestsMutex;
     bool _isQueueingRequests { true };
     using RequestQueue = QVector<QPair<QSharedPointer<ReceivedMessage>, SharedNodePointer>>;
@@ -13,9 +13,14 @@
 
 #include <mutex>
 
+#include <QtCore/QStandardPaths>
 #include <QtCore/QThread>
 #include <QCoreApplication>
 
+#ifdef Q_OS_WIN
+#include <Windows.h>
+#endif
+
 #include <PathUtils.h>
 
 static const int OVEN_STATUS_CODE_SUCCESS { 0 };
@@ -24,11 +29,16 @@ static const int OVEN_STATUS_CODE_ABORT { 2 };
 
 std::once_flag registerMetaTypesFlag;
 
-BakeAssetTask::BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath) :
+std::atomic<int> BakeAssetTask::_ovenNiceness { 0 };
+
+BakeAssetTask::BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath,
+                             BakePriority priority) :
     _assetHash(assetHash),
     _assetPath(assetPath),
-    _filePath(filePath)
+    _filePath(filePath),
+    _priority(priority)
 {
+    _queuedTimer.start();
 
     std::call_once(registerMetaTypesFlag, []() {
         qRegisterMetaType<QProcess::ProcessError>("QProcess::ProcessError");
@@ -42,6 +52,16 @@ void BakeAssetTask::run() {
         return;
     }
 
+    _queuedMSecs.store(_queuedTimer.elapsed());
+    if (_wasAborted) {
+        // the asset was deleted or replaced while we were queued
+        emit bakeAborted(_assetHash, _assetPath);
+        return;
+    }
+
+    QElapsedTimer bakeTimer;
+    bakeTimer.start();
+
     // Make a new temporary directory for the Oven to work in
     QString tempOutputDir = PathUtils::generateTemporaryDir();
     QString tempOutputDirName = QDir(tempOutputDir).dirName();
@@ -72,13 +92,39 @@ void BakeAssetTask::run() {
         "-t", extension,
     };
 
+    std::unique_lock<std::mutex> ovenProcessLock(_ovenProcessMutex);
+    if (_wasAborted) {
+        ovenProcessLock.unlock();
+        PathUtils::deleteMyTemporaryDir(tempOutputDirName);
+        emit bakeAborted(_assetHash, _assetPath);
+        return;
+    }
     _ovenProcess.reset(new QProcess());
 
+    // keep the oven from competing with the asset server itself (and anything else on the host) for CPU
+    int niceness = _ovenNiceness.load();
+    if (niceness > 0) {
+#ifdef Q_OS_WIN
+        static const int IDLE_NICENESS = 15;
+        DWORD priorityClass = niceness >= IDLE_NICENESS ? IDLE_PRIORITY_CLASS : BELOW_NORMAL_PRIORITY_CLASS;
+        _ovenProcess->setCreateProcessArgumentsModifier([priorityClass](QProcess::CreateProcessArguments* arguments) {
+            arguments->flags |= priorityClass;
+        });
+#else
+        auto nicePath = QStandardPaths::findExecutable("nice");
+        if (!nicePath.isEmpty()) {
+            args = QStringList { "-n", QString::number(niceness), path } + args;
+            path = nicePath;
+        }
+#endif
+    }
+
     QEventLoop loop;
 
     connect(_ovenProcess.get(), static_cast<void(QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished),
-            this, [&loop, this, tempOutputDir, tempAssetPath, tempOutputDirName](int exitCode, QProcess::ExitStatus exitStatus) {
+            this, [&loop, &bakeTimer, this, tempOutputDir, tempAssetPath, tempOutputDirName](int exitCode, QProcess::ExitStatus exitStatus) {
         qDebug() << "Baking process finished: " << exitCode << exitStatus;
+        _bakeMSecs.store(bakeTimer.elapsed());
 
         if (exitStatus == QProcess::CrashExit) {
             PathUtils::deleteMyTemporaryDir(tempOutputDirName);
@@ -88,6 +134,10 @@ void BakeAssetTask::run() {
                 QString errors = "Fatal error occurred while baking";
                 emit bakeFailed(_assetHash, _assetPath, errors);
             }
+        } else if (exitCode == OVEN_STATUS_CODE_SUCCESS && _wasAborted) {
+            // aborted too late to stop the oven, but the asset it baked is gone so its output is no use
+            PathUtils::deleteMyTemporaryDir(tempOutputDirName);
+            emit bakeAborted(_assetHash, _assetPath);
         } else if (exitCode == OVEN_STATUS_CODE_SUCCESS) {
             emit bakeComplete(_assetHash, _assetPath, tempOutputDir);
         } else if (exitStatus == QProcess::NormalExit && exitCode == OVEN_STATUS_CODE_ABORT) {
@@ -116,6 +166,7 @@ void BakeAssetTask::run() {
 
     qDebug() << "Starting oven for " << _assetPath;
     _ovenProcess->start(path, args, QIODevice::ReadOnly);
+    ovenProcessLock.unlock();
     qDebug() << "Running:" << path << args;
     if (!_ovenProcess->waitForStarted()) {
         PathUtils::deleteMyTemporaryDir(tempOutputDirName);
@@ -125,20 +176,24 @@ void BakeAssetTask::run() {
         return;
     }
 
-    _isBaking = true;
+    // abort() may have found the oven still starting, too early to terminate it
+    ovenProcessLock.lock();
+    if (_wasAborted && _ovenProcess->state() == QProcess::Running) {
+        _ovenProcess->terminate();
+    }
+    ovenProcessLock.unlock();
 
     loop.exec();
 }
 
 void BakeAssetTask::abort() {
-    if (QThread::currentThread() != thread()) {
-        QMetaObject::invokeMethod(this, "abort");
-        return;
-    }
     qDebug() << "Aborting BakeAssetTask for" << _assetHash;
-    if (_ovenProcess->state() != QProcess::NotRunning) {
+    // set before looking for the oven, so that run() sees it if the oven isn't started yet
+    _wasAborted = true;
+
+    std::lock_guard<std::mutex> lock(_ovenProcessMutex);
+    if (_ovenProcess && _ovenProcess->state() == QProcess::Running) {
         qDebug() << "Teminating oven process for" << _assetHash;
-        _wasAborted = true;
         _ovenProcess->terminate();
     }
 }
@@ -13,8 +13,10 @@
 #define hifi_BakeAssetTask_h
 
 #include <memory>
+#include <mutex>
 
 #include <QtCore/QDebug>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QObject>
 #include <QtCore/QRunnable>
 #include <QDir>
@@ -22,14 +24,33 @@
 
 #include <AssetUtils.h>
 
+// Higher priorities are taken off the baking queue first
+enum class BakePriority : int {
+    Backlog = 0,        // un-baked assets found when the asset server starts up
+    RecentlyUploaded,   // assets that were just mapped
+    Requested           // assets a client is asking for right now
+};
+
 class BakeAssetTask : public QObject, public QRunnable {
     Q_OBJECT
 public:
-    BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath);
+    BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath,
+                  BakePriority priority = BakePriority::Backlog);
+
+    // Only changed by the asset server while the task is still queued
+    BakePriority getPriority() const { return _priority; }
+    void setPriority(BakePriority priority) { _priority = priority; }
+
+    const AssetUtils::AssetPath& getAssetPath() const { return _assetPath; }
 
     // Thread-safe inspection methods
     bool isBaking() { return _isBaking.load(); }
     bool wasAborted() const { return _wasAborted.load(); }
+    qint64 getQueuedMSecs() const { return _queuedMSecs.load(); }
+    qint64 getBakeMSecs() const { return _bakeMSecs.load(); }
+
+    // 0 runs the oven at normal priority, up to 19 runs it at the lowest priority the OS offers
+    static void setOvenNiceness(int niceness) { _ovenNiceness.store(niceness); }
 
     void run() override;
 
@@ -46,8 +67,16 @@ private:
     AssetUtils::AssetHash _assetHash;
     AssetUtils::AssetPath _assetPath;
     QString _filePath;
+    std::mutex _ovenProcessMutex; // guards _ovenProcess, which run() creates and abort() terminates from another thread
     std::unique_ptr<QProcess> _ovenProcess { nullptr };
     std::atomic<bool> _wasAborted { false };
+    BakePriority _priority;
+
+    QElapsedTimer _queuedTimer;
+    std::atomic<qint64> _queuedMSecs { 0 };
+    std::atomic<qint64> _bakeMSecs { 0 };
+
+    static std::atomic<int> _ovenNiceness;
 };
 
 #endif // hifi_BakeAssetTask_h
@@ -85,8 +85,9 @@ AudioMixer::AudioMixer(ReceivedMessage& message) :
     auto nodeList = DependencyManager::get<NodeList>();
     auto& packetReceiver = nodeList->getPacketReceiver();
 
-    // packets whose consequences are limited to their own node can be parallelized
-    packetReceiver.registerListenerForTypes({
+    // packets whose consequences are limited to their own node can be parallelized,
+    // they go straight from the network thread to the packet queue of their node
+    packetReceiver.registerDirectHandler({
             PacketType::MicrophoneAudioNoEcho,
             PacketType::MicrophoneAudioWithEcho,
             PacketType::InjectAudio,
@@ -101,7 +102,9 @@ AudioMixer::AudioMixer(ReceivedMessage& message) :
             PacketType::InjectorGainSet,
             PacketType::AudioSoloRequest,
             PacketType::StopInjector },
-            this, "queueAudioPacket");
+            this, [this](QSharedPointer<ReceivedMessage> message, SharedNodePointer node) {
+                queueAudioPacket(message, node);
+            });
 
     // packets whose consequences are global should be processed on the main thread
     packetReceiver.registerListener(PacketType::MuteEnvironment, this, "handleMuteEnvironmentPacket");
@@ -121,6 +124,9 @@ AudioMixer::AudioMixer(ReceivedMessage& message) :
 }
 
 void AudioMixer::aboutToFinish() {
+    // stop the packets queued from the network thread before we go away
+    DependencyManager::get<NodeList>()->getPacketReceiver().unregisterListener(this);
+
     DependencyManager::destroy<PluginManager>();
 }
 
@@ -129,7 +135,21 @@ void AudioMixer::queueAudioPacket(QSharedPointer<ReceivedMessage> message, Share
         _numSilentPackets++;
     }
 
-    getOrCreateClientData(node.data())->queuePacket(message, node);
+    // this runs on the network thread, where only the main thread may create the node's linked data
+    AudioMixerClientData* clientData;
+    {
+        QMutexLocker lock(&node->getMutex());
+        clientData = dynamic_cast<AudioMixerClientData*>(node->getLinkedData());
+    }
+
+    if (clientData) {
+        clientData->queuePacket(message, node);
+    } else {
+        QMetaObject::invokeMethod(this, [this, message, node] {
+            QMutexLocker lock(&node->getMutex());
+            getOrCreateClientData(node.data())->queuePacket(message, node);
+        }, Qt::QueuedConnection);
+    }
 }
 
 void AudioMixer::queueReplicatedAudioPacket(QSharedPointer<ReceivedMessage> message) {
@@ -157,6 +177,7 @@ void AudioMixer::queueReplicatedAudioPacket(QSharedPointer<ReceivedMessage> mess
                                                                      versionForPacketType(rewrittenType),
                                                                      message->getSenderSockAddr(), Node::NULL_LOCAL_ID);
 
+    QMutexLocker lock(&replicatedNode->getMutex());
     getOrCreateClientData(replicatedNode.data())->queuePacket(replicatedMessage, replicatedNode);
 }
 
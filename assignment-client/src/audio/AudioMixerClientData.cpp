@@ -51,6 +51,7 @@ AudioMixerClientData::~AudioMixerClientData() {
 }
 
 void AudioMixerClientData::queuePacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer node) {
+    std::lock_guard<std::mutex> lock(_packetQueueMutex);
     if (!_packetQueue.node) {
         _packetQueue.node = node;
     }
@@ -58,12 +59,18 @@ void AudioMixerClientData::queuePacket(QSharedPointer<ReceivedMessage> message,
 }
 
 int AudioMixerClientData::processPackets(ConcurrentAddedStreams& addedStreams) {
-    SharedNodePointer node = _packetQueue.node;
-    assert(_packetQueue.empty() || node);
-    _packetQueue.node.clear();
+    // take the packets queued so far, those that arrive meanwhile are for the next frame
+    PacketQueue packetQueue;
+    {
+        std::lock_guard<std::mutex> lock(_packetQueueMutex);
+        std::swap(packetQueue, _packetQueue);
+    }
+
+    SharedNodePointer node = packetQueue.node;
+    assert(packetQueue.empty() || node);
 
-    while (!_packetQueue.empty()) {
-        auto& packet = _packetQueue.front();
+    while (!packetQueue.empty()) {
+        auto& packet = packetQueue.front();
 
         switch (packet->getType()) {
             case PacketType::MicrophoneAudioNoEcho:
@@ -111,9 +118,8 @@ int AudioMixerClientData::processPackets(ConcurrentAddedStreams& addedStreams) {
                 Q_UNREACHABLE();
         }
 
-        _packetQueue.pop();
+        packetQueue.pop();
     }
-    assert(_packetQueue.empty());
 
     // now that we have processed all packets for this frame
     // we can prepare the sources from this client to be ready for mixing
@@ -12,6 +12,7 @@
 #ifndef hifi_AudioMixerClientData_h
 #define hifi_AudioMixerClientData_h
 
+#include <mutex>
 #include <queue>
 
 #include <tbb/concurrent_vector.h>
@@ -173,6 +174,7 @@ private:
         QWeakPointer<Node> node;
     };
     PacketQueue _packetQueue;
+    std::mutex _packetQueueMutex; // packets are queued from the network thread
 
     AudioStreamVector _audioStreams; // microphone stream from avatar has a null stream ID
 
@@ -49,18 +49,6 @@ EntityServer::EntityServer(ReceivedMessage& message) :
     DependencyManager::set<ModelFormatRegistry>(); // ModelFormatRegistry must be defined before ModelCache. See the ModelCache ctor
     DependencyManager::set<ModelCache>();
 
-    auto& packetReceiver = DependencyManager::get<NodeList>()->getPacketReceiver();
-    packetReceiver.registerListenerForTypes({ PacketType::EntityAdd,
-        PacketType::EntityClone,
-        PacketType::EntityEdit,
-        PacketType::EntityErase,
-        PacketType::EntityPhysics,
-        PacketType::ChallengeOwnership,
-        PacketType::ChallengeOwnershipRequest,
-        PacketType::ChallengeOwnershipReply },
-        this,
-        "handleEntityPacket");
-
     connect(&_dynamicDomainVerificationTimer, &QTimer::timeout, this, &EntityServer::startDynamicDomainVerification);
     _dynamicDomainVerificationTimer.setSingleShot(true);
 }
@@ -83,10 +71,15 @@ void EntityServer::aboutToFinish() {
     OctreeServer::aboutToFinish();
 }
 
-void EntityServer::handleEntityPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
-    if (_octreeInboundPacketProcessor) {
-        _octreeInboundPacketProcessor->queueReceivedPacket(message, senderNode);
-    }
+PacketReceiver::PacketTypeList EntityServer::getMyInboundPacketTypes() const {
+    return { PacketType::EntityAdd,
+        PacketType::EntityClone,
+        PacketType::EntityEdit,
+        PacketType::EntityErase,
+        PacketType::EntityPhysics,
+        PacketType::ChallengeOwnership,
+        PacketType::ChallengeOwnershipRequest,
+        PacketType::ChallengeOwnershipReply };
 }
 
 std::unique_ptr<OctreeQueryNode> EntityServer::createOctreeQueryNode() {
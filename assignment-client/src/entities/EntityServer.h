@@ -47,6 +47,7 @@ public:
 
     // subclass may implement these method
     virtual void beforeRun() override;
+    virtual PacketReceiver::PacketTypeList getMyInboundPacketTypes() const override;
     virtual bool hasSpecialPacketsToSend(const SharedNodePointer& node) override;
     virtual int sendSpecialPackets(const SharedNodePointer& node, OctreeQueryNode* queryNode, int& packetsSent) override;
 
@@ -70,7 +71,6 @@ protected:
     virtual UniqueSendThread newSendThread(const SharedNodePointer& node) override;
 
 private slots:
-    void handleEntityPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
     void domainSettingsRequestFailed();
 
 private:
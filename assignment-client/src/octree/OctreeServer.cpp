@@ -1223,6 +1223,16 @@ void OctreeServer::beginRunning() {
     _octreeInboundPacketProcessor = new OctreeInboundPacketProcessor(this);
     _octreeInboundPacketProcessor->initialize(true);
 
+    // inbound edits go straight from the network thread to the processor's queue
+    auto inboundPacketTypes = getMyInboundPacketTypes();
+    if (!inboundPacketTypes.empty()) {
+        auto processor = _octreeInboundPacketProcessor;
+        nodeList->getPacketReceiver().registerDirectHandler(inboundPacketTypes, processor,
+            [processor](QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
+                processor->queueReceivedPacket(message, senderNode);
+            });
+    }
+
     // Convert now to tm struct for local timezone
     tm* localtm = localtime(&_started);
     const int MAX_TIME_LENGTH = 128;
@@ -1285,6 +1295,8 @@ void OctreeServer::aboutToFinish() {
     DependencyManager::get<NodeList>()->linkedDataCreateCallback = nullptr;
 
     if (_octreeInboundPacketProcessor) {
+        // no more packets queued to it from the network thread
+        DependencyManager::get<NodeList>()->getPacketReceiver().unregisterListener(_octreeInboundPacketProcessor);
         _octreeInboundPacketProcessor->terminating();
     }
 
@@ -79,6 +79,7 @@ public:
 
     // subclass may implement these method
     virtual void beforeRun() { }
+    virtual PacketReceiver::PacketTypeList getMyInboundPacketTypes() const { return {}; }
     virtual bool hasSpecialPacketsToSend(const SharedNodePointer& node) { return false; }
     virtual int sendSpecialPackets(const SharedNodePointer& node, OctreeQueryNode* queryNode, int& packetsSent) { return 0; }
     virtual QString serverSubclassStats() { return QString(); }
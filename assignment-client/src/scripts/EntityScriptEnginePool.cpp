@@ -0,0 +1,493 @@
+//
+//  EntityScriptEnginePool.cpp
+//  assignment-client/src/scripts
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityScriptEnginePool.h"
+
+#include <algorithm>
+#include <limits>
+
+#include <QtCore/QJsonArray>
+
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+#include <UUID.h>
+
+#include "EntityScriptServerLogging.h"
+
+// an engine has to be this much busier than another, in usecs per second, before a script is moved off it
+static const float MIN_MIGRATION_LOAD_DIFFERENCE = 0.1f * USECS_PER_SECOND;
+static const int NUM_HOTTEST_ENTITIES_IN_STATS = 10;
+static const int MAX_MOVED_SCRIPT_LOAD_ATTEMPTS = 3;
+
+EntityScriptEnginePool::EntityScriptEnginePool(EngineFactory engineFactory, int numEngines, Assignment assignment) :
+    _engineFactory(engineFactory),
+    _assignment(assignment)
+{
+    _lastSampleTime = usecTimestampNow();
+    setNumEngines(numEngines);
+}
+
+int EntityScriptEnginePool::getNumEngines() const {
+    QReadLocker locker(&_lock);
+    return (int)_engines.size();
+}
+
+void EntityScriptEnginePool::setNumEngines(int numEngines) {
+    numEngines = std::max(1, numEngines);
+
+    std::vector<ScriptEnginePointer> newEngines;
+    for (int i = getNumEngines(); i < numEngines; ++i) {
+        newEngines.push_back(_engineFactory());
+    }
+
+    std::vector<ScriptEnginePointer> removedEngines;
+    std::vector<std::pair<EntityItemID, ScriptEnginePointer>> movedEntities;
+    QHash<EntityItemID, QString> movedScripts;
+    {
+        QWriteLocker locker(&_lock);
+        for (auto& engine : newEngines) {
+            _engines.push_back(engine);
+            _engineLoads.emplace_back();
+            _engineLoads.back().lastScriptUsecs = engine->getEntityScriptUsecs();
+        }
+
+        if ((int)_engines.size() > numEngines) {
+            removedEngines.assign(_engines.begin() + numEngines, _engines.end());
+            for (auto it = _entities.cbegin(); it != _entities.cend(); ++it) {
+                if (it->movingToIndex >= 0) {
+                    // already unloaded from the engine it is on
+                    if (it->engineIndex >= numEngines || it->movingToIndex >= numEngines) {
+                        movedScripts[it.key()] = it->movingScript;
+                    }
+                } else if (it->engineIndex >= numEngines) {
+                    movedEntities.emplace_back(it.key(), _engines[it->engineIndex]);
+                }
+            }
+        }
+    }
+
+    if (removedEngines.empty()) {
+        return;
+    }
+
+    // the scripts are unloaded from the engines that go before they are loaded on those that stay
+    for (auto& movedEntity : movedEntities) {
+        EntityScriptDetails details;
+        if (movedEntity.second->getEntityScriptDetails(movedEntity.first, details)) {
+            movedScripts[movedEntity.first] = details.scriptText;
+        }
+    }
+    for (auto& engine : removedEngines) {
+        engine->unloadAllEntityScripts();
+        engine->stop();
+        engine->waitTillDoneRunning();
+    }
+
+    std::vector<std::pair<EntityItemID, ScriptEnginePointer>> loadedEntities;
+    {
+        QWriteLocker locker(&_lock);
+        _engines.resize(numEngines);
+        _engineLoads.resize(numEngines);
+
+        for (auto it = _entities.begin(); it != _entities.end(); ++it) {
+            bool wasMoving = it->movingToIndex >= 0;
+            if (it->engineIndex >= numEngines) {
+                if (wasMoving && it->movingToIndex < numEngines) {
+                    // it is already loading on an engine that stays
+                    it->engineIndex = it->movingToIndex;
+                } else {
+                    it->engineIndex = pickEngine(it.key());
+                    ++_engineLoads[it->engineIndex].numAssignedSinceSample;
+                }
+                ++_engineLoads[it->engineIndex].numEntities;
+                it->lastScriptUsecs = 0;
+            } else if (!wasMoving || it->movingToIndex < numEngines) {
+                continue;
+            }
+
+            // there is no engine left to go back to, so a script that fails to load is loaded again where it is
+            auto script = movedScripts.value(it.key());
+            if (script.isEmpty()) {
+                // nothing was loaded yet, it will be loaded on the engine it is assigned
+                it->movingToIndex = -1;
+                it->movingScript.clear();
+            } else if (it->movingToIndex != it->engineIndex) {
+                it->movingToIndex = it->engineIndex;
+                it->movingScript = script;
+                it->numLoadAttempts = 1;
+                loadedEntities.emplace_back(it.key(), _engines[it->engineIndex]);
+            }
+        }
+    }
+
+    qCDebug(entity_script_server) << "Moving" << loadedEntities.size() << "entity scripts off"
+        << removedEngines.size() << "script engines";
+    for (auto& loadedEntity : loadedEntities) {
+        loadedEntity.second->loadEntityScript(loadedEntity.first, movedScripts.value(loadedEntity.first), false);
+    }
+}
+
+ScriptEnginePointer EntityScriptEnginePool::getEngine(int index) const {
+    QReadLocker locker(&_lock);
+    return index >= 0 && index < (int)_engines.size() ? _engines[index] : ScriptEnginePointer();
+}
+
+ScriptEnginePointer EntityScriptEnginePool::engineForEntity(const EntityItemID& entityID) const {
+    QReadLocker locker(&_lock);
+    auto it = _entities.constFind(entityID);
+    if (it == _entities.constEnd() || it->engineIndex >= (int)_engines.size()) {
+        return ScriptEnginePointer();
+    }
+    return _engines[it->engineIndex];
+}
+
+int EntityScriptEnginePool::pickEngine(const EntityItemID& entityID) const {
+    int numEngines = (int)_engines.size();
+    if (_assignment == ByHash) {
+        return (int)(qHash(entityID) % (uint)numEngines);
+    }
+
+    // what the entities assigned since the last sample will likely add, guessing they are as busy as the average
+    float totalUsecsPerSecond = 0.0f;
+    int totalEntities = 0;
+    for (auto& engineLoad : _engineLoads) {
+        totalUsecsPerSecond += engineLoad.usecsPerSecond;
+        totalEntities += engineLoad.numEntities;
+    }
+    float averageEntityUsecsPerSecond = std::max(1.0f, totalEntities > 0 ? totalUsecsPerSecond / totalEntities : 0.0f);
+
+    int bestIndex = 0;
+    float bestLoad = std::numeric_limits<float>::max();
+    for (int i = 0; i < numEngines; ++i) {
+        auto& engineLoad = _engineLoads[i];
+        float load = engineLoad.usecsPerSecond + engineLoad.numAssignedSinceSample * averageEntityUsecsPerSecond;
+        if (load < bestLoad || (load == bestLoad && engineLoad.numEntities < _engineLoads[bestIndex].numEntities)) {
+            bestLoad = load;
+            bestIndex = i;
+        }
+    }
+    return bestIndex;
+}
+
+ScriptEnginePointer EntityScriptEnginePool::assignEngine(const EntityItemID& entityID) {
+    QWriteLocker locker(&_lock);
+    auto it = _entities.find(entityID);
+    if (it == _entities.end()) {
+        EntityLoad entityLoad;
+        entityLoad.engineIndex = pickEngine(entityID);
+        ++_engineLoads[entityLoad.engineIndex].numEntities;
+        ++_engineLoads[entityLoad.engineIndex].numAssignedSinceSample;
+        it = _entities.insert(entityID, entityLoad);
+    }
+    return _engines[it->engineIndex];
+}
+
+void EntityScriptEnginePool::unloadEntityScript(const EntityItemID& entityID) {
+    ScriptEnginePointer engine;
+    ScriptEnginePointer movingToEngine;
+    {
+        QWriteLocker locker(&_lock);
+        auto it = _entities.find(entityID);
+        if (it == _entities.end()) {
+            return;
+        }
+        engine = _engines[it->engineIndex];
+        if (it->movingToIndex >= 0 && it->movingToIndex != it->engineIndex) {
+            movingToEngine = _engines[it->movingToIndex];
+        }
+        --_engineLoads[it->engineIndex].numEntities;
+        _entities.erase(it);
+    }
+    engine->unloadEntityScript(entityID, true);
+    if (movingToEngine) {
+        movingToEngine->unloadEntityScript(entityID, true);
+    }
+}
+
+void EntityScriptEnginePool::moveEntityScript(const EntityItemID& entityID, int toEngineIndex) {
+    ScriptEnginePointer fromEngine;
+    ScriptEnginePointer toEngine;
+    {
+        QReadLocker locker(&_lock);
+        auto it = _entities.constFind(entityID);
+        if (it == _entities.constEnd() || it->engineIndex == toEngineIndex || it->movingToIndex >= 0) {
+            return;
+        }
+        fromEngine = _engines[it->engineIndex];
+        toEngine = _engines[toEngineIndex];
+    }
+
+    EntityScriptDetails details;
+    if (!fromEngine->getEntityScriptDetails(entityID, details) || details.scriptText.isEmpty()) {
+        return;
+    }
+
+    {
+        QWriteLocker locker(&_lock);
+        auto it = _entities.find(entityID);
+        if (it == _entities.end() || it->movingToIndex >= 0 || _engines[it->engineIndex] != fromEngine) {
+            return;
+        }
+        // it stays on its engine until it is running on the other, see finishMovingScripts()
+        it->movingToIndex = toEngineIndex;
+        it->movingScript = details.scriptText;
+        it->numLoadAttempts = 1;
+    }
+
+    fromEngine->unloadEntityScript(entityID, true);
+    toEngine->loadEntityScript(entityID, details.scriptText, false);
+}
+
+void EntityScriptEnginePool::finishMovingScripts() {
+    std::vector<std::pair<EntityItemID, ScriptEnginePointer>> movingEntities;
+    {
+        QReadLocker locker(&_lock);
+        for (auto it = _entities.cbegin(); it != _entities.cend(); ++it) {
+            if (it->movingToIndex >= 0) {
+                movingEntities.emplace_back(it.key(), _engines[it->movingToIndex]);
+            }
+        }
+    }
+
+    for (auto& movingEntity : movingEntities) {
+        auto& entityID = movingEntity.first;
+        EntityScriptDetails details;
+        if (!movingEntity.second->getEntityScriptDetails(entityID, details)) {
+            details.status = EntityScriptStatus::UNLOADED;
+        }
+        if (details.status == EntityScriptStatus::PENDING || details.status == EntityScriptStatus::LOADING) {
+            continue;
+        }
+
+        ScriptEnginePointer unloadEngine;
+        ScriptEnginePointer loadEngine;
+        QString script;
+        {
+            QWriteLocker locker(&_lock);
+            auto it = _entities.find(entityID);
+            if (it == _entities.end() || it->movingToIndex < 0 || _engines[it->movingToIndex] != movingEntity.second) {
+                continue;
+            }
+
+            if (details.status == EntityScriptStatus::RUNNING) {
+                if (it->movingToIndex != it->engineIndex) {
+                    --_engineLoads[it->engineIndex].numEntities;
+                    ++_engineLoads[it->movingToIndex].numEntities;
+                    it->engineIndex = it->movingToIndex;
+                    it->lastScriptUsecs = 0;
+                }
+                it->movingToIndex = -1;
+                it->movingScript.clear();
+                continue;
+            }
+
+            script = it->movingScript;
+            if (it->movingToIndex != it->engineIndex) {
+                qCWarning(entity_script_server) << "The script of" << entityID << "failed to load on script engine"
+                    << it->movingToIndex << "- loading it again on script engine" << it->engineIndex;
+                unloadEngine = movingEntity.second;
+                it->movingToIndex = it->engineIndex;
+                it->numLoadAttempts = 1;
+            } else if (it->numLoadAttempts < MAX_MOVED_SCRIPT_LOAD_ATTEMPTS) {
+                ++it->numLoadAttempts;
+            } else {
+                qCWarning(entity_script_server) << "The script of" << entityID << "failed to load on script engine"
+                    << it->engineIndex << "after" << it->numLoadAttempts << "attempts";
+                it->movingToIndex = -1;
+                it->movingScript.clear();
+                continue;
+            }
+            loadEngine = _engines[it->engineIndex];
+        }
+
+        if (unloadEngine) {
+            unloadEngine->unloadEntityScript(entityID, true);
+        }
+        loadEngine->loadEntityScript(entityID, script, false);
+    }
+}
+
+void EntityScriptEnginePool::callEntityScriptMethod(const EntityItemID& entityID, const QString& methodName,
+                                                    const QStringList& params, const QUuid& remoteCallerID) {
+    if (auto engine = engineForEntity(entityID)) {
+        engine->callEntityScriptMethod(entityID, methodName, params, remoteCallerID);
+    }
+}
+
+QFuture<QVariant> EntityScriptEnginePool::getLocalEntityScriptDetails(const EntityItemID& entityID) {
+    auto engine = engineForEntity(entityID);
+    if (!engine) {
+        // the first engine doesn't have it either, and says so
+        engine = getEngine(0);
+    }
+    return engine->getLocalEntityScriptDetails(entityID);
+}
+
+bool EntityScriptEnginePool::getEntityScriptDetails(const EntityItemID& entityID, EntityScriptDetails& details) const {
+    auto engine = engineForEntity(entityID);
+    return engine && engine->getEntityScriptDetails(entityID, details);
+}
+
+int EntityScriptEnginePool::getNumRunningEntityScripts() const {
+    int numRunningScripts = 0;
+    forEachEngine([&](const ScriptEnginePointer& engine) {
+        numRunningScripts += engine->getNumRunningEntityScripts();
+    });
+    return numRunningScripts;
+}
+
+void EntityScriptEnginePool::forEachEngine(std::function<void(const ScriptEnginePointer&)> function) const {
+    std::vector<ScriptEnginePointer> engines;
+    {
+        QReadLocker locker(&_lock);
+        engines = _engines;
+    }
+    for (auto& engine : engines) {
+        function(engine);
+    }
+}
+
+void EntityScriptEnginePool::stop() {
+    // do this here (instead of in deleter) to avoid marshalling unload signals back to this thread
+    forEachEngine([](const ScriptEnginePointer& engine) {
+        engine->unloadAllEntityScripts();
+        engine->stop();
+    });
+    forEachEngine([](const ScriptEnginePointer& engine) {
+        engine->waitTillDoneRunning();
+    });
+
+    QWriteLocker locker(&_lock);
+    _entities.clear();
+    for (auto& engineLoad : _engineLoads) {
+        engineLoad.numEntities = 0;
+        engineLoad.numAssignedSinceSample = 0;
+    }
+}
+
+void EntityScriptEnginePool::rebalance() {
+    finishMovingScripts();
+
+    auto now = usecTimestampNow();
+    float sampleSeconds = std::max(1.0f, (float)(now - _lastSampleTime)) / USECS_PER_SECOND;
+    _lastSampleTime = now;
+
+    QVector<EntityItemID> entityIDs;
+    {
+        QWriteLocker locker(&_lock);
+        for (size_t i = 0; i < _engines.size(); ++i) {
+            auto& engineLoad = _engineLoads[i];
+            auto scriptUsecs = _engines[i]->getEntityScriptUsecs();
+            engineLoad.usecsPerSecond = (scriptUsecs - engineLoad.lastScriptUsecs) / sampleSeconds;
+            engineLoad.lastScriptUsecs = scriptUsecs;
+            engineLoad.numAssignedSinceSample = 0;
+        }
+        entityIDs = _entities.keys().toVector();
+    }
+
+    // the details are read without our lock, the engines hold theirs while they're read
+    for (auto& entityID : entityIDs) {
+        EntityScriptDetails details;
+        if (!getEntityScriptDetails(entityID, details)) {
+            continue;
+        }
+
+        QWriteLocker locker(&_lock);
+        auto it = _entities.find(entityID);
+        if (it != _entities.end()) {
+            // a reloaded script starts counting over
+            auto lastScriptUsecs = std::min(it->lastScriptUsecs, details.scriptUsecs);
+            it->usecsPerSecond = (details.scriptUsecs - lastScriptUsecs) / sampleSeconds;
+            it->lastScriptUsecs = details.scriptUsecs;
+        }
+    }
+
+    if (_assignment != ByLoad) {
+        return;
+    }
+
+    // moving a script that takes less than the difference between the busiest and quietest engines evens them out,
+    // pick the one that leaves them closest
+    EntityItemID hottestEntityID;
+    int quietestIndex = 0;
+    {
+        QReadLocker locker(&_lock);
+        if (_engines.size() < 2) {
+            return;
+        }
+
+        int busiestIndex = 0;
+        for (int i = 1; i < (int)_engineLoads.size(); ++i) {
+            if (_engineLoads[i].usecsPerSecond > _engineLoads[busiestIndex].usecsPerSecond) {
+                busiestIndex = i;
+            }
+            if (_engineLoads[i].usecsPerSecond < _engineLoads[quietestIndex].usecsPerSecond) {
+                quietestIndex = i;
+            }
+        }
+
+        float loadDifference = _engineLoads[busiestIndex].usecsPerSecond - _engineLoads[quietestIndex].usecsPerSecond;
+        if (loadDifference < MIN_MIGRATION_LOAD_DIFFERENCE || _engineLoads[busiestIndex].numEntities < 2) {
+            return;
+        }
+
+        float bestRemainingDifference = loadDifference;
+        for (auto it = _entities.cbegin(); it != _entities.cend(); ++it) {
+            if (it->engineIndex == busiestIndex && it->movingToIndex < 0 && it->usecsPerSecond > 0.0f) {
+                float remainingDifference = std::abs(loadDifference - 2.0f * it->usecsPerSecond);
+                if (remainingDifference < bestRemainingDifference) {
+                    bestRemainingDifference = remainingDifference;
+                    hottestEntityID = it.key();
+                }
+            }
+        }
+    }
+
+    if (!hottestEntityID.isNull()) {
+        qCDebug(entity_script_server) << "Moving the script of" << hottestEntityID << "to script engine" << quietestIndex;
+        ++_numMigrations;
+        moveEntityScript(hottestEntityID, quietestIndex);
+    }
+}
+
+QJsonObject EntityScriptEnginePool::getStatsJSON() const {
+    QJsonObject statsObject;
+
+    QReadLocker locker(&_lock);
+    QJsonArray enginesArray;
+    for (size_t i = 0; i < _engines.size(); ++i) {
+        QJsonObject engineObject;
+        engineObject["number_running_scripts"] = _engines[i]->getNumRunningEntityScripts();
+        engineObject["number_entities"] = _engineLoads[i].numEntities;
+        engineObject["script_usecs_per_second"] = _engineLoads[i].usecsPerSecond;
+        enginesArray.append(engineObject);
+    }
+    statsObject["engines"] = enginesArray;
+    statsObject["assignment"] = _assignment == ByHash ? "hash" : "load";
+    statsObject["number_migrations"] = _numMigrations;
+
+    std::vector<std::pair<float, EntityItemID>> entityLoads;
+    for (auto it = _entities.cbegin(); it != _entities.cend(); ++it) {
+        entityLoads.emplace_back(it->usecsPerSecond, it.key());
+    }
+    auto numHottest = std::min((int)entityLoads.size(), NUM_HOTTEST_ENTITIES_IN_STATS);
+    std::partial_sort(entityLoads.begin(), entityLoads.begin() + numHottest, entityLoads.end(),
+                      [](const std::pair<float, EntityItemID>& a, const std::pair<float, EntityItemID>& b) {
+        return a.first > b.first;
+    });
+
+    QJsonObject hottestObject;
+    for (int i = 0; i < numHottest && entityLoads[i].first > 0.0f; ++i) {
+        hottestObject[uuidStringWithoutCurlyBraces(entityLoads[i].second)] = entityLoads[i].first;
+    }
+    statsObject["hottest_entities_usecs_per_second"] = hottestObject;
+
+    return statsObject;
+}
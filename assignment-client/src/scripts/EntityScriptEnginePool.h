@@ -0,0 +1,108 @@
+//
+//  EntityScriptEnginePool.h
+//  assignment-client/src/scripts
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityScriptEnginePool_h
+#define hifi_EntityScriptEnginePool_h
+
+#include <atomic>
+#include <functional>
+#include <vector>
+
+#include <QtCore/QHash>
+#include <QtCore/QJsonObject>
+#include <QtCore/QReadWriteLock>
+
+#include <EntitiesScriptEngineProvider.h>
+#include <ScriptEngine.h>
+
+// The script engines that server entity scripts run in, each on its own thread.  Each entity's script runs in one of
+// them, picked by a hash of the entity ID or by which engine is least busy.  With load assignment, rebalance() moves
+// the busiest engine's hottest script to the quietest engine, which reloads it there.  A moved script is only counted
+// on its new engine once it is running there, if it fails to load it is loaded again on the engine it came from.
+//
+// Engines are added, removed and assigned from the thread that owns the pool.  Calls to entity scripts may come from
+// any thread and are sent to the engine running the script.
+class EntityScriptEnginePool : public EntitiesScriptEngineProvider {
+public:
+    enum Assignment { ByHash, ByLoad };
+
+    using EngineFactory = std::function<ScriptEnginePointer()>;
+
+    EntityScriptEnginePool(EngineFactory engineFactory, int numEngines, Assignment assignment);
+
+    int getNumEngines() const;
+    // Shrinking the pool unloads the scripts of the engines that go and loads them on the others, loading those that
+    // fail again when the pool is next rebalanced.
+    void setNumEngines(int numEngines);
+    void setAssignment(Assignment assignment) { _assignment = assignment; }
+
+    ScriptEnginePointer getEngine(int index) const;
+    // The engine running this entity's script, if it has been assigned one.
+    ScriptEnginePointer engineForEntity(const EntityItemID& entityID) const;
+    // The engine to run this entity's script in, picking one if it has none.
+    ScriptEnginePointer assignEngine(const EntityItemID& entityID);
+    void unloadEntityScript(const EntityItemID& entityID);
+
+    void callEntityScriptMethod(const EntityItemID& entityID, const QString& methodName,
+                                const QStringList& params = QStringList(), const QUuid& remoteCallerID = QUuid()) override;
+    QFuture<QVariant> getLocalEntityScriptDetails(const EntityItemID& entityID) override;
+    bool getEntityScriptDetails(const EntityItemID& entityID, EntityScriptDetails& details) const;
+    int getNumRunningEntityScripts() const;
+
+    void forEachEngine(std::function<void(const ScriptEnginePointer&)> function) const;
+    // Unloads every script and stops the engines, blocking until they are done.
+    void stop();
+
+    // Finishes moving the scripts that have loaded since the last call, measures how busy the engines and scripts were,
+    // and with load assignment moves a script from the busiest engine to the quietest if that evens them out.
+    void rebalance();
+
+    QJsonObject getStatsJSON() const;
+
+private:
+    class EngineLoad {
+    public:
+        quint64 lastScriptUsecs { 0 };
+        float usecsPerSecond { 0.0f };
+        int numEntities { 0 };
+        int numAssignedSinceSample { 0 };
+    };
+
+    class EntityLoad {
+    public:
+        int engineIndex { 0 };
+        quint64 lastScriptUsecs { 0 };
+        float usecsPerSecond { 0.0f };
+
+        // while its script is moved: the engine loading it, which is engineIndex when there is none to go back to
+        int movingToIndex { -1 };
+        QString movingScript;
+        int numLoadAttempts { 0 };
+    };
+
+    int pickEngine(const EntityItemID& entityID) const;
+    void moveEntityScript(const EntityItemID& entityID, int toEngineIndex);
+    void finishMovingScripts();
+
+    EngineFactory _engineFactory;
+    std::atomic<Assignment> _assignment;
+
+    mutable QReadWriteLock _lock;
+    std::vector<ScriptEnginePointer> _engines;
+    std::vector<EngineLoad> _engineLoads;
+    QHash<EntityItemID, EntityLoad> _entities;
+
+    quint64 _lastSampleTime { 0 };
+    int _numMigrations { 0 };
+};
+
+using EntityScriptEnginePoolPointer = QSharedPointer<EntityScriptEnginePool>;
+
+#endif // hifi_EntityScriptEnginePool_h
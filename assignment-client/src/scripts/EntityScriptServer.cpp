@@ -125,7 +125,7 @@ void EntityScriptServer::handleEntityScriptGetStatusPacket(QSharedPointer<Receiv
         replyPacketList->writePrimitive(messageID);
 
         EntityScriptDetails details;
-        if (_entitiesScriptEngine->getEntityScriptDetails(entityID, details)) {
+        if (_entitiesScriptEngines && _entitiesScriptEngines->getEntityScriptDetails(entityID, details)) {
             replyPacketList->writePrimitive(true);
             replyPacketList->writePrimitive(details.status);
             replyPacketList->writeString(details.errorInfo);
@@ -156,6 +156,24 @@ void EntityScriptServer::handleSettings() {
 
     static const QString MAX_ENTITY_PPS_OPTION = "max_total_entity_pps";
     static const QString ENTITY_PPS_PER_SCRIPT = "entity_pps_per_script";
+    static const QString SCRIPT_ENGINES_OPTION = "script_engines";
+    static const QString SCRIPT_ENGINE_ASSIGNMENT_OPTION = "script_engine_assignment";
+
+    if (entityScriptServerSettings.contains(SCRIPT_ENGINES_OPTION)) {
+        _numEntitiesScriptEngines = std::max(1, entityScriptServerSettings[SCRIPT_ENGINES_OPTION].toInt());
+    }
+    if (entityScriptServerSettings.contains(SCRIPT_ENGINE_ASSIGNMENT_OPTION)) {
+        _entitiesScriptEngineAssignment = entityScriptServerSettings[SCRIPT_ENGINE_ASSIGNMENT_OPTION].toString() == "hash" ?
+            EntityScriptEnginePool::ByHash : EntityScriptEnginePool::ByLoad;
+    }
+
+    if (_entitiesScriptEngines && !_shuttingDown) {
+        _entitiesScriptEngines->setAssignment(_entitiesScriptEngineAssignment);
+        if (_entitiesScriptEngines->getNumEngines() != _numEntitiesScriptEngines) {
+            qDebug() << "Running server entity scripts in" << _numEntitiesScriptEngines << "script engines";
+            _entitiesScriptEngines->setNumEngines(_numEntitiesScriptEngines);
+        }
+    }
 
     if (!entityScriptServerSettings.contains(MAX_ENTITY_PPS_OPTION) || !entityScriptServerSettings.contains(ENTITY_PPS_PER_SCRIPT)) {
         qWarning() << "Received settings from the domain-server with no max_total_entity_pps or entity_pps_per_script properties.";
@@ -170,7 +188,11 @@ void EntityScriptServer::handleSettings() {
 }
 
 void EntityScriptServer::updateEntityPPS() {
-    int numRunningScripts = _entitiesScriptEngine->getNumRunningEntityScripts();
+    if (!_entitiesScriptEngines) {
+        return;
+    }
+
+    int numRunningScripts = _entitiesScriptEngines->getNumRunningEntityScripts();
     int pps;
     if (std::numeric_limits<int>::max() / _entityPPSPerScript < numRunningScripts) {
         qWarning() << QString("Integer multiplication would overflow, clamping to maxint: %1 * %2").arg(numRunningScripts).arg(_entityPPSPerScript);
@@ -231,7 +253,7 @@ void EntityScriptServer::pushLogs() {
 
 void EntityScriptServer::handleEntityScriptCallMethodPacket(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode) {
 
-    if (_entitiesScriptEngine && _entityViewer.getTree() && !_shuttingDown) {
+    if (_entitiesScriptEngines && _entityViewer.getTree() && !_shuttingDown) {
         auto entityID = QUuid::fromRfc4122(receivedMessage->read(NUM_BYTES_RFC4122_UUID));
 
         auto method = receivedMessage->readString();
@@ -245,7 +267,7 @@ void EntityScriptServer::handleEntityScriptCallMethodPacket(QSharedPointer<Recei
             params << paramString;
         }
 
-        _entitiesScriptEngine->callEntityScriptMethod(entityID, method, params, senderNode->getUUID());
+        _entitiesScriptEngines->callEntityScriptMethod(entityID, method, params, senderNode->getUUID());
     }
 }
 
@@ -276,8 +298,18 @@ void EntityScriptServer::run() {
         NodeType::EntityServer, NodeType::MessagesMixer, NodeType::AssetServer
     });
 
-    // Setup Script Engine
-    resetEntitiesScriptEngine();
+    // Setup Script Engines
+    resetEntitiesScriptEngines();
+
+    // move busy scripts to quieter engines
+    static const int REBALANCE_INTERVAL_MSECS = 5 * MSECS_PER_SECOND;
+    auto rebalanceTimer = new QTimer(this);
+    connect(rebalanceTimer, &QTimer::timeout, this, [this] {
+        if (_entitiesScriptEngines && !_shuttingDown) {
+            _entitiesScriptEngines->rebalance();
+        }
+    });
+    rebalanceTimer->start(REBALANCE_INTERVAL_MSECS);
 
     auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
     entityScriptingInterface->init();
@@ -439,7 +471,7 @@ void EntityScriptServer::selectAudioFormat(const QString& selectedCodecName) {
     }
 }
 
-void EntityScriptServer::resetEntitiesScriptEngine() {
+ScriptEnginePointer EntityScriptServer::createEntitiesScriptEngine() {
     auto engineName = QString("about:Entities %1").arg(++_entitiesScriptEngineCount);
     auto newEngine = scriptEngineFactory(ScriptEngine::ENTITY_SERVER_SCRIPT, NO_SCRIPT, engineName);
 
@@ -456,48 +488,49 @@ void EntityScriptServer::resetEntitiesScriptEngine() {
     connect(newEngine.data(), &ScriptEngine::warningMessage, scriptEngines, &ScriptEngines::onWarningMessage);
     connect(newEngine.data(), &ScriptEngine::infoMessage, scriptEngines, &ScriptEngines::onInfoMessage);
 
-    connect(newEngine.data(), &ScriptEngine::update, this, [this] {
+    connect(newEngine.data(), &ScriptEngine::entityScriptDetailsUpdated, this, &EntityScriptServer::updateEntityPPS);
+
+    scriptEngines->runScriptInitializers(newEngine);
+    newEngine->runInThread();
+    return newEngine;
+}
+
+void EntityScriptServer::resetEntitiesScriptEngines() {
+    auto newEngines = EntityScriptEnginePoolPointer::create([this] { return createEntitiesScriptEngine(); },
+                                                            _numEntitiesScriptEngines, _entitiesScriptEngineAssignment);
+
+    // the first engine's updates drive the entity tree for all of them
+    connect(newEngines->getEngine(0).data(), &ScriptEngine::update, this, [this] {
         _entityViewer.queryOctree();
         _entityViewer.getTree()->preUpdate();
         _entityViewer.getTree()->update();
     });
 
-    scriptEngines->runScriptInitializers(newEngine);
-    newEngine->runInThread();
-    auto newEngineSP = qSharedPointerCast<EntitiesScriptEngineProvider>(newEngine);
-    DependencyManager::get<EntityScriptingInterface>()->setEntitiesScriptEngine(newEngineSP);
-
-    if (_entitiesScriptEngine) {
-        disconnect(_entitiesScriptEngine.data(), &ScriptEngine::entityScriptDetailsUpdated,
-                   this, &EntityScriptServer::updateEntityPPS);
-    }
+    DependencyManager::get<EntityScriptingInterface>()->setEntitiesScriptEngine(newEngines);
 
-    _entitiesScriptEngine.swap(newEngine);
-    connect(_entitiesScriptEngine.data(), &ScriptEngine::entityScriptDetailsUpdated,
-            this, &EntityScriptServer::updateEntityPPS);
+    _entitiesScriptEngines.swap(newEngines);
 }
 
 
 void EntityScriptServer::clear() {
-    // unload and stop the engine
-    if (_entitiesScriptEngine) {
-        // do this here (instead of in deleter) to avoid marshalling unload signals back to this thread
-        _entitiesScriptEngine->unloadAllEntityScripts();
-        _entitiesScriptEngine->stop();
-        _entitiesScriptEngine->waitTillDoneRunning();
+    // unload and stop the engines
+    if (_entitiesScriptEngines) {
+        _entitiesScriptEngines->stop();
     }
 
     _entityViewer.clear();
 
-    // reset the engine
+    // reset the engines
     if (!_shuttingDown) {
-        resetEntitiesScriptEngine();
+        resetEntitiesScriptEngines();
     }
 }
 
 void EntityScriptServer::shutdownScriptEngine() {
-    if (_entitiesScriptEngine) {
-        _entitiesScriptEngine->disconnectNonEssentialSignals(); // disconnect all slots/signals from the script engine, except essential
+    if (_entitiesScriptEngines) {
+        _entitiesScriptEngines->forEachEngine([](const ScriptEnginePointer& engine) {
+            engine->disconnectNonEssentialSignals(); // disconnect all slots/signals from the script engine, except essential
+        });
     }
     _shuttingDown = true;
 
@@ -506,7 +539,7 @@ void EntityScriptServer::shutdownScriptEngine() {
     auto scriptEngines = DependencyManager::get<ScriptEngines>();
     scriptEngines->shutdownScripting();
 
-    _entitiesScriptEngine.clear();
+    _entitiesScriptEngines.clear();
 
     auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
     // our entity tree is going to go away so tell that to the EntityScriptingInterface
@@ -524,8 +557,8 @@ void EntityScriptServer::addingEntity(const EntityItemID& entityID) {
 }
 
 void EntityScriptServer::deletingEntity(const EntityItemID& entityID) {
-    if (_entityViewer.getTree() && !_shuttingDown && _entitiesScriptEngine) {
-        _entitiesScriptEngine->unloadEntityScript(entityID, true);
+    if (_entityViewer.getTree() && !_shuttingDown && _entitiesScriptEngines) {
+        _entitiesScriptEngines->unloadEntityScript(entityID);
     }
 }
 
@@ -536,20 +569,20 @@ void EntityScriptServer::entityServerScriptChanging(const EntityItemID& entityID
 }
 
 void EntityScriptServer::checkAndCallPreload(const EntityItemID& entityID, bool forceRedownload) {
-    if (_entityViewer.getTree() && !_shuttingDown && _entitiesScriptEngine) {
+    if (_entityViewer.getTree() && !_shuttingDown && _entitiesScriptEngines) {
 
         EntityItemPointer entity = _entityViewer.getTree()->findEntityByEntityItemID(entityID);
         EntityScriptDetails details;
-        bool isRunning = _entitiesScriptEngine->getEntityScriptDetails(entityID, details);
+        bool isRunning = _entitiesScriptEngines->getEntityScriptDetails(entityID, details);
         if (entity && (forceRedownload || !isRunning || details.scriptText != entity->getServerScripts())) {
             if (isRunning) {
-                _entitiesScriptEngine->unloadEntityScript(entityID, true);
+                _entitiesScriptEngines->unloadEntityScript(entityID);
             }
 
             QString scriptUrl = entity->getServerScripts();
             if (!scriptUrl.isEmpty()) {
                 scriptUrl = DependencyManager::get<ResourceManager>()->normalizeURL(scriptUrl);
-                _entitiesScriptEngine->loadEntityScript(entityID, scriptUrl, forceRedownload);
+                _entitiesScriptEngines->assignEngine(entityID)->loadEntityScript(entityID, scriptUrl, forceRedownload);
             }
         }
     }
@@ -566,9 +599,10 @@ void EntityScriptServer::sendStatsPacket() {
 
     QJsonObject scriptEngineStats;
     int numberRunningScripts = 0;
-    const auto scriptEngine = _entitiesScriptEngine;
-    if (scriptEngine) {
-        numberRunningScripts = scriptEngine->getNumRunningEntityScripts();
+    const auto scriptEngines = _entitiesScriptEngines;
+    if (scriptEngines) {
+        numberRunningScripts = scriptEngines->getNumRunningEntityScripts();
+        scriptEngineStats = scriptEngines->getStatsJSON();
     }
     scriptEngineStats["number_running_scripts"] = numberRunningScripts;
     statsObject["script_engine_stats"] = scriptEngineStats;
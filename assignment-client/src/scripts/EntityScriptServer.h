@@ -24,6 +24,7 @@
 #include <SimpleEntitySimulation.h>
 #include <ThreadedAssignment.h>
 #include "../entities/EntityTreeHeadlessViewer.h"
+#include "EntityScriptEnginePool.h"
 
 class EntityScriptServer : public ThreadedAssignment {
     Q_OBJECT
@@ -61,7 +62,8 @@ private:
     void negotiateAudioFormat();
     void selectAudioFormat(const QString& selectedCodecName);
 
-    void resetEntitiesScriptEngine();
+    ScriptEnginePointer createEntitiesScriptEngine();
+    void resetEntitiesScriptEngines();
     void clear();
     void shutdownScriptEngine();
 
@@ -75,7 +77,9 @@ private:
     bool _shuttingDown { false };
 
     static int _entitiesScriptEngineCount;
-    ScriptEnginePointer _entitiesScriptEngine;
+    EntityScriptEnginePoolPointer _entitiesScriptEngines;
+    int _numEntitiesScriptEngines { 1 };
+    EntityScriptEnginePool::Assignment _entitiesScriptEngineAssignment { EntityScriptEnginePool::ByLoad };
     SimpleEntitySimulationPointer _entitySimulation;
     EntityEditPacketSender _entityEditSender;
     EntityTreeHeadlessViewer _entityViewer;
@@ -17,6 +17,16 @@ macro(TARGET_BULLET)
         list(APPEND BULLET_LIBRARIES ${LIB_DIR}/libBulletSoftBody.a)
     else()
         find_package(Bullet REQUIRED)
+        # a bullet built with BULLET2_MULTITHREADING needs its headers compiled with BT_THREADSAFE everywhere,
+        # so the definition is carried by a target that is linked with bullet and passed on to whatever links to it.
+        # Our bullet3 port marks such a build, the prebuilt Windows and OS X dependency archives predate that
+        if (NOT TARGET bullet-threadsafe)
+            add_library(bullet-threadsafe INTERFACE)
+            if (EXISTS "${BULLET_INCLUDE_DIR}/../../share/bullet3/threadsafe")
+                target_compile_definitions(bullet-threadsafe INTERFACE BT_THREADSAFE=1)
+            endif()
+        endif()
+        list(APPEND BULLET_LIBRARIES bullet-threadsafe)
    endif()
     # perform the system include hack for OS X to ignore warnings
     if (APPLE)
@@ -44,12 +44,16 @@ vcpkg_configure_cmake(
         -DBUILD_CPU_DEMOS=OFF
         -DBUILD_EXTRAS=OFF
         -DBUILD_UNIT_TESTS=OFF
+        -DBULLET2_MULTITHREADING=ON
         -DBUILD_SHARED_LIBS=ON
         -DINSTALL_LIBS=ON
 )
 
 vcpkg_install_cmake()
 
+# tells target_bullet() that this bullet is built with BULLET2_MULTITHREADING, so its headers need BT_THREADSAFE
+file(WRITE ${CURRENT_PACKAGES_DIR}/share/bullet3/threadsafe "BT_THREADSAFE=1\n")
+
 file(REMOVE_RECURSE ${CURRENT_PACKAGES_DIR}/lib/cmake)
 file(REMOVE_RECURSE ${CURRENT_PACKAGES_DIR}/debug/lib/cmake)
 file(REMOVE_RECURSE ${CURRENT_PACKAGES_DIR}/debug/include)
@@ -683,6 +683,7 @@ bool DomainServer::isPacketVerified(const udt::Packet& packet) {
 void DomainServer::setupNodeListAndAssignments() {
     const QString CUSTOM_LOCAL_PORT_OPTION = "metaverse.local_port";
     static const QString ENABLE_PACKET_AUTHENTICATION = "metaverse.enable_packet_verification";
+    static const QString PACKET_AUTHENTICATION_METHOD = "metaverse.packet_verification_method";
 
     QVariant localPortValue = _settingsManager.valueOrDefaultValueForKeyPath(CUSTOM_LOCAL_PORT_OPTION);
     int domainServerPort = localPortValue.toInt();
@@ -752,6 +753,10 @@ void DomainServer::setupNodeListAndAssignments() {
     bool isAuthEnabled = _settingsManager.valueOrDefaultValueForKeyPath(ENABLE_PACKET_AUTHENTICATION).toBool();
     nodeList->setAuthenticatePackets(isAuthEnabled);
 
+    // every node hashes with what the domain list tells it, so this has to be set before any node is added
+    QString authMethod = _settingsManager.valueOrDefaultValueForKeyPath(PACKET_AUTHENTICATION_METHOD).toString();
+    nodeList->setAuthenticationMethod(authMethod == "siphash" ? HMACAuth::SIPHASH : HMACAuth::MD5);
+
     connect(nodeList.data(), &LimitedNodeList::nodeAdded, this, &DomainServer::nodeAdded);
     connect(nodeList.data(), &LimitedNodeList::nodeKilled, this, &DomainServer::nodeKilled);
     connect(nodeList.data(), &LimitedNodeList::localSockAddrChanged, this,
@@ -1068,6 +1073,8 @@ void DomainServer::populateDefaultStaticAssignmentsExcludingTypes(const QSet<Ass
 }
 
 void DomainServer::processListRequestPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode) {
+    auto processingStart = p_high_resolution_clock::now();
+
     QDataStream packetStream(message->getMessage());
     NodeConnectionData nodeRequestData = NodeConnectionData::fromDataStream(packetStream, message->getSenderSockAddr(), false);
 
@@ -1099,7 +1106,17 @@ void DomainServer::processListRequestPacket(QSharedPointer<ReceivedMessage> mess
     // client-side send time of last connect/domain list request
     nodeData->setLastDomainCheckinTimestamp(nodeRequestData.lastPingTimestamp);
 
+    // the sockets may have changed, so may what other nodes are sent about this one
+    refreshListRecordForNode(sendingNode);
+
+    nodeData->acknowledgeListVersion(nodeRequestData.domainListVersion);
+
     sendDomainListToNode(sendingNode, message->getFirstPacketReceiveTime(), message->getSenderSockAddr(), false);
+
+    auto processingUsecs = (quint64)duration_cast<microseconds>(p_high_resolution_clock::now() - processingStart).count();
+    ++_checkInStats.numCheckIns;
+    _checkInStats.totalProcessingUsecs += processingUsecs;
+    _checkInStats.maxProcessingUsecs = std::max(_checkInStats.maxProcessingUsecs, processingUsecs);
 }
 
 bool DomainServer::isInInterestSet(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB) {
@@ -1164,6 +1181,9 @@ QUrl DomainServer::oauthAuthorizationURL(const QUuid& stateUUID) {
 void DomainServer::handleConnectedNode(SharedNodePointer newNode, quint64 requestReceiveTime) {
     DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(newNode->getLinkedData());
 
+    // the node has none of the domain list yet
+    nodeData->resetListVersions();
+
     // reply back to the user with a PacketType::DomainList
     sendDomainListToNode(newNode, requestReceiveTime, nodeData->getSendingSockAddr(), true);
 
@@ -1177,13 +1197,15 @@ void DomainServer::handleConnectedNode(SharedNodePointer newNode, quint64 reques
         newNode->setIsReplicated(true);
     }
 
+    refreshListRecordForNode(newNode);
+
     // send out this node to our other connected nodes
     broadcastNewNode(newNode);
 }
 
 void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 requestPacketReceiveTime, const HifiSockAddr &senderSockAddr, bool newConnection) {
     const int NUM_DOMAIN_LIST_EXTENDED_HEADER_BYTES = NUM_BYTES_RFC4122_UUID + NLPacket::NUM_BYTES_LOCALID +
-        NUM_BYTES_RFC4122_UUID + NLPacket::NUM_BYTES_LOCALID + 4;
+        NUM_BYTES_RFC4122_UUID + NLPacket::NUM_BYTES_LOCALID + 5;
 
     // setup the extended header for the domain list packets
     // this data is at the beginning of each of the domain list packets
@@ -1192,45 +1214,96 @@ void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 r
     DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
     auto limitedNodeList = DependencyManager::get<LimitedNodeList>();
 
+    auto& nodeInterestSet = nodeData->getNodeInterestSet();
+
+    // a node that has a list we know the contents of, and still wants the same types of nodes,
+    // is only sent what changed since that list
+    quint64 baseListVersion = 0;
+    if (!newConnection && nodeData->getAckedListVersion() != 0 && nodeData->getAckedListInterestSet() == nodeInterestSet) {
+        baseListVersion = nodeData->getAckedListVersion();
+    }
+
+    const auto& ackedListRecords = nodeData->getAckedListRecords();
+    DomainServerNodeData::ListRecordVersions listRecords;
+    QVector<SharedNodePointer> changedNodes;
+    QVector<QUuid> removedNodes;
+
+    if (baseListVersion == _domainListVersion) {
+        // nothing has changed since the list this node has
+        listRecords = ackedListRecords;
+    } else if (nodeInterestSet.size() > 0 && nodeData->isAuthenticated()) {
+        // DTLSServerSession* dtlsSession = _isUsingDTLS ? _dtlsSessions[senderSockAddr] : NULL;
+        // if this authenticated node has any interest types, send back those nodes as well
+        limitedNodeList->eachNode([&](const SharedNodePointer& otherNode) {
+            auto otherNodeData = static_cast<DomainServerNodeData*>(otherNode->getLinkedData());
+            if (otherNodeData && otherNode->getUUID() != node->getUUID() && isInInterestSet(node, otherNode)) {
+                if (otherNodeData->getListRecordVersion() == 0) {
+                    refreshListRecordForNode(otherNode);
+                }
+
+                auto listRecordVersion = otherNodeData->getListRecordVersion();
+                listRecords.insert(otherNode->getUUID(), listRecordVersion);
+
+                if (baseListVersion == 0 || ackedListRecords.value(otherNode->getUUID()) != listRecordVersion) {
+                    changedNodes.push_back(otherNode);
+                }
+            }
+        });
+    }
+
+    if (baseListVersion != 0) {
+        for (auto it = ackedListRecords.cbegin(); it != ackedListRecords.cend(); ++it) {
+            if (!listRecords.contains(it.key())) {
+                removedNodes.push_back(it.key());
+            }
+        }
+    }
+
     extendedHeaderStream << limitedNodeList->getSessionUUID();
     extendedHeaderStream << limitedNodeList->getSessionLocalID();
     extendedHeaderStream << node->getUUID();
     extendedHeaderStream << node->getLocalID();
     extendedHeaderStream << node->getPermissions();
     extendedHeaderStream << limitedNodeList->getAuthenticatePackets();
+    extendedHeaderStream << quint8(limitedNodeList->getAuthenticationMethod());
     extendedHeaderStream << nodeData->getLastDomainCheckinTimestamp();
     extendedHeaderStream << quint64(duration_cast<microseconds>(system_clock::now().time_since_epoch()).count());
     extendedHeaderStream << quint64(duration_cast<microseconds>(p_high_resolution_clock::now().time_since_epoch()).count()) - requestPacketReceiveTime;
     extendedHeaderStream << newConnection;
+    extendedHeaderStream << _domainListVersion;
+    extendedHeaderStream << baseListVersion;
     auto domainListPackets = NLPacketList::create(PacketType::DomainList, extendedHeader);
 
     // always send the node their own UUID back
     QDataStream domainListStream(domainListPackets.get());
 
-    // store the nodeInterestSet on this DomainServerNodeData, in case it has changed
-    auto& nodeInterestSet = nodeData->getNodeInterestSet();
+    domainListStream << (quint32)removedNodes.size();
+    for (const auto& removedNode : removedNodes) {
+        domainListStream << removedNode;
+    }
 
-    if (nodeInterestSet.size() > 0) {
+    for (const auto& otherNode : changedNodes) {
+        // since we're about to add a node to the packet we start a segment
+        domainListPackets->startSegment();
 
-        // DTLSServerSession* dtlsSession = _isUsingDTLS ? _dtlsSessions[senderSockAddr] : NULL;
-        if (nodeData->isAuthenticated()) {
-            // if this authenticated node has any interest types, send back those nodes as well
-            limitedNodeList->eachNode([this, node, &domainListPackets, &domainListStream](const SharedNodePointer& otherNode) {
-                if (otherNode->getUUID() != node->getUUID() && isInInterestSet(node, otherNode)) {
-                    // since we're about to add a node to the packet we start a segment
-                    domainListPackets->startSegment();
+        // the node as we last saw it, written when it last checked in
+        domainListPackets->write(static_cast<DomainServerNodeData*>(otherNode->getLinkedData())->getListRecord());
+
+        // pack the secret that these two nodes will use to communicate with each other
+        domainListStream << connectionSecretForNodes(node, otherNode);
 
-                    // don't send avatar nodes to other avatars, that will come from avatar mixer
-                    domainListStream << *otherNode.data();
+        // we've added the node we wanted so end the segment now
+        domainListPackets->endSegment();
+    }
 
-                    // pack the secret that these two nodes will use to communicate with each other
-                    domainListStream << connectionSecretForNodes(node, otherNode);
+    nodeData->setSentList(_domainListVersion, std::move(listRecords), nodeInterestSet);
 
-                    // we've added the node we wanted so end the segment now
-                    domainListPackets->endSegment();
-                }
-            });
-        }
+    if (baseListVersion == 0) {
+        ++_checkInStats.numFullLists;
+        _checkInStats.fullListBytes += domainListPackets->getDataSize();
+    } else {
+        ++_checkInStats.numDeltaLists;
+        _checkInStats.deltaListBytes += domainListPackets->getDataSize();
     }
 
     // send an empty list to the node, in case there were no other nodes
@@ -1240,6 +1313,35 @@ void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 r
     limitedNodeList->sendPacketList(std::move(domainListPackets), *node);
 }
 
+void DomainServer::refreshListRecordForNode(const SharedNodePointer& node) {
+    auto nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
+    if (!nodeData) {
+        return;
+    }
+
+    QByteArray listRecord;
+    QDataStream listRecordStream(&listRecord, QIODevice::WriteOnly);
+    listRecordStream << *node.data();
+
+    if (nodeData->setListRecord(listRecord, _domainListVersion + 1)) {
+        ++_domainListVersion;
+    }
+}
+
+QJsonObject DomainServer::checkInStatsJSON() const {
+    QJsonObject statsObject;
+    statsObject["domain_list_version"] = (double)_domainListVersion;
+    statsObject["check_ins"] = (double)_checkInStats.numCheckIns;
+    statsObject["average_check_in_usecs"] = _checkInStats.numCheckIns == 0 ? 0.0 :
+        (double)_checkInStats.totalProcessingUsecs / _checkInStats.numCheckIns;
+    statsObject["max_check_in_usecs"] = (double)_checkInStats.maxProcessingUsecs;
+    statsObject["full_lists"] = (double)_checkInStats.numFullLists;
+    statsObject["full_list_bytes"] = (double)_checkInStats.fullListBytes;
+    statsObject["delta_lists"] = (double)_checkInStats.numDeltaLists;
+    statsObject["delta_list_bytes"] = (double)_checkInStats.deltaListBytes;
+    return statsObject;
+}
+
 QUuid DomainServer::connectionSecretForNodes(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB) {
     DomainServerNodeData* nodeAData = static_cast<DomainServerNodeData*>(nodeA->getLinkedData());
     DomainServerNodeData* nodeBData = static_cast<DomainServerNodeData*>(nodeB->getLinkedData());
@@ -2147,6 +2249,11 @@ bool DomainServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
             QJsonDocument transactionsDocument(rootObject);
             connection->respond(HTTPConnection::StatusCode200, transactionsDocument.toJson(), qPrintable(JSON_MIME_TYPE));
 
+            return true;
+        } else if (url.path() == "/check_ins.json") {
+            QJsonDocument statsDocument(checkInStatsJSON());
+            connection->respond(HTTPConnection::StatusCode200, statsDocument.toJson(), qPrintable(JSON_MIME_TYPE));
+
             return true;
         } else if (url.path() == QString("%1.json").arg(URI_NODES)) {
             // setup the JSON
@@ -3098,6 +3205,9 @@ void DomainServer::nodeKilled(SharedNodePointer node) {
     // if this peer connected via ICE then remove them from our ICE peers hash
     _gatekeeper.cleanupICEPeerForNode(node->getUUID());
 
+    // the nodes that were sent this one need to hear that it's gone
+    ++_domainListVersion;
+
     DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
 
     if (nodeData) {
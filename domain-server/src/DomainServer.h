@@ -182,6 +182,8 @@ private:
     void broadcastNodeDisconnect(const SharedNodePointer& disconnnectedNode);
 
     void sendDomainListToNode(const SharedNodePointer& node, quint64 requestPacketReceiveTime, const HifiSockAddr& senderSockAddr, bool newConnection);
+    void refreshListRecordForNode(const SharedNodePointer& node);
+    QJsonObject checkInStatsJSON() const;
 
     bool isInInterestSet(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB);
 
@@ -252,6 +254,21 @@ private:
 
     std::unordered_map<QUuid, QByteArray> _ephemeralACScripts;
 
+    // bumped whenever a node's list record changes or a node leaves, nodes are sent the changes between versions
+    quint64 _domainListVersion { 1 };
+
+    class CheckInStats {
+    public:
+        quint64 numCheckIns { 0 };
+        quint64 totalProcessingUsecs { 0 };
+        quint64 maxProcessingUsecs { 0 };
+        quint64 numFullLists { 0 };
+        quint64 numDeltaLists { 0 };
+        quint64 fullListBytes { 0 };
+        quint64 deltaListBytes { 0 };
+    };
+    CheckInStats _checkInStats;
+
     QSet<QUuid> _webAuthenticationStateSet;
     QHash<QUuid, DomainServerWebSessionData> _cookieSessionHash;
 
@@ -31,6 +31,48 @@ void DomainServerNodeData::updateJSONStats(QByteArray statsByteArray) {
     _statsJSONObject = overrideValuesIfNeeded(document.object());
 }
 
+bool DomainServerNodeData::setListRecord(const QByteArray& listRecord, quint64 listVersion) {
+    if (_listRecordVersion != 0 && listRecord == _listRecord) {
+        return false;
+    }
+
+    _listRecord = listRecord;
+    _listRecordVersion = listVersion;
+    return true;
+}
+
+void DomainServerNodeData::setSentList(quint64 listVersion, ListRecordVersions listRecords, const NodeSet& interestSet) {
+    _sentListVersion = listVersion;
+    _sentListRecords = std::move(listRecords);
+    _sentListInterestSet = interestSet;
+}
+
+void DomainServerNodeData::acknowledgeListVersion(quint64 listVersion) {
+    if (listVersion == _ackedListVersion) {
+        return;
+    }
+
+    if (listVersion != 0 && listVersion == _sentListVersion) {
+        _ackedListVersion = _sentListVersion;
+        _ackedListRecords = _sentListRecords;
+        _ackedListInterestSet = _sentListInterestSet;
+    } else {
+        // the node has a list we don't know the contents of, it will need a full one
+        _ackedListVersion = 0;
+        _ackedListRecords.clear();
+        _ackedListInterestSet.clear();
+    }
+}
+
+void DomainServerNodeData::resetListVersions() {
+    _ackedListVersion = 0;
+    _ackedListRecords.clear();
+    _ackedListInterestSet.clear();
+    _sentListVersion = 0;
+    _sentListRecords.clear();
+    _sentListInterestSet.clear();
+}
+
 QJsonObject DomainServerNodeData::overrideValuesIfNeeded(const QJsonObject& newStats) {
     QJsonObject result;
     for (auto it = newStats.constBegin(); it != newStats.constEnd(); ++it) {
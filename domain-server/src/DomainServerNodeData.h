@@ -75,7 +75,26 @@ public:
 
     bool hasCheckedIn() const { return _hasCheckedIn; }
     void setHasCheckedIn(bool hasCheckedIn) { _hasCheckedIn = hasCheckedIn; }
-    
+
+    // This node as it is written into the domain lists sent to other nodes, and the domain list version it last changed at.
+    const QByteArray& getListRecord() const { return _listRecord; }
+    quint64 getListRecordVersion() const { return _listRecordVersion; }
+    // Returns false and keeps the older version if the record is unchanged.
+    bool setListRecord(const QByteArray& listRecord, quint64 listVersion);
+
+    // The record versions of the nodes this node was sent in its domain lists, by node UUID
+    using ListRecordVersions = QHash<QUuid, quint64>;
+
+    // What this node has acknowledged having of the domain list, deltas are made against it
+    quint64 getAckedListVersion() const { return _ackedListVersion; }
+    const ListRecordVersions& getAckedListRecords() const { return _ackedListRecords; }
+    const NodeSet& getAckedListInterestSet() const { return _ackedListInterestSet; }
+
+    // What was last sent to this node, which becomes what it has once it acknowledges the version
+    void setSentList(quint64 listVersion, ListRecordVersions listRecords, const NodeSet& interestSet);
+    void acknowledgeListVersion(quint64 listVersion);
+    void resetListVersions();
+
 private:
     QJsonObject overrideValuesIfNeeded(const QJsonObject& newStats);
     QJsonArray overrideValuesIfNeeded(const QJsonArray& newStats);
@@ -102,6 +121,16 @@ private:
     bool _wasAssigned { false };
 
     bool _hasCheckedIn { false };
+
+    QByteArray _listRecord;
+    quint64 _listRecordVersion { 0 };
+
+    quint64 _ackedListVersion { 0 };
+    ListRecordVersions _ackedListRecords;
+    NodeSet _ackedListInterestSet;
+    quint64 _sentListVersion { 0 };
+    ListRecordVersions _sentListRecords;
+    NodeSet _sentListInterestSet;
 };
 
 #endif // hifi_DomainServerNodeData_h
@@ -29,6 +29,7 @@ public:
     HifiSockAddr senderSockAddr;
     QList<NodeType_t> interestList;
     QString placeName;
+    quint64 domainListVersion { 0 }; // the domain list version the node has, list requests only
     QString hardwareAddress;
     QUuid machineFingerprint;
     QString SystemInfo;
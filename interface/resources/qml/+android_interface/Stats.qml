@@ -121,6 +121,15 @@ Item {
                         visible: root.expanded
                         text: "Avatars NOT Updated: " + root.notUpdatedAvatarCount
                     }
+                    StatText {
+                        visible: root.expanded
+                        text: "Avatar Anim LOD Full/Reduced/Minimal: " + root.fullAnimAvatarCount + "/" +
+                            root.reducedAnimAvatarCount + "/" + root.minimalAnimAvatarCount
+                    }
+                    StatText {
+                        visible: root.expanded
+                        text: "Avatar Rigs: " + root.avatarRigTime.toFixed(1) + " ms"
+                    }
                 }
             }
 
@@ -1492,6 +1492,13 @@ Application::Application(int& argc, char** argv, QElapsedTimer& startupTimer, bo
     }
     ResourceCache::setRequestLimit(concurrentDownloads);
 
+    // let content-heavy domains spread the physics step (narrowphase and island solving) over several threads
+    QString physicsThreadsStr = getCmdOption(argc, constArgv, "--physics-threads");
+    int physicsThreads = physicsThreadsStr.toInt(&success);
+    if (success && physicsThreads > 0) {
+        PhysicsEngine::setNumSimulationThreads(physicsThreads);
+    }
+
     // perhaps override the avatar url.  Since we will test later for validity
     // we don't need to do so here.
     QString avatarURL = getCmdOption(argc, constArgv, "--avatarURL");
@@ -5583,10 +5590,20 @@ void Application::init() {
             return 0.0f;
         }
 
-        auto distance = glm::distance(getMyAvatar()->getWorldPosition(), item.getWorldPosition());
-        return atan2(maxSize, distance);
+        auto offset = item.getWorldPosition() - _myCamera.getPosition();
+        auto distance = glm::length(offset);
+        float angularSize = atan2(maxSize, distance);
+
+        // what the camera is looking at should finish before what is behind it
+        const float BEHIND_CAMERA_PRIORITY_SCALE = 0.25f;
+        float facing = 1.0f;
+        if (distance > maxSize) {
+            facing = glm::dot(offset / distance, _myCamera.getOrientation() * Vectors::FRONT);
+        }
+        return angularSize * glm::mix(BEHIND_CAMERA_PRIORITY_SCALE, 1.0f, 0.5f * (facing + 1.0f));
     });
 
+    _shapeManager.enableShapeCache("shape_cache");
     ObjectMotionState::setShapeManager(&_shapeManager);
     _physicsEngine->init();
 
@@ -6214,6 +6231,9 @@ void Application::update(float deltaTime) {
         if (!domainLoadingInProgress) {
             PROFILE_ASYNC_BEGIN(app, "Scene Loading", "");
             domainLoadingInProgress = true;
+            _domainLoadStartTime = usecTimestampNow();
+            _domainLoadStartBytes = ResourceCache::getBytesDownloaded();
+            _awaitingVisualCompleteness = true;
         }
 
         // we haven't yet enabled physics.  we wait until we think we have all the collision information
@@ -6235,6 +6255,15 @@ void Application::update(float deltaTime) {
         PROFILE_ASYNC_END(app, "Scene Loading", "");
     }
 
+    if (_physicsEnabled && _awaitingVisualCompleteness &&
+        ResourceCache::getPendingRequestCount() == 0 && ResourceCache::getLoadingRequestCount() == 0) {
+        _awaitingVisualCompleteness = false;
+        _timeToVisualCompleteness = (int)((usecTimestampNow() - _domainLoadStartTime) / USECS_PER_MSEC);
+        qCDebug(interfaceapp) << "Domain" << DependencyManager::get<NodeList>()->getDomainHandler().getHostname()
+            << "visually complete after" << _timeToVisualCompleteness << "ms,"
+            << (ResourceCache::getBytesDownloaded() - _domainLoadStartBytes) / BYTES_PER_KILOBYTE << "KB downloaded";
+    }
+
     auto myAvatar = getMyAvatar();
     {
         PerformanceTimer perfTimer("devices");
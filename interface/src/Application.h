@@ -201,6 +201,7 @@ public:
 
     size_t getRenderFrameCount() const { return _graphicsEngine.getRenderFrameCount(); }
     float getRenderLoopRate() const { return _graphicsEngine.getRenderLoopRate(); }
+    int getTimeToVisualCompleteness() const { return _timeToVisualCompleteness; } // msecs, -1 until a domain has loaded
     float getNumCollisionObjects() const;
     float getTargetRenderFrameRate() const; // frames/second
 
@@ -748,6 +749,12 @@ private:
     bool _physicsEnabled { false };
     bool _failedToConnectToEntityServer { false };
 
+    // time from starting to load a domain until it has landed and every download queued for it has finished
+    quint64 _domainLoadStartTime { 0 };
+    uint64_t _domainLoadStartBytes { 0 };
+    bool _awaitingVisualCompleteness { false };
+    int _timeToVisualCompleteness { -1 };
+
     bool _reticleClickPressed { false };
     bool _keyboardFocusWaitingOnRenderable { false };
 
@@ -15,6 +15,8 @@
 
 #include <QScriptEngine>
 
+#include <tbb/parallel_for.h>
+
 #include "AvatarLogging.h"
 
 #if defined(__GNUC__) && !defined(__clang__)
@@ -292,6 +294,11 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
     int numHerosUpdated = 0;
     int numAvatarsUpdated = 0;
     int numAvatarsNotUpdated = 0;
+    std::array<int, OtherAvatar::NumAnimLODs> numAvatarsPerAnimLOD {{ 0 }};
+    uint64_t rigTime = 0;
+    std::vector<OtherAvatar*> posedAvatars;
+    // heroes have their LOD and joint update settled once, even those the crowd pass takes over
+    std::unordered_set<OtherAvatar*> heroAvatars;
 
     render::Transaction renderTransaction;
     workload::Transaction workloadTransaction;
@@ -303,6 +310,32 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
 
         auto passExpiry = updatePriorityExpiries[p];
 
+        // Pick each avatar's animation LOD and find the rigs that are due for new joints, which are posed in parallel
+        // below, a batch at a time as the budget allows.  The rest of OtherAvatar::simulate() touches shared state, so it
+        // stays on this thread.
+        _avatarsToPose.clear();
+        for (const auto& sortData : sortedAvatarVector) {
+            const auto avatar = std::static_pointer_cast<OtherAvatar>(sortData.getAvatar());
+            bool needsPose;
+            if (p != kHero && heroAvatars.count(avatar.get()) > 0) {
+                // a hero the hero budget ran out on: its LOD was picked and counted in the hero pass, and it may have
+                // been posed there in a batch ahead of the cut off
+                needsPose = avatar->_jointUpdateDue && !avatar->_rigPosed;
+            } else {
+                avatar->computeAnimLOD(views);
+                numAvatarsPerAnimLOD[avatar->getAnimLOD()]++;
+                bool inView = sortData.getPriority() > OUT_OF_VIEW_THRESHOLD;
+                needsPose = avatar->isJointUpdateDue(deltaTime, inView);
+                if (p == kHero) {
+                    heroAvatars.insert(avatar.get());
+                }
+            }
+            if (needsPose && avatar->getSkeletonModel()->isLoaded()) {
+                _avatarsToPose.push_back(avatar.get());
+            }
+        }
+        size_t numPosed = 0;
+
         for (auto it = sortedAvatarVector.begin(); it != sortedAvatarVector.end(); ++it) {
             const SortableAvatar& sortData = *it;
             const auto avatar = std::static_pointer_cast<OtherAvatar>(sortData.getAvatar());
@@ -340,8 +373,22 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
                     avatar->_transit.reset();
                     avatar->setIsNewAvatar(false);
                 }
+                if (numPosed < _avatarsToPose.size() && _avatarsToPose[numPosed] == avatar.get()) {
+                    // this avatar is the next due to be posed, so pose it along with the next few, now that we know
+                    // there's budget for it; any left unsimulated when the budget runs out are posed again next frame
+                    const size_t POSE_BATCH_SIZE = 16;
+                    size_t batchEnd = std::min(numPosed + POSE_BATCH_SIZE, _avatarsToPose.size());
+                    uint64_t rigStart = usecTimestampNow();
+                    tbb::parallel_for(numPosed, batchEnd, [&](size_t i) {
+                        _avatarsToPose[i]->poseRigFromJointData();
+                    });
+                    rigTime += usecTimestampNow() - rigStart;
+                    posedAvatars.insert(posedAvatars.end(), _avatarsToPose.begin() + numPosed, _avatarsToPose.begin() + batchEnd);
+                    numPosed = batchEnd;
+                }
                 avatar->simulate(deltaTime, inView);
-                if (avatar->getSkeletonModel()->isLoaded() && avatar->getWorkloadRegion() == workload::Region::R1) {
+                if (avatar->getSkeletonModel()->isLoaded() && avatar->getWorkloadRegion() == workload::Region::R1 &&
+                    avatar->getAnimLOD() == OtherAvatar::AnimFull) {
                     _myAvatar->addAvatarHandsToFlow(avatar);
                 }
                 if (_drawOtherAvatarSkeletons) {
@@ -386,12 +433,22 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
         }
     }
 
+    // Compute the skinning matrices of the freshly posed avatars now, in parallel, rather than one by one
+    // in the post update lambdas. Avatars that ran out of time budget were not simulated, so this is a no-op for them.
+    uint64_t skinStart = usecTimestampNow();
+    tbb::parallel_for(size_t(0), posedAvatars.size(), [&](size_t i) {
+        posedAvatars[i]->getSkeletonModel()->updateClusterMatrices();
+    });
+    rigTime += usecTimestampNow() - skinStart;
+
     if (_shouldRender) {
         qApp->getMain3DScene()->enqueueTransaction(renderTransaction);
     }
 
     _space->enqueueTransaction(workloadTransaction);
 
+    _numAvatarsPerAnimLOD = numAvatarsPerAnimLOD;
+    _avatarRigTime = (float)rigTime / (float)USECS_PER_MSEC;
     _numAvatarsUpdated = numAvatarsUpdated;
     _numAvatarsNotUpdated = numAvatarsNotUpdated;
     _numHeroAvatarsUpdated = numHerosUpdated;
@@ -12,6 +12,7 @@
 #ifndef hifi_AvatarManager_h
 #define hifi_AvatarManager_h
 
+#include <array>
 #include <set>
 
 #include <QtCore/QHash>
@@ -118,6 +119,8 @@ public:
     int getNumHeroAvatars() const { return _numHeroAvatars; }
     int getNumHeroAvatarsUpdated() const { return _numHeroAvatarsUpdated; }
     float getAvatarSimulationTime() const { return _avatarSimulationTime; }
+    int getNumAvatarsAtAnimLOD(OtherAvatar::AnimLOD lod) const { return _numAvatarsPerAnimLOD[lod]; }
+    float getAvatarRigTime() const { return _avatarRigTime; }
 
     void updateMyAvatar(float deltaTime);
     void updateOtherAvatars(float deltaTime);
@@ -305,6 +308,9 @@ private:
     int _numHeroAvatars{ 0 };
     int _numHeroAvatarsUpdated{ 0 };
     float _avatarSimulationTime { 0.0f };
+    std::array<int, OtherAvatar::NumAnimLODs> _numAvatarsPerAnimLOD {{ 0 }};
+    float _avatarRigTime { 0.0f };
+    std::vector<OtherAvatar*> _avatarsToPose;
     bool _shouldRender { true };
     bool _myAvatarDataPacketsPaused { false };
 
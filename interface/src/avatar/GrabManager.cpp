@@ -20,7 +20,8 @@ void GrabManager::simulateGrabs() {
     auto entityTree = entityTreeRenderer->getTree();
     auto sessionID = DependencyManager::get<NodeList>()->getSessionUUID();
     EntityEditPacketSender* packetSender = entityTreeRenderer ? entityTreeRenderer->getPacketSender() : nullptr;
-    entityTree->withReadLock([&] {
+    // moving grabbed things moves them in the entity tree, which needs its write lock
+    entityTree->withWriteLock([&] {
         PROFILE_RANGE(simulation, "Grabs");
 
         std::map<QUuid, GrabLocationAccumulator> grabAccumulators;
@@ -21,6 +21,13 @@
 const float DISPLAYNAME_FADE_TIME = 0.5f;
 const float DISPLAYNAME_FADE_FACTOR = pow(0.01f, 1.0f / DISPLAYNAME_FADE_TIME);
 
+// angular size (bounding radius over distance) below which an avatar drops to the next animation LOD
+const float ANIM_LOD_REDUCED_ANGULAR_SIZE = 0.08f;
+const float ANIM_LOD_MINIMAL_ANGULAR_SIZE = 0.025f;
+
+// minimum time between rig updates for each animation LOD
+const float ANIM_LOD_UPDATE_PERIODS[OtherAvatar::NumAnimLODs] = { 0.0f, 1.0f / 30.0f, 1.0f / 10.0f };
+
 static glm::u8vec3 getLoadingOrbColor(Avatar::LoadingStatus loadingStatus) {
 
     const glm::u8vec3 NO_MODEL_COLOR(0xe3, 0xe3, 0xe3);
@@ -216,6 +223,58 @@ void OtherAvatar::computeShapeLOD() {
     }
 }
 
+void OtherAvatar::computeAnimLOD(const ConicalViewFrustums& views) {
+    if (getHasPriority()) {
+        // hero avatars are always fully animated
+        _animLOD = AnimLOD::AnimFull;
+        return;
+    }
+
+    float angularSize = 0.0f;
+    glm::vec3 position = getWorldPosition();
+    float radius = getBoundingRadius();
+    for (const auto& view : views) {
+        angularSize = std::max(angularSize, view.getAngularSize(glm::distance(view.getPosition(), position), radius));
+    }
+
+    AnimLOD newLOD;
+    if (angularSize >= ANIM_LOD_REDUCED_ANGULAR_SIZE) {
+        newLOD = AnimLOD::AnimFull;
+    } else if (angularSize >= ANIM_LOD_MINIMAL_ANGULAR_SIZE) {
+        newLOD = AnimLOD::AnimReduced;
+    } else {
+        newLOD = AnimLOD::AnimMinimal;
+    }
+
+    // like the body LOD, avatars in the outer workload regions never get the full treatment
+    switch (_workloadRegion) {
+    case workload::Region::R1:
+        break;
+    case workload::Region::R2:
+        newLOD = std::max(newLOD, AnimLOD::AnimReduced);
+        break;
+    default:
+        newLOD = AnimLOD::AnimMinimal;
+        break;
+    }
+    _animLOD = newLOD;
+}
+
+bool OtherAvatar::isJointUpdateDue(float deltaTime, bool inView) {
+    _rigPosed = false;
+    _timeSinceJointUpdate += deltaTime;
+    _jointUpdateDue = inView && (_hasNewJointData || _transit.isActive()) &&
+        _timeSinceJointUpdate >= ANIM_LOD_UPDATE_PERIODS[_animLOD];
+    return _jointUpdateDue;
+}
+
+void OtherAvatar::poseRigFromJointData() {
+    _skeletonModel->getRig().copyJointsFromJointData(_jointData);
+    glm::mat4 rootTransform = glm::scale(_skeletonModel->getScale()) * glm::translate(_skeletonModel->getOffset());
+    _skeletonModel->getRig().computeExternalPoses(rootTransform);
+    _rigPosed = true;
+}
+
 bool OtherAvatar::isInPhysicsSimulation() const {
     return _motionState && _motionState->getRigidBody();
 }
@@ -261,10 +320,15 @@ void OtherAvatar::simulate(float deltaTime, bool inView) {
         PROFILE_RANGE(simulation, "updateJoints");
         if (inView) {
             Head* head = getHead();
-            if (_hasNewJointData || _transit.isActive()) {
-                _skeletonModel->getRig().copyJointsFromJointData(_jointData);
-                glm::mat4 rootTransform = glm::scale(_skeletonModel->getScale()) * glm::translate(_skeletonModel->getOffset());
-                _skeletonModel->getRig().computeExternalPoses(rootTransform);
+            if (_jointUpdateDue) {
+                // the rig is normally posed ahead of time by AvatarManager, in parallel with the other avatars
+                if (!_rigPosed) {
+                    poseRigFromJointData();
+                }
+                _jointUpdateDue = false;
+                _rigPosed = false;
+                _timeSinceJointUpdate = 0.0f;
+                _skeletonModel->setEyesTrackLookAt(_animLOD == AnimLOD::AnimFull);
                 _jointDataSimulationRate.increment();
 
                 head->simulate(deltaTime);
@@ -13,6 +13,7 @@
 #include <vector>
 
 #include <avatars-renderer/Avatar.h>
+#include <shared/ConicalViewFrustum.h>
 #include <workload/Space.h>
 
 #include "InterfaceLogging.h"
@@ -32,6 +33,13 @@ public:
         MultiSphereHigh // All joints
     };
 
+    enum AnimLOD {
+        AnimFull = 0,   // joints posed every frame, eyes track their look-at target, hands collide with flow
+        AnimReduced,    // joints posed at 30Hz
+        AnimMinimal,    // joints posed at 10Hz
+        NumAnimLODs
+    };
+
     virtual void instantiableAvatar() override { };
     virtual void createOrb() override;
     virtual void indicateLoadingStatus(LoadingStatus loadingStatus) override;
@@ -63,6 +71,15 @@ public:
 
     void setCollisionWithOtherAvatarsFlags() override;
 
+    // picks the animation LOD from the avatar's size on screen and its workload region
+    void computeAnimLOD(const ConicalViewFrustums& views);
+    AnimLOD getAnimLOD() const { return _animLOD; }
+
+    // returns true if the next simulate() will pose the rig from new joint data
+    bool isJointUpdateDue(float deltaTime, bool inView);
+    // copies the joint data into the rig and computes its poses, safe to run in parallel with other avatars
+    void poseRigFromJointData();
+
     void simulate(float deltaTime, bool inView) override;
     void debugJointData() const;
     friend AvatarManager;
@@ -90,6 +107,10 @@ protected:
     int32_t _spaceIndex { -1 };
     uint8_t _workloadRegion { workload::Region::INVALID };
     BodyLOD _bodyLOD { BodyLOD::Sphere };
+    AnimLOD _animLOD { AnimLOD::AnimFull };
+    float _timeSinceJointUpdate { 0.0f };
+    bool _jointUpdateDue { false };
+    bool _rigPosed { false };
     bool _needsDetailedRebuild { false };
 };
 
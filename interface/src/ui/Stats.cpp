@@ -130,6 +130,9 @@ void Stats::updateStats(bool force) {
     STAT_UPDATE(updatedAvatarCount, avatarManager->getNumAvatarsUpdated());
     STAT_UPDATE(updatedHeroAvatarCount, avatarManager->getNumHeroAvatarsUpdated());
     STAT_UPDATE(notUpdatedAvatarCount, avatarManager->getNumAvatarsNotUpdated());
+    STAT_UPDATE(fullAnimAvatarCount, avatarManager->getNumAvatarsAtAnimLOD(OtherAvatar::AnimFull));
+    STAT_UPDATE(reducedAnimAvatarCount, avatarManager->getNumAvatarsAtAnimLOD(OtherAvatar::AnimReduced));
+    STAT_UPDATE(minimalAnimAvatarCount, avatarManager->getNumAvatarsAtAnimLOD(OtherAvatar::AnimMinimal));
     STAT_UPDATE(serverCount, (int)nodeList->size());
     STAT_UPDATE_FLOAT(renderrate, qApp->getRenderLoopRate(), 0.1f);
     RefreshRateManager& refreshRateManager = qApp->getRefreshRateManager();
@@ -291,8 +294,9 @@ void Stats::updateStats(bool force) {
 
         auto loadingRequests = ResourceCache::getLoadingRequests();
         STAT_UPDATE(downloads, loadingRequests.size());
-        STAT_UPDATE(downloadLimit, (int)ResourceCache::getRequestLimit())
+        STAT_UPDATE(downloadLimit, (int)ResourceCache::getActiveRequestLimit())
         STAT_UPDATE(downloadsPending, (int)ResourceCache::getPendingRequestCount());
+        STAT_UPDATE(timeToVisualCompleteness, qApp->getTimeToVisualCompleteness());
         STAT_UPDATE(processing, DependencyManager::get<StatTracker>()->getStat("Processing").toInt());
         STAT_UPDATE(processingPending, DependencyManager::get<StatTracker>()->getStat("PendingProcessing").toInt());
 
@@ -389,6 +393,7 @@ void Stats::updateStats(bool force) {
     auto config = qApp->getRenderEngine()->getConfiguration().get();
     STAT_UPDATE(engineFrameTime, (float) config->getCPURunTime());
     STAT_UPDATE(avatarSimulationTime, (float)avatarManager->getAvatarSimulationTime());
+    STAT_UPDATE(avatarRigTime, avatarManager->getAvatarRigTime());
 
     if (_expanded) {
         STAT_UPDATE(gpuBuffers, (int)gpu::Context::getBufferGPUCount());
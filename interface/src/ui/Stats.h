@@ -96,6 +96,15 @@ private: \
  * @property {number} notUpdatedAvatarCount - The number of avatars in the domain, other than the client's, that weren't able 
  *     to be updated in the most recent game loop because there wasn't enough time to.
  *     <em>Read-only.</em>
+ * @property {number} fullAnimAvatarCount - The number of avatars, other than the client's, whose joints are updated every 
+ *     frame because they are large on screen.
+ *     <em>Read-only.</em>
+ * @property {number} reducedAnimAvatarCount - The number of avatars, other than the client's, whose joints are updated at a 
+ *     reduced rate because they are small on screen or farther away.
+ *     <em>Read-only.</em>
+ * @property {number} minimalAnimAvatarCount - The number of avatars, other than the client's, whose joints are updated at the 
+ *     lowest rate because they are tiny on screen or far away.
+ *     <em>Read-only.</em>
  * @property {number} packetInCount - The number of packets being received from the domain server, in packets per second.
  *     <em>Read-only.</em>
  * @property {number} packetOutCount - The number of packets being sent to the domain server, in packets per second.
@@ -205,13 +214,17 @@ private: \
  *
  * @property {number} downloads - The number of downloads in progress.
  *     <em>Read-only.</em>
- * @property {number} downloadLimit - The maximum number of concurrent downloads.
+ * @property {number} downloadLimit - The maximum number of concurrent downloads. This adapts to the measured download
+ *     throughput, up to the limit set by the <code>--concurrent-downloads</code> command line parameter.
  *     <em>Read-only.</em>
  * @property {number} downloadsPending - The number of downloads pending.
  *     <em>Read-only.</em>
  * @property {string[]} downloadUrls - The download URLs.
  *     <em>Read-only.</em>
  *     <p><strong>Note:</strong> Property not available in the API.</p>
+ * @property {number} timeToVisualCompleteness - The time it took the last domain to load, from starting to load it until
+ *     all of its downloads finished, in milliseconds. <code>-1</code> until a domain has loaded.
+ *     <em>Read-only.</em>
  * @property {number} processing - The number of completed downloads being processed.
  *     <em>Read-only.</em>
  * @property {number} processingPending - The number of completed downloads waiting to be processed.
@@ -333,6 +346,9 @@ private: \
  *     <em>Read-only.</em>
  * @property {number} avatarSimulationTime - The time being spent simulating avatars each frame, in ms.
  *     <em>Read-only.</em>
+ * @property {number} avatarRigTime - The time being spent posing the rigs and computing the skinning matrices of other 
+ *     avatars each frame, in ms. This work is spread over several threads.
+ *     <em>Read-only.</em>
  *
  * @property {number} stylusPicksCount - The number of stylus picks currently in effect.
  *     <em>Read-only.</em>
@@ -484,6 +500,9 @@ class Stats : public QQuickItem {
     STATS_PROPERTY(int, updatedAvatarCount, 0)
     STATS_PROPERTY(int, updatedHeroAvatarCount, 0)
     STATS_PROPERTY(int, notUpdatedAvatarCount, 0)
+    STATS_PROPERTY(int, fullAnimAvatarCount, 0)
+    STATS_PROPERTY(int, reducedAnimAvatarCount, 0)
+    STATS_PROPERTY(int, minimalAnimAvatarCount, 0)
     STATS_PROPERTY(int, packetInCount, 0)
     STATS_PROPERTY(int, packetOutCount, 0)
     STATS_PROPERTY(float, mbpsIn, 0)
@@ -525,6 +544,7 @@ class Stats : public QQuickItem {
     STATS_PROPERTY(int, downloadLimit, 0)
     STATS_PROPERTY(int, downloadsPending, 0)
     Q_PROPERTY(QStringList downloadUrls READ downloadUrls NOTIFY downloadUrlsChanged)
+    STATS_PROPERTY(int, timeToVisualCompleteness, -1)
     STATS_PROPERTY(int, processing, 0)
     STATS_PROPERTY(int, processingPending, 0)
     STATS_PROPERTY(int, triangles, 0)
@@ -575,6 +595,7 @@ class Stats : public QQuickItem {
     STATS_PROPERTY(float, batchFrameTime, 0)
     STATS_PROPERTY(float, engineFrameTime, 0)
     STATS_PROPERTY(float, avatarSimulationTime, 0)
+    STATS_PROPERTY(float, avatarRigTime, 0)
 
     STATS_PROPERTY(int, stylusPicksCount, 0)
     STATS_PROPERTY(int, rayPicksCount, 0)
@@ -810,6 +831,27 @@ signals:
      */
     void notUpdatedAvatarCountChanged();
 
+    /**jsdoc
+     * Triggered when the value of the <code>fullAnimAvatarCount</code> property changes.
+     * @function Stats.fullAnimAvatarCountChanged
+     * @returns {Signal}
+     */
+    void fullAnimAvatarCountChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>reducedAnimAvatarCount</code> property changes.
+     * @function Stats.reducedAnimAvatarCountChanged
+     * @returns {Signal}
+     */
+    void reducedAnimAvatarCountChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>minimalAnimAvatarCount</code> property changes.
+     * @function Stats.minimalAnimAvatarCountChanged
+     * @returns {Signal}
+     */
+    void minimalAnimAvatarCountChanged();
+
     /**jsdoc
      * Triggered when the value of the <code>packetInCount</code> property changes.
      * @function Stats.packetInCountChanged
@@ -1085,6 +1127,13 @@ signals:
      */
     void downloadUrlsChanged();
 
+    /**jsdoc
+     * Triggered when the value of the <code>timeToVisualCompleteness</code> property changes.
+     * @function Stats.timeToVisualCompletenessChanged
+     * @returns {Signal}
+     */
+    void timeToVisualCompletenessChanged();
+
     /**jsdoc
      * Triggered when the value of the <code>processing</code> property changes.
      * @function Stats.processingChanged
@@ -1428,6 +1477,13 @@ signals:
      */
     void avatarSimulationTimeChanged();
 
+    /**jsdoc
+     * Triggered when the value of the <code>avatarRigTime</code> property changes.
+     * @function Stats.avatarRigTimeChanged
+     * @returns {Signal}
+     */
+    void avatarRigTimeChanged();
+
     /**jsdoc
      * Triggered when the value of the <code>stylusPicksCount</code> property changes.
      * @function Stats.stylusPicksCountChanged
@@ -82,22 +82,22 @@ const AnimPoseVec& AnimBlendDirectional::evaluate(const AnimVariantMap& animVars
             alpha.x * (1.0f - alpha.y)
         }};
 
-        // evaluate children
-        std::array<AnimPoseVec, 4> poseVecs;
+        // evaluate children, the children own their poses so they don't need to be copied here.
+        std::array<const AnimPoseVec*, 4> poseVecs;
         for (int i = 0; i < 4; i++) {
-            poseVecs[i] = _children[indices[i]]->evaluate(animVars, context, dt, triggersOut);
+            poseVecs[i] = &_children[indices[i]]->evaluate(animVars, context, dt, triggersOut);
         }
 
         // blend children
         size_t minSize = INT_MAX;
         for (int i = 0; i < 4; i++) {
-            if (poseVecs[i].size() < minSize) {
-                minSize = poseVecs[i].size();
+            if (poseVecs[i]->size() < minSize) {
+                minSize = poseVecs[i]->size();
             }
         }
         _poses.resize(minSize);
         if (minSize > 0) {
-            blend4(minSize, &poseVecs[0][0], &poseVecs[1][0], &poseVecs[2][0], &poseVecs[3][0], &alphas[0], &_poses[0]);
+            blend4(minSize, poseVecs[0]->data(), poseVecs[1]->data(), poseVecs[2]->data(), poseVecs[3]->data(), &alphas[0], &_poses[0]);
         }
 
         // animation stack debug stats
@@ -87,8 +87,9 @@ void AnimBlendLinear::evaluateAndBlendChildren(const AnimVariantMap& animVars, c
         _poses = _children[prevPoseIndex]->evaluate(animVars, context, dt, triggersOut);
     } else {
         // need to eval and blend between two children.
-        auto prevPoses = _children[prevPoseIndex]->evaluate(animVars, context, dt, triggersOut);
-        auto nextPoses = _children[nextPoseIndex]->evaluate(animVars, context, dt, triggersOut);
+        // the children own these poses until their next evaluate, so there is no need to copy them
+        const AnimPoseVec& prevPoses = _children[prevPoseIndex]->evaluate(animVars, context, dt, triggersOut);
+        const AnimPoseVec& nextPoses = _children[nextPoseIndex]->evaluate(animVars, context, dt, triggersOut);
 
         if (prevPoses.size() > 0 && prevPoses.size() == nextPoses.size()) {
             _poses.resize(prevPoses.size());
@@ -99,26 +100,21 @@ void AnimBlendLinear::evaluateAndBlendChildren(const AnimVariantMap& animVars, c
                 ::blendAdd(_poses.size(), &prevPoses[0], &nextPoses[0], alpha, &_poses[0]);
             } else if (_blendType == AnimBlendType_AddAbsolute) {
                 // convert prev from relative to absolute
-                AnimPoseVec absPrev = prevPoses;
-                _skeleton->convertRelativePosesToAbsolute(absPrev);
+                _absPrevPoses = prevPoses;
+                _skeleton->convertRelativePosesToAbsolute(_absPrevPoses);
 
                 // rotate the offset rotations from next into the parent relative frame of each joint.
-                AnimPoseVec relOffsetPoses;
-                relOffsetPoses.reserve(nextPoses.size());
-                for (size_t i = 0; i < nextPoses.size(); ++i) {
-
-                    // copy translation and scale from nextPoses
-                    AnimPose pose = nextPoses[i];
-
+                // copy translation and scale from nextPoses
+                _relOffsetPoses = nextPoses;
+                for (size_t i = 0; i < _relOffsetPoses.size(); ++i) {
                     // convert from a rotation that happens in the absolute space of the joint
                     // into a rotation that happens in the relative space of the joint.
-                    pose.rot() = glm::inverse(absPrev[i].rot()) * pose.rot() * absPrev[i].rot();
-
-                    relOffsetPoses.push_back(pose);
+                    AnimPose& pose = _relOffsetPoses[i];
+                    pose.rot() = glm::inverse(_absPrevPoses[i].rot()) * pose.rot() * _absPrevPoses[i].rot();
                 }
 
                 // then blend
-                ::blendAdd(_poses.size(), &prevPoses[0], &relOffsetPoses[0], alpha, &_poses[0]);
+                ::blendAdd(_poses.size(), &prevPoses[0], &_relOffsetPoses[0], alpha, &_poses[0]);
             }
         }
     }
@@ -43,6 +43,10 @@ protected:
 
     AnimPoseVec _poses;
 
+    // scratch space for AnimBlendType_AddAbsolute, kept between frames to avoid reallocating it
+    AnimPoseVec _absPrevPoses;
+    AnimPoseVec _relOffsetPoses;
+
     float _alpha;
     AnimBlendType _blendType;
 
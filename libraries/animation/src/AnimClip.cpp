@@ -12,6 +12,8 @@
 
 #include <assert.h>
 
+#include <QtCore/QCryptographicHash>
+
 #include "GLMHelpers.h"
 #include "AnimationLogging.h"
 #include "AnimUtil.h"
@@ -261,52 +263,37 @@ const AnimPoseVec& AnimClip::evaluate(const AnimVariantMap& animVars, const Anim
     _frame = ::accumulateTime(_startFrame, _endFrame, _timeScale, frame, dt, _loopFlag, _id, triggersOut);
 
     // poll network anim to see if it's finished loading yet.
-    if (_blendType == AnimBlendType_Normal) {
-        if (_networkAnim && _networkAnim->isLoaded() && _skeleton) {
-            // loading is complete, copy & retarget animation.
-            _anim = copyAndRetargetFromNetworkAnim(_networkAnim, _skeleton);
-
-            // we no longer need the actual animation resource anymore.
-            _networkAnim.reset();
-
-            // mirrorAnim will be re-built on demand, if needed.
-            _mirrorAnim.clear();
-
-            _poses.resize(_skeleton->getNumJoints());
+    bool isLoaded = _networkAnim && _networkAnim->isLoaded() && _skeleton;
+    if (_blendType != AnimBlendType_Normal) {
+        // an additive blend type also needs its base animation.
+        isLoaded = isLoaded && _baseNetworkAnim && _baseNetworkAnim->isLoaded();
+    }
+    if (isLoaded) {
+        // loading is complete, share or build the retargeted animation.
+        auto animCache = DependencyManager::get<AnimationCache>();
+        _clipDataKey = computeClipDataKey();
+        _clipData = animCache->getClipData(_clipDataKey);
+        if (!_clipData) {
+            _clipData = animCache->addClipData(_clipDataKey, buildClipData());
         }
-    } else {
-        // an additive blend type
-        if (_networkAnim && _networkAnim->isLoaded() && _baseNetworkAnim && _baseNetworkAnim->isLoaded() && _skeleton) {
-            // loading is complete, copy & retarget animation.
-            _anim = copyAndRetargetFromNetworkAnim(_networkAnim, _skeleton);
-
-            // we no longer need the actual animation resource anymore.
-            _networkAnim.reset();
 
-            // mirrorAnim will be re-built on demand, if needed.
-            // TODO: handle mirrored relative animations.
-            _mirrorAnim.clear();
+        // we no longer need the actual animation resource anymore.
+        _networkAnim.reset();
 
-            _poses.resize(_skeleton->getNumJoints());
+        // mirrorAnim will be re-built on demand, if needed.
+        // TODO: handle mirrored relative animations.
+        _mirrorClipData.reset();
 
-            // copy & retarget baseAnim!
-            auto baseAnim = copyAndRetargetFromNetworkAnim(_baseNetworkAnim, _skeleton);
-
-            if (_blendType == AnimBlendType_AddAbsolute) {
-                bakeAbsoluteDeltaAnim(_anim, baseAnim[(int)_baseFrame], _skeleton);
-            } else {
-                // AnimBlendType_AddRelative
-                bakeRelativeDeltaAnim(_anim, baseAnim[(int)_baseFrame]);
-            }
-        }
+        _poses.resize(_skeleton->getNumJoints());
     }
 
-    if (_anim.size()) {
+    if (_clipData && _clipData->getNumFrames() > 0 && _clipData->getNumJoints() == (int)_poses.size()) {
 
         // lazy creation of mirrored animation frames.
-        if (_mirrorFlag && _anim.size() != _mirrorAnim.size()) {
+        if (_mirrorFlag && !_mirrorClipData) {
             buildMirrorAnim();
         }
+        const AnimClipData& clipData = _mirrorFlag ? *_mirrorClipData : *_clipData;
 
         int prevIndex = (int)glm::floor(_frame);
         int nextIndex;
@@ -318,15 +305,23 @@ const AnimPoseVec& AnimClip::evaluate(const AnimVariantMap& animVars, const Anim
 
         // It can be quite possible for the user to set _startFrame and _endFrame to
         // values before or past valid ranges.  We clamp the frames here.
-        int frameCount = (int)_anim.size();
+        int frameCount = clipData.getNumFrames();
         prevIndex = std::min(std::max(0, prevIndex), frameCount - 1);
         nextIndex = std::min(std::max(0, nextIndex), frameCount - 1);
-
-        const AnimPoseVec& prevFrame = _mirrorFlag ? _mirrorAnim[prevIndex] : _anim[prevIndex];
-        const AnimPoseVec& nextFrame = _mirrorFlag ? _mirrorAnim[nextIndex] : _anim[nextIndex];
         float alpha = glm::fract(_frame);
 
-        ::blend(_poses.size(), &prevFrame[0], &nextFrame[0], alpha, &_poses[0]);
+        if (nextIndex == prevIndex) {
+            clipData.sample((float)prevIndex, &_poses[0], _cursors);
+        } else if (nextIndex == prevIndex + 1) {
+            // the curves interpolate between their keys, so sample in between the frames directly.
+            clipData.sample((float)prevIndex + alpha, &_poses[0], _cursors);
+        } else {
+            // wrapping around to the start of a loop.
+            _loopPoses.resize(_poses.size());
+            clipData.sample((float)prevIndex, &_poses[0], _cursors);
+            clipData.sample((float)nextIndex, &_loopPoses[0], _cursors);
+            ::blend(_poses.size(), &_poses[0], &_loopPoses[0], alpha, &_poses[0]);
+        }
     }
 
     processOutputJoints(triggersOut);
@@ -341,14 +336,75 @@ void AnimClip::setCurrentFrameInternal(float frame) {
     _frame = ::accumulateTime(_startFrame, _endFrame, _timeScale, frame + _startFrame, dt, _loopFlag, _id, triggers);
 }
 
-void AnimClip::buildMirrorAnim() {
+QByteArray AnimClip::computeClipDataKey() const {
     assert(_skeleton);
 
-    _mirrorAnim.clear();
-    _mirrorAnim.reserve(_anim.size());
-    for (auto& relPoses : _anim) {
-        _mirrorAnim.push_back(relPoses);
-        _skeleton->mirrorRelativePoses(_mirrorAnim.back());
+    // rigs built from the same model end up with identical skeletons, and can share the retargeted animation.
+    QCryptographicHash hash(QCryptographicHash::Md5);
+    hash.addData(_url.toUtf8());
+    hash.addData((const char*)&_blendType, sizeof(_blendType));
+    if (_blendType != AnimBlendType_Normal) {
+        hash.addData(_baseURL.toUtf8());
+        hash.addData((const char*)&_baseFrame, sizeof(_baseFrame));
+    }
+    for (int i = 0; i < _skeleton->getNumJoints(); i++) {
+        hash.addData(_skeleton->getJointName(i).toUtf8());
+        int parentIndex = _skeleton->getParentIndex(i);
+        hash.addData((const char*)&parentIndex, sizeof(parentIndex));
+        const AnimPose& defaultPose = _skeleton->getRelativeDefaultPose(i);
+        hash.addData((const char*)&defaultPose, sizeof(AnimPose));
+    }
+    hash.addData((const char*)&_skeleton->getGeometryOffset(), sizeof(glm::mat4));
+    return hash.result();
+}
+
+static AnimClipData::Tolerances computeTolerances(const AnimSkeleton& skeleton) {
+    AnimClipData::Tolerances tolerances;
+
+    // translations are in the units of the model, the tolerance is in meters.
+    const float MIN_UNIT_SCALE = 0.0001f;
+    const float unitScale = extractScale(skeleton.getGeometryOffset()).y;
+    if (unitScale > MIN_UNIT_SCALE) {
+        tolerances.translation /= unitScale;
+    }
+    return tolerances;
+}
+
+AnimClipData::Pointer AnimClip::buildClipData() const {
+    auto anim = copyAndRetargetFromNetworkAnim(_networkAnim, _skeleton);
+
+    if (_blendType != AnimBlendType_Normal) {
+        // copy & retarget baseAnim!
+        auto baseAnim = copyAndRetargetFromNetworkAnim(_baseNetworkAnim, _skeleton);
+
+        if (_blendType == AnimBlendType_AddAbsolute) {
+            bakeAbsoluteDeltaAnim(anim, baseAnim[(int)_baseFrame], _skeleton);
+        } else {
+            // AnimBlendType_AddRelative
+            bakeRelativeDeltaAnim(anim, baseAnim[(int)_baseFrame]);
+        }
+    }
+
+    auto clipData = AnimClipData::compress(anim, computeTolerances(*_skeleton));
+    qCDebug(animation) << "AnimClip, compressed" << _url << "from" << AnimClipData::getUncompressedMemorySize(anim)
+        << "to" << clipData->getMemorySize() << "bytes," << clipData->getNumKeys() << "keys";
+    return clipData;
+}
+
+void AnimClip::buildMirrorAnim() {
+    assert(_skeleton && _clipData);
+
+    auto animCache = DependencyManager::get<AnimationCache>();
+    QByteArray mirrorKey = _clipDataKey + "mirror";
+    _mirrorClipData = animCache->getClipData(mirrorKey);
+    if (!_mirrorClipData) {
+        // mirroring is not linear, so it is applied to the decompressed frames,
+        // which puts the mirrored frames within twice the tolerance of the source animation.
+        auto mirrorAnim = _clipData->decompress();
+        for (auto& relPoses : mirrorAnim) {
+            _skeleton->mirrorRelativePoses(relPoses);
+        }
+        _mirrorClipData = animCache->addClipData(mirrorKey, AnimClipData::compress(mirrorAnim, computeTolerances(*_skeleton)));
     }
 }
 
@@ -61,6 +61,8 @@ protected:
 
     virtual void setCurrentFrameInternal(float frame) override;
 
+    QByteArray computeClipDataKey() const;
+    AnimClipData::Pointer buildClipData() const;
     void buildMirrorAnim();
 
     // for AnimDebugDraw rendering
@@ -71,9 +73,14 @@ protected:
 
     AnimPoseVec _poses;
 
-    // _anim[frame][joint]
-    std::vector<AnimPoseVec> _anim;
-    std::vector<AnimPoseVec> _mirrorAnim;
+    // retargeted to _skeleton and shared with every other clip playing _url on the same skeleton.
+    AnimClipData::Pointer _clipData;
+    AnimClipData::Pointer _mirrorClipData;
+    QByteArray _clipDataKey;
+    AnimClipData::Cursors _cursors;
+
+    // only needed when blending the end frame of a looping clip with its start frame.
+    AnimPoseVec _loopPoses;
 
     QString _url;
     float _startFrame;
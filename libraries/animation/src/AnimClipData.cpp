@@ -0,0 +1,327 @@
+//
+//  AnimClipData.cpp
+//  libraries/animation/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AnimClipData.h"
+
+#include <algorithm>
+#include <array>
+#include <cfloat>
+
+#include "AnimationLogging.h"
+
+// key frame numbers are stored in 16 bits.
+static const int MAX_NUM_FRAMES = 1 << 16;
+
+// bounds the cost of fitting long, smooth curves; a key every four seconds costs next to nothing.
+static const int MAX_KEY_SPACING = 120;
+
+static const float SMALLEST_THREE_RANGE = 0.70710678f;  // 1 / sqrt(2)
+static const uint64_t ROTATION_COMPONENT_BITS = 15;
+static const uint64_t ROTATION_COMPONENT_MAX = (1 << ROTATION_COMPONENT_BITS) - 1;
+static const float ROTATION_COMPONENT_SCALE = 2.0f * SMALLEST_THREE_RANGE / (float)ROTATION_COMPONENT_MAX;
+static const float VEC3_COMPONENT_MAX = 65535.0f;
+
+static void quantizeRotation(const glm::quat& rotation, uint16_t* data) {
+    glm::quat q = glm::normalize(rotation);
+    int largest = 0;
+    for (int i = 1; i < 4; i++) {
+        if (fabsf(q[i]) > fabsf(q[largest])) {
+            largest = i;
+        }
+    }
+    if (q[largest] < 0.0f) {
+        q = -q;
+    }
+
+    uint64_t bits = (uint64_t)largest;
+    for (int i = 0; i < 4; i++) {
+        if (i != largest) {
+            float component = glm::clamp(q[i] / SMALLEST_THREE_RANGE, -1.0f, 1.0f);
+            uint64_t value = (uint64_t)((component * 0.5f + 0.5f) * (float)ROTATION_COMPONENT_MAX + 0.5f);
+            bits = (bits << ROTATION_COMPONENT_BITS) | value;
+        }
+    }
+    data[0] = (uint16_t)(bits & 0xffff);
+    data[1] = (uint16_t)((bits >> 16) & 0xffff);
+    data[2] = (uint16_t)((bits >> 32) & 0xffff);
+}
+
+static glm::quat dequantizeRotation(const uint16_t* data) {
+    uint64_t bits = (uint64_t)data[0] | ((uint64_t)data[1] << 16) | ((uint64_t)data[2] << 32);
+
+    // the components were shifted in from the top, so the last one is in the lowest bits.
+    float components[3];
+    for (int i = 2; i >= 0; i--) {
+        components[i] = (float)(bits & ROTATION_COMPONENT_MAX) * ROTATION_COMPONENT_SCALE - SMALLEST_THREE_RANGE;
+        bits >>= ROTATION_COMPONENT_BITS;
+    }
+    int largest = (int)(bits & 0x3);
+
+    float q[4];
+    float sumOfSquares = components[0] * components[0] + components[1] * components[1] + components[2] * components[2];
+    int j = 0;
+    for (int i = 0; i < 4; i++) {
+        q[i] = (i == largest) ? sqrtf(std::max(0.0f, 1.0f - sumOfSquares)) : components[std::min(j++, 2)];
+    }
+    return glm::quat(q[3], q[0], q[1], q[2]);
+}
+
+static void quantizeVec3(const glm::vec3& value, const glm::vec3& min, const glm::vec3& step, uint16_t* data) {
+    for (int i = 0; i < 3; i++) {
+        float normalized = step[i] > 0.0f ? (value[i] - min[i]) / step[i] : 0.0f;
+        data[i] = (uint16_t)glm::clamp(normalized + 0.5f, 0.0f, VEC3_COMPONENT_MAX);
+    }
+}
+
+static glm::vec3 dequantizeVec3(const uint16_t* data, const glm::vec3& min, const glm::vec3& step) {
+    return min + step * glm::vec3((float)data[0], (float)data[1], (float)data[2]);
+}
+
+static glm::quat interpolateRotation(const glm::quat& a, const glm::quat& b, float alpha) {
+    float beta = glm::dot(a, b) < 0.0f ? -alpha : alpha;
+    float oneMinusAlpha = 1.0f - alpha;
+    glm::quat result(oneMinusAlpha * a.w + beta * b.w, oneMinusAlpha * a.x + beta * b.x,
+                     oneMinusAlpha * a.y + beta * b.y, oneMinusAlpha * a.z + beta * b.z);
+    float inverseLength = 1.0f / sqrtf(glm::dot(result, result));
+    return glm::quat(result.w * inverseLength, result.x * inverseLength, result.y * inverseLength, result.z * inverseLength);
+}
+
+// picks the fewest frames of a curve that, interpolated, stay within tolerance of every original frame.
+template <typename T, typename Interpolate, typename WithinTolerance>
+static std::vector<int> reduceKeys(const std::vector<T>& original, const std::vector<T>& quantized,
+                                   Interpolate interpolate, WithinTolerance withinTolerance) {
+    const int numFrames = (int)original.size();
+
+    bool isConstant = true;
+    for (int i = 0; i < numFrames && isConstant; i++) {
+        isConstant = withinTolerance(quantized[0], original[i]);
+    }
+    if (isConstant) {
+        return { 0 };
+    }
+
+    std::vector<int> keys;
+    keys.push_back(0);
+    int start = 0;
+    int end = 1;
+    while (end < numFrames - 1) {
+        int candidate = end + 1;
+        bool fits = candidate - start <= MAX_KEY_SPACING;
+        for (int i = start + 1; i < candidate && fits; i++) {
+            float alpha = (float)(i - start) / (float)(candidate - start);
+            fits = withinTolerance(interpolate(quantized[start], quantized[candidate], alpha), original[i]);
+        }
+        if (fits) {
+            end = candidate;
+        } else {
+            keys.push_back(end);
+            start = end;
+            end = start + 1;
+        }
+    }
+    keys.push_back(numFrames - 1);
+    return keys;
+}
+
+AnimClipData::Pointer AnimClipData::compress(const std::vector<AnimPoseVec>& anim, const Tolerances& tolerances) {
+    auto clipData = std::make_shared<AnimClipData>();
+    if (anim.empty()) {
+        return clipData;
+    }
+
+    int numFrames = (int)anim.size();
+    if (numFrames > MAX_NUM_FRAMES) {
+        qCWarning(animation) << "AnimClipData: animation has" << numFrames << "frames, only the first" << MAX_NUM_FRAMES << "are kept";
+        numFrames = MAX_NUM_FRAMES;
+    }
+    const int numJoints = (int)anim[0].size();
+    clipData->_numFrames = numFrames;
+    clipData->_numJoints = numJoints;
+    clipData->_curves.resize(numJoints * NumChannels);
+    clipData->_ranges.resize(numJoints * 2);
+
+    // for small angles the distance between two aligned unit quaternions is half the angle between them,
+    // which unlike the cosine of the angle keeps its precision in floats.
+    const float maxRotationDistance = 0.5f * tolerances.rotation;
+    auto rotationWithinTolerance = [&](const glm::quat& a, const glm::quat& b) {
+        float sign = glm::dot(a, b) < 0.0f ? -1.0f : 1.0f;
+        float dx = a.x - sign * b.x;
+        float dy = a.y - sign * b.y;
+        float dz = a.z - sign * b.z;
+        float dw = a.w - sign * b.w;
+        return dx * dx + dy * dy + dz * dz + dw * dw <= maxRotationDistance * maxRotationDistance;
+    };
+
+    auto addKeys = [&](Curve& curve, const std::vector<int>& keys, const std::vector<std::array<uint16_t, 3>>& data) {
+        curve.firstKey = (uint32_t)clipData->_keyFrames.size();
+        curve.numKeys = (uint32_t)keys.size();
+        for (int key : keys) {
+            clipData->_keyFrames.push_back((uint16_t)key);
+            clipData->_keyData.insert(clipData->_keyData.end(), data[key].begin(), data[key].end());
+        }
+    };
+
+    std::vector<glm::quat> originalRotations(numFrames);
+    std::vector<glm::quat> quantizedRotations(numFrames);
+    std::vector<glm::vec3> originalVec3s(numFrames);
+    std::vector<glm::vec3> quantizedVec3s(numFrames);
+    std::vector<std::array<uint16_t, 3>> data(numFrames);
+
+    for (int joint = 0; joint < numJoints; joint++) {
+
+        // rotation curve
+        for (int frame = 0; frame < numFrames; frame++) {
+            originalRotations[frame] = glm::normalize(anim[frame][joint].rot());
+            quantizeRotation(originalRotations[frame], data[frame].data());
+            quantizedRotations[frame] = dequantizeRotation(data[frame].data());
+        }
+        auto keys = reduceKeys(originalRotations, quantizedRotations, interpolateRotation, rotationWithinTolerance);
+        addKeys(clipData->_curves[joint * NumChannels + Rotation], keys, data);
+
+        // translation and scale curves
+        for (int channel = Translation; channel <= Scale; channel++) {
+            glm::vec3 min(FLT_MAX);
+            glm::vec3 max(-FLT_MAX);
+            for (int frame = 0; frame < numFrames; frame++) {
+                const AnimPose& pose = anim[frame][joint];
+                originalVec3s[frame] = channel == Translation ? pose.trans() : pose.scale();
+                min = glm::min(min, originalVec3s[frame]);
+                max = glm::max(max, originalVec3s[frame]);
+            }
+
+            Range& range = clipData->_ranges[joint * 2 + (channel - Translation)];
+            range.min = min;
+            range.step = (max - min) / VEC3_COMPONENT_MAX;
+            for (int frame = 0; frame < numFrames; frame++) {
+                quantizeVec3(originalVec3s[frame], range.min, range.step, data[frame].data());
+                quantizedVec3s[frame] = dequantizeVec3(data[frame].data(), range.min, range.step);
+            }
+
+            const float tolerance = channel == Translation ? tolerances.translation : tolerances.scale;
+            auto vec3WithinTolerance = [&](const glm::vec3& a, const glm::vec3& b) {
+                return glm::all(glm::lessThanEqual(glm::abs(a - b), glm::vec3(tolerance)));
+            };
+            auto interpolateVec3 = [](const glm::vec3& a, const glm::vec3& b, float alpha) {
+                return a + alpha * (b - a);
+            };
+            keys = reduceKeys(originalVec3s, quantizedVec3s, interpolateVec3, vec3WithinTolerance);
+            addKeys(clipData->_curves[joint * NumChannels + channel], keys, data);
+        }
+    }
+
+    clipData->_keyFrames.shrink_to_fit();
+    clipData->_keyData.shrink_to_fit();
+    return clipData;
+}
+
+void AnimClipData::findSegment(const Curve& curve, float frame, Cursors::Segment& segment) const {
+    const uint16_t* keyFrames = &_keyFrames[curve.firstKey];
+    const uint32_t lastKey = curve.numKeys - 1;
+    segment.inverseLength = 0.0f;
+    if (lastKey == 0) {
+        segment.key0 = segment.key1 = curve.firstKey;
+        segment.frame0 = -FLT_MAX;
+        segment.frame1 = FLT_MAX;
+        return;
+    }
+    if (frame < (float)keyFrames[0]) {
+        segment.key0 = segment.key1 = curve.firstKey;
+        segment.frame0 = -FLT_MAX;
+        segment.frame1 = (float)keyFrames[0];
+        return;
+    }
+    if (frame >= (float)keyFrames[lastKey]) {
+        segment.key0 = segment.key1 = curve.firstKey + lastKey;
+        segment.frame0 = (float)keyFrames[lastKey];
+        segment.frame1 = FLT_MAX;
+        return;
+    }
+
+    // playback mostly moves forward a fraction of a frame at a time, so try the segment after the one used last time
+    // before searching.
+    uint32_t index = segment.key1 - curve.firstKey;
+    if (!(segment.key1 > curve.firstKey && index < lastKey &&
+          frame >= (float)keyFrames[index] && frame < (float)keyFrames[index + 1])) {
+        index = (uint32_t)(std::upper_bound(keyFrames, keyFrames + curve.numKeys, frame) - keyFrames) - 1;
+    }
+
+    segment.key0 = curve.firstKey + index;
+    segment.key1 = segment.key0 + 1;
+    segment.frame0 = (float)keyFrames[index];
+    segment.frame1 = (float)keyFrames[index + 1];
+    segment.inverseLength = 1.0f / (segment.frame1 - segment.frame0);
+}
+
+glm::quat AnimClipData::sampleRotation(const Curve& curve, float frame, Cursors::RotationCursor& cursor) const {
+    Cursors::Segment& segment = cursor.segment;
+    if (frame < segment.frame0 || frame >= segment.frame1) {
+        findSegment(curve, frame, segment);
+        cursor.value0 = dequantizeRotation(&_keyData[segment.key0 * 3]);
+        cursor.value1 = (segment.key1 == segment.key0) ? cursor.value0 : dequantizeRotation(&_keyData[segment.key1 * 3]);
+    }
+    if (segment.key0 == segment.key1) {
+        return cursor.value0;
+    }
+    return interpolateRotation(cursor.value0, cursor.value1, (frame - segment.frame0) * segment.inverseLength);
+}
+
+glm::vec3 AnimClipData::sampleVec3(const Curve& curve, const Range& range, float frame, Cursors::Vec3Cursor& cursor) const {
+    Cursors::Segment& segment = cursor.segment;
+    if (frame < segment.frame0 || frame >= segment.frame1) {
+        findSegment(curve, frame, segment);
+        cursor.value0 = dequantizeVec3(&_keyData[segment.key0 * 3], range.min, range.step);
+        cursor.value1 = (segment.key1 == segment.key0) ? cursor.value0 : dequantizeVec3(&_keyData[segment.key1 * 3], range.min, range.step);
+    }
+    if (segment.key0 == segment.key1) {
+        return cursor.value0;
+    }
+    return cursor.value0 + ((frame - segment.frame0) * segment.inverseLength) * (cursor.value1 - cursor.value0);
+}
+
+void AnimClipData::sample(float frame, AnimPose* poses, Cursors& cursors) const {
+    if (cursors._clipData != this) {
+        // decoded keys of another clip are no use here
+        cursors._clipData = this;
+        cursors._rotations.assign(_numJoints, Cursors::RotationCursor());
+        cursors._vec3s.assign(_numJoints * 2, Cursors::Vec3Cursor());
+    }
+    for (int joint = 0; joint < _numJoints; joint++) {
+        const Curve* curves = &_curves[joint * NumChannels];
+        const Range* ranges = &_ranges[joint * 2];
+        Cursors::Vec3Cursor* vec3Cursors = &cursors._vec3s[joint * 2];
+        poses[joint].rot() = sampleRotation(curves[Rotation], frame, cursors._rotations[joint]);
+        poses[joint].trans() = sampleVec3(curves[Translation], ranges[0], frame, vec3Cursors[0]);
+        poses[joint].scale() = sampleVec3(curves[Scale], ranges[1], frame, vec3Cursors[1]);
+    }
+}
+
+std::vector<AnimPoseVec> AnimClipData::decompress() const {
+    std::vector<AnimPoseVec> anim(_numFrames, AnimPoseVec(_numJoints));
+    Cursors cursors;
+    for (int frame = 0; frame < _numFrames; frame++) {
+        if (_numJoints > 0) {
+            sample((float)frame, &anim[frame][0], cursors);
+        }
+    }
+    return anim;
+}
+
+size_t AnimClipData::getMemorySize() const {
+    return sizeof(AnimClipData) + _curves.capacity() * sizeof(Curve) + _ranges.capacity() * sizeof(Range) +
+        _keyFrames.capacity() * sizeof(uint16_t) + _keyData.capacity() * sizeof(uint16_t);
+}
+
+size_t AnimClipData::getUncompressedMemorySize(const std::vector<AnimPoseVec>& anim) {
+    size_t size = anim.capacity() * sizeof(AnimPoseVec);
+    for (auto& poses : anim) {
+        size += poses.capacity() * sizeof(AnimPose);
+    }
+    return size;
+}
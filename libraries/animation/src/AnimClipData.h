@@ -0,0 +1,112 @@
+//
+//  AnimClipData.h
+//  libraries/animation/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AnimClipData_h
+#define hifi_AnimClipData_h
+
+#include <cfloat>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "AnimPose.h"
+
+// Immutable, compressed storage for the frames of a retargeted animation clip.
+//
+// Every joint has a rotation, translation and scale curve.  Each curve keeps only the frames needed to
+// reproduce the source animation within the given tolerances by interpolating between the kept keys.
+// Rotations are quantized to 48 bits (smallest three), translations and scales to 16 bits per component
+// within the range of their curve.
+//
+// Instances are shared between every AnimClip playing the same animation on the same skeleton, see AnimationCache.
+class AnimClipData {
+public:
+    using Pointer = std::shared_ptr<const AnimClipData>;
+
+    struct Tolerances {
+        float rotation { 0.0005f };     // radians
+        float translation { 0.0001f };  // same units as the pose translations
+        float scale { 0.0001f };
+    };
+
+    // anim[frame][joint], every frame must have the same number of joints.
+    static Pointer compress(const std::vector<AnimPoseVec>& anim, const Tolerances& tolerances);
+
+    int getNumFrames() const { return _numFrames; }
+    int getNumJoints() const { return _numJoints; }
+
+    // The keys around where each curve was last sampled, decoded.  Every player of a clip keeps its own, so that
+    // playing forward only searches for and decodes keys when it moves past one.
+    class Cursors {
+    private:
+        // the frames a pair of keys covers, frame0 <= frame < frame1.
+        struct Segment {
+            float frame0 { FLT_MAX };
+            float frame1 { -FLT_MAX };
+            float inverseLength { 0.0f };
+            uint32_t key0 { 0 };
+            uint32_t key1 { 0 };
+        };
+        struct RotationCursor {
+            Segment segment;
+            glm::quat value0;
+            glm::quat value1;
+        };
+        struct Vec3Cursor {
+            Segment segment;
+            glm::vec3 value0;
+            glm::vec3 value1;
+        };
+
+        const AnimClipData* _clipData { nullptr };
+        std::vector<RotationCursor> _rotations;  // [joint]
+        std::vector<Vec3Cursor> _vec3s;          // [joint * 2 + (channel - Translation)]
+
+        friend class AnimClipData;
+    };
+
+    // samples every joint at a fractional frame, poses must point to getNumJoints() poses.
+    void sample(float frame, AnimPose* poses, Cursors& cursors) const;
+
+    // restores every frame, as passed to compress() within the tolerances.
+    std::vector<AnimPoseVec> decompress() const;
+
+    size_t getNumKeys() const { return _keyFrames.size(); }
+    size_t getMemorySize() const;
+
+    static size_t getUncompressedMemorySize(const std::vector<AnimPoseVec>& anim);
+
+private:
+    struct Curve {
+        uint32_t firstKey { 0 };
+        uint32_t numKeys { 0 };
+    };
+    struct Range {
+        glm::vec3 min;
+        glm::vec3 step;
+    };
+
+    // curves are stored joint by joint so sampling walks the key arrays mostly in order.
+    enum Channel { Rotation = 0, Translation, Scale, NumChannels };
+
+    void findSegment(const Curve& curve, float frame, Cursors::Segment& segment) const;
+    glm::quat sampleRotation(const Curve& curve, float frame, Cursors::RotationCursor& cursor) const;
+    glm::vec3 sampleVec3(const Curve& curve, const Range& range, float frame, Cursors::Vec3Cursor& cursor) const;
+
+    int _numFrames { 0 };
+    int _numJoints { 0 };
+
+    std::vector<Curve> _curves;           // [joint * NumChannels + channel]
+    std::vector<Range> _ranges;           // [joint * 2 + (channel - Translation)]
+    std::vector<uint16_t> _keyFrames;     // frame number of every key
+    std::vector<uint16_t> _keyData;       // three quantized components for every key
+};
+
+#endif // hifi_AnimClipData_h
@@ -64,9 +64,14 @@ const AnimPoseVec& AnimOverlay::evaluate(const AnimVariantMap& animVars, const A
                 _poses.resize(underPoses.size());
                 assert(_boneSetVec.size() == _poses.size());
 
-                for (size_t i = 0; i < _poses.size(); i++) {
-                    float alpha = _boneSetVec[i] * _alpha;
-                    ::blend(1, &underPoses[i], &overPoses[i], alpha, &_poses[i]);
+                // blend runs of joints that share the same bone set weight together, so they can be vectorized.
+                size_t runStart = 0;
+                for (size_t i = 1; i <= _poses.size(); i++) {
+                    if (i == _poses.size() || _boneSetVec[i] != _boneSetVec[runStart]) {
+                        float alpha = _boneSetVec[runStart] * _alpha;
+                        ::blend(i - runStart, &underPoses[runStart], &overPoses[runStart], alpha, &_poses[runStart]);
+                        runStart = i;
+                    }
                 }
             }
         }
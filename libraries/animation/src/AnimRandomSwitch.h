@@ -164,6 +164,7 @@ protected:
     float _alpha = 0.0f;
     AnimPoseVec _prevPoses;
     AnimPoseVec _nextPoses;
+    AnimPoseVec _evaluatedPrevPoses;
 
     RandomSwitchState::Pointer _currentState;
     RandomSwitchState::Pointer _previousState;
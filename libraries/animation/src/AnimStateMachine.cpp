@@ -54,10 +54,9 @@ const AnimPoseVec& AnimStateMachine::evaluate(const AnimVariantMap& animVars, co
     if (_duringInterp) {
         _alpha += _alphaVel * dt;
         if (_alpha < 1.0f) {
-            AnimPoseVec* nextPoses = nullptr;
-            AnimPoseVec* prevPoses = nullptr;
-            AnimPoseVec localNextPoses;
-            AnimPoseVec localPrevPoses;
+            // the evaluated poses are owned by the child nodes, so they are referenced rather than copied.
+            const AnimPoseVec* nextPoses = nullptr;
+            const AnimPoseVec* prevPoses = nullptr;
 
             if (_interpType == InterpType::SnapshotBoth) {
                 // interp between both snapshots
@@ -66,14 +65,16 @@ const AnimPoseVec& AnimStateMachine::evaluate(const AnimVariantMap& animVars, co
             } else if (_interpType == InterpType::SnapshotPrev) {
                 // interp between the prev snapshot and evaluated next target.
                 // this is useful for interping into a blend
-                localNextPoses = currentStateNode->evaluate(animVars, context, dt, triggersOut);
+                nextPoses = &currentStateNode->evaluate(animVars, context, dt, triggersOut);
                 prevPoses = &_prevPoses;
-                nextPoses = &localNextPoses;
             } else if (_interpType == InterpType::EvaluateBoth) {
-                localPrevPoses = previousStateNode->evaluate(animVars, context, dt, triggersOut);
-                localNextPoses = currentStateNode->evaluate(animVars, context, dt, triggersOut);
-                prevPoses = &localPrevPoses;
-                nextPoses = &localNextPoses;
+                prevPoses = &previousStateNode->evaluate(animVars, context, dt, triggersOut);
+                if (previousStateNode == currentStateNode) {
+                    // the second evaluate would overwrite the poses of the first one.
+                    _evaluatedPrevPoses = *prevPoses;
+                    prevPoses = &_evaluatedPrevPoses;
+                }
+                nextPoses = &currentStateNode->evaluate(animVars, context, dt, triggersOut);
             } else {
                 assert(false);
             }
@@ -144,6 +144,7 @@ protected:
     float _alpha = 0.0f;
     AnimPoseVec _prevPoses;
     AnimPoseVec _nextPoses;
+    AnimPoseVec _evaluatedPrevPoses;
 
     State::Pointer _currentState;
     State::Pointer _previousState;
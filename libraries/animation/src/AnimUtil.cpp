@@ -13,9 +13,7 @@
 #include <NumericalConstants.h>
 #include <DebugDraw.h>
 
-// TODO: use restrict keyword
-// TODO: excellent candidate for simd vectorization.
-void blend(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, AnimPose* result) {
+static void blend_ref(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, AnimPose* result) {
     for (size_t i = 0; i < numPoses; i++) {
         const AnimPose& aPose = a[i];
         const AnimPose& bPose = b[i];
@@ -26,7 +24,7 @@ void blend(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, A
     }
 }
 
-void blend3(size_t numPoses, const AnimPose* a, const AnimPose* b, const AnimPose* c, float* alphas, AnimPose* result) {
+static void blend3_ref(size_t numPoses, const AnimPose* a, const AnimPose* b, const AnimPose* c, const float* alphas, AnimPose* result) {
     for (size_t i = 0; i < numPoses; i++) {
         const AnimPose& aPose = a[i];
         const AnimPose& bPose = b[i];
@@ -38,7 +36,7 @@ void blend3(size_t numPoses, const AnimPose* a, const AnimPose* b, const AnimPos
     }
 }
 
-void blend4(size_t numPoses, const AnimPose* a, const AnimPose* b, const AnimPose* c, const AnimPose* d, float* alphas, AnimPose* result) {
+static void blend4_ref(size_t numPoses, const AnimPose* a, const AnimPose* b, const AnimPose* c, const AnimPose* d, const float* alphas, AnimPose* result) {
     for (size_t i = 0; i < numPoses; i++) {
         const AnimPose& aPose = a[i];
         const AnimPose& bPose = b[i];
@@ -52,7 +50,7 @@ void blend4(size_t numPoses, const AnimPose* a, const AnimPose* b, const AnimPos
 }
 
 // additive blend
-void blendAdd(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, AnimPose* result) {
+static void blendAdd_ref(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, AnimPose* result) {
 
     const glm::vec3 IDENTITY_SCALE = glm::vec3(1.0f);
     const glm::quat IDENTITY_ROT = glm::quat();
@@ -75,6 +73,91 @@ void blendAdd(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha
     }
 }
 
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+//
+// Runtime CPU dispatch
+//
+#include <CPUDetect.h>
+
+using PoseFloats = float[10];
+static_assert(sizeof(AnimPose) == sizeof(PoseFloats), "AnimPose is expected to be 10 packed floats");
+
+// the AVX2 kernels work on blocks of 8 poses, the remainder goes through the reference code.
+static const size_t POSE_BLOCK_SIZE = 8;
+
+void blend_AVX2(size_t numPoses, const float (*a)[10], const float (*b)[10], float alpha, float (*result)[10]);
+void blend3_AVX2(size_t numPoses, const float (*a)[10], const float (*b)[10], const float (*c)[10],
+                 const float* alphas, float (*result)[10]);
+void blend4_AVX2(size_t numPoses, const float (*a)[10], const float (*b)[10], const float (*c)[10], const float (*d)[10],
+                 const float* alphas, float (*result)[10]);
+void blendAdd_AVX2(size_t numPoses, const float (*a)[10], const float (*b)[10], float alpha, float (*result)[10]);
+
+static const bool CPU_SUPPORTS_AVX2 = cpuSupportsAVX2();
+
+static inline const PoseFloats* asFloats(const AnimPose* poses) {
+    return reinterpret_cast<const PoseFloats*>(poses);
+}
+
+static inline PoseFloats* asFloats(AnimPose* poses) {
+    return reinterpret_cast<PoseFloats*>(poses);
+}
+
+void blend(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, AnimPose* result) {
+    size_t i = 0;
+    if (CPU_SUPPORTS_AVX2) {
+        i = numPoses - (numPoses % POSE_BLOCK_SIZE);
+        blend_AVX2(i, asFloats(a), asFloats(b), alpha, asFloats(result));
+    }
+    blend_ref(numPoses - i, a + i, b + i, alpha, result + i);
+}
+
+void blend3(size_t numPoses, const AnimPose* a, const AnimPose* b, const AnimPose* c, float* alphas, AnimPose* result) {
+    size_t i = 0;
+    if (CPU_SUPPORTS_AVX2) {
+        i = numPoses - (numPoses % POSE_BLOCK_SIZE);
+        blend3_AVX2(i, asFloats(a), asFloats(b), asFloats(c), alphas, asFloats(result));
+    }
+    blend3_ref(numPoses - i, a + i, b + i, c + i, alphas, result + i);
+}
+
+void blend4(size_t numPoses, const AnimPose* a, const AnimPose* b, const AnimPose* c, const AnimPose* d, float* alphas, AnimPose* result) {
+    size_t i = 0;
+    if (CPU_SUPPORTS_AVX2) {
+        i = numPoses - (numPoses % POSE_BLOCK_SIZE);
+        blend4_AVX2(i, asFloats(a), asFloats(b), asFloats(c), asFloats(d), alphas, asFloats(result));
+    }
+    blend4_ref(numPoses - i, a + i, b + i, c + i, d + i, alphas, result + i);
+}
+
+void blendAdd(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, AnimPose* result) {
+    size_t i = 0;
+    if (CPU_SUPPORTS_AVX2) {
+        i = numPoses - (numPoses % POSE_BLOCK_SIZE);
+        blendAdd_AVX2(i, asFloats(a), asFloats(b), alpha, asFloats(result));
+    }
+    blendAdd_ref(numPoses - i, a + i, b + i, alpha, result + i);
+}
+
+#else   // portable reference code
+
+void blend(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, AnimPose* result) {
+    blend_ref(numPoses, a, b, alpha, result);
+}
+
+void blend3(size_t numPoses, const AnimPose* a, const AnimPose* b, const AnimPose* c, float* alphas, AnimPose* result) {
+    blend3_ref(numPoses, a, b, c, alphas, result);
+}
+
+void blend4(size_t numPoses, const AnimPose* a, const AnimPose* b, const AnimPose* c, const AnimPose* d, float* alphas, AnimPose* result) {
+    blend4_ref(numPoses, a, b, c, d, alphas, result);
+}
+
+void blendAdd(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, AnimPose* result) {
+    blendAdd_ref(numPoses, a, b, alpha, result);
+}
+
+#endif
+
 glm::quat averageQuats(size_t numQuats, const glm::quat* quats) {
     if (numQuats == 0) {
         return glm::quat();
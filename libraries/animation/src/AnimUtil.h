@@ -13,6 +13,9 @@
 
 #include "AnimNode.h"
 
+// The pose blending functions below use AVX2 kernels when the cpu supports them,
+// and the result may be the same array as the first input.
+
 // this is where the magic happens
 void blend(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, AnimPose* result);
 
@@ -40,7 +43,7 @@ inline glm::quat safeLerp(const glm::quat& a, const glm::quat& b, float alpha) {
     return glm::normalize(glm::lerp(a, bTemp, alpha));
 }
 
-inline glm::quat safeLinearCombine3(const glm::quat& a, const glm::quat& b, const glm::quat& c, float* alphas) {
+inline glm::quat safeLinearCombine3(const glm::quat& a, const glm::quat& b, const glm::quat& c, const float* alphas) {
     // adjust signs for b & c if necessary
     glm::quat bTemp = b;
     float dot = glm::dot(a, bTemp);
@@ -55,7 +58,7 @@ inline glm::quat safeLinearCombine3(const glm::quat& a, const glm::quat& b, cons
     return glm::normalize(alphas[0] * a + alphas[1] * bTemp + alphas[2] * cTemp);
 }
 
-inline glm::quat safeLinearCombine4(const glm::quat& a, const glm::quat& b, const glm::quat& c, const glm::quat& d, float* alphas) {
+inline glm::quat safeLinearCombine4(const glm::quat& a, const glm::quat& b, const glm::quat& c, const glm::quat& d, const float* alphas) {
     // adjust signs for b, c & d if necessary
     glm::quat bTemp = b;
     float dot = glm::dot(a, bTemp);
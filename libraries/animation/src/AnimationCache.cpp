@@ -36,6 +36,54 @@ AnimationPointer AnimationCache::getAnimation(const QUrl& url) {
     return getResource(url).staticCast<Animation>();
 }
 
+AnimClipData::Pointer AnimationCache::getClipData(const QByteArray& key) {
+    std::lock_guard<std::mutex> lock(_clipDataMutex);
+    return _clipData.value(key).lock();
+}
+
+AnimClipData::Pointer AnimationCache::addClipData(const QByteArray& key, const AnimClipData::Pointer& clipData) {
+    std::lock_guard<std::mutex> lock(_clipDataMutex);
+
+    // drop the entries whose clips have all gone away
+    for (auto itr = _clipData.begin(); itr != _clipData.end();) {
+        if (itr.value().expired()) {
+            itr = _clipData.erase(itr);
+        } else {
+            ++itr;
+        }
+    }
+
+    auto existing = _clipData.value(key).lock();
+    if (existing) {
+        return existing;
+    }
+    _clipData.insert(key, clipData);
+    return clipData;
+}
+
+size_t AnimationCache::getNumClipData() {
+    std::lock_guard<std::mutex> lock(_clipDataMutex);
+    size_t count = 0;
+    for (auto& weakClipData : _clipData) {
+        if (!weakClipData.expired()) {
+            count++;
+        }
+    }
+    return count;
+}
+
+size_t AnimationCache::getClipDataMemorySize() {
+    std::lock_guard<std::mutex> lock(_clipDataMutex);
+    size_t size = 0;
+    for (auto& weakClipData : _clipData) {
+        auto clipData = weakClipData.lock();
+        if (clipData) {
+            size += clipData->getMemorySize();
+        }
+    }
+    return size;
+}
+
 QSharedPointer<Resource> AnimationCache::createResource(const QUrl& url) {
     return QSharedPointer<Resource>(new Animation(url), &Resource::deleter);
 }
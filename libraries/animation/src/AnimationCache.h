@@ -12,6 +12,9 @@
 #ifndef hifi_AnimationCache_h
 #define hifi_AnimationCache_h
 
+#include <mutex>
+
+#include <QtCore/QHash>
 #include <QtCore/QRunnable>
 #include <QtScript/QScriptEngine>
 #include <QtScript/QScriptValue>
@@ -20,6 +23,8 @@
 #include <hfm/HFM.h>
 #include <ResourceCache.h>
 
+#include "AnimClipData.h"
+
 class Animation;
 
 using AnimationPointer = QSharedPointer<Animation>;
@@ -33,6 +38,16 @@ public:
     Q_INVOKABLE AnimationPointer getAnimation(const QString& url) { return getAnimation(QUrl(url)); }
     Q_INVOKABLE AnimationPointer getAnimation(const QUrl& url);
 
+    // Retargeted, compressed clips are shared by every AnimClip playing the same animation on the same skeleton.
+    // They are only held weakly here, and freed once the last clip using them goes away.
+    AnimClipData::Pointer getClipData(const QByteArray& key);
+
+    // returns the clip data already stored under key, if another rig got there first, otherwise stores clipData.
+    AnimClipData::Pointer addClipData(const QByteArray& key, const AnimClipData::Pointer& clipData);
+
+    size_t getNumClipData();
+    size_t getClipDataMemorySize();
+
 protected:
     virtual QSharedPointer<Resource> createResource(const QUrl& url) override;
     QSharedPointer<Resource> createResourceCopy(const QSharedPointer<Resource>& resource) override;
@@ -41,6 +56,8 @@ private:
     explicit AnimationCache(QObject* parent = NULL);
     virtual ~AnimationCache() { }
 
+    std::mutex _clipDataMutex;
+    QHash<QByteArray, std::weak_ptr<const AnimClipData>> _clipData;
 };
 
 Q_DECLARE_METATYPE(AnimationPointer)
@@ -0,0 +1,253 @@
+//
+//  AnimUtil_avx2.cpp
+//  libraries/animation/src/avx2
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifdef __AVX2__
+
+#include <stddef.h>
+#include <immintrin.h>
+
+//
+// Each AnimPose is 10 floats: scale xyz, rot xyzw, trans xyz.
+// Poses are processed in blocks of 8, transposed into one register per component (structure-of-arrays),
+// so that the sign fix, lerp and normalize of the quaternions become plain vertical math.
+//
+
+struct PoseBlock {
+    __m256 sx, sy, sz;
+    __m256 qx, qy, qz, qw;
+    __m256 tx, ty, tz;
+};
+
+// 8x4 transpose of columns [k, k+4) of 8 consecutive poses
+static inline void load4(const float (*p)[10], int k, __m256& c0, __m256& c1, __m256& c2, __m256& c3) {
+    __m256 s0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(&p[0][k])), _mm_loadu_ps(&p[4][k]), 1);
+    __m256 s1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(&p[1][k])), _mm_loadu_ps(&p[5][k]), 1);
+    __m256 s2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(&p[2][k])), _mm_loadu_ps(&p[6][k]), 1);
+    __m256 s3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(&p[3][k])), _mm_loadu_ps(&p[7][k]), 1);
+
+    __m256 t0 = _mm256_unpacklo_ps(s0, s1);
+    __m256 t1 = _mm256_unpackhi_ps(s0, s1);
+    __m256 t2 = _mm256_unpacklo_ps(s2, s3);
+    __m256 t3 = _mm256_unpackhi_ps(s2, s3);
+
+    c0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1,0,1,0));
+    c1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3,2,3,2));
+    c2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1,0,1,0));
+    c3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3,2,3,2));
+}
+
+// inverse of load4
+static inline void store4(float (*p)[10], int k, __m256 c0, __m256 c1, __m256 c2, __m256 c3) {
+    __m256 t0 = _mm256_unpacklo_ps(c0, c1);
+    __m256 t1 = _mm256_unpackhi_ps(c0, c1);
+    __m256 t2 = _mm256_unpacklo_ps(c2, c3);
+    __m256 t3 = _mm256_unpackhi_ps(c2, c3);
+
+    __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1,0,1,0));
+    __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3,2,3,2));
+    __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1,0,1,0));
+    __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3,2,3,2));
+
+    _mm_storeu_ps(&p[0][k], _mm256_castps256_ps128(s0));
+    _mm_storeu_ps(&p[1][k], _mm256_castps256_ps128(s1));
+    _mm_storeu_ps(&p[2][k], _mm256_castps256_ps128(s2));
+    _mm_storeu_ps(&p[3][k], _mm256_castps256_ps128(s3));
+    _mm_storeu_ps(&p[4][k], _mm256_extractf128_ps(s0, 1));
+    _mm_storeu_ps(&p[5][k], _mm256_extractf128_ps(s1, 1));
+    _mm_storeu_ps(&p[6][k], _mm256_extractf128_ps(s2, 1));
+    _mm_storeu_ps(&p[7][k], _mm256_extractf128_ps(s3, 1));
+}
+
+static inline PoseBlock loadPoses(const float (*p)[10]) {
+    PoseBlock b;
+    __m256 unused0, unused1;
+    load4(p, 0, b.sx, b.sy, b.sz, b.qx);
+    load4(p, 4, b.qy, b.qz, b.qw, b.tx);
+    load4(p, 6, unused0, unused1, b.ty, b.tz);  // overlaps the previous columns, to stay within the pose
+    return b;
+}
+
+static inline void storePoses(float (*p)[10], const PoseBlock& b) {
+    // all loads of a block happen before its stores, so the result may alias an input
+    store4(p, 0, b.sx, b.sy, b.sz, b.qx);
+    store4(p, 4, b.qy, b.qz, b.qw, b.tx);
+    store4(p, 6, b.qw, b.tx, b.ty, b.tz);
+}
+
+static inline __m256 quatDot(const PoseBlock& a, const PoseBlock& b) {
+    __m256 dot = _mm256_mul_ps(a.qx, b.qx);
+    dot = _mm256_fmadd_ps(a.qy, b.qy, dot);
+    dot = _mm256_fmadd_ps(a.qz, b.qz, dot);
+    return _mm256_fmadd_ps(a.qw, b.qw, dot);
+}
+
+// negate the rotations in b that are in the opposite hemisphere from the rotations in a
+static inline void alignQuats(const PoseBlock& a, PoseBlock& b) {
+    __m256 flip = _mm256_and_ps(_mm256_cmp_ps(quatDot(a, b), _mm256_setzero_ps(), _CMP_LT_OQ), _mm256_set1_ps(-0.0f));
+    b.qx = _mm256_xor_ps(b.qx, flip);
+    b.qy = _mm256_xor_ps(b.qy, flip);
+    b.qz = _mm256_xor_ps(b.qz, flip);
+    b.qw = _mm256_xor_ps(b.qw, flip);
+}
+
+// same as glm::normalize(), a zero length quaternion becomes the identity
+static inline void normalizeQuats(PoseBlock& r) {
+    __m256 len = _mm256_sqrt_ps(quatDot(r, r));
+    __m256 valid = _mm256_cmp_ps(len, _mm256_setzero_ps(), _CMP_GT_OQ);
+    __m256 oneOverLen = _mm256_div_ps(_mm256_set1_ps(1.0f), len);
+    r.qx = _mm256_and_ps(valid, _mm256_mul_ps(r.qx, oneOverLen));
+    r.qy = _mm256_and_ps(valid, _mm256_mul_ps(r.qy, oneOverLen));
+    r.qz = _mm256_and_ps(valid, _mm256_mul_ps(r.qz, oneOverLen));
+    r.qw = _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(r.qw, oneOverLen), valid);
+}
+
+// r = a + alpha * (b - a), for every component
+static inline PoseBlock lerpPoses(const PoseBlock& a, const PoseBlock& b, __m256 alpha) {
+    PoseBlock r;
+    r.sx = _mm256_fmadd_ps(alpha, _mm256_sub_ps(b.sx, a.sx), a.sx);
+    r.sy = _mm256_fmadd_ps(alpha, _mm256_sub_ps(b.sy, a.sy), a.sy);
+    r.sz = _mm256_fmadd_ps(alpha, _mm256_sub_ps(b.sz, a.sz), a.sz);
+    r.qx = _mm256_fmadd_ps(alpha, _mm256_sub_ps(b.qx, a.qx), a.qx);
+    r.qy = _mm256_fmadd_ps(alpha, _mm256_sub_ps(b.qy, a.qy), a.qy);
+    r.qz = _mm256_fmadd_ps(alpha, _mm256_sub_ps(b.qz, a.qz), a.qz);
+    r.qw = _mm256_fmadd_ps(alpha, _mm256_sub_ps(b.qw, a.qw), a.qw);
+    r.tx = _mm256_fmadd_ps(alpha, _mm256_sub_ps(b.tx, a.tx), a.tx);
+    r.ty = _mm256_fmadd_ps(alpha, _mm256_sub_ps(b.ty, a.ty), a.ty);
+    r.tz = _mm256_fmadd_ps(alpha, _mm256_sub_ps(b.tz, a.tz), a.tz);
+    return r;
+}
+
+static inline PoseBlock scalePoses(const PoseBlock& a, __m256 alpha) {
+    PoseBlock r;
+    r.sx = _mm256_mul_ps(alpha, a.sx);
+    r.sy = _mm256_mul_ps(alpha, a.sy);
+    r.sz = _mm256_mul_ps(alpha, a.sz);
+    r.qx = _mm256_mul_ps(alpha, a.qx);
+    r.qy = _mm256_mul_ps(alpha, a.qy);
+    r.qz = _mm256_mul_ps(alpha, a.qz);
+    r.qw = _mm256_mul_ps(alpha, a.qw);
+    r.tx = _mm256_mul_ps(alpha, a.tx);
+    r.ty = _mm256_mul_ps(alpha, a.ty);
+    r.tz = _mm256_mul_ps(alpha, a.tz);
+    return r;
+}
+
+// r += alpha * a
+static inline void accumulatePoses(PoseBlock& r, const PoseBlock& a, __m256 alpha) {
+    r.sx = _mm256_fmadd_ps(alpha, a.sx, r.sx);
+    r.sy = _mm256_fmadd_ps(alpha, a.sy, r.sy);
+    r.sz = _mm256_fmadd_ps(alpha, a.sz, r.sz);
+    r.qx = _mm256_fmadd_ps(alpha, a.qx, r.qx);
+    r.qy = _mm256_fmadd_ps(alpha, a.qy, r.qy);
+    r.qz = _mm256_fmadd_ps(alpha, a.qz, r.qz);
+    r.qw = _mm256_fmadd_ps(alpha, a.qw, r.qw);
+    r.tx = _mm256_fmadd_ps(alpha, a.tx, r.tx);
+    r.ty = _mm256_fmadd_ps(alpha, a.ty, r.ty);
+    r.tz = _mm256_fmadd_ps(alpha, a.tz, r.tz);
+}
+
+// numPoses must be a multiple of 8
+void blend_AVX2(size_t numPoses, const float (*a)[10], const float (*b)[10], float alpha, float (*result)[10]) {
+    __m256 alphaVec = _mm256_set1_ps(alpha);
+    for (size_t i = 0; i < numPoses; i += 8) {
+        PoseBlock aBlock = loadPoses(a + i);
+        PoseBlock bBlock = loadPoses(b + i);
+        alignQuats(aBlock, bBlock);
+        PoseBlock r = lerpPoses(aBlock, bBlock, alphaVec);
+        normalizeQuats(r);
+        storePoses(result + i, r);
+    }
+}
+
+void blend3_AVX2(size_t numPoses, const float (*a)[10], const float (*b)[10], const float (*c)[10],
+                 const float* alphas, float (*result)[10]) {
+    __m256 alpha0 = _mm256_set1_ps(alphas[0]);
+    __m256 alpha1 = _mm256_set1_ps(alphas[1]);
+    __m256 alpha2 = _mm256_set1_ps(alphas[2]);
+    for (size_t i = 0; i < numPoses; i += 8) {
+        PoseBlock aBlock = loadPoses(a + i);
+        PoseBlock bBlock = loadPoses(b + i);
+        PoseBlock cBlock = loadPoses(c + i);
+        alignQuats(aBlock, bBlock);
+        alignQuats(aBlock, cBlock);
+        PoseBlock r = scalePoses(aBlock, alpha0);
+        accumulatePoses(r, bBlock, alpha1);
+        accumulatePoses(r, cBlock, alpha2);
+        normalizeQuats(r);
+        storePoses(result + i, r);
+    }
+}
+
+void blend4_AVX2(size_t numPoses, const float (*a)[10], const float (*b)[10], const float (*c)[10], const float (*d)[10],
+                 const float* alphas, float (*result)[10]) {
+    __m256 alpha0 = _mm256_set1_ps(alphas[0]);
+    __m256 alpha1 = _mm256_set1_ps(alphas[1]);
+    __m256 alpha2 = _mm256_set1_ps(alphas[2]);
+    __m256 alpha3 = _mm256_set1_ps(alphas[3]);
+    for (size_t i = 0; i < numPoses; i += 8) {
+        PoseBlock aBlock = loadPoses(a + i);
+        PoseBlock bBlock = loadPoses(b + i);
+        PoseBlock cBlock = loadPoses(c + i);
+        PoseBlock dBlock = loadPoses(d + i);
+        alignQuats(aBlock, bBlock);
+        alignQuats(aBlock, cBlock);
+        alignQuats(aBlock, dBlock);
+        PoseBlock r = scalePoses(aBlock, alpha0);
+        accumulatePoses(r, bBlock, alpha1);
+        accumulatePoses(r, cBlock, alpha2);
+        accumulatePoses(r, dBlock, alpha3);
+        normalizeQuats(r);
+        storePoses(result + i, r);
+    }
+}
+
+void blendAdd_AVX2(size_t numPoses, const float (*a)[10], const float (*b)[10], float alpha, float (*result)[10]) {
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    __m256 alphaVec = _mm256_set1_ps(alpha);
+    __m256 oneMinusAlpha = _mm256_set1_ps(1.0f - alpha);
+    for (size_t i = 0; i < numPoses; i += 8) {
+        PoseBlock aBlock = loadPoses(a + i);
+        PoseBlock bBlock = loadPoses(b + i);
+        PoseBlock r;
+
+        // scale = a.scale * lerp(1, b.scale, alpha)
+        r.sx = _mm256_mul_ps(aBlock.sx, _mm256_fmadd_ps(alphaVec, _mm256_sub_ps(bBlock.sx, one), one));
+        r.sy = _mm256_mul_ps(aBlock.sy, _mm256_fmadd_ps(alphaVec, _mm256_sub_ps(bBlock.sy, one), one));
+        r.sz = _mm256_mul_ps(aBlock.sz, _mm256_fmadd_ps(alphaVec, _mm256_sub_ps(bBlock.sz, one), one));
+
+        // delta = lerp(identity, b.rot, alpha), with b.rot given the same polarity as the identity
+        __m256 flip = _mm256_and_ps(_mm256_cmp_ps(bBlock.qw, _mm256_setzero_ps(), _CMP_LT_OQ), signMask);
+        __m256 dx = _mm256_mul_ps(alphaVec, _mm256_xor_ps(bBlock.qx, flip));
+        __m256 dy = _mm256_mul_ps(alphaVec, _mm256_xor_ps(bBlock.qy, flip));
+        __m256 dz = _mm256_mul_ps(alphaVec, _mm256_xor_ps(bBlock.qz, flip));
+        __m256 dw = _mm256_fmadd_ps(alphaVec, _mm256_xor_ps(bBlock.qw, flip), oneMinusAlpha);
+
+        // rot = normalize(a.rot * delta)
+        r.qw = _mm256_sub_ps(_mm256_mul_ps(aBlock.qw, dw),
+               _mm256_fmadd_ps(aBlock.qx, dx, _mm256_fmadd_ps(aBlock.qy, dy, _mm256_mul_ps(aBlock.qz, dz))));
+        r.qx = _mm256_fmsub_ps(aBlock.qy, dz,
+               _mm256_fmsub_ps(aBlock.qz, dy, _mm256_fmadd_ps(aBlock.qw, dx, _mm256_mul_ps(aBlock.qx, dw))));
+        r.qy = _mm256_fmsub_ps(aBlock.qz, dx,
+               _mm256_fmsub_ps(aBlock.qx, dz, _mm256_fmadd_ps(aBlock.qw, dy, _mm256_mul_ps(aBlock.qy, dw))));
+        r.qz = _mm256_fmsub_ps(aBlock.qx, dy,
+               _mm256_fmsub_ps(aBlock.qy, dx, _mm256_fmadd_ps(aBlock.qw, dz, _mm256_mul_ps(aBlock.qz, dw))));
+        normalizeQuats(r);
+
+        // trans = a.trans + alpha * b.trans
+        r.tx = _mm256_fmadd_ps(alphaVec, bBlock.tx, aBlock.tx);
+        r.ty = _mm256_fmadd_ps(alphaVec, bBlock.ty, aBlock.ty);
+        r.tz = _mm256_fmadd_ps(alphaVec, bBlock.tz, aBlock.tz);
+
+        storePoses(result + i, r);
+    }
+}
+
+#endif
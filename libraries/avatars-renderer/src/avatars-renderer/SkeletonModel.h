@@ -39,6 +39,8 @@ public:
     void simulate(float deltaTime, bool fullUpdate = true) override;
     glm::vec3 avoidCrossedEyes(const glm::vec3& lookAt);
     void updateRig(float deltaTime, glm::mat4 parentTransform) override;
+    // when disabled, the eyes keep the rotations received in the joint data instead of being aimed at the look-at target
+    void setEyesTrackLookAt(bool enabled) { _eyesTrackLookAt = enabled; }
     void updateAttitude(const glm::quat& orientation);
 
     bool getIsJointOverridden(int jointIndex) const;
@@ -114,6 +116,7 @@ protected:
 
 private:
     bool _texturesLoaded { false };
+    bool _eyesTrackLookAt { true };
 };
 
 #endif // hifi_SkeletonModel_h
@@ -11,8 +11,14 @@
 
 #include "Baker.h"
 
+#include <QtCore/QCryptographicHash>
+
 #include "ModelBakingLoggingCategory.h"
 
+QByteArray Baker::hashContent(const QByteArray& content) {
+    return QCryptographicHash::hash(content, QCryptographicHash::Sha256).toHex();
+}
+
 bool Baker::shouldStop() {
     if (_shouldAbort) {
         setWasAborted(true);
@@ -12,7 +12,13 @@
 #ifndef hifi_Baker_h
 #define hifi_Baker_h
 
+#include <QtCore/QHash>
 #include <QtCore/QObject>
+#include <QtCore/QUrl>
+
+// The external files a bake read, by URL, each with a hash of its content as it was read (empty if it couldn't be read),
+// so that a cached bake can tell when one of them has changed
+using BakeDependencies = QHash<QUrl, QByteArray>;
 
 class Baker : public QObject {
     Q_OBJECT
@@ -37,6 +43,9 @@ public:
 
     bool wasAborted() const { return _wasAborted.load(); }
 
+    // The hash that BakeDependencies keep of each file's content
+    static QByteArray hashContent(const QByteArray& content);
+
 public slots:
     virtual void bake() = 0;
     virtual void abort() { _shouldAbort.store(true); }
@@ -171,6 +171,9 @@ void MaterialBaker::handleFinishedTextureBaker() {
 
     if (baker) {
         TextureKey textureKey = { baker->getTextureURL(), baker->getTextureType() };
+        if (!baker->isEmbedded()) {
+            _dependencies[baker->getTextureURL()] = baker->getOriginalTextureHash();
+        }
         if (!baker->hasErrors()) {
             // this TextureBaker is done and everything went according to plan
             qCDebug(material_baking) << "Re-writing texture references to" << baker->getTextureURL();
@@ -37,6 +37,9 @@ public:
 
     NetworkMaterialResourcePointer getNetworkMaterialResource() const { return _materialResource; }
 
+    // The texture files the materials were baked from, once the bake is finished
+    const BakeDependencies& getDependencies() const { return _dependencies; }
+
     static void setNextOvenWorkerThreadOperator(std::function<QThread*()> getNextOvenWorkerThreadOperator) { _getNextOvenWorkerThreadOperator = getNextOvenWorkerThreadOperator; }
 
 public slots:
@@ -62,6 +65,7 @@ private:
 
     QHash<TextureKey, QSharedPointer<TextureBaker>> _textureBakers;
     QMultiHash<TextureKey, std::shared_ptr<NetworkMaterial>> _materialsNeedingRewrite;
+    BakeDependencies _dependencies;
 
     QString _bakedOutputDir;
     QString _textureOutputDir;
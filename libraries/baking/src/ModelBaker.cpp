@@ -133,8 +133,17 @@ void ModelBaker::initializeOutputDirs() {
 }
 
 void ModelBaker::saveSourceModel() {
-    // check if the FBX is local or first needs to be downloaded
-    if (_modelURL.isLocalFile()) {
+    // check if we were handed the FBX already, or if it is local or first needs to be downloaded
+    if (!_sourceContent.isEmpty()) {
+        bool wasWritten = writeSourceCopy(_sourceContent);
+        _sourceContent.clear();
+        if (!wasWritten) {
+            return;
+        }
+
+        // emit our signal to start the import of the model source copy
+        emit modelLoaded();
+    } else if (_modelURL.isLocalFile()) {
         // load up the local file
         QFile localModelURL { _modelURL.toLocalFile() };
 
@@ -181,23 +190,10 @@ void ModelBaker::handleModelNetworkReply() {
         qCDebug(model_baking) << "Downloaded" << _modelURL;
 
         // grab the contents of the reply and make a copy in the output folder
-        QFile copyOfOriginal(_originalOutputModelPath);
-
-        qDebug(model_baking) << "Writing copy of original model file to" << _originalOutputModelPath << copyOfOriginal.fileName();
-
-        if (!copyOfOriginal.open(QIODevice::WriteOnly)) {
-            // add an error to the error list for this model stating that a duplicate of the original model could not be made
-            handleError("Could not create copy of " + _modelURL.toString() + " (Failed to open " + _originalOutputModelPath + ")");
-            return;
-        }
-        if (copyOfOriginal.write(requestReply->readAll()) == -1) {
-            handleError("Could not create copy of " + _modelURL.toString() + " (Failed to write)");
+        if (!writeSourceCopy(requestReply->readAll())) {
             return;
         }
 
-        // close that file now that we are done writing to it
-        copyOfOriginal.close();
-
         // emit our signal to start the import of the model source copy
         emit modelLoaded();
     } else {
@@ -206,6 +202,26 @@ void ModelBaker::handleModelNetworkReply() {
     }
 }
 
+bool ModelBaker::writeSourceCopy(const QByteArray& content) {
+    QFile copyOfOriginal(_originalOutputModelPath);
+
+    qDebug(model_baking) << "Writing copy of original model file to" << _originalOutputModelPath << copyOfOriginal.fileName();
+
+    if (!copyOfOriginal.open(QIODevice::WriteOnly)) {
+        // add an error to the error list for this model stating that a duplicate of the original model could not be made
+        handleError("Could not create copy of " + _modelURL.toString() + " (Failed to open " + _originalOutputModelPath + ")");
+        return false;
+    }
+    if (copyOfOriginal.write(content) == -1) {
+        handleError("Could not create copy of " + _modelURL.toString() + " (Failed to write)");
+        return false;
+    }
+
+    // close that file now that we are done writing to it
+    copyOfOriginal.close();
+    return true;
+}
+
 void ModelBaker::bakeSourceCopy() {
     QFile modelFile(_originalOutputModelPath);
     if (!modelFile.open(QIODevice::ReadOnly)) {
@@ -213,6 +229,10 @@ void ModelBaker::bakeSourceCopy() {
         return;
     }
     hifi::ByteArray modelData = modelFile.readAll();
+    if (!_mappingURL.isEmpty() && _mappingURL != _modelURL) {
+        // the model file is named by an FST, which is what the bake is keyed by
+        _dependencies[_modelURL] = hashContent(modelData);
+    }
 
     std::vector<hifi::ByteArray> dracoMeshes;
     std::vector<std::vector<hifi::ByteArray>> dracoMaterialLists; // Material order for per-mesh material lookup used by dracoMeshes
@@ -278,10 +298,17 @@ void ModelBaker::bakeSourceCopy() {
     }
 }
 
+void ModelBaker::addDependencies(const BakeDependencies& dependencies) {
+    for (auto it = dependencies.begin(); it != dependencies.end(); ++it) {
+        _dependencies[it.key()] = it.value();
+    }
+}
+
 void ModelBaker::handleFinishedMaterialBaker() {
     auto baker = qobject_cast<MaterialBaker*>(sender());
 
     if (baker) {
+        addDependencies(baker->getDependencies());
         if (!baker->hasErrors()) {
             // this MaterialBaker is done and everything went according to plan
             qCDebug(model_baking) << "Adding baked material to FST mapping " << baker->getBakedMaterialData();
@@ -330,6 +357,7 @@ void ModelBaker::handleFinishedMaterialMapBaker() {
     auto baker = qobject_cast<MaterialBaker*>(sender());
 
     if (baker) {
+        addDependencies(baker->getDependencies());
         if (!baker->hasErrors()) {
             // this MaterialBaker is done and everything went according to plan
             qCDebug(model_baking) << "Adding baked material to FST mapping " << baker->getBakedMaterialData();
@@ -44,6 +44,8 @@ public:
     void setOutputURLSuffix(const QUrl& urlSuffix);
     void setMappingURL(const QUrl& mappingURL);
     void setMapping(const hifi::VariantHash& mapping);
+    // The model file as it was already read by the caller, so that it is not downloaded again
+    void setSourceContent(const QByteArray& sourceContent) { _sourceContent = sourceContent; }
 
     void initializeOutputDirs();
 
@@ -55,6 +57,9 @@ public:
     virtual QUrl getFullOutputMappingURL() const;
     QUrl getBakedModelURL() const { return _bakedModelURL; }
 
+    // The model file, if it was named by an FST, and the texture files the model was baked from, once the bake is finished
+    const BakeDependencies& getDependencies() const { return _dependencies; }
+
 signals:
     void modelLoaded();
 
@@ -64,6 +69,7 @@ public slots:
 
 protected:
     void saveSourceModel();
+    bool writeSourceCopy(const QByteArray& content);
     virtual void bakeProcessedSource(const hfm::Model::Pointer& hfmModel, const std::vector<hifi::ByteArray>& dracoMeshes, const std::vector<std::vector<hifi::ByteArray>>& dracoMaterialLists) = 0;
     void exportScene();
 
@@ -78,6 +84,8 @@ protected:
     QString _originalOutputModelPath;
     QString _outputMappingURL;
     QUrl _bakedModelURL;
+    BakeDependencies _dependencies;
+    QByteArray _sourceContent;
 
 protected slots:
     void handleModelNetworkReply();
@@ -89,6 +97,7 @@ private:
     void outputUnbakedFST();
     void outputBakedFST();
     void bakeMaterialMap();
+    void addDependencies(const BakeDependencies& dependencies);
 
     bool _hasBeenBaked { false };
 
@@ -37,6 +37,7 @@ TextureBaker::TextureBaker(const QUrl& textureURL, image::TextureUsage::Type tex
                            const QByteArray& textureContent) :
     _textureURL(textureURL),
     _originalTexture(textureContent),
+    _isEmbedded(!textureContent.isEmpty()),
     _textureType(textureType),
     _baseFilename(baseFilename),
     _outputDirectory(outputDirectory)
@@ -135,6 +136,7 @@ void TextureBaker::processTexture() {
     hasher.addData((const char*)&_textureType, sizeof(_textureType));
     auto hashData = hasher.result();
     std::string hash = hashData.toHex().toStdString();
+    _originalTextureHash = hashContent(_originalTexture);
 
     TextureMeta meta;
 
@@ -37,6 +37,11 @@ public:
 
     const QByteArray& getOriginalTexture() const { return _originalTexture; }
 
+    // Whether the texture was handed to us, embedded in a model, rather than read from its URL
+    bool isEmbedded() const { return _isEmbedded; }
+    // Baker::hashContent of the original texture, once it is read
+    const QByteArray& getOriginalTextureHash() const { return _originalTextureHash; }
+
     QUrl getTextureURL() const { return _textureURL; }
 
     QString getBaseFilename() const { return _baseFilename; }
@@ -46,6 +51,7 @@ public:
     virtual void setWasAborted(bool wasAborted) override;
 
     static void setCompressionEnabled(bool enabled) { _compressionEnabled = enabled; }
+    static bool isCompressionEnabled() { return _compressionEnabled; }
 
     void setMapChannel(graphics::Material::MapChannel mapChannel) { _mapChannel = mapChannel; }
     graphics::Material::MapChannel getMapChannel() const { return _mapChannel; }
@@ -67,6 +73,8 @@ private:
 
     QUrl _textureURL;
     QByteArray _originalTexture;
+    QByteArray _originalTextureHash;
+    bool _isEmbedded;
     image::TextureUsage::Type _textureType;
     graphics::Material::MapChannel _mapChannel;
     bool _mapChannelSet { false };
@@ -104,6 +104,7 @@ void FSTBaker::handleModelBakerEnded() {
     for (auto& outputFile : _modelBaker->getOutputFiles()) {
         _outputFiles.push_back(outputFile);
     }
+    _dependencies = _modelBaker->getDependencies();
 
 }
 
@@ -1290,6 +1290,8 @@ void ModelEntityRenderer::doRenderUpdateSynchronousTyped(const ScenePointer& sce
         withWriteLock([&] {
             _prevModelLoaded = false;
         });
+        // keep the download priority in step with the view while the model waits in the download queue
+        model->setLoadingPriority(EntityTreeRenderer::getEntityLoadingPriority(*entity));
         emit requestRenderUpdate();
         return;
     } else if (!_prevModelLoaded) {
@@ -70,6 +70,31 @@ void EntityEditPacketSender::queueEditEntityMessage(PacketType type,
                                                     EntityTreePointer entityTree,
                                                     EntityItemID entityItemID,
                                                     const EntityItemProperties& properties) {
+    std::vector<EditMessagePair> editMessages;
+    encodeEditEntityMessage(type, entityTree, entityItemID, properties, editMessages);
+    queueOctreeEditMessages(editMessages);
+
+    if (!editMessages.empty() && editMessages.front().first == PacketType::EntityAdd && !properties.getCertificateID().isEmpty()) {
+        emit addingEntityWithCertificate(properties.getCertificateID(), DependencyManager::get<AddressManager>()->getPlaceName());
+    }
+}
+
+void EntityEditPacketSender::queueEditEntityMessages(PacketType type, EntityTreePointer entityTree,
+                                                     const std::vector<EntityEdit>& edits) {
+    // encode everything first so the whole batch is packed into the server's pending packet in one go
+    std::vector<EditMessagePair> editMessages;
+    editMessages.reserve(edits.size());
+    for (auto& edit : edits) {
+        encodeEditEntityMessage(type, entityTree, edit.first, edit.second, editMessages);
+    }
+    queueOctreeEditMessages(editMessages);
+}
+
+void EntityEditPacketSender::encodeEditEntityMessage(PacketType type,
+                                                     EntityTreePointer entityTree,
+                                                     const EntityItemID& entityItemID,
+                                                     const EntityItemProperties& properties,
+                                                     std::vector<EditMessagePair>& editMessages) {
     if (properties.getEntityHostType() == entity::HostType::AVATAR) {
         if (!_myAvatar) {
             qCWarning(entities) << "Suppressing entity edit message: cannot send avatar entity edit with no myAvatar";
@@ -134,10 +159,7 @@ void EntityEditPacketSender::queueEditEntityMessage(PacketType type,
                 qCDebug(entities) << "    properties:" << properties;
             #endif
 
-            queueOctreeEditMessage(type, bufferOut);
-            if (type == PacketType::EntityAdd && !properties.getCertificateID().isEmpty()) {
-                emit addingEntityWithCertificate(properties.getCertificateID(), DependencyManager::get<AddressManager>()->getPlaceName());
-            }
+            editMessages.emplace_back(type, bufferOut);
         }
 
         // if we still have properties to send, switch the message type to edit, and request only the packets that didn't fit
@@ -35,6 +35,9 @@ public:
     void queueEditEntityMessage(PacketType type, EntityTreePointer entityTree,
                                 EntityItemID entityItemID, const EntityItemProperties& properties);
 
+    /// Queues edits for many entities at once, coalescing them into as few packets as possible per entity server.
+    using EntityEdit = std::pair<EntityItemID, EntityItemProperties>;
+    void queueEditEntityMessages(PacketType type, EntityTreePointer entityTree, const std::vector<EntityEdit>& edits);
 
     void queueEraseEntityMessage(const EntityItemID& entityItemID);
     void queueCloneEntityMessage(const EntityItemID& entityIDToClone, const EntityItemID& newEntityID);
@@ -51,6 +54,8 @@ public slots:
 
 private:
     friend class MyAvatar;
+    void encodeEditEntityMessage(PacketType type, EntityTreePointer entityTree, const EntityItemID& entityItemID,
+                                 const EntityItemProperties& properties, std::vector<EditMessagePair>& editMessages);
     void queueEditAvatarEntityMessage(EntityTreePointer entityTree, EntityItemID entityItemID);
 
 private:
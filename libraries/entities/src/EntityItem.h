@@ -551,6 +551,8 @@ public:
     float getBoundingRadius() const { return _boundingRadius; }
     void setSpaceIndex(int32_t index);
     int32_t getSpaceIndex() const { return _spaceIndex; }
+    void setQueryTreeProxy(int32_t proxy) { _queryTreeProxy = proxy; }
+    int32_t getQueryTreeProxy() const { return _queryTreeProxy; }
 
     virtual void preDelete();
     virtual void postParentFixup() {}
@@ -747,6 +749,7 @@ protected:
 
     float _boundingRadius { 0.0f };
     int32_t _spaceIndex { -1 }; // index to proxy in workload::Space
+    int32_t _queryTreeProxy { -1 }; // proxy in the EntityTree's query tree, which only the tree changes
 
     // TODO: move this "scriptSimulationPriority" and "pendingOwnership" stuff into EntityMotionState
     // but first would need to do some other cleanup. In the meantime these live here as "scratch space"
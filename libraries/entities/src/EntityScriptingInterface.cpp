@@ -19,6 +19,7 @@
 #include <QJsonObject>
 #include <QJsonDocument>
 #include <QJsonArray>
+#include <QtScript/QScriptValueIterator>
 
 #include <shared/QtHelpers.h>
 #include <VariantMapToScriptValue.h>
@@ -776,6 +777,314 @@ QScriptValue EntityScriptingInterface::getMultipleEntityPropertiesInternal(QScri
     return finalResult;
 }
 
+namespace {
+    // The properties that the typed array functions get and edit, each packed as a run of floats per entity.
+    enum class ArrayProperty {
+        Position,
+        Rotation,
+        Velocity,
+        AngularVelocity,
+        Dimensions,
+        LocalPosition,
+        LocalRotation,
+        LocalVelocity,
+        LocalAngularVelocity,
+        LocalDimensions,
+        Gravity,
+        Acceleration
+    };
+
+    struct ArrayPropertyInfo {
+        const char* name;
+        ArrayProperty property;
+        int numComponents;
+    };
+
+    const int VEC3_COMPONENTS = 3;
+    const int QUAT_COMPONENTS = 4;
+
+    const ArrayPropertyInfo ARRAY_PROPERTIES[] = {
+        { "position", ArrayProperty::Position, VEC3_COMPONENTS },
+        { "rotation", ArrayProperty::Rotation, QUAT_COMPONENTS },
+        { "velocity", ArrayProperty::Velocity, VEC3_COMPONENTS },
+        { "angularVelocity", ArrayProperty::AngularVelocity, VEC3_COMPONENTS },
+        { "dimensions", ArrayProperty::Dimensions, VEC3_COMPONENTS },
+        { "localPosition", ArrayProperty::LocalPosition, VEC3_COMPONENTS },
+        { "localRotation", ArrayProperty::LocalRotation, QUAT_COMPONENTS },
+        { "localVelocity", ArrayProperty::LocalVelocity, VEC3_COMPONENTS },
+        { "localAngularVelocity", ArrayProperty::LocalAngularVelocity, VEC3_COMPONENTS },
+        { "localDimensions", ArrayProperty::LocalDimensions, VEC3_COMPONENTS },
+        { "gravity", ArrayProperty::Gravity, VEC3_COMPONENTS },
+        { "acceleration", ArrayProperty::Acceleration, VEC3_COMPONENTS }
+    };
+
+    const ArrayPropertyInfo* findArrayProperty(const QString& name) {
+        for (const auto& info : ARRAY_PROPERTIES) {
+            if (name == info.name) {
+                return &info;
+            }
+        }
+        qCWarning(entities) << "Entities: can't get or edit" << name << "as a typed array";
+        return nullptr;
+    }
+
+    // quaternions are packed x, y, z, w like their script objects, which isn't how glm stores them
+    void writeQuat(const glm::quat& rotation, float* values) {
+        values[0] = rotation.x;
+        values[1] = rotation.y;
+        values[2] = rotation.z;
+        values[3] = rotation.w;
+    }
+
+    glm::quat readQuat(const float* values) {
+        return glm::quat(values[3], values[0], values[1], values[2]);
+    }
+
+    void getArrayProperty(const EntityItemPointer& entity, ArrayProperty property, float* values) {
+        glm::vec3 vector;
+        switch (property) {
+            case ArrayProperty::Position:
+                vector = entity->getWorldPosition();
+                break;
+            case ArrayProperty::Rotation:
+                writeQuat(entity->getWorldOrientation(), values);
+                return;
+            case ArrayProperty::Velocity:
+                vector = entity->getWorldVelocity();
+                break;
+            case ArrayProperty::AngularVelocity:
+                vector = entity->getWorldAngularVelocity();
+                break;
+            case ArrayProperty::Dimensions:
+                vector = entity->getScaledDimensions();
+                break;
+            case ArrayProperty::LocalPosition:
+                vector = entity->getLocalPosition();
+                break;
+            case ArrayProperty::LocalRotation:
+                writeQuat(entity->getLocalOrientation(), values);
+                return;
+            case ArrayProperty::LocalVelocity:
+                vector = entity->getLocalVelocity();
+                break;
+            case ArrayProperty::LocalAngularVelocity:
+                vector = entity->getLocalAngularVelocity();
+                break;
+            case ArrayProperty::LocalDimensions:
+                vector = entity->getUnscaledDimensions();
+                break;
+            case ArrayProperty::Gravity:
+                vector = entity->getGravity();
+                break;
+            case ArrayProperty::Acceleration:
+                vector = entity->getAcceleration();
+                break;
+        }
+        values[0] = vector.x;
+        values[1] = vector.y;
+        values[2] = vector.z;
+    }
+
+    // sets the script-side property, as editEntity() would be given it
+    void setArrayProperty(EntityItemProperties& properties, ArrayProperty property, const float* values) {
+        glm::vec3 vector(values[0], values[1], values[2]);
+        switch (property) {
+            case ArrayProperty::Position:
+                properties.setPosition(vector);
+                break;
+            case ArrayProperty::Rotation:
+                properties.setRotation(readQuat(values));
+                break;
+            case ArrayProperty::Velocity:
+                properties.setVelocity(vector);
+                break;
+            case ArrayProperty::AngularVelocity:
+                properties.setAngularVelocity(vector);
+                break;
+            case ArrayProperty::Dimensions:
+                properties.setDimensions(vector);
+                break;
+            case ArrayProperty::LocalPosition:
+                properties.setLocalPosition(vector);
+                break;
+            case ArrayProperty::LocalRotation:
+                properties.setLocalRotation(readQuat(values));
+                break;
+            case ArrayProperty::LocalVelocity:
+                properties.setLocalVelocity(vector);
+                break;
+            case ArrayProperty::LocalAngularVelocity:
+                properties.setLocalAngularVelocity(vector);
+                break;
+            case ArrayProperty::LocalDimensions:
+                properties.setLocalDimensions(vector);
+                break;
+            case ArrayProperty::Gravity:
+                properties.setGravity(vector);
+                break;
+            case ArrayProperty::Acceleration:
+                properties.setAcceleration(vector);
+                break;
+        }
+    }
+
+    // Reads the floats of a Float32Array straight from its buffer, or converts a plain array of numbers.
+    bool readFloatArray(const QScriptValue& array, std::vector<float>& values) {
+        QScriptEngine* engine = array.engine();
+        if (engine && array.instanceOf(engine->globalObject().property("Float32Array"))) {
+            QByteArray buffer = qscriptvalue_cast<QByteArray>(array.property("buffer"));
+            quint32 byteOffset = array.property("byteOffset").toUInt32();
+            quint32 length = array.property("length").toUInt32();
+            if (byteOffset + length * sizeof(float) > (quint32)buffer.size()) {
+                return false;
+            }
+            // typed arrays are little endian, like every platform we run on
+            values.resize(length);
+            memcpy(values.data(), buffer.constData() + byteOffset, length * sizeof(float));
+            return true;
+        }
+        if (array.isArray()) {
+            quint32 length = array.property("length").toUInt32();
+            values.resize(length);
+            for (quint32 i = 0; i < length; i++) {
+                values[i] = (float)array.property(i).toNumber();
+            }
+            return true;
+        }
+        return false;
+    }
+
+    QScriptValue newFloatArray(QScriptEngine* engine, const std::vector<float>& values) {
+        QByteArray buffer(reinterpret_cast<const char*>(values.data()), (int)(values.size() * sizeof(float)));
+        return engine->globalObject().property("Float32Array").construct(QScriptValueList { engine->toScriptValue(buffer) });
+    }
+}
+
+QScriptValue EntityScriptingInterface::getMultipleEntityPropertyArrays(QScriptContext* context, QScriptEngine* engine) {
+    const int ARGUMENT_ENTITY_IDS = 0;
+    const int ARGUMENT_DESIRED_PROPERTIES = 1;
+
+    auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
+    const auto entityIDs = qscriptvalue_cast<QVector<QUuid>>(context->argument(ARGUMENT_ENTITY_IDS));
+    return entityScriptingInterface->getMultipleEntityPropertyArraysInternal(engine, entityIDs,
+                                                                             context->argument(ARGUMENT_DESIRED_PROPERTIES));
+}
+
+QScriptValue EntityScriptingInterface::getMultipleEntityPropertyArraysInternal(QScriptEngine* engine,
+                                                                              const QVector<QUuid>& entityIDs,
+                                                                              const QScriptValue& desiredProperties) {
+    PROFILE_RANGE(script_entities, __FUNCTION__);
+
+    std::vector<const ArrayPropertyInfo*> properties;
+    if (desiredProperties.isArray()) {
+        const quint32 length = desiredProperties.property("length").toUInt32();
+        for (quint32 i = 0; i < length; i++) {
+            if (auto info = findArrayProperty(desiredProperties.property(i).toString())) {
+                properties.push_back(info);
+            }
+        }
+    } else if (auto info = findArrayProperty(desiredProperties.toString())) {
+        properties.push_back(info);
+    }
+
+    std::vector<std::vector<float>> values(properties.size());
+    for (size_t i = 0; i < properties.size(); i++) {
+        values[i].assign(entityIDs.size() * properties[i]->numComponents, NAN);
+    }
+
+    if (_entityTree) {
+        _entityTree->withReadLock([&] {
+            for (int i = 0; i < entityIDs.size(); i++) {
+                EntityItemPointer entity = _entityTree->findEntityByEntityItemID(EntityItemID(entityIDs[i]));
+                if (!entity) {
+                    continue;
+                }
+                for (size_t j = 0; j < properties.size(); j++) {
+                    getArrayProperty(entity, properties[j]->property, &values[j][i * properties[j]->numComponents]);
+                }
+            }
+        });
+    }
+
+    QScriptValue result = engine->newObject();
+    for (size_t i = 0; i < properties.size(); i++) {
+        result.setProperty(properties[i]->name, newFloatArray(engine, values[i]));
+    }
+    return result;
+}
+
+// Sometimes ESS don't have the entity they are trying to edit in their local tree.  In this case,
+// convertPropertiesFromScriptSemantics doesn't get called and local* edits will get dropped.
+// This is because, on the script side, "position" is in world frame, but in the network
+// protocol and in the internal data-structures, "position" is "relative to parent".
+// Compensate here.  The local* versions will get ignored during the edit-packet encoding.
+static void useLocalPropertiesForUnknownEntity(EntityItemProperties& properties) {
+    if (properties.localPositionChanged()) {
+        properties.setPosition(properties.getLocalPosition());
+    }
+    if (properties.localRotationChanged()) {
+        properties.setRotation(properties.getLocalRotation());
+    }
+    if (properties.localVelocityChanged()) {
+        properties.setVelocity(properties.getLocalVelocity());
+    }
+    if (properties.localAngularVelocityChanged()) {
+        properties.setAngularVelocity(properties.getLocalAngularVelocity());
+    }
+    if (properties.localDimensionsChanged()) {
+        properties.setDimensions(properties.getLocalDimensions());
+    }
+}
+
+void EntityScriptingInterface::restrictEditToEntity(const EntityItemPointer& entity, const SimulationOwner& simulationOwner,
+                                                    const QUuid& sessionID, EntityItemProperties& properties) {
+    if (properties.hasTransformOrVelocityChanges() && entity->hasGrabs()) {
+        // if an entity is grabbed, the grab will override any position changes
+        properties.clearTransformOrVelocityChanges();
+    }
+    if (properties.hasSimulationRestrictedChanges()) {
+        if (_bidOnSimulationOwnership) {
+            // flag for simulation ownership, or upgrade existing ownership priority
+            // (actual bids for simulation ownership are sent by the PhysicalEntitySimulation)
+            entity->upgradeScriptSimulationPriority(properties.computeSimulationBidPriority());
+            if (entity->isLocalEntity() || entity->isMyAvatarEntity() || simulationOwner.getID() == sessionID) {
+                // we own the simulation --> copy ALL restricted properties
+                properties.copySimulationRestrictedProperties(entity);
+            } else {
+                // we don't own the simulation but think we would like to
+
+                uint8_t desiredPriority = entity->getScriptSimulationPriority();
+                if (desiredPriority < simulationOwner.getPriority()) {
+                    // the priority at which we'd like to own it is not high enough
+                    // --> assume failure and clear all restricted property changes
+                    properties.clearSimulationRestrictedProperties();
+                } else {
+                    // the priority at which we'd like to own it is high enough to win.
+                    // --> assume success and copy ALL restricted properties
+                    properties.copySimulationRestrictedProperties(entity);
+                }
+            }
+        } else if (!simulationOwner.getID().isNull()) {
+            // someone owns this but not us
+            // clear restricted properties
+            properties.clearSimulationRestrictedProperties();
+        }
+        // clear the cached simulationPriority level
+        entity->upgradeScriptSimulationPriority(0);
+    }
+
+    // set these to make EntityItemProperties::getScalesWithParent() work correctly
+    entity::HostType entityHostType = entity->getEntityHostType();
+    properties.setEntityHostType(entityHostType);
+    if (entityHostType == entity::HostType::LOCAL) {
+        properties.setCollisionless(true);
+    }
+    properties.setOwningAvatarID(entity->getOwningAvatarID());
+
+    // make sure the properties has a type, so that the encode can know which properties to include
+    properties.setType(entity->getType());
+}
+
 QUuid EntityScriptingInterface::editEntity(const QUuid& id, const EntityItemProperties& scriptSideProperties) {
     PROFILE_RANGE(script_entities, __FUNCTION__);
 
@@ -812,52 +1121,7 @@ QUuid EntityScriptingInterface::editEntity(const QUuid& id, const EntityItemProp
 
     QString previousUserdata;
     if (entity) {
-        if (properties.hasTransformOrVelocityChanges() && entity->hasGrabs()) {
-            // if an entity is grabbed, the grab will override any position changes
-            properties.clearTransformOrVelocityChanges();
-        }
-        if (properties.hasSimulationRestrictedChanges()) {
-            if (_bidOnSimulationOwnership) {
-                // flag for simulation ownership, or upgrade existing ownership priority
-                // (actual bids for simulation ownership are sent by the PhysicalEntitySimulation)
-                entity->upgradeScriptSimulationPriority(properties.computeSimulationBidPriority());
-                if (entity->isLocalEntity() || entity->isMyAvatarEntity() || simulationOwner.getID() == sessionID) {
-                    // we own the simulation --> copy ALL restricted properties
-                    properties.copySimulationRestrictedProperties(entity);
-                } else {
-                    // we don't own the simulation but think we would like to
-
-                    uint8_t desiredPriority = entity->getScriptSimulationPriority();
-                    if (desiredPriority < simulationOwner.getPriority()) {
-                        // the priority at which we'd like to own it is not high enough
-                        // --> assume failure and clear all restricted property changes
-                        properties.clearSimulationRestrictedProperties();
-                    } else {
-                        // the priority at which we'd like to own it is high enough to win.
-                        // --> assume success and copy ALL restricted properties
-                        properties.copySimulationRestrictedProperties(entity);
-                    }
-                }
-            } else if (!simulationOwner.getID().isNull()) {
-                // someone owns this but not us
-                // clear restricted properties
-                properties.clearSimulationRestrictedProperties();
-            }
-            // clear the cached simulationPriority level
-            entity->upgradeScriptSimulationPriority(0);
-        }
-
-        // set these to make EntityItemProperties::getScalesWithParent() work correctly
-        entity::HostType entityHostType = entity->getEntityHostType();
-        properties.setEntityHostType(entityHostType);
-        if (entityHostType == entity::HostType::LOCAL) {
-            properties.setCollisionless(true);
-        }
-        properties.setOwningAvatarID(entity->getOwningAvatarID());
-
-        // make sure the properties has a type, so that the encode can know which properties to include
-        properties.setType(entity->getType());
-
+        restrictEditToEntity(entity, simulationOwner, sessionID, properties);
         previousUserdata = entity->getUserData();
     } else if (_bidOnSimulationOwnership) {
         // bail when simulation participants don't know about entity
@@ -916,26 +1180,7 @@ QUuid EntityScriptingInterface::editEntity(const QUuid& id, const EntityItemProp
     });
     if (!entity) {
         if (hasQueryAACubeRelatedChanges) {
-            // Sometimes ESS don't have the entity they are trying to edit in their local tree.  In this case,
-            // convertPropertiesFromScriptSemantics doesn't get called and local* edits will get dropped.
-            // This is because, on the script side, "position" is in world frame, but in the network
-            // protocol and in the internal data-structures, "position" is "relative to parent".
-            // Compensate here.  The local* versions will get ignored during the edit-packet encoding.
-            if (properties.localPositionChanged()) {
-                properties.setPosition(properties.getLocalPosition());
-            }
-            if (properties.localRotationChanged()) {
-                properties.setRotation(properties.getLocalRotation());
-            }
-            if (properties.localVelocityChanged()) {
-                properties.setVelocity(properties.getLocalVelocity());
-            }
-            if (properties.localAngularVelocityChanged()) {
-                properties.setAngularVelocity(properties.getLocalAngularVelocity());
-            }
-            if (properties.localDimensionsChanged()) {
-                properties.setDimensions(properties.getLocalDimensions());
-            }
+            useLocalPropertiesForUnknownEntity(properties);
         }
         // we've made an edit to an entity we don't know about, or to a non-entity.  If it's a known non-entity,
         // print a warning and don't send an edit packet to the entity-server.
@@ -961,6 +1206,123 @@ QUuid EntityScriptingInterface::editEntity(const QUuid& id, const EntityItemProp
     return id;
 }
 
+QScriptValue EntityScriptingInterface::editMultipleEntities(QScriptContext* context, QScriptEngine* engine) {
+    const int ARGUMENT_ENTITY_IDS = 0;
+    const int ARGUMENT_PROPERTY_ARRAYS = 1;
+
+    auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
+    const auto entityIDs = qscriptvalue_cast<QVector<QUuid>>(context->argument(ARGUMENT_ENTITY_IDS));
+    return entityScriptingInterface->editMultipleEntitiesInternal(entityIDs, context->argument(ARGUMENT_PROPERTY_ARRAYS));
+}
+
+int EntityScriptingInterface::editMultipleEntitiesInternal(const QVector<QUuid>& entityIDs,
+                                                           const QScriptValue& propertyArrays) {
+    PROFILE_RANGE(script_entities, __FUNCTION__);
+
+    std::vector<const ArrayPropertyInfo*> arrayProperties;
+    std::vector<std::vector<float>> values;
+    QScriptValueIterator it(propertyArrays);
+    while (it.hasNext()) {
+        it.next();
+        auto info = findArrayProperty(it.name());
+        if (!info) {
+            continue;
+        }
+        std::vector<float> propertyValues;
+        if (!readFloatArray(it.value(), propertyValues) ||
+            propertyValues.size() != (size_t)(entityIDs.size() * info->numComponents)) {
+            qCWarning(entities) << "Entities.editMultipleEntities():" << it.name() << "needs"
+                << info->numComponents << "numbers for each of the" << entityIDs.size() << "entities";
+            return 0;
+        }
+        arrayProperties.push_back(info);
+        values.push_back(std::move(propertyValues));
+    }
+    if (arrayProperties.empty()) {
+        return 0;
+    }
+
+    _activityTracking.editedEntityCount += entityIDs.size();
+
+    const auto sessionID = DependencyManager::get<NodeList>()->getSessionUUID();
+    auto scriptSideProperties = [&](int index) {
+        EntityItemProperties result;
+        for (size_t i = 0; i < arrayProperties.size(); i++) {
+            setArrayProperty(result, arrayProperties[i]->property, &values[i][index * arrayProperties[i]->numComponents]);
+        }
+        return result;
+    };
+
+    // the edits are sent once the tree is unlocked
+    std::vector<std::pair<EntityItemID, EntityItemProperties>> edits;
+    edits.reserve(entityIDs.size());
+    int numEdited = 0;
+
+    if (!_entityTree) {
+        for (int i = 0; i < entityIDs.size(); i++) {
+            EntityItemProperties properties = scriptSideProperties(i);
+            properties.setLastEditedBy(sessionID);
+            edits.emplace_back(EntityItemID(entityIDs[i]), properties);
+        }
+        numEdited = entityIDs.size();
+    } else {
+        // the same as editEntity() for each, but all under the one lock
+        _entityTree->withWriteLock([&] {
+            uint64_t now = usecTimestampNow();
+            for (int i = 0; i < entityIDs.size(); i++) {
+                EntityItemID entityID(entityIDs[i]);
+                EntityItemProperties properties = scriptSideProperties(i);
+                EntityItemPointer entity = _entityTree->findEntityByEntityItemID(entityID);
+
+                if (!entity) {
+                    // bail when simulation participants don't know about entity, otherwise send it on to the server
+                    if (!_bidOnSimulationOwnership) {
+                        properties = convertPropertiesFromScriptSemantics(properties, properties.getScalesWithParent());
+                        properties.setLastEditedBy(sessionID);
+                        if (properties.queryAACubeRelatedPropertyChanged()) {
+                            useLocalPropertiesForUnknownEntity(properties);
+                        }
+                        edits.emplace_back(entityID, properties);
+                        numEdited++;
+                    }
+                    continue;
+                }
+                if (entity->isAvatarEntity() && !entity->isMyAvatarEntity()) {
+                    // don't edit other avatar's avatarEntities
+                    continue;
+                }
+
+                restrictEditToEntity(entity, entity->getSimulationOwner(), sessionID, properties);
+                properties = convertPropertiesFromScriptSemantics(properties, properties.getScalesWithParent());
+                properties.setLastEditedBy(sessionID);
+                _entityTree->updateEntity(entityID, properties);
+                entity->setLastBroadcast(now);
+
+                if (properties.queryAACubeRelatedPropertyChanged()) {
+                    properties.setQueryAACube(entity->getQueryAACube());
+
+                    entity->forEachDescendant([&](SpatiallyNestablePointer descendant) {
+                        if (descendant->getNestableType() == NestableType::Entity && descendant->updateQueryAACube()) {
+                            EntityItemProperties newQueryCubeProperties;
+                            newQueryCubeProperties.setQueryAACube(descendant->getQueryAACube());
+                            newQueryCubeProperties.setLastEdited(properties.getLastEdited());
+                            edits.emplace_back(descendant->getID(), newQueryCubeProperties);
+                            std::static_pointer_cast<EntityItem>(descendant)->setLastBroadcast(now);
+                        }
+                    });
+                }
+                edits.emplace_back(entityID, properties);
+                numEdited++;
+            }
+        });
+    }
+
+    for (const auto& edit : edits) {
+        queueEntityMessage(PacketType::EntityEdit, edit.first, edit.second);
+    }
+    return numEdited;
+}
+
 void EntityScriptingInterface::deleteEntity(const QUuid& id) {
     PROFILE_RANGE(script_entities, __FUNCTION__);
 
@@ -1152,6 +1514,38 @@ QVector<QUuid> EntityScriptingInterface::findEntities(const glm::vec3& center, f
     return result;
 }
 
+QScriptValue EntityScriptingInterface::findEntitiesInSpheres(QScriptContext* context, QScriptEngine* engine) {
+    const int ARGUMENT_CENTERS = 0;
+    const int ARGUMENT_RADII = 1;
+
+    auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
+    const QVector<glm::vec3> centers = qVectorVec3FromScriptValue(context->argument(ARGUMENT_CENTERS));
+    const QScriptValue radiiValue = context->argument(ARGUMENT_RADII);
+    const QVector<float> radii = radiiValue.isNumber() ? QVector<float>(centers.size(), (float)radiiValue.toNumber()) :
+        qVectorFloatFromScriptValue(radiiValue);
+
+    const QVector<QVector<QUuid>> found = entityScriptingInterface->findEntitiesInSpheresInternal(centers, radii);
+    QScriptValue result = engine->newArray(found.size());
+    for (int i = 0; i < found.size(); i++) {
+        result.setProperty(i, engine->toScriptValue(found[i]));
+    }
+    return result;
+}
+
+QVector<QVector<QUuid>> EntityScriptingInterface::findEntitiesInSpheresInternal(const QVector<glm::vec3>& centers,
+                                                                                const QVector<float>& radii) const {
+    PROFILE_RANGE(script_entities, __FUNCTION__);
+
+    QVector<QVector<QUuid>> result;
+    if (_entityTree) {
+        unsigned int searchFilter = PickFilter::getBitMask(PickFilter::FlagBit::DOMAIN_ENTITIES) | PickFilter::getBitMask(PickFilter::FlagBit::AVATAR_ENTITIES);
+        _entityTree->withReadLock([&] {
+            _entityTree->evalEntitiesInSpheres(centers, radii, PickFilter(searchFilter), result);
+        });
+    }
+    return result;
+}
+
 QVector<QUuid> EntityScriptingInterface::findEntitiesInBox(const glm::vec3& corner, const glm::vec3& dimensions) const {
     PROFILE_RANGE(script_entities, __FUNCTION__);
 
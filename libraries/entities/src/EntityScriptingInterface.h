@@ -203,6 +203,79 @@ public:
     static QScriptValue getMultipleEntityProperties(QScriptContext* context, QScriptEngine* engine);
     QScriptValue getMultipleEntityPropertiesInternal(QScriptEngine* engine, QVector<QUuid> entityIDs, const QScriptValue& extendedDesiredProperties);
 
+    /**jsdoc
+     * Gets position, rotation, velocity and size properties of multiple entities as typed arrays, much more cheaply than
+     * {@link Entities.getMultipleEntityProperties|getMultipleEntityProperties} when there are many entities.
+     * <p>Each property's values are packed into a <code>Float32Array</code>, one after another in the order of the entity
+     * IDs: 3 numbers per entity for a {@link Vec3} and 4 for a {@link Quat} (<code>x, y, z, w</code>). The values of an
+     * entity that can't be found are <code>NaN</code>, which read back as <code>undefined</code>.</p>
+     * <p>The properties that can be got are: <code>position</code>, <code>rotation</code>, <code>velocity</code>,
+     * <code>angularVelocity</code>, <code>dimensions</code>, <code>localPosition</code>, <code>localRotation</code>,
+     * <code>localVelocity</code>, <code>localAngularVelocity</code>, <code>localDimensions</code>, <code>gravity</code>
+     * and <code>acceleration</code>.</p>
+     * @function Entities.getMultipleEntityPropertyArrays
+     * @param {Uuid[]} entityIDs - The IDs of the entities to get the properties of.
+     * @param {string[]|string} desiredProperties - The name or names of the properties to get.
+     * @returns {object} An object with a <code>Float32Array</code> for each of the desired properties, named by the
+     *     property.
+     * @example <caption>Report the positions of the nearby entities.</caption>
+     * var entityIDs = Entities.findEntities(MyAvatar.position, 50);
+     * var positions = Entities.getMultipleEntityPropertyArrays(entityIDs, "position").position;
+     * for (var i = 0; i < entityIDs.length; i++) {
+     *     print(entityIDs[i] + ": " + positions[3 * i] + ", " + positions[3 * i + 1] + ", " + positions[3 * i + 2]);
+     * }
+     */
+    static QScriptValue getMultipleEntityPropertyArrays(QScriptContext* context, QScriptEngine* engine);
+    QScriptValue getMultipleEntityPropertyArraysInternal(QScriptEngine* engine, const QVector<QUuid>& entityIDs,
+        const QScriptValue& desiredProperties);
+
+    /**jsdoc
+     * Edits multiple entities at once, with their new property values packed into typed arrays.  This takes the entity
+     * tree's lock once for all the edits rather than for each, so is much cheaper than calling
+     * {@link Entities.editEntity|editEntity} for each of many entities.
+     * <p>The values are packed the same as for {@link Entities.getMultipleEntityPropertyArrays|
+     * getMultipleEntityPropertyArrays}, and the same properties can be edited.  Plain arrays of numbers may be used in
+     * place of <code>Float32Array</code>s.</p>
+     * @function Entities.editMultipleEntities
+     * @param {Uuid[]} entityIDs - The IDs of the entities to edit.
+     * @param {object} propertyArrays - A <code>Float32Array</code> of new values for each property to edit, named by the
+     *     property.
+     * @returns {number} The number of entities edited.
+     * @example <caption>Spread the nearby entities out in a row.</caption>
+     * var entityIDs = Entities.findEntities(MyAvatar.position, 10);
+     * var positions = new Float32Array(3 * entityIDs.length);
+     * for (var i = 0; i < entityIDs.length; i++) {
+     *     positions[3 * i] = MyAvatar.position.x + i;
+     *     positions[3 * i + 1] = MyAvatar.position.y;
+     *     positions[3 * i + 2] = MyAvatar.position.z - 5;
+     * }
+     * Entities.editMultipleEntities(entityIDs, { position: positions });
+     */
+    static QScriptValue editMultipleEntities(QScriptContext* context, QScriptEngine* engine);
+    int editMultipleEntitiesInternal(const QVector<QUuid>& entityIDs, const QScriptValue& propertyArrays);
+
+    /**jsdoc
+     * Finds all domain and avatar entities that intersect each of several spheres, as
+     * {@link Entities.findEntities|findEntities} does for one.  This takes the entity tree's lock once for all the spheres
+     * rather than for each, so is cheaper than calling {@link Entities.findEntities|findEntities} for each of many spheres.
+     * @function Entities.findEntitiesInSpheres
+     * @param {Vec3[]} centers - The points about which to search.
+     * @param {number[]|number} radii - The radius of each sphere, or one radius for all of them.
+     * @returns {Uuid[][]} For each sphere, an array of the IDs of the entities that intersect it.
+     * @example <caption>Report how many entities are within 5m of each of the nearby avatars.</caption>
+     * var avatarIDs = AvatarList.getAvatarsInRange(MyAvatar.position, 50);
+     * var centers = avatarIDs.map(function (avatarID) {
+     *     return AvatarList.getAvatar(avatarID).position;
+     * });
+     * var entityIDs = Entities.findEntitiesInSpheres(centers, 5);
+     * for (var i = 0; i < avatarIDs.length; i++) {
+     *     print("Number of entities within 5m of " + avatarIDs[i] + ": " + entityIDs[i].length);
+     * }
+     */
+    static QScriptValue findEntitiesInSpheres(QScriptContext* context, QScriptEngine* engine);
+    QVector<QVector<QUuid>> findEntitiesInSpheresInternal(const QVector<glm::vec3>& centers,
+        const QVector<float>& radii) const;
+
     QUuid addEntityInternal(const EntityItemProperties& properties, entity::HostType entityHostType);
 
 public slots:
@@ -2504,6 +2577,9 @@ private:
     bool polyVoxWorker(QUuid entityID, std::function<bool(PolyVoxEntityItem&)> actor);
     bool setPoints(QUuid entityID, std::function<bool(LineEntityItem&)> actor);
     void queueEntityMessage(PacketType packetType, EntityItemID entityID, const EntityItemProperties& properties);
+    // Drops or completes the changes of an edit to an entity in the local tree, by grabs and simulation ownership.
+    void restrictEditToEntity(const EntityItemPointer& entity, const SimulationOwner& simulationOwner,
+                              const QUuid& sessionID, EntityItemProperties& properties);
     bool addLocalEntityCopy(EntityItemProperties& propertiesWithSimID, EntityItemID& id, bool isClone = false);
 
     EntityItemPointer checkForTreeEntityAndTypeMatch(const QUuid& entityID,
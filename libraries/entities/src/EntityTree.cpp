@@ -788,85 +788,31 @@ void EntityTree::processRemovedEntities(const DeleteEntityOperator& theOperator)
     }
 }
 
-class RayArgs {
-public:
-    // Inputs
-    glm::vec3 origin;
-    glm::vec3 direction;
-    glm::vec3 invDirection;
-    const QVector<EntityItemID>& entityIdsToInclude;
-    const QVector<EntityItemID>& entityIdsToDiscard;
-    PickFilter searchFilter;
-
-    // Outputs
-    OctreeElementPointer& element;
-    float& distance;
-    BoxFace& face;
-    glm::vec3& surfaceNormal;
-    QVariantMap& extraInfo;
-    EntityItemID entityID;
-};
-
-bool evalRayIntersectionOp(const OctreeElementPointer& element, void* extraData) {
-    RayArgs* args = static_cast<RayArgs*>(extraData);
-    bool keepSearching = true;
-    EntityTreeElementPointer entityTreeElementPointer = std::static_pointer_cast<EntityTreeElement>(element);
-    EntityItemID entityID = entityTreeElementPointer->evalRayIntersection(args->origin, args->direction,
-        args->element, args->distance, args->face, args->surfaceNormal, args->entityIdsToInclude,
-        args->entityIdsToDiscard, args->searchFilter, args->extraInfo);
-    if (!entityID.isNull()) {
-        args->entityID = entityID;
-        // We recurse OctreeElements in order, so if we hit something, we can stop immediately
-        keepSearching = false;
-    }
-    return keepSearching;
-}
-
-float evalRayIntersectionSortingOp(const OctreeElementPointer& element, void* extraData) {
-    RayArgs* args = static_cast<RayArgs*>(extraData);
-    EntityTreeElementPointer entityTreeElementPointer = std::static_pointer_cast<EntityTreeElement>(element);
-    float distance = FLT_MAX;
-    // If origin is inside the cube, always check this element first
-    if (entityTreeElementPointer->getAACube().contains(args->origin)) {
-        distance = 0.0f;
-    } else {
-        float boundDistance = FLT_MAX;
-        BoxFace face;
-        glm::vec3 surfaceNormal;
-        if (entityTreeElementPointer->getAACube().findRayIntersection(args->origin, args->direction, args->invDirection, boundDistance, face, surfaceNormal)) {
-            // Don't add this cell if it's already farther than our best distance so far
-            if (boundDistance < args->distance) {
-                distance = boundDistance;
-            }
-        }
-    }
-    return distance;
-}
-
 EntityItemID EntityTree::evalRayIntersection(const glm::vec3& origin, const glm::vec3& direction,
                                     QVector<EntityItemID> entityIdsToInclude, QVector<EntityItemID> entityIdsToDiscard,
                                     PickFilter searchFilter, OctreeElementPointer& element, float& distance,
                                     BoxFace& face, glm::vec3& surfaceNormal, QVariantMap& extraInfo,
                                     Octree::lockType lockType, bool* accurateResult) {
-
-    // calculate dirReciprocal like this rather than with glm's scalar / vec3 template to avoid NaNs.
-    vec3 dirReciprocal = glm::vec3(direction.x == 0.0f ? 0.0f : 1.0f / direction.x,
-                                   direction.y == 0.0f ? 0.0f : 1.0f / direction.y,
-                                   direction.z == 0.0f ? 0.0f : 1.0f / direction.z);
-    RayArgs args = { origin, direction, dirReciprocal, entityIdsToInclude, entityIdsToDiscard,
-            searchFilter, element, distance, face, surfaceNormal, extraInfo, EntityItemID() };
+    EntityItemID entityID;
     distance = FLT_MAX;
 
     bool requireLock = lockType == Octree::Lock;
     bool lockResult = withReadLock([&]{
-        recurseTreeWithOperationSorted(evalRayIntersectionOp, evalRayIntersectionSortingOp, &args);
+        // the query tree offers entities nearest first, and skips those beyond the nearest hit so far
+        _queryTree.findRayHits(origin, direction, FLT_MAX, [&](const EntityItemPointer& entity, float entryDistance) {
+            if (EntityTreeElement::evalEntityRayIntersection(entity, origin, direction, element, distance, face,
+                    surfaceNormal, entityIdsToInclude, entityIdsToDiscard, searchFilter, extraInfo)) {
+                entityID = entity->getEntityItemID();
+            }
+            return distance;
+        });
     }, requireLock);
 
     if (accurateResult) {
         *accurateResult = lockResult; // if user asked to accuracy or result, let them know this is accurate
     }
 
-    return args.entityID;
+    return entityID;
 }
 
 class ParabolaArgs {
@@ -952,248 +898,139 @@ EntityItemID EntityTree::evalParabolaIntersection(const PickParabola& parabola,
     return args.entityID;
 }
 
-class FindClosestEntityArgs {
-public:
-    // Inputs
-    glm::vec3 position;
-    float targetRadius;
-    PickFilter searchFilter;
-
-    // Outputs
+// NOTE: assumes caller has handled locking
+QUuid EntityTree::evalClosestEntity(const glm::vec3& position, float targetRadius, PickFilter searchFilter) {
     QUuid closestEntity;
-    float closestEntityDistance;
-};
-
-
-bool evalClosestEntityOperation(const OctreeElementPointer& element, void* extraData) {
-    FindClosestEntityArgs* args = static_cast<FindClosestEntityArgs*>(extraData);
-    EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
-
-    glm::vec3 penetration;
-    bool sphereIntersection = entityTreeElement->getAACube().findSpherePenetration(args->position, args->targetRadius, penetration);
-
-    // If this entityTreeElement contains the point, then search it...
-    if (sphereIntersection) {
-        float closestDistanceSquared = FLT_MAX;
-        QUuid thisClosestEntity = entityTreeElement->evalClosetEntity(args->position, args->searchFilter, closestDistanceSquared);
-
-        // we may have gotten NULL back, meaning no entity was available
-        if (!thisClosestEntity.isNull()) {
-            float distanceFromPointToEntity = glm::sqrt(closestDistanceSquared);
-
-            // If we're within our target radius
-            if (distanceFromPointToEntity <= args->targetRadius) {
-                // we are closer than anything else we've found
-                if (distanceFromPointToEntity < args->closestEntityDistance) {
-                    args->closestEntity = thisClosestEntity;
-                    args->closestEntityDistance = distanceFromPointToEntity;
-                }
-            }
+    float closestDistanceSquared = FLT_MAX;
+    float targetRadiusSquared = targetRadius * targetRadius;
+    _queryTree.findTouchingSphere(position, targetRadius, [&](const EntityItemPointer& entity) {
+        if (!EntityTreeElement::checkFilterSettings(entity, searchFilter)) {
+            return;
         }
-
-        // we should be able to optimize this...
-        return true; // keep searching in case children have closer entities
-    }
-
-    // if this element doesn't contain the point, then none of its children can contain the point, so stop searching
-    return false;
+        float distanceSquared = glm::distance2(position, entity->getWorldPosition());
+        if (distanceSquared <= targetRadiusSquared && distanceSquared < closestDistanceSquared) {
+            closestEntity = entity->getID();
+            closestDistanceSquared = distanceSquared;
+        }
+    });
+    return closestEntity;
 }
 
 // NOTE: assumes caller has handled locking
-QUuid EntityTree::evalClosestEntity(const glm::vec3& position, float targetRadius, PickFilter searchFilter) {
-    FindClosestEntityArgs args = { position, targetRadius, searchFilter, QUuid(), FLT_MAX };
-    recurseTreeWithOperation(evalClosestEntityOperation, &args);
-    return args.closestEntity;
-}
-
-class FindEntitiesInSphereArgs {
-public:
-    // Inputs
-    glm::vec3 position;
-    float targetRadius;
-    PickFilter searchFilter;
-
-    // Outputs
+void EntityTree::evalEntitiesInSphere(const glm::vec3& center, float radius, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
     QVector<QUuid> entities;
-};
-
-bool evalInSphereOperation(const OctreeElementPointer& element, void* extraData) {
-    FindEntitiesInSphereArgs* args = static_cast<FindEntitiesInSphereArgs*>(extraData);
-    glm::vec3 penetration;
-    bool sphereIntersection = element->getAACube().findSpherePenetration(args->position, args->targetRadius, penetration);
-
-    // If this element contains the point, then search it...
-    if (sphereIntersection) {
-        EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
-        entityTreeElement->evalEntitiesInSphere(args->position, args->targetRadius, args->searchFilter, args->entities);
-        return true; // keep searching in case children have closer entities
-    }
-
-    // if this element doesn't contain the point, then none of it's children can contain the point, so stop searching
-    return false;
+    _queryTree.findTouchingSphere(center, radius, [&](const EntityItemPointer& entity) {
+        if (EntityTreeElement::checkFilterSettings(entity, searchFilter) &&
+                EntityTreeElement::entityTouchesSphere(entity, center, radius)) {
+            entities.push_back(entity->getID());
+        }
+    });
+    foundEntities.swap(entities);
 }
 
 // NOTE: assumes caller has handled locking
-void EntityTree::evalEntitiesInSphere(const glm::vec3& center, float radius, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
-    FindEntitiesInSphereArgs args = { center, radius, searchFilter, QVector<QUuid>() };
-    recurseTreeWithOperation(evalInSphereOperation, &args);
-    foundEntities.swap(args.entities);
-}
-
-class FindEntitiesInSphereWithTypeArgs {
-public:
-    // Inputs
-    glm::vec3 position;
-    float targetRadius;
-    EntityTypes::EntityType type;
-    PickFilter searchFilter;
-
-    // Outputs
-    QVector<QUuid> entities;
-};
-
-bool evalInSphereWithTypeOperation(const OctreeElementPointer& element, void* extraData) {
-    FindEntitiesInSphereWithTypeArgs* args = static_cast<FindEntitiesInSphereWithTypeArgs*>(extraData);
-    glm::vec3 penetration;
-    bool sphereIntersection = element->getAACube().findSpherePenetration(args->position, args->targetRadius, penetration);
-
-    // If this element contains the point, then search it...
-    if (sphereIntersection) {
-        EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
-        entityTreeElement->evalEntitiesInSphereWithType(args->position, args->targetRadius, args->type, args->searchFilter, args->entities);
-        return true; // keep searching in case children have closer entities
+void EntityTree::evalEntitiesInSpheres(const QVector<glm::vec3>& centers, const QVector<float>& radii, PickFilter searchFilter,
+                                       QVector<QVector<QUuid>>& foundEntities) {
+    int numSpheres = std::min(centers.size(), radii.size());
+    foundEntities.resize(numSpheres);
+    for (int i = 0; i < numSpheres; ++i) {
+        evalEntitiesInSphere(centers[i], radii[i], searchFilter, foundEntities[i]);
     }
-
-    // if this element doesn't contain the point, then none of it's children can contain the point, so stop searching
-    return false;
 }
 
 // NOTE: assumes caller has handled locking
 void EntityTree::evalEntitiesInSphereWithType(const glm::vec3& center, float radius, EntityTypes::EntityType type, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
-    FindEntitiesInSphereWithTypeArgs args = { center, radius, type, searchFilter, QVector<QUuid>() };
-    recurseTreeWithOperation(evalInSphereWithTypeOperation, &args);
-    foundEntities.swap(args.entities);
-}
-
-class FindEntitiesInSphereWithNameArgs {
-public:
-    // Inputs
-    glm::vec3 position;
-    float targetRadius;
-    QString name;
-    bool caseSensitive;
-    PickFilter searchFilter;
-
-    // Outputs
     QVector<QUuid> entities;
-};
-
-bool evalInSphereWithNameOperation(const OctreeElementPointer& element, void* extraData) {
-    FindEntitiesInSphereWithNameArgs* args = static_cast<FindEntitiesInSphereWithNameArgs*>(extraData);
-    glm::vec3 penetration;
-    bool sphereIntersection = element->getAACube().findSpherePenetration(args->position, args->targetRadius, penetration);
-
-    // If this element contains the point, then search it...
-    if (sphereIntersection) {
-        EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
-        entityTreeElement->evalEntitiesInSphereWithName(args->position, args->targetRadius, args->name, args->caseSensitive, args->searchFilter, args->entities);
-        return true; // keep searching in case children have closer entities
-    }
-
-    // if this element doesn't contain the point, then none of it's children can contain the point, so stop searching
-    return false;
+    _queryTree.findTouchingSphere(center, radius, [&](const EntityItemPointer& entity) {
+        if (EntityTreeElement::checkFilterSettings(entity, searchFilter) && type == entity->getType() &&
+                EntityTreeElement::entityTouchesSphere(entity, center, radius)) {
+            entities.push_back(entity->getID());
+        }
+    });
+    foundEntities.swap(entities);
 }
 
 // NOTE: assumes caller has handled locking
 void EntityTree::evalEntitiesInSphereWithName(const glm::vec3& center, float radius, const QString& name, bool caseSensitive, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
-    FindEntitiesInSphereWithNameArgs args = { center, radius, name, caseSensitive, searchFilter, QVector<QUuid>() };
-    recurseTreeWithOperation(evalInSphereWithNameOperation, &args);
-    foundEntities.swap(args.entities);
-}
-
-class FindEntitiesInCubeArgs {
-public:
-    // Inputs
-    AACube cube;
-    PickFilter searchFilter;
-
-    // Outputs
     QVector<QUuid> entities;
-};
-
-bool findInCubeOperation(const OctreeElementPointer& element, void* extraData) {
-    FindEntitiesInCubeArgs* args = static_cast<FindEntitiesInCubeArgs*>(extraData);
-    if (element->getAACube().touches(args->cube)) {
-        EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
-        entityTreeElement->evalEntitiesInCube(args->cube, args->searchFilter, args->entities);
-        return true;
-    }
-    return false;
+    _queryTree.findTouchingSphere(center, radius, [&](const EntityItemPointer& entity) {
+        if (EntityTreeElement::checkFilterSettings(entity, searchFilter) &&
+                EntityTreeElement::entityHasName(entity, name, caseSensitive) &&
+                EntityTreeElement::entityTouchesSphere(entity, center, radius)) {
+            entities.push_back(entity->getID());
+        }
+    });
+    foundEntities.swap(entities);
 }
 
 // NOTE: assumes caller has handled locking
 void EntityTree::evalEntitiesInCube(const AACube& cube, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
-    FindEntitiesInCubeArgs args { cube, searchFilter, QVector<QUuid>() };
-    recurseTreeWithOperation(findInCubeOperation, &args);
-    foundEntities.swap(args.entities);
+    evalEntitiesInBox(AABox(cube), searchFilter, foundEntities);
 }
 
-class FindEntitiesInBoxArgs {
-public:
-    // Inputs
-    AABox box;
-    PickFilter searchFilter;
-
-    // Outputs
+// NOTE: assumes caller has handled locking
+void EntityTree::evalEntitiesInBox(const AABox& box, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
     QVector<QUuid> entities;
-};
-
-bool findInBoxOperation(const OctreeElementPointer& element, void* extraData) {
-    FindEntitiesInBoxArgs* args = static_cast<FindEntitiesInBoxArgs*>(extraData);
-    if (element->getAACube().touches(args->box)) {
-        EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
-        entityTreeElement->evalEntitiesInBox(args->box, args->searchFilter, args->entities);
-        return true;
-    }
-    return false;
+    _queryTree.findTouchingBox(box, [&](const EntityItemPointer& entity) {
+        if (!EntityTreeElement::checkFilterSettings(entity, searchFilter)) {
+            return;
+        }
+        // If the entities AABox touches the search box then consider it to be found
+        bool success;
+        AABox entityBox = entity->getAABox(success);
+        if (success && entityBox.touches(box)) {
+            entities.push_back(entity->getID());
+        }
+    });
+    foundEntities.swap(entities);
 }
 
 // NOTE: assumes caller has handled locking
-void EntityTree::evalEntitiesInBox(const AABox& box, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
-    FindEntitiesInBoxArgs args { box, searchFilter, QVector<QUuid>() };
-    // NOTE: This should use recursion, since this is a spatial operation
-    recurseTreeWithOperation(findInBoxOperation, &args);
-    // swap the two lists of entity pointers instead of copy
-    foundEntities.swap(args.entities);
+void EntityTree::evalEntitiesInFrustum(const ViewFrustum& frustum, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
+    auto boxInView = [&](const AABox& box) {
+        return frustum.boxIntersectsFrustum(box) || frustum.boxIntersectsKeyhole(box);
+    };
+    QVector<QUuid> entities;
+    _queryTree.findTouching(boxInView, [&](const EntityItemPointer& entity) {
+        if (!EntityTreeElement::checkFilterSettings(entity, searchFilter)) {
+            return;
+        }
+        bool success;
+        AABox entityBox = entity->getAABox(success);
+        if (success && boxInView(entityBox)) {
+            entities.push_back(entity->getID());
+        }
+    });
+    foundEntities.swap(entities);
 }
 
-class FindEntitiesInFrustumArgs {
-public:
-    // Inputs
-    ViewFrustum frustum;
-    PickFilter searchFilter;
+bool EntityTree::canChangeQueryTree() const {
+    // the query tree has no lock of its own, so it may only be changed by the thread holding the tree's write lock
+    return isWriteLockedByCurrentThread();
+}
 
-    // Outputs
-    QVector<QUuid> entities;
-};
+void EntityTree::addToQueryTree(const EntityItemPointer& entity) {
+    assert(canChangeQueryTree());
+    if (entity->getQueryTreeProxy() == AABoxTree<EntityItemPointer>::NULL_PROXY) {
+        entity->setQueryTreeProxy(_queryTree.insert(AABox(entity->getQueryAACube()), entity));
+    }
+}
 
-bool findInFrustumOperation(const OctreeElementPointer& element, void* extraData) {
-    FindEntitiesInFrustumArgs* args = static_cast<FindEntitiesInFrustumArgs*>(extraData);
-    if (element->isInView(args->frustum)) {
-        EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
-        entityTreeElement->evalEntitiesInFrustum(args->frustum, args->searchFilter, args->entities);
-        return true;
+void EntityTree::updateInQueryTree(const EntityItemPointer& entity, const AACube& queryAACube) {
+    assert(canChangeQueryTree());
+    int32_t proxy = entity->getQueryTreeProxy();
+    if (proxy != AABoxTree<EntityItemPointer>::NULL_PROXY) {
+        _queryTree.update(proxy, AABox(queryAACube));
     }
-    return false;
 }
 
-// NOTE: assumes caller has handled locking
-void EntityTree::evalEntitiesInFrustum(const ViewFrustum& frustum, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
-    FindEntitiesInFrustumArgs args = { frustum, searchFilter, QVector<QUuid>() };
-    // NOTE: This should use recursion, since this is a spatial operation
-    recurseTreeWithOperation(findInFrustumOperation, &args);
-    // swap the two lists of entity pointers instead of copy
-    foundEntities.swap(args.entities);
+void EntityTree::removeFromQueryTree(const EntityItemPointer& entity) {
+    assert(canChangeQueryTree());
+    int32_t proxy = entity->getQueryTreeProxy();
+    if (proxy != AABoxTree<EntityItemPointer>::NULL_PROXY) {
+        _queryTree.remove(proxy);
+        entity->setQueryTreeProxy(AABoxTree<EntityItemPointer>::NULL_PROXY);
+    }
 }
 
 EntityItemPointer EntityTree::findEntityByID(const QUuid& id) const {
@@ -2653,28 +2490,32 @@ QVector<EntityItemID> EntityTree::sendEntities(EntityEditPacketSender* packetSen
     // that isn't in the data being imported.  For those that made it, fix up their queryAACubes and send an
     // add-entity packet to the server.
 
-    // fix the queryAACubes of any children that were read in before their parents, get them into the correct element
-    MovingEntitiesOperator moveOperator;
-    QHash<EntityItemID, EntityItemID>::iterator i = map.begin();
-    while (i != map.end()) {
-        EntityItemID newID = i.value();
-        EntityItemPointer entity = localTree->findEntityByEntityItemID(newID);
-        if (entity) {
-            if (!entity->getParentID().isNull()) {
-                addToNeedsParentFixupList(entity);
+    // fix the queryAACubes of any children that were read in before their parents, get them into the correct element.
+    // Adding to the move list updates the local tree's query tree, so script threads must not be reading it meanwhile
+    QHash<EntityItemID, EntityItemID>::iterator i;
+    localTree->withWriteLock([&] {
+        MovingEntitiesOperator moveOperator;
+        i = map.begin();
+        while (i != map.end()) {
+            EntityItemID newID = i.value();
+            EntityItemPointer entity = localTree->findEntityByEntityItemID(newID);
+            if (entity) {
+                if (!entity->getParentID().isNull()) {
+                    addToNeedsParentFixupList(entity);
+                }
+                entity->forceQueryAACubeUpdate();
+                entity->updateQueryAACube();
+                moveOperator.addEntityToMoveList(entity, entity->getQueryAACube());
+                i++;
+            } else {
+                i = map.erase(i);
             }
-            entity->forceQueryAACubeUpdate();
-            entity->updateQueryAACube();
-            moveOperator.addEntityToMoveList(entity, entity->getQueryAACube());
-            i++;
-        } else {
-            i = map.erase(i);
         }
-    }
-    if (moveOperator.hasMovingEntities()) {
-        PerformanceTimer perfTimer("recurseTreeWithOperator");
-        localTree->recurseTreeWithOperator(&moveOperator);
-    }
+        if (moveOperator.hasMovingEntities()) {
+            PerformanceTimer perfTimer("recurseTreeWithOperator");
+            localTree->recurseTreeWithOperator(&moveOperator);
+        }
+    });
 
     if (!_serverlessDomain) {
         // send add-entity packets to the server
@@ -15,6 +15,7 @@
 #include <QSet>
 #include <QVector>
 
+#include <AABoxTree.h>
 #include <Octree.h>
 #include <SpatialParentFinder.h>
 
@@ -143,6 +144,15 @@ public:
     void evalEntitiesInCube(const AACube& cube, PickFilter searchFilter, QVector<QUuid>& foundEntities);
     void evalEntitiesInBox(const AABox& box, PickFilter searchFilter, QVector<QUuid>& foundEntities);
     void evalEntitiesInFrustum(const ViewFrustum& frustum, PickFilter searchFilter, QVector<QUuid>& foundEntities);
+    // Same as evalEntitiesInSphere() for each center and radius, setting foundEntities[i] to what the ith sphere finds.
+    void evalEntitiesInSpheres(const QVector<glm::vec3>& centers, const QVector<float>& radii, PickFilter searchFilter,
+                               QVector<QVector<QUuid>>& foundEntities);
+
+    // The query tree holds each entity's query AACube, so that the eval*() queries visit only the entities near
+    // what they look for.  It follows the entity as the operators add, move and delete it, under the write lock.
+    void addToQueryTree(const EntityItemPointer& entity);
+    void updateInQueryTree(const EntityItemPointer& entity, const AACube& queryAACube);
+    void removeFromQueryTree(const EntityItemPointer& entity);
 
     void addNewlyCreatedHook(NewlyCreatedEntityHook* hook);
     void removeNewlyCreatedHook(NewlyCreatedEntityHook* hook);
@@ -375,11 +385,14 @@ protected:
     QStringList _entityScriptSourceWhitelist;
 
     MovingEntitiesOperator _entityMover;
+    AABoxTree<EntityItemPointer> _queryTree;
     QHash<EntityItemID, EntityItemPointer> _entitiesToAdd;
 
     Q_INVOKABLE void startChallengeOwnershipTimer(const EntityItemID& entityItemID);
 
 private:
+    bool canChangeQueryTree() const;
+
     void addCertifiedEntityOnServer(EntityItemPointer entity);
     void removeCertifiedEntityOnServer(EntityItemPointer entity);
     void sendChallengeOwnershipPacket(const QString& certID, const QString& ownerKey, const EntityItemID& entityItemID, const SharedNodePointer& senderNode);
@@ -135,6 +135,13 @@ public:
     virtual bool deleteApproved() const override { return !hasEntities(); }
 
     static bool checkFilterSettings(const EntityItemPointer& entity, PickFilter searchFilter);
+    // the tests the eval*() queries make of each entity, shared with EntityTree's query tree
+    static bool evalEntityRayIntersection(const EntityItemPointer& entity, const glm::vec3& origin, const glm::vec3& direction,
+        OctreeElementPointer& element, float& distance, BoxFace& face, glm::vec3& surfaceNormal,
+        const QVector<EntityItemID>& entityIdsToInclude, const QVector<EntityItemID>& entityIdsToDiscard,
+        PickFilter searchFilter, QVariantMap& extraInfo);
+    static bool entityTouchesSphere(const EntityItemPointer& entity, const glm::vec3& position, float radius);
+    static bool entityHasName(const EntityItemPointer& entity, const QString& name, bool caseSensitive);
     virtual bool canPickIntersect() const override { return hasEntities(); }
     virtual EntityItemID evalRayIntersection(const glm::vec3& origin, const glm::vec3& direction,
         OctreeElementPointer& element, float& distance, BoxFace& face, glm::vec3& surfaceNormal,
@@ -63,6 +63,9 @@ void MovingEntitiesOperator::addEntityToMoveList(EntityItemPointer entity, const
         return; // bail without adding.
     }
 
+    // the query tree follows every move, even those that leave the entity in its element
+    oldContainingElement->getTree()->updateInQueryTree(entity, newCube);
+
     // If the original containing element is the best fit for the requested newCube locations then
     // we don't actually need to add the entity for moving and we can short circuit all this work
     if (!oldContainingElement->bestFitBounds(newCubeClamped)) {
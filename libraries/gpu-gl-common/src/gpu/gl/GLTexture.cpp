@@ -254,7 +254,12 @@ TransferJob::TransferJob(const Texture& texture,
     _bufferingLambda = [=](const TexturePointer& texture) {
         auto mipStorage = texture->accessStoredMipFace(sourceMip, face);
         if (mipStorage) {
-            _mipData = mipStorage->createView(_transferSize, _transferOffset);
+            // a mip from a KTX file is a view into the mapped file, so copy the lines this job transfers here
+            // rather than paging them in on the render thread
+            auto lines = mipStorage->createView(_transferSize, _transferOffset);
+            if (lines) {
+                _mipData = lines->toMemoryStorage();
+            }
         } else {
             qCWarning(gpugllogging) << "Buffering failed because mip could not be retrieved from texture "
                 << texture->source().c_str();
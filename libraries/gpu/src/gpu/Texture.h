@@ -18,6 +18,9 @@
 #include <QUrl>
 
 #include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 #include <shared/Storage.h>
 #include <shared/FileCache.h>
 #include <RegisteredMetaTypes.h>
@@ -32,6 +35,7 @@ namespace ktx {
     using KTXUniquePointer = std::unique_ptr<KTX>;
     struct KTXDescriptor;
     using KTXDescriptorPointer = std::unique_ptr<KTXDescriptor>;
+    using KTXDescriptorSharedPointer = std::shared_ptr<const KTXDescriptor>;
     struct Header;
     struct KeyValue;
     using KeyValues = std::list<KeyValue>;
@@ -358,8 +362,14 @@ public:
         // Don't keep files open forever.  We close them at the beginning of each frame (GLBackend::recycle)
         static void releaseOpenKtxFiles();
 
+        // Parses and validates a KTX file, or returns null if it isn't a valid KTX.
+        // The result is cached per file, so the validity check, building the texture and creating its backing
+        // storage only touch the file once.
+        static ktx::KTXDescriptorSharedPointer getDescriptor(const std::string& filename);
+
     protected:
         std::shared_ptr<storage::FileStorage> maybeOpenFile() const;
+        void readMinMipLevelAvailable(const storage::StoragePointer& storage);
 
         mutable std::shared_ptr<std::mutex> _cacheFileMutex { std::make_shared<std::mutex>() };
         mutable std::weak_ptr<storage::FileStorage> _cacheFile;
@@ -367,13 +377,23 @@ public:
         static std::vector<std::pair<std::shared_ptr<storage::FileStorage>, std::shared_ptr<std::mutex>>> _cachedKtxFiles;
         static std::mutex _cachedKtxFilesMutex;
 
+        struct CachedDescriptor {
+            int64_t fileSize;
+            ktx::KTXDescriptorSharedPointer descriptor; // null for an invalid file
+            std::list<std::string>::iterator lastUse;
+        };
+        // by file name, with the names from most to least recently used so the least is dropped when the cache is full
+        static std::unordered_map<std::string, CachedDescriptor> _cachedDescriptors;
+        static std::list<std::string> _descriptorsByUse;
+        static std::mutex _cachedDescriptorsMutex;
+
         storage::StoragePointer _storage;
         std::string _filename;
         cache::FilePointer _cacheEntry;
         std::atomic<uint8_t> _minMipLevelAvailable;
         size_t _offsetToMinMipKV;
 
-        ktx::KTXDescriptorPointer _ktxDescriptor;
+        ktx::KTXDescriptorSharedPointer _ktxDescriptor;
         friend class Texture;
         friend class Serializer;
         friend class Deserializer;
@@ -13,6 +13,7 @@
 #include "Texture.h"
 
 #include <QtCore/QByteArray>
+#include <QtCore/QFileInfo>
 
 #include <ktx/KTX.h>
 
@@ -25,6 +26,22 @@ using KtxStorage = Texture::KtxStorage;
 
 std::vector<std::pair<std::shared_ptr<storage::FileStorage>, std::shared_ptr<std::mutex>>> KtxStorage::_cachedKtxFiles;
 std::mutex KtxStorage::_cachedKtxFilesMutex;
+std::unordered_map<std::string, KtxStorage::CachedDescriptor> KtxStorage::_cachedDescriptors;
+std::list<std::string> KtxStorage::_descriptorsByUse;
+std::mutex KtxStorage::_cachedDescriptorsMutex;
+
+static const size_t MAX_CACHED_KTX_DESCRIPTORS = 8192;
+
+// A mip face read straight out of the mapped KTX file, so only the pages that are read get loaded.  It holds the
+// mapping, and the cache entry so the file can't be evicted from under it, for as long as the caller holds the view
+class KtxMipFaceView : public storage::ViewStorage {
+public:
+    KtxMipFaceView(const storage::StoragePointer& file, const cache::FilePointer& cacheEntry, size_t size, const uint8_t* data) :
+        storage::ViewStorage(file, size, data), _cacheEntry(cacheEntry) {}
+
+private:
+    const cache::FilePointer _cacheEntry;
+};
 
 struct GPUKTXPayload {
     using Version = uint8;
@@ -159,21 +176,61 @@ struct IrradianceKTXPayload {
 };
 const std::string IrradianceKTXPayload::KEY{ "hifi.irradianceSH" };
 
-KtxStorage::KtxStorage(const storage::StoragePointer& storage) : _storage(storage) {
-    auto ktxPointer = ktx::KTX::create(storage);
-    _ktxDescriptor.reset(new ktx::KTXDescriptor(ktxPointer->toDescriptor()));
+ktx::KTXDescriptorSharedPointer KtxStorage::getDescriptor(const std::string& filename) {
+    // KTX files in the cache only change in place when mips are assigned, which leaves their layout and size alone
+    auto fileSize = QFileInfo(QString::fromStdString(filename)).size();
+    {
+        std::lock_guard<std::mutex> lock(_cachedDescriptorsMutex);
+        auto found = _cachedDescriptors.find(filename);
+        if (found != _cachedDescriptors.end() && found->second.fileSize == fileSize) {
+            _descriptorsByUse.splice(_descriptorsByUse.begin(), _descriptorsByUse, found->second.lastUse);
+            return found->second.descriptor;
+        }
+    }
+
+    ktx::KTXDescriptorSharedPointer descriptor;
+    {
+        ktx::StoragePointer storage { new storage::FileStorage(filename.c_str()) };
+        auto ktxPointer = ktx::KTX::create(storage);
+        if (ktxPointer) {
+            descriptor = std::make_shared<const ktx::KTXDescriptor>(ktxPointer->toDescriptor());
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(_cachedDescriptorsMutex);
+    auto found = _cachedDescriptors.find(filename);
+    if (found != _cachedDescriptors.end()) {
+        _descriptorsByUse.erase(found->second.lastUse);
+        _cachedDescriptors.erase(found);
+    } else if (_cachedDescriptors.size() >= MAX_CACHED_KTX_DESCRIPTORS) {
+        _cachedDescriptors.erase(_descriptorsByUse.back());
+        _descriptorsByUse.pop_back();
+    }
+    _descriptorsByUse.push_front(filename);
+    _cachedDescriptors[filename] = { fileSize, descriptor, _descriptorsByUse.begin() };
+    return descriptor;
+}
+
+void KtxStorage::readMinMipLevelAvailable(const storage::StoragePointer& storage) {
     if (_ktxDescriptor->images.size() < _ktxDescriptor->header.numberOfMipmapLevels) {
         qWarning() << "Bad images found in ktx";
     }
 
+    // the populated mip level is updated in place as mips are assigned, so always read it from the file
     _offsetToMinMipKV = _ktxDescriptor->getValueOffsetForKey(ktx::HIFI_MIN_POPULATED_MIP_KEY);
-    if (_offsetToMinMipKV) {
+    if (_offsetToMinMipKV && storage && *storage) {
         auto data = storage->data() + ktx::KTX_HEADER_SIZE + _offsetToMinMipKV;
         _minMipLevelAvailable = *data;
     } else {
         // Assume all mip levels are available
         _minMipLevelAvailable = 0;
     }
+}
+
+KtxStorage::KtxStorage(const storage::StoragePointer& storage) : _storage(storage) {
+    auto ktxPointer = ktx::KTX::create(storage);
+    _ktxDescriptor = std::make_shared<const ktx::KTXDescriptor>(ktxPointer->toDescriptor());
+    readMinMipLevelAvailable(storage);
 
     // now that we know the ktx, let's get the header info to configure this Texture::Storage:
     Format mipFormat = Format::COLOR_BGRA_32;
@@ -188,23 +245,11 @@ KtxStorage::KtxStorage(const cache::FilePointer& cacheEntry) : KtxStorage(cacheE
 }
 
 KtxStorage::KtxStorage(const std::string& filename) : _filename(filename) {
+    _ktxDescriptor = getDescriptor(_filename);
     {
-        // We are doing a lot of work here just to get descriptor data
-        ktx::StoragePointer storage{ new storage::FileStorage(_filename.c_str()) };
-        auto ktxPointer = ktx::KTX::create(storage);
-        _ktxDescriptor.reset(new ktx::KTXDescriptor(ktxPointer->toDescriptor()));
-        if (_ktxDescriptor->images.size() < _ktxDescriptor->header.numberOfMipmapLevels) {
-            qWarning() << "Bad images found in ktx";
-        }
-
-        _offsetToMinMipKV = _ktxDescriptor->getValueOffsetForKey(ktx::HIFI_MIN_POPULATED_MIP_KEY);
-        if (_offsetToMinMipKV) {
-            auto data = storage->data() + ktx::KTX_HEADER_SIZE + _offsetToMinMipKV;
-            _minMipLevelAvailable = *data;
-        } else {
-            // Assume all mip levels are available
-            _minMipLevelAvailable = 0;
-        }
+        // only the page holding the populated mip level is touched here, the texels are paged in as mip views are read
+        std::lock_guard<std::mutex> lock(*_cacheFileMutex);
+        readMinMipLevelAvailable(maybeOpenFile());
     }
 
 
@@ -260,7 +305,9 @@ PixelsPointer KtxStorage::getMipFace(uint16 level, uint8 face) const {
             std::lock_guard<std::mutex> lock(*_cacheFileMutex);
             auto file = maybeOpenFile();
             if (file) {
-                storageView = file->createView(faceSize, faceOffset);
+                if (faceOffset + faceSize <= file->size()) {
+                    storageView = std::make_shared<KtxMipFaceView>(file, _cacheEntry, faceSize, file->data() + faceOffset);
+                }
             } else {
                 qWarning() << "Failed to get a valid file out of maybeOpenFile " << QString::fromStdString(_filename);
             }
@@ -270,7 +317,7 @@ PixelsPointer KtxStorage::getMipFace(uint16 level, uint8 face) const {
         qWarning() << "Failed to get a valid storageView for faceSize=" << faceSize << "  faceOffset=" << faceOffset
                     << "out of valid file " << QString::fromStdString(_filename);
     }
-    return storageView->toMemoryStorage();
+    return storageView;
 }
 
 Size KtxStorage::getMipFaceSize(uint16 level, uint8 face) const {
@@ -347,8 +394,7 @@ bool validKtx(const storage::StoragePointer& storage) {
 }
 
 bool validKtx(const std::string& filename) {
-    ktx::StoragePointer storage{ new storage::FileStorage(filename.c_str()) };
-    return validKtx(storage);
+    return (bool)KtxStorage::getDescriptor(filename);
 }
 
 void Texture::setKtxBacking(const storage::StoragePointer& storage) {
@@ -573,12 +619,12 @@ TexturePointer Texture::build(const ktx::KTXDescriptor& descriptor) {
 }
 
 TexturePointer Texture::unserialize(const cache::FilePointer& cacheEntry, const std::string& source) {
-    std::unique_ptr<ktx::KTX> ktxPointer = ktx::KTX::create(std::make_shared<storage::FileStorage>(cacheEntry->getFilepath().c_str()));
-    if (!ktxPointer) {
+    auto descriptor = KtxStorage::getDescriptor(cacheEntry->getFilepath());
+    if (!descriptor) {
         return nullptr;
     }
 
-    auto texture = build(ktxPointer->toDescriptor());
+    auto texture = build(*descriptor);
     if (texture) {
         texture->setKtxBacking(cacheEntry);
         if (texture->source().empty()) {
@@ -590,12 +636,12 @@ TexturePointer Texture::unserialize(const cache::FilePointer& cacheEntry, const
 }
 
 TexturePointer Texture::unserialize(const std::string& ktxfile) {
-    std::unique_ptr<ktx::KTX> ktxPointer = ktx::KTX::create(std::make_shared<storage::FileStorage>(ktxfile.c_str()));
-    if (!ktxPointer) {
+    auto descriptor = KtxStorage::getDescriptor(ktxfile);
+    if (!descriptor) {
         return nullptr;
     }
 
-    auto texture = build(ktxPointer->toDescriptor());
+    auto texture = build(*descriptor);
     if (texture) {
         texture->setKtxBacking(ktxfile);
         texture->setSource(ktxfile);
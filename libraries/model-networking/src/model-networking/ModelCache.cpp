@@ -525,6 +525,12 @@ void ModelResourceWatcher::setResource(ModelResource::Pointer resource) {
     }
 }
 
+void ModelResourceWatcher::setLoadPriority(const QPointer<QObject>& owner, float priority) {
+    if (_resource && !_resource->isLoaded()) {
+        _resource->setLoadPriority(owner, priority);
+    }
+}
+
 void ModelResourceWatcher::resourceFinished(bool success) {
     if (success) {
         _networkModelRef = std::make_shared<NetworkModel>(*_resource);
@@ -131,6 +131,9 @@ public:
     int getResourceDownloadAttempts() { return _resource ? _resource->getDownloadAttempts() : 0; }
     int getResourceDownloadAttemptsRemaining() { return _resource ? _resource->getDownloadAttemptsRemaining() : 0; }
 
+    // Updates the priority of the watched resource while it is still waiting to be downloaded
+    void setLoadPriority(const QPointer<QObject>& owner, float priority);
+
 private:
     void startWatching();
     void stopWatching();
@@ -17,35 +17,128 @@
 #include <QUuid>
 #include "NetworkLogging.h"
 #include <cassert>
+#include <cstring>
+
+static_assert(HMACAuth::MAX_HASH_SIZE >= EVP_MAX_MD_SIZE, "HMACAuth::MAX_HASH_SIZE must hold any OpenSSL digest");
 
 #if OPENSSL_VERSION_NUMBER >= 0x10100000
-HMACAuth::HMACAuth(AuthMethod authMethod)
-    : _hmacContext(HMAC_CTX_new())
-    , _authMethod(authMethod) { }
+static HMAC_CTX* newContext() {
+    return HMAC_CTX_new();
+}
 
-HMACAuth::~HMACAuth()
-{
-    HMAC_CTX_free(_hmacContext);
+static void freeContext(HMAC_CTX* context) {
+    HMAC_CTX_free(context);
+}
+
+static bool copyContext(HMAC_CTX* destination, HMAC_CTX* source) {
+    return (bool) HMAC_CTX_copy(destination, source);
 }
 
 #else
 
-HMACAuth::HMACAuth(AuthMethod authMethod)
-    : _hmacContext(new HMAC_CTX())
-    , _authMethod(authMethod) {
-    HMAC_CTX_init(_hmacContext);
+static HMAC_CTX* newContext() {
+    HMAC_CTX* context = new HMAC_CTX();
+    HMAC_CTX_init(context);
+    return context;
 }
 
-HMACAuth::~HMACAuth() {
-    HMAC_CTX_cleanup(_hmacContext);
-    delete _hmacContext;
+static void freeContext(HMAC_CTX* context) {
+    HMAC_CTX_cleanup(context);
+    delete context;
+}
+
+static bool copyContext(HMAC_CTX* destination, HMAC_CTX* source) {
+    // HMAC_CTX_copy initializes the destination over whatever it held, release that first
+    HMAC_CTX_cleanup(destination);
+    HMAC_CTX_init(destination);
+    return (bool) HMAC_CTX_copy(destination, source);
 }
 #endif
 
-bool HMACAuth::setKey(const char* keyValue, int keyLen) {
+static const int SIPHASH_KEY_SIZE = 16;
+static const int SIPHASH_HASH_SIZE = 16;
+
+static inline uint64_t rotateLeft(uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+static inline uint64_t readLittleEndian(const unsigned char* bytes) {
+    uint64_t value = 0;
+    for (int i = 7; i >= 0; --i) {
+        value = (value << 8) | bytes[i];
+    }
+    return value;
+}
+
+static inline void writeLittleEndian(unsigned char* bytes, uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+        bytes[i] = (unsigned char)(value >> (8 * i));
+    }
+}
+
+// SipHash-2-4 with the 128-bit output, as in the reference implementation
+static void sipHash128(const uint64_t key[2], const unsigned char* data, size_t dataLen,
+                       unsigned char hashResult[SIPHASH_HASH_SIZE]) {
+    uint64_t v0 = 0x736f6d6570736575ULL ^ key[0];
+    uint64_t v1 = 0x646f72616e646f6dULL ^ key[1] ^ 0xee;
+    uint64_t v2 = 0x6c7967656e657261ULL ^ key[0];
+    uint64_t v3 = 0x7465646279746573ULL ^ key[1];
+
+    auto rounds = [&](int numRounds) {
+        for (int i = 0; i < numRounds; ++i) {
+            v0 += v1; v1 = rotateLeft(v1, 13); v1 ^= v0; v0 = rotateLeft(v0, 32);
+            v2 += v3; v3 = rotateLeft(v3, 16); v3 ^= v2;
+            v0 += v3; v3 = rotateLeft(v3, 21); v3 ^= v0;
+            v2 += v1; v1 = rotateLeft(v1, 17); v1 ^= v2; v2 = rotateLeft(v2, 32);
+        }
+    };
+
+    const unsigned char* end = data + (dataLen & ~size_t(7));
+    for (; data != end; data += 8) {
+        uint64_t word = readLittleEndian(data);
+        v3 ^= word;
+        rounds(2);
+        v0 ^= word;
+    }
+
+    // the last word holds the remaining bytes and the length
+    uint64_t lastWord = uint64_t(dataLen) << 56;
+    for (size_t i = 0; i < (dataLen & 7); ++i) {
+        lastWord |= uint64_t(data[i]) << (8 * i);
+    }
+    v3 ^= lastWord;
+    rounds(2);
+    v0 ^= lastWord;
+
+    v2 ^= 0xee;
+    rounds(4);
+    writeLittleEndian(hashResult, v0 ^ v1 ^ v2 ^ v3);
+
+    v1 ^= 0xdd;
+    rounds(4);
+    writeLittleEndian(hashResult + 8, v0 ^ v1 ^ v2 ^ v3);
+}
+
+// The keyed state, immutable once made so that any thread may hash from it.  Setting a key makes a new one.
+class HMACAuth::Key {
+public:
+    Key(AuthMethod authMethod, const char* keyValue, int keyLen);
+    ~Key();
+
+    bool isValid { false };
+    AuthMethod authMethod;
+    std::vector<char> keyValue;
+    HMAC_CTX* context { nullptr }; // keyed HMAC, copied before each hash
+    uint64_t sipHashKey[2] { 0, 0 };
+};
+
+HMACAuth::Key::Key(AuthMethod authMethod, const char* keyValue, int keyLen) :
+    authMethod(authMethod),
+    keyValue(keyValue, keyValue + keyLen)
+{
     const EVP_MD* sslStruct = nullptr;
 
-    switch (_authMethod) {
+    switch (authMethod) {
     case MD5:
         sslStruct = EVP_md5();
         break;
@@ -66,12 +159,74 @@ bool HMACAuth::setKey(const char* keyValue, int keyLen) {
         sslStruct = EVP_ripemd160();
         break;
 
+    case SIPHASH:
+        if (keyLen != SIPHASH_KEY_SIZE) {
+            qCWarning(networking) << "SipHash needs a" << SIPHASH_KEY_SIZE << "byte key, got" << keyLen;
+            return;
+        }
+        sipHashKey[0] = readLittleEndian(reinterpret_cast<const unsigned char*>(keyValue));
+        sipHashKey[1] = readLittleEndian(reinterpret_cast<const unsigned char*>(keyValue) + 8);
+        isValid = true;
+        return;
+
     default:
+        return;
+    }
+
+    context = newContext();
+    isValid = (bool) HMAC_Init_ex(context, keyValue, keyLen, sslStruct, nullptr);
+}
+
+HMACAuth::Key::~Key() {
+    if (context) {
+        freeContext(context);
+    }
+}
+
+namespace {
+    // What each thread hashes with in calculateHash(), so that threads never share a context that is being written.
+    class ThreadContext {
+    public:
+        ThreadContext() : hashContext(newContext()) { }
+        ~ThreadContext() { freeContext(hashContext); }
+
+        HMAC_CTX* hashContext;
+    };
+
+    ThreadContext& threadContext() {
+        thread_local ThreadContext context;
+        return context;
+    }
+}
+
+HMACAuth::HMACAuth(AuthMethod authMethod) :
+    _authMethod(authMethod),
+    _streamContext(newContext())
+{
+}
+
+HMACAuth::~HMACAuth() {
+    freeContext(_streamContext);
+}
+
+bool HMACAuth::setAuthMethod(AuthMethod authMethod) {
+    _authMethod = authMethod;
+
+    auto key = std::atomic_load(&_key);
+    if (!key || key->authMethod == authMethod) {
+        return true;
+    }
+    return setKey(key->keyValue.data(), (int)key->keyValue.size());
+}
+
+bool HMACAuth::setKey(const char* keyValue, int keyLen) {
+    auto key = std::make_shared<const Key>(_authMethod, keyValue, keyLen);
+    if (!key->isValid) {
         return false;
     }
 
-    QMutexLocker lock(&_lock);
-    return (bool) HMAC_Init_ex(_hmacContext, keyValue, keyLen, sslStruct, nullptr);
+    std::atomic_store(&_key, std::shared_ptr<const Key>(std::move(key)));
+    return true;
 }
 
 bool HMACAuth::setKey(const QUuid& uidKey) {
@@ -79,39 +234,104 @@ bool HMACAuth::setKey(const QUuid& uidKey) {
     return setKey(rfcBytes.constData(), rfcBytes.length());
 }
 
+bool HMACAuth::startStream() {
+    // a hash in progress keeps the key it started with
+    if (_streamKey) {
+        return true;
+    }
+
+    auto key = std::atomic_load(&_key);
+    if (!key) {
+        return false;
+    }
+
+    if (key->authMethod == SIPHASH) {
+        _streamData.clear();
+    } else if (!copyContext(_streamContext, key->context)) {
+        return false;
+    }
+    _streamKey = key;
+    return true;
+}
+
 bool HMACAuth::addData(const char* data, int dataLen) {
-    QMutexLocker lock(&_lock);
-    return (bool) HMAC_Update(_hmacContext, reinterpret_cast<const unsigned char*>(data), dataLen);
+    QMutexLocker lock(&_streamLock);
+    if (!startStream()) {
+        return false;
+    }
+
+    if (_streamKey->authMethod == SIPHASH) {
+        _streamData.insert(_streamData.end(), data, data + dataLen);
+        return true;
+    }
+    return (bool) HMAC_Update(_streamContext, reinterpret_cast<const unsigned char*>(data), dataLen);
 }
 
 HMACAuth::HMACHash HMACAuth::result() {
-    HMACHash hashValue(EVP_MAX_MD_SIZE);
-    unsigned int hashLen;
-    QMutexLocker lock(&_lock);
-    
-    auto hmacResult = HMAC_Final(_hmacContext, &hashValue[0], &hashLen);
-    
-    if (hmacResult) {
-        hashValue.resize((size_t)hashLen);
+    QMutexLocker lock(&_streamLock);
+
+    HMACHash hashValue(MAX_HASH_SIZE);
+    // with nothing added, the hash of no data
+    if (!startStream()) {
+        qCWarning(networking) << "HMACAuth::result() called before a key was set";
+        hashValue.clear();
+        return hashValue;
+    }
+
+    if (_streamKey->authMethod == SIPHASH) {
+        sipHash128(_streamKey->sipHashKey, reinterpret_cast<const unsigned char*>(_streamData.data()),
+                   _streamData.size(), &hashValue[0]);
+        hashValue.resize(SIPHASH_HASH_SIZE);
     } else {
-        // the HMAC_FINAL call failed - should not be possible to get into this state
-        qCWarning(networking) << "Error occured calling HMAC_Final";
-        assert(hmacResult);
+        unsigned int hashLen;
+        auto hmacResult = HMAC_Final(_streamContext, &hashValue[0], &hashLen);
+
+        if (hmacResult) {
+            hashValue.resize((size_t)hashLen);
+        } else {
+            // the HMAC_FINAL call failed - should not be possible to get into this state
+            qCWarning(networking) << "Error occured calling HMAC_Final";
+            assert(hmacResult);
+        }
     }
 
     // Clear state for possible reuse.
-    HMAC_Init_ex(_hmacContext, nullptr, 0, nullptr, nullptr);
+    _streamKey.reset();
     return hashValue;
 }
 
+int HMACAuth::calculateHash(unsigned char* hashResult, const char* data, int dataLen) {
+    auto key = std::atomic_load(&_key);
+    if (!key) {
+        return 0;
+    }
+
+    if (key->authMethod == SIPHASH) {
+        sipHash128(key->sipHashKey, reinterpret_cast<const unsigned char*>(data), dataLen, hashResult);
+        return SIPHASH_HASH_SIZE;
+    }
+
+    // start from a copy of the keyed context, which only reads the shared one
+    HMAC_CTX* context = threadContext().hashContext;
+    unsigned int hashLen = 0;
+    if (!copyContext(context, key->context) ||
+        !HMAC_Update(context, reinterpret_cast<const unsigned char*>(data), dataLen) ||
+        !HMAC_Final(context, hashResult, &hashLen)) {
+        return 0;
+    }
+    return (int)hashLen;
+}
+
 bool HMACAuth::calculateHash(HMACHash& hashResult, const char* data, int dataLen) {
-    QMutexLocker lock(&_lock);
-    if (!addData(data, dataLen)) {
-        qCWarning(networking) << "Error occured calling HMACAuth::addData()";
+    hashResult.resize(MAX_HASH_SIZE);
+    int hashLen = calculateHash(&hashResult[0], data, dataLen);
+    if (hashLen == 0) {
+        qCWarning(networking) << "Error occured calculating HMACAuth hash";
         assert(false);
+        hashResult.clear();
         return false;
     }
 
-    hashResult = result();
+    hashResult.resize(hashLen);
     return true;
 }
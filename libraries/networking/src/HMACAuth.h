@@ -12,24 +12,38 @@
 #ifndef hifi_HMACAuth_h
 #define hifi_HMACAuth_h
 
-#include <vector>
+#include <atomic>
 #include <memory>
+#include <vector>
+
 #include <QtCore/QMutex>
 
 class QUuid;
 
+// Keyed hashes for packet verification.  calculateHash() may be called from any number of threads at once without
+// locking: the keyed state is shared read-only and each thread hashes with its own copy of it.
 class HMACAuth {
 public:
-    enum AuthMethod { MD5, SHA1, SHA224, SHA256, RIPEMD160 };
+    // SIPHASH is SipHash-2-4 with a 128-bit result, much cheaper than an HMAC on small packets.  It needs a 16 byte key.
+    enum AuthMethod { MD5, SHA1, SHA224, SHA256, RIPEMD160, SIPHASH };
     using HMACHash = std::vector<unsigned char>;
-    
+
+    // large enough for the result of any method
+    static const int MAX_HASH_SIZE = 64;
+
     explicit HMACAuth(AuthMethod authMethod = MD5);
     ~HMACAuth();
 
+    AuthMethod getAuthMethod() const { return _authMethod; }
+    // Switches method, keeping the current key.
+    bool setAuthMethod(AuthMethod authMethod);
+
     bool setKey(const char* keyValue, int keyLen);
     bool setKey(const QUuid& uidKey);
     // Calculate complete hash in one.
     bool calculateHash(HMACHash& hashResult, const char* data, int dataLen);
+    // Same, into a buffer of at least MAX_HASH_SIZE bytes, returns the size of the hash or 0 on failure.
+    int calculateHash(unsigned char* hashResult, const char* data, int dataLen);
 
     // Append to data to be hashed.
     bool addData(const char* data, int dataLen);
@@ -39,9 +53,18 @@ public:
     HMACHash result();
 
 private:
-    QMutex _lock { QMutex::Recursive };
-    struct hmac_ctx_st* _hmacContext;
-    AuthMethod _authMethod;
+    class Key;
+
+    bool startStream();
+
+    std::shared_ptr<const Key> _key;
+    std::atomic<AuthMethod> _authMethod;
+
+    // state of a hash made with addData() and result()
+    QMutex _streamLock;
+    struct hmac_ctx_st* _streamContext;
+    std::shared_ptr<const Key> _streamKey;
+    std::vector<char> _streamData; // SipHash hashes it all at once
 };
 
 #endif  // hifi_HMACAuth_h
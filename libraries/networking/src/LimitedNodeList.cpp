@@ -347,18 +347,19 @@ bool LimitedNodeList::packetSourceAndHashMatchAndTrackBandwidth(const udt::Packe
 
             if (verifiedPacket && verificationEnabled) {
 
-                QByteArray packetHeaderHash = NLPacket::verificationHashInHeader(packet);
-                QByteArray expectedHash;
                 auto sourceNodeHMACAuth = sourceNode->getAuthenticateHash();
-                if (sourceNode->getAuthenticateHash()) {
-                    expectedHash = NLPacket::hashForPacketAndHMAC(packet, *sourceNodeHMACAuth);
-                }
 
-                // check if the HMAC-md5 hash in the header matches the hash we would expect
-                if (!sourceNodeHMACAuth || packetHeaderHash != expectedHash) {
+                // check if the keyed hash in the header matches the hash we would expect
+                if (!sourceNodeHMACAuth || !NLPacket::isVerificationHashValid(packet, *sourceNodeHMACAuth)) {
                     static QMultiMap<QUuid, PacketType> hashDebugSuppressMap;
 
                     if (!hashDebugSuppressMap.contains(sourceID, headerType)) {
+                        QByteArray packetHeaderHash = NLPacket::verificationHashInHeader(packet);
+                        QByteArray expectedHash;
+                        if (sourceNodeHMACAuth) {
+                            expectedHash = NLPacket::hashForPacketAndHMAC(packet, *sourceNodeHMACAuth);
+                        }
+
                         qCDebug(networking) << "Packet hash mismatch on" << headerType << "- Sender" << sourceID;
                         qCDebug(networking) << "Packet len:" << packet.getDataSize() << "Expected hash:" <<
                             expectedHash.toHex() << "Actual:" << packetHeaderHash.toHex();
@@ -385,6 +386,25 @@ bool LimitedNodeList::packetSourceAndHashMatchAndTrackBandwidth(const udt::Packe
     return false;
 }
 
+void LimitedNodeList::setAuthenticationMethod(HMACAuth::AuthMethod authMethod) {
+    // only methods with a hash the size of the one in the packet header can verify packets
+    if (authMethod != HMACAuth::MD5 && authMethod != HMACAuth::SIPHASH) {
+        qCWarning(networking) << "Ignoring unsupported packet authentication method" << authMethod;
+        return;
+    }
+
+    if (authMethod == _authenticationMethod) {
+        return;
+    }
+
+    qCDebug(networking) << "Packet authentication method set to" << (authMethod == HMACAuth::SIPHASH ? "SipHash" : "HMAC-MD5");
+    _authenticationMethod = authMethod;
+
+    eachNode([authMethod](const SharedNodePointer& node) {
+        node->setAuthenticationMethod(authMethod);
+    });
+}
+
 void LimitedNodeList::fillPacketHeader(const NLPacket& packet, HMACAuth* hmacAuth) {
     if (!PacketTypeEnum::getNonSourcedPackets().contains(packet.getType())) {
         packet.writeSourceID(getSessionLocalID());
@@ -718,6 +738,7 @@ SharedNodePointer LimitedNodeList::addOrUpdateNode(const QUuid& uuid, NodeType_t
     Node* newNode = new Node(uuid, nodeType, publicSocket, localSocket);
     newNode->setIsReplicated(isReplicated);
     newNode->setIsUpstream(isUpstream || NodeType::isUpstream(nodeType));
+    newNode->setAuthenticationMethod(_authenticationMethod);
     newNode->setConnectionSecret(connectionSecret);
     newNode->setPermissions(permissions);
     newNode->setLocalID(localID);
@@ -318,6 +318,9 @@ public:
     bool isPacketVerified(const udt::Packet& packet) { return isPacketVerifiedWithSource(packet); }
     void setAuthenticatePackets(bool useAuthentication) { _useAuthentication = useAuthentication; }
     bool getAuthenticatePackets() const { return _useAuthentication; }
+    // the keyed hash verified packets carry, which the domain-server picks for the whole domain
+    void setAuthenticationMethod(HMACAuth::AuthMethod authMethod);
+    HMACAuth::AuthMethod getAuthenticationMethod() const { return _authenticationMethod; }
 
     void setFlagTimeForConnectionStep(bool flag) { _flagTimeForConnectionStep = flag; }
     bool isFlagTimeForConnectionStep() { return _flagTimeForConnectionStep; }
@@ -445,6 +448,7 @@ protected:
     HifiSockAddr _stunSockAddr { STUN_SERVER_HOSTNAME, STUN_SERVER_PORT };
     bool _hasTCPCheckedLocalSocket { false };
     bool _useAuthentication { true };
+    HMACAuth::AuthMethod _authenticationMethod { HMACAuth::MD5 };
 
     PacketReceiver* _packetReceiver;
 
@@ -11,6 +11,8 @@
 
 #include "NLPacket.h"
 
+#include <algorithm>
+
 #include "HMACAuth.h"
 
 int NLPacket::localHeaderSize(PacketType type) {
@@ -157,11 +159,20 @@ QByteArray NLPacket::hashForPacketAndHMAC(const udt::Packet& packet, HMACAuth& h
         + NUM_BYTES_LOCALID + NUM_BYTES_MD5_HASH;
     
     // add the packet payload and the connection UUID
-    HMACAuth::HMACHash hashResult;
-    if (!hash.calculateHash(hashResult, packet.getData() + offset, packet.getDataSize() - offset)) {
-        return QByteArray();
-    }
-    return QByteArray((const char*) hashResult.data(), (int) hashResult.size());
+    unsigned char hashResult[HMACAuth::MAX_HASH_SIZE];
+    int hashLen = hash.calculateHash(hashResult, packet.getData() + offset, packet.getDataSize() - offset);
+    return QByteArray((const char*) hashResult, hashLen);
+}
+
+bool NLPacket::isVerificationHashValid(const udt::Packet& packet, HMACAuth& hash) {
+    int hashOffset = Packet::totalHeaderSize(packet.isPartOfMessage()) + sizeof(PacketType) + sizeof(PacketVersion)
+        + NUM_BYTES_LOCALID;
+    int offset = hashOffset + NUM_BYTES_MD5_HASH;
+
+    // compare in place, this runs for every verified packet received
+    unsigned char hashResult[HMACAuth::MAX_HASH_SIZE];
+    int hashLen = hash.calculateHash(hashResult, packet.getData() + offset, packet.getDataSize() - offset);
+    return hashLen == NUM_BYTES_MD5_HASH && memcmp(packet.getData() + hashOffset, hashResult, NUM_BYTES_MD5_HASH) == 0;
 }
 
 void NLPacket::writeTypeAndVersion() {
@@ -223,7 +234,10 @@ void NLPacket::writeVerificationHash(HMACAuth& hmacAuth) const {
     auto offset = Packet::totalHeaderSize(isPartOfMessage()) + sizeof(PacketType) + sizeof(PacketVersion)
                 + NUM_BYTES_LOCALID;
 
-    QByteArray verificationHash = hashForPacketAndHMAC(*this, hmacAuth);
-    
-    memcpy(_packet.get() + offset, verificationHash.data(), verificationHash.size());
+    unsigned char hashResult[HMACAuth::MAX_HASH_SIZE];
+    int hashLen = hmacAuth.calculateHash(hashResult, _packet.get() + offset + NUM_BYTES_MD5_HASH,
+                                         (int)(getDataSize() - offset - NUM_BYTES_MD5_HASH));
+    Q_ASSERT(hashLen == NUM_BYTES_MD5_HASH);
+
+    memcpy(_packet.get() + offset, hashResult, std::min(hashLen, NUM_BYTES_MD5_HASH));
 }
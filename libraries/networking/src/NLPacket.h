@@ -33,7 +33,7 @@ public:
     //    |  Packet Type  |    Version    | Local Node ID - sourced only  |
     //    +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
     //    |                                                               |
-    //    |                 MD5 Verification - 16 bytes                   |
+    //    |       Verification - 16 bytes, HMAC-MD5 or SipHash-2-4        |
     //    |                 (ONLY FOR VERIFIED PACKETS)                   |
     //    |                                                               |
     //    +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
@@ -72,6 +72,7 @@ public:
     static LocalID sourceIDInHeader(const udt::Packet& packet);
     static QByteArray verificationHashInHeader(const udt::Packet& packet);
     static QByteArray hashForPacketAndHMAC(const udt::Packet& packet, HMACAuth& hash);
+    static bool isVerificationHashValid(const udt::Packet& packet, HMACAuth& hash);
     
     PacketType getType() const { return _type; }
     void setType(PacketType type);
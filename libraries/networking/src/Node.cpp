@@ -213,13 +213,20 @@ void Node::setConnectionSecret(const QUuid& connectionSecret) {
     }
 
     if (!_authenticateHash) {
-        _authenticateHash.reset(new HMACAuth());
+        _authenticateHash.reset(new HMACAuth(_authenticationMethod));
     }
 
     _connectionSecret = connectionSecret;
     _authenticateHash->setKey(_connectionSecret);
 }
 
+void Node::setAuthenticationMethod(HMACAuth::AuthMethod authMethod) {
+    _authenticationMethod = authMethod;
+    if (_authenticateHash) {
+        _authenticateHash->setAuthMethod(authMethod);
+    }
+}
+
 void Node::updateStats(Stats stats) {
     _stats = stats;
 }
@@ -62,6 +62,7 @@ public:
     const QUuid& getConnectionSecret() const { return _connectionSecret; }
     void setConnectionSecret(const QUuid& connectionSecret);
     HMACAuth* getAuthenticateHash() const { return _authenticateHash.get(); }
+    void setAuthenticationMethod(HMACAuth::AuthMethod authMethod);
 
     NodeData* getLinkedData() const { return _linkedData.get(); }
     void setLinkedData(std::unique_ptr<NodeData> linkedData) { _linkedData = std::move(linkedData); }
@@ -115,6 +116,7 @@ private:
 
     QUuid _connectionSecret;
     std::unique_ptr<HMACAuth> _authenticateHash { nullptr };
+    HMACAuth::AuthMethod _authenticationMethod { HMACAuth::MD5 };
     std::unique_ptr<NodeData> _linkedData;
     bool _isReplicated { false };
     int _pingMs;
@@ -110,6 +110,13 @@ NodeList::NodeList(char newOwnerType, int socketListenPort, int dtlsListenPort)
     // anytime we get a new node we may need to re-send our set of ignored node IDs to it
     connect(this, &LimitedNodeList::nodeActivated, this, &NodeList::maybeSendIgnoreSetToNode);
 
+    // a node we lost on our own is one the domain-server still thinks we have, ask for a full list next time
+    connect(this, &LimitedNodeList::nodeKilled, this, [this] {
+        if (!_isKillingRemovedNode) {
+            _domainListVersion = 0;
+        }
+    });
+
     // setup our timer to send keepalive pings (it's started and stopped on domain connect/disconnect)
     _keepAlivePingTimer.setInterval(KEEPALIVE_PING_INTERVAL_MS); // 1s, Qt::CoarseTimer acceptable
     connect(&_keepAlivePingTimer, &QTimer::timeout, this, &NodeList::sendKeepAlivePings);
@@ -284,6 +291,8 @@ void NodeList::reset(QString reason, bool skipDomainHandlerReset) {
         _domainHandler.softReset(reason);
     }
 
+    _domainListVersion = 0;
+
     // refresh the owner UUID to the NULL UUID
     setSessionUUID(QUuid());
     setSessionLocalID(Node::NULL_LOCAL_ID);
@@ -466,7 +475,9 @@ void NodeList::sendDomainServerCheckIn() {
         packetStream << _ownerType.load() << publicSockAddr << localSockAddr << _nodeTypesOfInterest.toList();
         packetStream << DependencyManager::get<AddressManager>()->getPlaceName();
 
-        if (!domainIsConnected) {
+        if (domainIsConnected) {
+            packetStream << _domainListVersion;
+        } else {
             DataServerAccountInfo& accountInfo = accountManager->getAccountInfo();
             packetStream << accountInfo.getUsername();
 
@@ -692,6 +703,8 @@ void NodeList::processDomainServerList(QSharedPointer<ReceivedMessage> message)
     // Is packet authentication enabled?
     bool isAuthenticated;
     packetStream >> isAuthenticated;
+    quint8 authenticationMethod;
+    packetStream >> authenticationMethod;
 
     qint64 now = qint64(duration_cast<microseconds>(system_clock::now().time_since_epoch()).count());
 
@@ -707,6 +720,12 @@ void NodeList::processDomainServerList(QSharedPointer<ReceivedMessage> message)
     bool newConnection;
     packetStream >> newConnection;
 
+    // a list with a base version only has what changed since that version
+    quint64 domainListVersion;
+    packetStream >> domainListVersion;
+    quint64 baseListVersion;
+    packetStream >> baseListVersion;
+
     if (newConnection) {
         _nodeConnectTimestamp = usecTimestampNow();
         _connectReason = Connect;
@@ -785,11 +804,27 @@ void NodeList::processDomainServerList(QSharedPointer<ReceivedMessage> message)
 
     setPermissions(newPermissions);
     setAuthenticatePackets(isAuthenticated);
+    setAuthenticationMethod((HMACAuth::AuthMethod)authenticationMethod);
+
+    if (baseListVersion != 0 && baseListVersion != _domainListVersion) {
+        // changes to a list we don't have, we'll ask for a full one with our next check-in
+        return;
+    }
+
+    quint32 numRemovedNodes;
+    packetStream >> numRemovedNodes;
+    for (quint32 i = 0; i < numRemovedNodes; ++i) {
+        QUuid nodeUUID;
+        packetStream >> nodeUUID;
+        killNodeRemovedByDomainServer(nodeUUID);
+    }
 
     // pull each node in the packet
     while (packetStream.device()->pos() < message->getSize()) {
         parseNodeFromPacketStream(packetStream);
     }
+
+    _domainListVersion = domainListVersion;
 }
 
 void NodeList::processDomainServerAddedNode(QSharedPointer<ReceivedMessage> message) {
@@ -804,7 +839,14 @@ void NodeList::processDomainServerRemovedNode(QSharedPointer<ReceivedMessage> me
     // read the UUID from the packet, remove it if it exists
     QUuid nodeUUID = QUuid::fromRfc4122(message->readWithoutCopy(NUM_BYTES_RFC4122_UUID));
     qCDebug(networking) << "Received packet from domain-server to remove node with UUID" << uuidStringWithoutCurlyBraces(nodeUUID);
+    killNodeRemovedByDomainServer(nodeUUID);
+}
+
+void NodeList::killNodeRemovedByDomainServer(const QUuid& nodeUUID) {
+    _isKillingRemovedNode = true;
     killNodeWithUUID(nodeUUID);
+    _isKillingRemovedNode = false;
+
     removeDelayedAdd(nodeUUID);
 }
 
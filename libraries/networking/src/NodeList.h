@@ -161,6 +161,7 @@ private:
     void sendDSPathQuery(const QString& newPath);
 
     void parseNodeFromPacketStream(QDataStream& packetStream);
+    void killNodeRemovedByDomainServer(const QUuid& nodeUUID);
 
     void pingPunchForInactiveNode(const SharedNodePointer& node);
 
@@ -174,6 +175,10 @@ private:
     QTimer _keepAlivePingTimer;
     bool _requestsDomainListData { false };
 
+    // the version of the domain list we have, sent with list requests so the domain-server can send what changed since
+    quint64 _domainListVersion { 0 };
+    bool _isKillingRemovedNode { false };
+
     bool _sendDomainServerCheckInEnabled { true };
 
     mutable QReadWriteLock _ignoredSetLock;
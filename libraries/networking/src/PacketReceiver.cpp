@@ -12,14 +12,27 @@
 
 #include "PacketReceiver.h"
 
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
 #include <QMutexLocker>
+#include <QThread>
 
 #include "DependencyManager.h"
 #include "NetworkLogging.h"
 #include "NodeList.h"
 #include "SharedUtil.h"
 
-PacketReceiver::PacketReceiver(QObject* parent) : QObject(parent) {
+using namespace std::chrono;
+
+// set while this thread dispatches a message, so a listener unregistering from its own handler does not wait on itself
+static thread_local bool isDispatching = false;
+
+PacketReceiver::PacketReceiver(QObject* parent) :
+    QObject(parent),
+    _listenerTable(std::make_shared<ListenerTable>())
+{
     qRegisterMetaType<QSharedPointer<NLPacket>>();
     qRegisterMetaType<QSharedPointer<NLPacketList>>();
     qRegisterMetaType<QSharedPointer<ReceivedMessage>>();
@@ -72,10 +85,8 @@ void PacketReceiver::registerDirectListener(PacketType type, QObject* listener,
     
     bool success = registerListener(type, listener, slot);
     if (success) {
-        QMutexLocker locker(&_directConnectSetMutex);
-        
-        // if we successfully registered, add this object to the set of objects that are directly connected
-        _directlyConnectedObjects.insert(listener);
+        // if we successfully registered, have this object's slots invoked directly
+        setDirectConnection(listener);
     }
 }
 
@@ -87,13 +98,67 @@ void PacketReceiver::registerDirectListenerForTypes(PacketTypeList types,
     // just call register listener for types to start
     bool success = registerListenerForTypes(std::move(types), listener, slot);
     if (success) {
-        QMutexLocker locker(&_directConnectSetMutex);
-        
-        // if we successfully registered, add this object to the set of objects that are directly connected
-        _directlyConnectedObjects.insert(listener);
+        // if we successfully registered, have this object's slots invoked directly
+        setDirectConnection(listener);
     }
 }
 
+void PacketReceiver::setDirectConnection(QObject* listener) {
+    updateListenerTable([this, listener](ListenerTable& table) {
+        // remembered for the listener's later registrations, the entries of destroyed objects are dropped on the way
+        _directlyConnectedObjects.erase(std::remove_if(_directlyConnectedObjects.begin(), _directlyConnectedObjects.end(),
+            [listener](const QPointer<QObject>& object) { return !object || object == listener; }),
+            _directlyConnectedObjects.end());
+        _directlyConnectedObjects.push_back(listener);
+
+        for (auto& entry : table) {
+            if (entry.isRegistered && entry.object == listener) {
+                entry.connectionType = Qt::DirectConnection;
+            }
+        }
+    });
+}
+
+void PacketReceiver::registerDirectHandler(PacketTypeList types, QObject* owner, DirectHandler handler,
+                                           bool deliverPending) {
+    Q_ASSERT_X(owner, "PacketReceiver::registerDirectHandler", "No owner to register");
+    Q_ASSERT_X(handler, "PacketReceiver::registerDirectHandler", "No handler to register");
+
+    updateListenerTable([&](ListenerTable& table) {
+        for (auto type : types) {
+            auto& entry = table[(size_t)type];
+            if (entry.isRegistered) {
+                qCWarning(networking) << "Registering a direct packet handler for packet type" << type
+                    << "that will remove a previously registered listener";
+            }
+
+            entry = Listener();
+            entry.object = owner;
+            entry.handler = handler;
+            entry.deliverPending = deliverPending;
+            entry.connectionType = Qt::DirectConnection;
+            entry.isRegistered = true;
+        }
+    });
+}
+
+bool PacketReceiver::isDirectlyConnected(QObject* listener) const {
+    return std::find(_directlyConnectedObjects.begin(), _directlyConnectedObjects.end(), listener)
+        != _directlyConnectedObjects.end();
+}
+
+std::shared_ptr<const PacketReceiver::ListenerTable> PacketReceiver::updateListenerTable(
+        const std::function<void(ListenerTable&)>& update) {
+    QMutexLocker locker(&_packetListenerLock);
+
+    auto oldTable = std::atomic_load(&_listenerTable);
+    auto newTable = std::make_shared<ListenerTable>(*oldTable);
+    update(*newTable);
+    std::atomic_store(&_listenerTable, std::shared_ptr<const ListenerTable>(std::move(newTable)));
+
+    return oldTable;
+}
+
 bool PacketReceiver::registerListener(PacketType type, QObject* listener, const char* slot,
                                              bool deliverPending) {
     Q_ASSERT_X(listener, "PacketReceiver::registerListener", "No object to register");
@@ -167,37 +232,62 @@ QMetaMethod PacketReceiver::matchingMethodForListener(PacketType type, QObject*
 
 void PacketReceiver::registerVerifiedListener(PacketType type, QObject* object, const QMetaMethod& slot, bool deliverPending) {
     Q_ASSERT_X(object, "PacketReceiver::registerVerifiedListener", "No object to register");
-    QMutexLocker locker(&_packetListenerLock);
 
-    if (_messageListenerMap.contains(type)) {
-        qCWarning(networking) << "Registering a packet listener for packet type" << type
-            << "that will remove a previously registered listener";
-    }
-    
-    // add the mapping
-    _messageListenerMap[type] = { QPointer<QObject>(object), slot, deliverPending };
+    updateListenerTable([&](ListenerTable& table) {
+        auto& entry = table[(size_t)type];
+        if (entry.isRegistered) {
+            qCWarning(networking) << "Registering a packet listener for packet type" << type
+                << "that will remove a previously registered listener";
+        }
+
+        // add the mapping
+        entry = Listener();
+        entry.object = object;
+        entry.method = slot;
+        entry.deliverPending = deliverPending;
+        entry.connectionType = isDirectlyConnected(object) ? Qt::DirectConnection : Qt::AutoConnection;
+        entry.isRegistered = true;
+    });
 }
 
 void PacketReceiver::unregisterListener(QObject* listener) {
     Q_ASSERT_X(listener, "PacketReceiver::unregisterListener", "No listener to unregister");
     
-    {
-        QMutexLocker packetListenerLocker(&_packetListenerLock);
-        
-        // clear any registrations for this listener in _messageListenerMap
-        auto it = _messageListenerMap.begin();
-        
-        while (it != _messageListenerMap.end()) {
-            if (it.value().object == listener) {
-                it = _messageListenerMap.erase(it);
-            } else {
-                ++it;
+    // clear any registrations for this listener in the table
+    auto oldTable = updateListenerTable([this, listener](ListenerTable& table) {
+        for (auto& entry : table) {
+            if (entry.isRegistered && entry.object == listener) {
+                entry = Listener();
             }
         }
+
+        _directlyConnectedObjects.erase(std::remove(_directlyConnectedObjects.begin(), _directlyConnectedObjects.end(),
+            QPointer<QObject>(listener)), _directlyConnectedObjects.end());
+    });
+
+    // a dispatch holds on to the table it read, wait for those still running with the old one
+    if (!isDispatching) {
+        while (oldTable.use_count() > 1) {
+            std::this_thread::yield();
+        }
     }
-    
-    QMutexLocker directConnectSetLocker(&_directConnectSetMutex);
-    _directlyConnectedObjects.remove(listener);
+}
+
+PacketReceiver::DispatchStatsList PacketReceiver::sampleDispatchStats() {
+    DispatchStatsList statsList;
+
+    for (size_t i = 0; i < NUM_PACKET_TYPES; ++i) {
+        auto& counters = _dispatchCounters[i];
+        auto numMessages = counters.numMessages.exchange(0);
+        auto totalLatencyUsecs = counters.totalLatencyUsecs.exchange(0);
+        auto maxLatencyUsecs = counters.maxLatencyUsecs.exchange(0);
+
+        if (numMessages > 0) {
+            statsList.push_back({ (PacketType)i, numMessages, totalLatencyUsecs / numMessages, maxLatencyUsecs });
+        }
+    }
+
+    return statsList;
 }
 
 void PacketReceiver::handleVerifiedPacket(std::unique_ptr<udt::Packet> packet) {
@@ -250,6 +340,56 @@ void PacketReceiver::handleMessageFailure(HifiSockAddr from, udt::Packet::Messag
     }
 }
 
+void PacketReceiver::recordDispatch(const ReceivedMessage& message) {
+    // messages that were not received, e.g. unwrapped replicated ones, have no receive time
+    quint64 receiveTime = message.getFirstPacketReceiveTime();
+    if (receiveTime == 0) {
+        return;
+    }
+
+    quint64 now = duration_cast<microseconds>(p_high_resolution_clock::now().time_since_epoch()).count();
+    quint64 latency = now > receiveTime ? now - receiveTime : 0;
+
+    auto& counters = _dispatchCounters[(size_t)message.getType()];
+    counters.numMessages++;
+    counters.totalLatencyUsecs += latency;
+
+    quint64 maxLatency = counters.maxLatencyUsecs;
+    while (latency > maxLatency && !counters.maxLatencyUsecs.compare_exchange_weak(maxLatency, latency)) { }
+}
+
+void PacketReceiver::invokeListener(const Listener& listener, QSharedPointer<ReceivedMessage> receivedMessage,
+                                    SharedNodePointer matchingNode) {
+    QMetaMethod metaMethod = listener.method;
+
+    static const QByteArray QSHAREDPOINTER_NODE_NORMALIZED = QMetaObject::normalizedType("QSharedPointer<Node>");
+    static const QByteArray SHARED_NODE_NORMALIZED = QMetaObject::normalizedType("SharedNodePointer");
+
+    bool success = false;
+    if (metaMethod.parameterTypes().contains(SHARED_NODE_NORMALIZED)) {
+        success = metaMethod.invoke(listener.object,
+                                    Qt::DirectConnection,
+                                    Q_ARG(QSharedPointer<ReceivedMessage>, receivedMessage),
+                                    Q_ARG(SharedNodePointer, matchingNode));
+
+    } else if (metaMethod.parameterTypes().contains(QSHAREDPOINTER_NODE_NORMALIZED)) {
+        success = metaMethod.invoke(listener.object,
+                                    Qt::DirectConnection,
+                                    Q_ARG(QSharedPointer<ReceivedMessage>, receivedMessage),
+                                    Q_ARG(QSharedPointer<Node>, matchingNode));
+
+    } else {
+        success = metaMethod.invoke(listener.object,
+                                    Qt::DirectConnection,
+                                    Q_ARG(QSharedPointer<ReceivedMessage>, receivedMessage));
+    }
+
+    if (!success) {
+        qCDebug(networking).nospace() << "Error delivering packet " << receivedMessage->getType() << " to listener "
+            << listener.object << "::" << qPrintable(listener.method.methodSignature());
+    }
+}
+
 void PacketReceiver::handleVerifiedMessage(QSharedPointer<ReceivedMessage> receivedMessage, bool justReceived) {
     auto nodeList = DependencyManager::get<LimitedNodeList>();
     
@@ -258,71 +398,70 @@ void PacketReceiver::handleVerifiedMessage(QSharedPointer<ReceivedMessage> recei
     if (receivedMessage->getSourceID() != Node::NULL_LOCAL_ID) {
         matchingNode = nodeList->nodeWithLocalID(receivedMessage->getSourceID());
     }
-    QMutexLocker packetListenerLocker(&_packetListenerLock);
-    
-    auto it = _messageListenerMap.find(receivedMessage->getType());
-    if (it != _messageListenerMap.end() && it->method.isValid()) {
-         
-        auto listener = it.value();
 
-        if ((listener.deliverPending && !justReceived) || (!listener.deliverPending && !receivedMessage->isComplete())) {
-            return;
-        }
-            
-        bool success = false;
-
-        Qt::ConnectionType connectionType;
-        // check if this is a directly connected listener
-        {
-            QMutexLocker directConnectLocker(&_directConnectSetMutex);
-            connectionType = _directlyConnectedObjects.contains(listener.object) ? Qt::DirectConnection : Qt::AutoConnection;
+    auto type = receivedMessage->getType();
+    if ((size_t)type >= NUM_PACKET_TYPES) {
+        qCWarning(networking) << "Received a packet of unknown type" << type;
+        return;
+    }
+
+    // no lock here, the table only changes by being replaced
+    auto table = std::atomic_load(&_listenerTable);
+    const Listener& listener = (*table)[(size_t)type];
+
+    if (!listener.isRegistered) {
+        if (!listener.wasReportedMissing) {
+            qCWarning(networking) << "No listener found for packet type" << type;
+
+            // flag the type so we don't print this again
+            updateListenerTable([type](ListenerTable& table) {
+                table[(size_t)type].wasReportedMissing = true;
+            });
         }
+        return;
+    }
 
-        QMetaMethod metaMethod = listener.method;
-
-        static const QByteArray QSHAREDPOINTER_NODE_NORMALIZED = QMetaObject::normalizedType("QSharedPointer<Node>");
-        static const QByteArray SHARED_NODE_NORMALIZED = QMetaObject::normalizedType("SharedNodePointer");
-
-        // one final check on the QPointer before we go to invoke
-        if (listener.object) {
-            if (metaMethod.parameterTypes().contains(SHARED_NODE_NORMALIZED)) {
-                success = metaMethod.invoke(listener.object,
-                                            connectionType,
-                                            Q_ARG(QSharedPointer<ReceivedMessage>, receivedMessage),
-                                            Q_ARG(SharedNodePointer, matchingNode));
-
-            } else if (metaMethod.parameterTypes().contains(QSHAREDPOINTER_NODE_NORMALIZED)) {
-                success = metaMethod.invoke(listener.object,
-                                            connectionType,
-                                            Q_ARG(QSharedPointer<ReceivedMessage>, receivedMessage),
-                                            Q_ARG(QSharedPointer<Node>, matchingNode));
-
-            } else {
-                success = metaMethod.invoke(listener.object,
-                                            connectionType,
-                                            Q_ARG(QSharedPointer<ReceivedMessage>, receivedMessage));
-            }
-        } else {
-            qCDebug(networking).nospace() << "Listener for packet " << receivedMessage->getType()
-                << " has been destroyed. Removing from listener map.";
-            it = _messageListenerMap.erase(it);
-
-            // if it exists, remove the listener from _directlyConnectedObjects
-            {
-                QMutexLocker directConnectLocker(&_directConnectSetMutex);
-                _directlyConnectedObjects.remove(listener.object);
+    if ((listener.deliverPending && !justReceived) || (!listener.deliverPending && !receivedMessage->isComplete())) {
+        return;
+    }
+
+    // one final check on the QPointer before we go to invoke
+    QObject* object = listener.object;
+    if (!object) {
+        qCDebug(networking).nospace() << "Listener for packet " << type
+            << " has been destroyed. Removing from listener map.";
+
+        updateListenerTable([type](ListenerTable& table) {
+            auto& entry = table[(size_t)type];
+            if (entry.isRegistered && !entry.object) {
+                entry = Listener();
             }
-        }
+        });
+        return;
+    }
 
-        if (!success) {
-            qCDebug(networking).nospace() << "Error delivering packet " << receivedMessage->getType() << " to listener "
-                << listener.object << "::" << qPrintable(listener.method.methodSignature());
-        }
+    isDispatching = true;
 
-    } else if (it == _messageListenerMap.end()) {
-        qCWarning(networking) << "No listener found for packet type" << receivedMessage->getType();
-        
-        // insert a dummy listener so we don't print this again
-        _messageListenerMap.insert(receivedMessage->getType(), { nullptr, QMetaMethod(), false });
+    if (listener.handler) {
+        // straight to the queue of whoever processes it
+        recordDispatch(*receivedMessage);
+        listener.handler(receivedMessage, matchingNode);
+
+    } else if (listener.connectionType == Qt::DirectConnection || object->thread() == QThread::currentThread()) {
+        recordDispatch(*receivedMessage);
+        invokeListener(listener, receivedMessage, matchingNode);
+
+    } else {
+        // through the event loop of the listener's thread, the latency is measured once it gets there
+        QPointer<QObject> objectPointer = listener.object;
+        Listener queuedListener = listener;
+        QMetaObject::invokeMethod(object, [this, objectPointer, queuedListener, receivedMessage, matchingNode] {
+            if (objectPointer) {
+                recordDispatch(*receivedMessage);
+                invokeListener(queuedListener, receivedMessage, matchingNode);
+            }
+        }, Qt::QueuedConnection);
     }
+
+    isDispatching = false;
 }
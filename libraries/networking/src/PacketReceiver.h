@@ -13,6 +13,10 @@
 #ifndef hifi_PacketReceiver_h
 #define hifi_PacketReceiver_h
 
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <vector>
 #include <unordered_map>
 
@@ -21,10 +25,10 @@
 #include <QtCore/QMutex>
 #include <QtCore/QObject>
 #include <QtCore/QPointer>
-#include <QtCore/QSet>
 
 #include "NLPacket.h"
 #include "NLPacketList.h"
+#include "Node.h"
 #include "ReceivedMessage.h"
 #include "udt/PacketHeaders.h"
 
@@ -44,7 +48,20 @@ class PacketReceiver : public QObject {
     Q_OBJECT
 public:
     using PacketTypeList = std::vector<PacketType>;
-    
+
+    // Called on the thread that receives the packets, without going through any event loop.  It must be thread safe
+    // and should do no more than hand the message to the queue of the thread that processes it.
+    using DirectHandler = std::function<void(QSharedPointer<ReceivedMessage>, SharedNodePointer)>;
+
+    class DispatchStats {
+    public:
+        PacketType type;
+        quint64 numMessages;
+        quint64 averageLatencyUsecs; // from the first packet being received to the listener starting on the message
+        quint64 maxLatencyUsecs;
+    };
+    using DispatchStatsList = std::vector<DispatchStats>;
+
     PacketReceiver(QObject* parent = 0);
     PacketReceiver(const PacketReceiver&) = delete;
 
@@ -57,7 +74,13 @@ public:
     // for the message is received.
     bool registerListener(PacketType type, QObject* listener, const char* slot, bool deliverPending = false);
     bool registerListenerForTypes(PacketTypeList types, QObject* listener, const char* slot);
+    // The handler belongs to owner, and is dropped when owner is unregistered or destroyed.
+    void registerDirectHandler(PacketTypeList types, QObject* owner, DirectHandler handler, bool deliverPending = false);
+    // Waits for any direct handler of listener that is running to return, so listener can be destroyed right after.
     void unregisterListener(QObject* listener);
+
+    // The dispatch latency of each packet type received since the last sample.
+    DispatchStatsList sampleDispatchStats();
     
     void handleVerifiedPacket(std::unique_ptr<udt::Packet> packet);
     void handleVerifiedMessagePacket(std::unique_ptr<udt::Packet> message);
@@ -67,25 +90,49 @@ private:
     struct Listener {
         QPointer<QObject> object;
         QMetaMethod method;
-        bool deliverPending;
+        DirectHandler handler; // called in place of the method when set
+        bool deliverPending { false };
+        Qt::ConnectionType connectionType { Qt::AutoConnection };
+        bool isRegistered { false };
+        bool wasReportedMissing { false };
+    };
+
+    // Indexed by packet type, and replaced as a whole on each change so that messages are dispatched without a lock.
+    static const size_t NUM_PACKET_TYPES = (size_t)PacketType::NUM_PACKET_TYPE;
+    using ListenerTable = std::array<Listener, NUM_PACKET_TYPES>;
+
+    class DispatchCounters {
+    public:
+        std::atomic<quint64> numMessages { 0 };
+        std::atomic<quint64> totalLatencyUsecs { 0 };
+        std::atomic<quint64> maxLatencyUsecs { 0 };
     };
 
     void handleVerifiedMessage(QSharedPointer<ReceivedMessage> message, bool justReceived);
+    void invokeListener(const Listener& listener, QSharedPointer<ReceivedMessage> message, SharedNodePointer node);
+    void recordDispatch(const ReceivedMessage& message);
 
     // these are brutal hacks for now - ideally GenericThread / ReceivedPacketProcessor
     // should be changed to have a true event loop and be able to handle our QMetaMethod::invoke
     void registerDirectListenerForTypes(PacketTypeList types, QObject* listener, const char* slot);
     void registerDirectListener(PacketType type, QObject* listener, const char* slot);
+    // has the slots of listener invoked on the network thread, for what it has registered and will register
+    void setDirectConnection(QObject* listener);
+    bool isDirectlyConnected(QObject* listener) const;
 
     QMetaMethod matchingMethodForListener(PacketType type, QObject* object, const char* slot) const;
     void registerVerifiedListener(PacketType type, QObject* listener, const QMetaMethod& slot, bool deliverPending = false);
 
-    QMutex _packetListenerLock;
-    QHash<PacketType, Listener> _messageListenerMap;
+    // copies the table, lets update change the copy and publishes it, returns the table it replaced
+    std::shared_ptr<const ListenerTable> updateListenerTable(const std::function<void(ListenerTable&)>& update);
+
+    QMutex _packetListenerLock; // held while changing the table
+    std::shared_ptr<const ListenerTable> _listenerTable;
+    std::vector<QPointer<QObject>> _directlyConnectedObjects; // guarded by _packetListenerLock
+
+    std::array<DispatchCounters, NUM_PACKET_TYPES> _dispatchCounters;
 
     bool _shouldDropPackets = false;
-    QMutex _directConnectSetMutex;
-    QSet<QObject*> _directlyConnectedObjects;
 
     std::unordered_map<std::pair<HifiSockAddr, udt::Packet::MessageNumber>, QSharedPointer<ReceivedMessage>> _pendingMessages;
     
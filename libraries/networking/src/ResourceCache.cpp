@@ -30,7 +30,7 @@
 
 bool ResourceCacheSharedItems::appendRequest(QWeakPointer<Resource> resource) {
     Lock lock(_mutex);
-    if ((uint32_t)_loadingRequests.size() < _requestLimit) {
+    if ((uint32_t)_loadingRequests.size() < _activeRequestLimit) {
         _loadingRequests.append(resource);
         return true;
     } else {
@@ -42,6 +42,9 @@ bool ResourceCacheSharedItems::appendRequest(QWeakPointer<Resource> resource) {
 void ResourceCacheSharedItems::setRequestLimit(uint32_t limit) {
     Lock lock(_mutex);
     _requestLimit = limit;
+    _activeRequestLimit = limit;
+    _activeRequestLimitStep = -1;
+    _lastThroughput = 0.0f;
 }
 
 uint32_t ResourceCacheSharedItems::getRequestLimit() const {
@@ -49,6 +52,65 @@ uint32_t ResourceCacheSharedItems::getRequestLimit() const {
     return _requestLimit;
 }
 
+uint32_t ResourceCacheSharedItems::getActiveRequestLimit() const {
+    Lock lock(_mutex);
+    return _activeRequestLimit;
+}
+
+void ResourceCacheSharedItems::recordBytesDownloaded(qint64 bytes) {
+    const quint64 THROUGHPUT_WINDOW_USECS = 2 * USECS_PER_SECOND;
+
+    Lock lock(_mutex);
+    _bytesDownloaded += bytes;
+
+    auto now = usecTimestampNow();
+    if (_throughputWindowStart == 0) {
+        _throughputWindowStart = now;
+    }
+    _throughputWindowBytes += bytes;
+
+    auto elapsed = now - _throughputWindowStart;
+    if (elapsed < THROUGHPUT_WINDOW_USECS) {
+        return;
+    }
+
+    // only adapt while requests are queued up behind the limit, an idle link says nothing about how much
+    // concurrency it can take
+    if (!_pendingRequests.isEmpty()) {
+        updateActiveRequestLimit((float)_throughputWindowBytes / (float)elapsed);
+    } else {
+        _lastThroughput = 0.0f;
+    }
+    _throughputWindowStart = now;
+    _throughputWindowBytes = 0;
+}
+
+void ResourceCacheSharedItems::updateActiveRequestLimit(float throughput) {
+    const float THROUGHPUT_CHANGE_THRESHOLD = 0.1f;
+
+    if (_lastThroughput > 0.0f) {
+        if (throughput < _lastThroughput * (1.0f - THROUGHPUT_CHANGE_THRESHOLD)) {
+            // the last step made things worse, go back the other way
+            _activeRequestLimitStep = -_activeRequestLimitStep;
+        } else if (throughput < _lastThroughput * (1.0f + THROUGHPUT_CHANGE_THRESHOLD)) {
+            // no real difference, prefer fewer requests so the highest priority ones finish sooner
+            _activeRequestLimitStep = -1;
+        }
+    }
+    _lastThroughput = throughput;
+
+    int64_t limit = (int64_t)_activeRequestLimit + _activeRequestLimitStep;
+    uint32_t minLimit = std::min(MIN_ACTIVE_REQUEST_LIMIT, _requestLimit);
+    if (limit <= (int64_t)minLimit) {
+        limit = minLimit;
+        _activeRequestLimitStep = 1;
+    } else if (limit >= (int64_t)_requestLimit) {
+        limit = _requestLimit;
+        _activeRequestLimitStep = -1;
+    }
+    _activeRequestLimit = (uint32_t)limit;
+}
+
 QList<QSharedPointer<Resource>> ResourceCacheSharedItems::getPendingRequests() const {
     QList<QSharedPointer<Resource>> result;
     Lock lock(_mutex);
@@ -265,13 +327,13 @@ ResourceCache::~ResourceCache() {
 }
 
 void ResourceCache::clearATPAssets() {
-    {
-        QWriteLocker locker(&_resourcesLock);
-        QList<QUrl> urls = _resources.keys();
+    for (auto& shard : _resourceShards) {
+        QWriteLocker locker(&shard.lock);
+        QList<QUrl> urls = shard.resources.keys();
         for (auto& url : urls) {
             // If this is an ATP resource
             if (url.scheme() == URL_SCHEME_ATP) {
-                auto resourcesWithExtraHash = _resources.take(url);
+                auto resourcesWithExtraHash = shard.resources.take(url);
                 for (auto& resource : resourcesWithExtraHash) {
                     if (auto strongRef = resource.lock()) {
                         // Make sure the resource won't reinsert itself
@@ -284,10 +346,14 @@ void ResourceCache::clearATPAssets() {
     }
     {
         QWriteLocker locker(&_unusedResourcesLock);
-        for (auto& resource : _unusedResources.values()) {
+        for (auto it = _unusedResources.begin(); it != _unusedResources.end();) {
+            auto& resource = *it;
             if (resource->getURL().scheme() == URL_SCHEME_ATP) {
-                _unusedResources.remove(resource->getLRUKey());
+                resource->_isUnused = false;
                 _unusedResourcesSize -= resource->getBytes();
+                it = _unusedResources.erase(it);
+            } else {
+                ++it;
             }
         }
     }
@@ -300,11 +366,7 @@ void ResourceCache::refreshAll() {
     clearUnusedResources();
     resetUnusedResourceCounter();
 
-    QHash<QUrl, QHash<size_t, QWeakPointer<Resource>>> allResources;
-    {
-        QReadLocker locker(&_resourcesLock);
-        allResources = _resources;
-    }
+    Resources allResources = getAllResources();
 
     // Refresh all remaining resources in use
     // FIXME: this will trigger multiple refreshes for the same resource if they have different hashes
@@ -325,14 +387,11 @@ QVariantList ResourceCache::getResourceList() {
         BLOCKING_INVOKE_METHOD(this, "getResourceList",
             Q_RETURN_ARG(QVariantList, list));
     } else {
-        QList<QUrl> resources;
-        {
-            QReadLocker locker(&_resourcesLock);
-            resources = _resources.uniqueKeys();
-        }
-        list.reserve(resources.size());
-        for (auto& resource : resources) {
-            list << resource;
+        for (auto& shard : _resourceShards) {
+            QReadLocker locker(&shard.lock);
+            for (auto it = shard.resources.cbegin(); it != shard.resources.cend(); ++it) {
+                list << it.key();
+            }
         }
     }
 
@@ -349,11 +408,21 @@ void ResourceCache::setRequestLimit(uint32_t limit) {
     }
 }
 
+ResourceCache::Resources ResourceCache::getAllResources() {
+    Resources allResources;
+    for (auto& shard : _resourceShards) {
+        QReadLocker locker(&shard.lock);
+        allResources.unite(shard.resources);
+    }
+    return allResources;
+}
+
 QSharedPointer<Resource> ResourceCache::getResource(const QUrl& url, const QUrl& fallback, void* extra, size_t extraHash) {
     QSharedPointer<Resource> resource;
     {
-        QWriteLocker locker(&_resourcesLock);
-        auto& resourcesWithExtraHash = _resources[url];
+        auto& shard = getResourceShard(url);
+        QWriteLocker locker(&shard.lock);
+        auto& resourcesWithExtraHash = shard.resources[url];
         auto resourcesWithExtraHashIter = resourcesWithExtraHash.find(extraHash);
         if (resourcesWithExtraHashIter != resourcesWithExtraHash.end()) {
             // We've seen this extra info before
@@ -375,6 +444,8 @@ QSharedPointer<Resource> ResourceCache::getResource(const QUrl& url, const QUrl&
         }
     }
     if (resource) {
+        ++_numHits;
+        DependencyManager::get<ResourceCacheSharedItems>()->recordCacheHit();
         removeUnusedResource(resource);
     }
 
@@ -390,10 +461,9 @@ QSharedPointer<Resource> ResourceCache::getResource(const QUrl& url, const QUrl&
         resource->setCache(this);
         resource->moveToThread(qApp->thread());
         connect(resource.data(), &Resource::updateSize, this, &ResourceCache::updateTotalSize);
-        {
-            QWriteLocker locker(&_resourcesLock);
-            _resources[url].insert(extraHash, resource);
-        }
+        insertResource(url, extraHash, resource);
+        ++_numMisses;
+        DependencyManager::get<ResourceCacheSharedItems>()->recordCacheMiss();
         removeUnusedResource(resource);
         resource->ensureLoading();
     }
@@ -417,13 +487,14 @@ void ResourceCache::addUnusedResource(const QSharedPointer<Resource>& resource)
         return;
     }
     reserveUnusedResource(resource->getBytes());
-    
-    resource->setLRUKey(++_lastLRUKey);
 
     {
         QWriteLocker locker(&_unusedResourcesLock);
-        _unusedResources.insert(resource->getLRUKey(), resource);
-        _unusedResourcesSize += resource->getBytes();
+        if (!resource->_isUnused) {
+            resource->_unusedIterator = _unusedResources.insert(_unusedResources.end(), resource);
+            resource->_isUnused = true;
+            _unusedResourcesSize += resource->getBytes();
+        }
     }
 
     resetUnusedResourceCounter();
@@ -431,10 +502,14 @@ void ResourceCache::addUnusedResource(const QSharedPointer<Resource>& resource)
 
 void ResourceCache::removeUnusedResource(const QSharedPointer<Resource>& resource) {
     QWriteLocker locker(&_unusedResourcesLock);
-    if (_unusedResources.contains(resource->getLRUKey())) {
-        _unusedResources.remove(resource->getLRUKey());
+    if (resource->_isUnused) {
+        resource->_isUnused = false;
         _unusedResourcesSize -= resource->getBytes();
 
+        // the list holds a reference to the resource, so keep ours until the node is gone
+        auto unusedResource = std::move(*resource->_unusedIterator);
+        _unusedResources.erase(resource->_unusedIterator);
+
         locker.unlock();
         resetUnusedResourceCounter();
     }
@@ -445,17 +520,21 @@ void ResourceCache::reserveUnusedResource(qint64 resourceSize) {
     while (!_unusedResources.empty() &&
            _unusedResourcesSize + resourceSize > _unusedResourcesMaxSize) {
         // unload the oldest resource
-        QMap<int, QSharedPointer<Resource> >::iterator it = _unusedResources.begin();
-        
-        it.value()->setCache(nullptr);
-        auto size = it.value()->getBytes();
+        auto resource = std::move(_unusedResources.front());
+        _unusedResources.pop_front();
+        resource->_isUnused = false;
+
+        resource->setCache(nullptr);
+        auto size = resource->getBytes();
+        _unusedResourcesSize -= size;
+
+        ++_numEvictions;
+        DependencyManager::get<ResourceCacheSharedItems>()->recordCacheEviction();
 
         locker.unlock();
-        removeResource(it.value()->getURL(), it.value()->getExtraHash(), size);
+        removeResource(resource->getURL(), resource->getExtraHash(), size);
+        resource.reset();
         locker.relock();
-
-        _unusedResourcesSize -= size;
-        _unusedResources.erase(it);
     }
 }
 
@@ -463,19 +542,26 @@ void ResourceCache::clearUnusedResources() {
     // the unused resources may themselves reference resources that will be added to the unused
     // list on destruction, so keep clearing until there are no references left
     QWriteLocker locker(&_unusedResourcesLock);
-    while (!_unusedResources.isEmpty()) {
-        foreach (const QSharedPointer<Resource>& resource, _unusedResources) {
+    while (!_unusedResources.empty()) {
+        UnusedResources unusedResources;
+        unusedResources.swap(_unusedResources);
+        for (auto& resource : unusedResources) {
+            resource->_isUnused = false;
             resource->setCache(nullptr);
         }
-        _unusedResources.clear();
+        unusedResources.clear();
     }
     _unusedResourcesSize = 0;
 }
 
 void ResourceCache::resetTotalResourceCounter() {
     {
-        QReadLocker locker(&_resourcesLock);
-        _numTotalResources = _resources.size();
+        size_t numTotalResources = 0;
+        for (auto& shard : _resourceShards) {
+            QReadLocker locker(&shard.lock);
+            numTotalResources += shard.resources.size();
+        }
+        _numTotalResources = numTotalResources;
     }
 
     emit dirty();
@@ -497,12 +583,19 @@ void ResourceCache::resetResourceCounters() {
     emit dirty();
 }
 
+void ResourceCache::insertResource(const QUrl& url, size_t extraHash, const QWeakPointer<Resource>& resource) {
+    auto& shard = getResourceShard(url);
+    QWriteLocker locker(&shard.lock);
+    shard.resources[url].insert(extraHash, resource);
+}
+
 void ResourceCache::removeResource(const QUrl& url, size_t extraHash, qint64 size) {
-    QWriteLocker locker(&_resourcesLock);
-    auto& resources = _resources[url];
+    auto& shard = getResourceShard(url);
+    QWriteLocker locker(&shard.lock);
+    auto& resources = shard.resources[url];
     resources.remove(extraHash);
     if (resources.size() == 0) {
-        _resources.remove(url);
+        shard.resources.remove(url);
     }
     _totalResourcesSize -= size;
 }
@@ -529,6 +622,18 @@ uint32_t ResourceCache::getLoadingRequestCount() {
     return DependencyManager::get<ResourceCacheSharedItems>()->getLoadingRequestsCount();
 }
 
+uint64_t ResourceCache::getCacheHitCount() {
+    return DependencyManager::get<ResourceCacheSharedItems>()->getCacheHits();
+}
+
+uint64_t ResourceCache::getCacheMissCount() {
+    return DependencyManager::get<ResourceCacheSharedItems>()->getCacheMisses();
+}
+
+uint64_t ResourceCache::getCacheEvictionCount() {
+    return DependencyManager::get<ResourceCacheSharedItems>()->getCacheEvictions();
+}
+
 bool ResourceCache::attemptRequest(QSharedPointer<Resource> resource) {
     Q_ASSERT(!resource.isNull());
 
@@ -546,7 +651,7 @@ void ResourceCache::requestCompleted(QWeakPointer<Resource> resource) {
     sharedItems->removeRequest(resource);
 
     // Now go fill any new request spots
-    while (sharedItems->getLoadingRequestsCount() < sharedItems->getRequestLimit() && sharedItems->getPendingRequestsCount() > 0) {
+    while (sharedItems->getLoadingRequestsCount() < sharedItems->getActiveRequestLimit() && sharedItems->getPendingRequestsCount() > 0) {
         attemptHighestPriorityRequest();
     }
 }
@@ -731,8 +836,7 @@ void Resource::setSize(const qint64& bytes) {
 }
 
 void Resource::reinsert() {
-    QWriteLocker locker(&_cache->_resourcesLock);
-    _cache->_resources[_url].insert(_extraHash, _self);
+    _cache->insertResource(_url, _extraHash, _self);
 }
 
 
@@ -795,6 +899,13 @@ void Resource::handleReplyFinished() {
 
     setSize(_bytesTotal);
 
+    if (_request->getResult() == ResourceRequest::Success && !_request->loadedFromCache()) {
+        auto scheme = _activeUrl.scheme();
+        if (scheme == HIFI_URL_SCHEME_HTTP || scheme == HIFI_URL_SCHEME_HTTPS || scheme == URL_SCHEME_ATP) {
+            DependencyManager::get<ResourceCacheSharedItems>()->recordBytesDownloaded(_bytesTotal);
+        }
+    }
+
     // Make sure we keep the Resource alive here
     auto self = _self.lock();
     ResourceCache::requestCompleted(_self);
@@ -12,7 +12,9 @@
 #ifndef hifi_ResourceCache_h
 #define hifi_ResourceCache_h
 
+#include <array>
 #include <atomic>
+#include <list>
 #include <mutex>
 
 #include <QtCore/QHash>
@@ -70,6 +72,7 @@ public:
     void removeRequest(QWeakPointer<Resource> doneRequest);
     void setRequestLimit(uint32_t limit);
     uint32_t getRequestLimit() const;
+    uint32_t getActiveRequestLimit() const;
     QList<QSharedPointer<Resource>> getPendingRequests() const;
     QSharedPointer<Resource> getHighestPendingRequest();
     uint32_t getPendingRequestsCount() const;
@@ -77,14 +80,45 @@ public:
     uint32_t getLoadingRequestsCount() const;
     void clear();
 
+    // Totals across every ResourceCache
+    void recordCacheHit() { ++_cacheHits; }
+    void recordCacheMiss() { ++_cacheMisses; }
+    void recordCacheEviction() { ++_cacheEvictions; }
+    uint64_t getCacheHits() const { return _cacheHits; }
+    uint64_t getCacheMisses() const { return _cacheMisses; }
+    uint64_t getCacheEvictions() const { return _cacheEvictions; }
+
+    // Called with the size of every completed network download; feeds the throughput estimate that
+    // the active request limit is adapted to
+    void recordBytesDownloaded(qint64 bytes);
+    uint64_t getBytesDownloaded() const { return _bytesDownloaded; }
+
 private:
     ResourceCacheSharedItems() = default;
 
+    void updateActiveRequestLimit(float throughput);
+
     mutable Mutex _mutex;
     QList<QWeakPointer<Resource>> _pendingRequests;
     QList<QWeakPointer<Resource>> _loadingRequests;
     const uint32_t DEFAULT_REQUEST_LIMIT = 10;
     uint32_t _requestLimit { DEFAULT_REQUEST_LIMIT };
+
+    // The number of requests actually allowed to run at once. It hill-climbs between MIN_ACTIVE_REQUEST_LIMIT
+    // and _requestLimit: keep stepping in the same direction while throughput improves, turn around when it drops,
+    // and shed a request when it stays flat, since extra requests that don't add throughput only delay the
+    // highest priority ones.
+    const uint32_t MIN_ACTIVE_REQUEST_LIMIT = 2;
+    uint32_t _activeRequestLimit { DEFAULT_REQUEST_LIMIT };
+    int _activeRequestLimitStep { -1 };
+    quint64 _throughputWindowStart { 0 };
+    qint64 _throughputWindowBytes { 0 };
+    float _lastThroughput { 0.0f };
+    std::atomic<uint64_t> _bytesDownloaded { 0 };
+
+    std::atomic<uint64_t> _cacheHits { 0 };
+    std::atomic<uint64_t> _cacheMisses { 0 };
+    std::atomic<uint64_t> _cacheEvictions { 0 };
 };
 
 /// Wrapper to expose resources to JS/QML
@@ -199,6 +233,9 @@ class ResourceCache : public QObject {
     Q_PROPERTY(size_t numCached READ getNumCachedResources NOTIFY dirty)
     Q_PROPERTY(size_t sizeTotal READ getSizeTotalResources NOTIFY dirty)
     Q_PROPERTY(size_t sizeCached READ getSizeCachedResources NOTIFY dirty)
+    Q_PROPERTY(size_t numHits READ getNumHits NOTIFY dirty)
+    Q_PROPERTY(size_t numMisses READ getNumMisses NOTIFY dirty)
+    Q_PROPERTY(size_t numEvictions READ getNumEvictions NOTIFY dirty)
 
 public:
 
@@ -206,11 +243,16 @@ public:
     size_t getSizeTotalResources() const { return _totalResourcesSize; }
     size_t getNumCachedResources() const { return _numUnusedResources; }
     size_t getSizeCachedResources() const { return _unusedResourcesSize; }
+    size_t getNumHits() const { return _numHits; }
+    size_t getNumMisses() const { return _numMisses; }
+    size_t getNumEvictions() const { return _numEvictions; }
 
     Q_INVOKABLE QVariantList getResourceList();
 
     static void setRequestLimit(uint32_t limit);
     static uint32_t getRequestLimit() { return DependencyManager::get<ResourceCacheSharedItems>()->getRequestLimit(); }
+    static uint32_t getActiveRequestLimit() { return DependencyManager::get<ResourceCacheSharedItems>()->getActiveRequestLimit(); }
+    static uint64_t getBytesDownloaded() { return DependencyManager::get<ResourceCacheSharedItems>()->getBytesDownloaded(); }
     
     void setUnusedResourceCacheSize(qint64 unusedResourcesMaxSize);
     qint64 getUnusedResourceCacheSize() const { return _unusedResourcesMaxSize; }
@@ -218,6 +260,9 @@ public:
     static QList<QSharedPointer<Resource>> getLoadingRequests();
     static uint32_t getPendingRequestCount();
     static uint32_t getLoadingRequestCount();
+    static uint64_t getCacheHitCount();
+    static uint64_t getCacheMissCount();
+    static uint64_t getCacheEvictionCount();
 
     ResourceCache(QObject* parent = nullptr);
     virtual ~ResourceCache();
@@ -276,27 +321,43 @@ private:
     friend class ScriptableResourceCache;
 
     void reserveUnusedResource(qint64 resourceSize);
+    void insertResource(const QUrl& url, size_t extraHash, const QWeakPointer<Resource>& resource);
     void removeResource(const QUrl& url, size_t extraHash, qint64 size = 0);
 
     void resetTotalResourceCounter();
     void resetUnusedResourceCounter();
     void resetResourceCounters();
 
-    // Resources
-    QHash<QUrl, QHash<size_t, QWeakPointer<Resource>>> _resources;
-    QReadWriteLock _resourcesLock { QReadWriteLock::Recursive };
-    int _lastLRUKey = 0;
+    using ResourcesWithExtraHash = QHash<size_t, QWeakPointer<Resource>>;
+    using Resources = QHash<QUrl, ResourcesWithExtraHash>;
+
+    // Resources, split into shards by URL so that threads loading different assets don't contend on one lock
+    struct ResourceShard {
+        Resources resources;
+        QReadWriteLock lock { QReadWriteLock::Recursive };
+    };
+    static const size_t NUM_RESOURCE_SHARDS = 16;
+    ResourceShard& getResourceShard(const QUrl& url) { return _resourceShards[qHash(url) % NUM_RESOURCE_SHARDS]; }
+    Resources getAllResources();
+
+    std::array<ResourceShard, NUM_RESOURCE_SHARDS> _resourceShards;
 
     std::atomic<size_t> _numTotalResources { 0 };
     std::atomic<qint64> _totalResourcesSize { 0 };
 
-    // Cached resources
-    QMap<int, QSharedPointer<Resource>> _unusedResources;
+    // Cached resources, least recently used first. Each resource keeps its own position in the list,
+    // so that it can be taken back out in constant time when it is used again.
+    using UnusedResources = std::list<QSharedPointer<Resource>>;
+    UnusedResources _unusedResources;
     QReadWriteLock _unusedResourcesLock { QReadWriteLock::Recursive };
     qint64 _unusedResourcesMaxSize = DEFAULT_UNUSED_MAX_SIZE;
 
     std::atomic<size_t> _numUnusedResources { 0 };
     std::atomic<qint64> _unusedResourcesSize { 0 };
+
+    std::atomic<size_t> _numHits { 0 };
+    std::atomic<size_t> _numMisses { 0 };
+    std::atomic<size_t> _numEvictions { 0 };
 };
 
 /// Wrapper to expose resource caches to JS/QML
@@ -311,11 +372,17 @@ class ScriptableResourceCache : public QObject {
      * @property {number} numCached - Total number of cached resource. <em>Read-only.</em>
      * @property {number} sizeTotal - Size in bytes of all resources. <em>Read-only.</em>
      * @property {number} sizeCached - Size in bytes of all cached resources. <em>Read-only.</em>
+     * @property {number} numHits - Number of resource requests served by a resource already in the cache. <em>Read-only.</em>
+     * @property {number} numMisses - Number of resource requests that created a new resource. <em>Read-only.</em>
+     * @property {number} numEvictions - Number of cached resources evicted to stay within the cache size. <em>Read-only.</em>
      */
     Q_PROPERTY(size_t numTotal READ getNumTotalResources NOTIFY dirty)
     Q_PROPERTY(size_t numCached READ getNumCachedResources NOTIFY dirty)
     Q_PROPERTY(size_t sizeTotal READ getSizeTotalResources NOTIFY dirty)
     Q_PROPERTY(size_t sizeCached READ getSizeCachedResources NOTIFY dirty)
+    Q_PROPERTY(size_t numHits READ getNumHits NOTIFY dirty)
+    Q_PROPERTY(size_t numMisses READ getNumMisses NOTIFY dirty)
+    Q_PROPERTY(size_t numEvictions READ getNumEvictions NOTIFY dirty)
 
     /**jsdoc
      * @property {number} numGlobalQueriesPending - Total number of global queries pending (across all resource cache managers).
@@ -399,6 +466,9 @@ private:
     size_t getSizeTotalResources() const { return _resourceCache->getSizeTotalResources(); }
     size_t getNumCachedResources() const { return _resourceCache->getNumCachedResources(); }
     size_t getSizeCachedResources() const { return _resourceCache->getSizeCachedResources(); }
+    size_t getNumHits() const { return _resourceCache->getNumHits(); }
+    size_t getNumMisses() const { return _resourceCache->getNumMisses(); }
+    size_t getNumEvictions() const { return _resourceCache->getNumEvictions(); }
 
     size_t getNumGlobalQueriesPending() const { return ResourceCache::getPendingRequestCount(); }
     size_t getNumGlobalQueriesLoading() const { return ResourceCache::getLoadingRequestCount(); }
@@ -416,9 +486,6 @@ public:
 
     virtual QString getType() const { return "Resource"; }
 
-    /// Returns the key last used to identify this resource in the unused map.
-    int getLRUKey() const { return _lruKey; }
-
     /// Makes sure that the resource has started loading.
     void ensureLoading();
 
@@ -557,15 +624,15 @@ private:
     friend class ResourceCache;
     friend class ScriptableResource;
     
-    void setLRUKey(int lruKey) { _lruKey = lruKey; }
-    
     void retry();
     void reinsert();
 
     bool isInScript() const { return _isInScript; }
     void setInScript(bool isInScript) { _isInScript = isInScript; }
     
-    int _lruKey{ 0 };
+    // Position in the owning cache's unused resources list, only valid while _isUnused is set
+    std::list<QSharedPointer<Resource>>::iterator _unusedIterator;
+    bool _isUnused { false };
     QTimer* _replyTimer{ nullptr };
     unsigned int _attempts{ 0 };
     static const int MAX_ATTEMPTS = 8;
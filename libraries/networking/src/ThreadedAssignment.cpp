@@ -22,6 +22,7 @@
 
 #include <platform/Platform.h>
 #include "NetworkLogging.h"
+#include "udt/SendScheduler.h"
 
 ThreadedAssignment::ThreadedAssignment(ReceivedMessage& message) :
     Assignment(message),
@@ -121,6 +122,25 @@ void ThreadedAssignment::addPacketStatsAndSendStatsPacket(QJsonObject statsObjec
 
     statsObject["io_stats"] = ioStats;
 
+    QJsonObject dispatchStats;
+    for (const auto& typeStats : nodeList->getPacketReceiver().sampleDispatchStats()) {
+        QJsonObject typeStatsObject;
+        typeStatsObject["messages"] = (double)typeStats.numMessages;
+        typeStatsObject["avg_latency_usecs"] = (double)typeStats.averageLatencyUsecs;
+        typeStatsObject["max_latency_usecs"] = (double)typeStats.maxLatencyUsecs;
+        dispatchStats[nameForPacketType(typeStats.type)] = typeStatsObject;
+    }
+    statsObject["dispatch_latency"] = dispatchStats;
+
+    auto sendStats = udt::SendScheduler::getInstance().sampleStats();
+    QJsonObject sendSchedulerStats;
+    sendSchedulerStats["queues"] = sendStats.numQueues;
+    sendSchedulerStats["services"] = (double)sendStats.numServices;
+    sendSchedulerStats["late_services"] = (double)sendStats.numLateServices;
+    sendSchedulerStats["avg_lag_usecs"] = sendStats.numServices > 0 ? (double)sendStats.totalLagUsecs / sendStats.numServices : 0.0;
+    sendSchedulerStats["max_lag_usecs"] = (double)sendStats.maxLagUsecs;
+    statsObject["send_scheduler"] = sendSchedulerStats;
+
     QJsonObject assignmentStats;
     assignmentStats["numQueuedCheckIns"] = _numQueuedCheckIns;
 
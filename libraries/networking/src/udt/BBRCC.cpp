@@ -0,0 +1,405 @@
+//
+//  BBRCC.cpp
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BBRCC.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QtCore/QtGlobal>
+
+#include <NumericalConstants.h>
+
+using namespace udt;
+using namespace std::chrono;
+
+static const double HIGH_GAIN = 2.885; // 2/ln(2), the smallest gain that doubles the rate every round
+static const std::array<double, 8> PROBE_BANDWIDTH_GAINS {{ 1.25, 0.75, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 }};
+static const double PROBE_BANDWIDTH_WINDOW_GAIN = 2.0;
+
+// a packet is lost once this many packets sent after it were selectively ACKed, as for the send queue
+static const int LOSS_REORDERING_THRESHOLD = 3;
+
+static const int INITIAL_WINDOW = 10;
+static const int MIN_WINDOW = 4;
+
+static const double FULL_BANDWIDTH_GROWTH = 1.25; // the pipe is full once the bandwidth grows less than this...
+static const int FULL_BANDWIDTH_ROUNDS = 3; // ...for this many rounds in a row
+
+// the peer ACKs every packet it receives, an ACK that reports more was held back by ACK loss or the limit on selective
+// ACK ranges, and counting packets that arrived long before in its delivery rate would overestimate the bandwidth
+static const int MAX_DELIVERED_PER_RATE_SAMPLE = 4;
+
+static const microseconds MIN_RTT_WINDOW = seconds(10);
+static const microseconds PROBE_RTT_DURATION = milliseconds(200);
+
+BBRCC::BBRCC() :
+    _pacingGain(HIGH_GAIN),
+    _windowGain(HIGH_GAIN),
+    _window(INITIAL_WINDOW)
+{
+    // until there is a bandwidth estimate the window alone limits sending
+    _packetSendPeriod = 0.0;
+    _congestionWindowSize = INITIAL_WINDOW;
+}
+
+bool BBRCC::onACK(SequenceNumber ack, p_high_resolution_clock::time_point receiveTime) {
+    bool wasDuplicateACK = (ack == _lastACK);
+
+    if (!wasDuplicateACK) {
+        _lastACK = ack;
+        _duplicateACKCount = 0;
+
+        while (!_sentPacketDatas.empty() && seqoff(_sentPacketDatas.front().sequenceNumber, ack) >= 0) {
+            markDelivered(_sentPacketDatas.front(), receiveTime);
+            _sentPacketDatas.pop_front();
+
+            _highestSelectiveACKIndex = std::max(_highestSelectiveACKIndex - 1, -1);
+            _numLossChecked = std::max(_numLossChecked - 1, 0);
+        }
+    }
+
+    detectLosses();
+
+    updateModel(receiveTime);
+
+    // with selective ACKs the send queue finds the holes by itself, otherwise
+    // fall back to Reno's fast re-transmit of ACK + 1 on the 3rd duplicate ACK
+    static const int RENO_FAST_RETRANSMIT_DUPLICATE_COUNT = 3;
+    if (wasDuplicateACK && !_isPeerSendingSelectiveACKs && !_sentPacketDatas.empty()
+        && ++_duplicateACKCount == RENO_FAST_RETRANSMIT_DUPLICATE_COUNT) {
+        return true;
+    }
+
+    return false;
+}
+
+void BBRCC::onSelectiveACK(SequenceNumber start, SequenceNumber end, p_high_resolution_clock::time_point receiveTime) {
+    _isPeerSendingSelectiveACKs = true;
+
+    for (auto seq = start; seqoff(seq, end) >= 0; ++seq) {
+        auto packet = findSentPacket(seq);
+        if (packet) {
+            markDelivered(*packet, receiveTime);
+        }
+    }
+
+    if (!_sentPacketDatas.empty()) {
+        auto endIndex = std::min(seqoff(_sentPacketDatas.front().sequenceNumber, end), (int)_sentPacketDatas.size() - 1);
+        _highestSelectiveACKIndex = std::max(_highestSelectiveACKIndex, endIndex);
+    }
+}
+
+void BBRCC::onTimeout() {
+    // the send queue re-sends everything not ACKed, start over from a small window but keep the model of the path
+    for (auto& packet : _sentPacketDatas) {
+        if (!packet.wasDelivered) {
+            packet.isLost = true;
+        }
+    }
+    _numInFlight = 0;
+    _numLossChecked = (int)_sentPacketDatas.size();
+
+    _window = MIN_WINDOW;
+    _congestionWindowSize = std::min(MIN_WINDOW + (int)_sentPacketDatas.size(), udt::MAX_PACKETS_IN_FLIGHT);
+
+    // re-sent packets don't give RTT samples, back off so a timeout shorter than the RTT can't repeat forever
+    ++_numTimeouts;
+}
+
+void BBRCC::onPacketSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) {
+    if (_numInFlight == 0) {
+        // the time we were idle for is not part of any delivery rate
+        _deliveredTime = timePoint;
+        _firstSentTime = timePoint;
+    }
+
+    SentPacketData packet;
+    packet.sequenceNumber = seqNum;
+    packet.timePoint = timePoint;
+    packet.deliveredAtSend = _delivered;
+    packet.deliveredTimeAtSend = _deliveredTime;
+    packet.firstSentTimeAtSend = _firstSentTime;
+    _sentPacketDatas.push_back(packet);
+
+    ++_numInFlight;
+}
+
+void BBRCC::onPacketReSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) {
+    auto packet = findSentPacket(seqNum);
+
+    // the delivery rate is measured from the last time a packet was sent, but the RTT is ambiguous
+    if (packet && !packet->wasDelivered) {
+        if (packet->isLost) {
+            // back in flight, if it is lost again only a timeout will tell
+            packet->isLost = false;
+            ++_numInFlight;
+        }
+
+        packet->timePoint = timePoint;
+        packet->deliveredAtSend = _delivered;
+        packet->deliveredTimeAtSend = _deliveredTime;
+        packet->firstSentTimeAtSend = _firstSentTime;
+        packet->wasResent = true;
+    }
+}
+
+int BBRCC::estimatedTimeout() const {
+    static const int MAX_TIMEOUT_BACKOFF = 6;
+
+    int timeout = _ewmaRTT == -1 ? DEFAULT_SYN_INTERVAL : _ewmaRTT + _rttVariance * 4;
+    return timeout << std::min(_numTimeouts, MAX_TIMEOUT_BACKOFF);
+}
+
+BBRCC::SentPacketData* BBRCC::findSentPacket(SequenceNumber seqNum) {
+    if (_sentPacketDatas.empty()) {
+        return nullptr;
+    }
+
+    // packets are sent in sequence, the offset from the first one is the index
+    auto index = seqoff(_sentPacketDatas.front().sequenceNumber, seqNum);
+    if (index < 0 || index >= (int)_sentPacketDatas.size()) {
+        return nullptr;
+    }
+
+    auto& packet = _sentPacketDatas[index];
+    return packet.sequenceNumber == seqNum ? &packet : nullptr;
+}
+
+void BBRCC::markDelivered(SentPacketData& packet, p_high_resolution_clock::time_point receiveTime) {
+    if (packet.wasDelivered) {
+        return;
+    }
+
+    packet.wasDelivered = true;
+    if (!packet.isLost) {
+        --_numInFlight;
+    }
+
+    ++_delivered;
+    _deliveredTime = receiveTime;
+    _firstSentTime = packet.timePoint;
+
+    // the delivery rate is sampled from the packet sent last, which covers the most recent state of the path
+    if (!_hasRateSample || packet.deliveredAtSend >= _rateSamplePacket.deliveredAtSend) {
+        _rateSamplePacket = packet;
+        _hasRateSample = true;
+    }
+}
+
+void BBRCC::detectLosses() {
+    int lastLossIndex = _highestSelectiveACKIndex - LOSS_REORDERING_THRESHOLD;
+    for (; _numLossChecked <= lastLossIndex; ++_numLossChecked) {
+        auto& packet = _sentPacketDatas[_numLossChecked];
+        if (!packet.wasDelivered && !packet.isLost) {
+            packet.isLost = true;
+            --_numInFlight;
+        }
+    }
+}
+
+void BBRCC::updateModel(p_high_resolution_clock::time_point now) {
+    int numNewlyDelivered = (int)(_delivered - _deliveredAtLastUpdate);
+    _deliveredAtLastUpdate = _delivered;
+
+    _isRoundStart = false;
+    _isMinRTTExpired = false;
+
+    if (_hasRateSample) {
+        _hasRateSample = false;
+        auto& packet = _rateSamplePacket;
+
+        if (!packet.wasResent) {
+            updateRTT((int)duration_cast<microseconds>(now - packet.timePoint).count(), now);
+        }
+
+        if (packet.deliveredAtSend >= _nextRoundDelivered) {
+            // a packet sent after the last round started was delivered, a new round starts
+            _nextRoundDelivered = _delivered;
+            ++_roundCount;
+            _isRoundStart = true;
+            _bandwidthSamples[_roundCount % BANDWIDTH_FILTER_ROUNDS] = 0.0;
+        }
+
+        // packets can't be delivered faster than they were sent, and ACKs that bunch up or cover many packets at once
+        // would overestimate the bandwidth, so the rate is over the longer of the two intervals and at least the min RTT
+        auto ackInterval = duration_cast<microseconds>(_deliveredTime - packet.deliveredTimeAtSend).count();
+        auto sendInterval = duration_cast<microseconds>(packet.timePoint - packet.firstSentTimeAtSend).count();
+        auto interval = std::max(ackInterval, sendInterval);
+        if (interval > 0 && interval >= _minRTT && numNewlyDelivered <= MAX_DELIVERED_PER_RATE_SAMPLE) {
+            double rate = (double)(_delivered - packet.deliveredAtSend) * USECS_PER_SECOND / interval;
+            auto& sample = _bandwidthSamples[_roundCount % BANDWIDTH_FILTER_ROUNDS];
+            sample = std::max(sample, rate);
+        }
+    }
+
+    checkFullPipe();
+    updateMode(now);
+    updateControlParameters(numNewlyDelivered);
+}
+
+void BBRCC::updateRTT(int rtt, p_high_resolution_clock::time_point now) {
+    static const int MAX_RTT_SAMPLE_MICROSECONDS = 10000000;
+
+    if (rtt < 0) {
+        Q_ASSERT_X(false, __FUNCTION__, "calculated an RTT that is not > 0");
+        return;
+    }
+    rtt = std::min(std::max(rtt, 1), MAX_RTT_SAMPLE_MICROSECONDS);
+
+    // the timeout can be trusted again
+    _numTimeouts = 0;
+
+    // Jacobson's estimate, for the timeout
+    if (_ewmaRTT == -1) {
+        _ewmaRTT = rtt;
+        _rttVariance = rtt / 2;
+    } else {
+        static const int RTT_ESTIMATION_ALPHA = 8;
+        static const int RTT_ESTIMATION_VARIANCE_ALPHA = 4;
+
+        _ewmaRTT = (_ewmaRTT * (RTT_ESTIMATION_ALPHA - 1) + rtt) / RTT_ESTIMATION_ALPHA;
+        _rttVariance = (_rttVariance * (RTT_ESTIMATION_VARIANCE_ALPHA - 1)
+                        + abs(rtt - _ewmaRTT)) / RTT_ESTIMATION_VARIANCE_ALPHA;
+    }
+
+    // the min RTT is that of the path without queues, it is taken again when too old since the path may have changed
+    _isMinRTTExpired = _minRTT != -1 && now - _minRTTTimestamp > MIN_RTT_WINDOW;
+    if (_minRTT == -1 || rtt <= _minRTT || _isMinRTTExpired) {
+        _minRTT = rtt;
+        _minRTTTimestamp = now;
+    }
+}
+
+void BBRCC::checkFullPipe() {
+    if (_isPipeFilled || !_isRoundStart) {
+        return;
+    }
+
+    auto bandwidth = getBottleneckBandwidth();
+    if (bandwidth >= _fullBandwidth * FULL_BANDWIDTH_GROWTH) {
+        // still growing
+        _fullBandwidth = bandwidth;
+        _fullBandwidthCount = 0;
+    } else if (++_fullBandwidthCount >= FULL_BANDWIDTH_ROUNDS) {
+        _isPipeFilled = true;
+    }
+}
+
+void BBRCC::updateMode(p_high_resolution_clock::time_point now) {
+    if (_mode == Mode::Startup && _isPipeFilled) {
+        _mode = Mode::Drain;
+        _pacingGain = 1.0 / HIGH_GAIN;
+        _windowGain = HIGH_GAIN;
+    }
+
+    if (_mode == Mode::Drain && _numInFlight <= getBandwidthDelayProduct()) {
+        enterProbeBandwidth(now);
+    }
+
+    if (_mode == Mode::ProbeBandwidth) {
+        auto sinceCycleStart = duration_cast<microseconds>(now - _cycleTimestamp).count();
+        bool isCycleDone = sinceCycleStart > _minRTT;
+
+        // probing down is done early once the queue probing up built is drained
+        if (_pacingGain < 1.0 && _numInFlight <= getBandwidthDelayProduct()) {
+            isCycleDone = true;
+        }
+
+        if (isCycleDone) {
+            _cycleIndex = (_cycleIndex + 1) % (int)PROBE_BANDWIDTH_GAINS.size();
+            _cycleTimestamp = now;
+            _pacingGain = PROBE_BANDWIDTH_GAINS[_cycleIndex];
+        }
+    }
+
+    if (_mode != Mode::ProbeRTT && _isMinRTTExpired) {
+        _mode = Mode::ProbeRTT;
+        _pacingGain = 1.0;
+        _windowGain = 1.0;
+        _isProbeRTTDoneTimestampSet = false;
+        _windowBeforeProbeRTT = _window;
+    }
+
+    if (_mode == Mode::ProbeRTT) {
+        if (!_isProbeRTTDoneTimestampSet && _numInFlight <= MIN_WINDOW) {
+            // hold the small window for a while and at least a round to see the RTT of the empty path
+            _probeRTTDoneTimestamp = now + PROBE_RTT_DURATION;
+            _isProbeRTTDoneTimestampSet = true;
+            _isProbeRTTRoundDone = false;
+            _nextRoundDelivered = _delivered;
+        } else if (_isProbeRTTDoneTimestampSet) {
+            if (_isRoundStart) {
+                _isProbeRTTRoundDone = true;
+            }
+
+            if (_isProbeRTTRoundDone && now > _probeRTTDoneTimestamp) {
+                _minRTTTimestamp = now;
+                _window = std::max(_window, _windowBeforeProbeRTT);
+
+                if (_isPipeFilled) {
+                    enterProbeBandwidth(now);
+                } else {
+                    _mode = Mode::Startup;
+                    _pacingGain = HIGH_GAIN;
+                    _windowGain = HIGH_GAIN;
+                }
+            }
+        }
+    }
+}
+
+void BBRCC::enterProbeBandwidth(p_high_resolution_clock::time_point now) {
+    _mode = Mode::ProbeBandwidth;
+    _windowGain = PROBE_BANDWIDTH_WINDOW_GAIN;
+
+    // start anywhere but in the probing down phase, so flows started together don't probe in step
+    _cycleIndex = (int)(_roundCount % (PROBE_BANDWIDTH_GAINS.size() - 1));
+    if (_cycleIndex >= 1) {
+        ++_cycleIndex;
+    }
+    _cycleTimestamp = now;
+    _pacingGain = PROBE_BANDWIDTH_GAINS[_cycleIndex];
+}
+
+void BBRCC::updateControlParameters(int numNewlyDelivered) {
+    auto bandwidth = getBottleneckBandwidth();
+    if (bandwidth > 0.0) {
+        setPacketSendPeriod(USECS_PER_SECOND / (_pacingGain * bandwidth));
+    }
+
+    int targetWindow = std::max(MIN_WINDOW, (int)std::ceil(_windowGain * getBandwidthDelayProduct()));
+
+    if (_mode == Mode::ProbeRTT) {
+        _window = MIN_WINDOW;
+    } else if (_isPipeFilled) {
+        _window = std::min(_window + numNewlyDelivered, targetWindow);
+    } else if (_window < targetWindow || _delivered < (uint64_t)INITIAL_WINDOW) {
+        // grow with what gets delivered until the model is good enough to set the window
+        _window += numNewlyDelivered;
+    }
+    _window = std::max(_window, MIN_WINDOW);
+
+    // the send queue counts every packet past the last ACK as in flight, including those selectively ACKed or lost
+    int numNotInFlight = (int)_sentPacketDatas.size() - _numInFlight;
+    _congestionWindowSize = std::min(_window + numNotInFlight, udt::MAX_PACKETS_IN_FLIGHT);
+}
+
+double BBRCC::getBottleneckBandwidth() const {
+    return *std::max_element(_bandwidthSamples.begin(), _bandwidthSamples.end());
+}
+
+int BBRCC::getBandwidthDelayProduct() const {
+    auto bandwidth = getBottleneckBandwidth();
+    if (bandwidth <= 0.0 || _minRTT == -1) {
+        return INITIAL_WINDOW;
+    }
+    return (int)std::ceil(bandwidth * _minRTT / USECS_PER_SECOND);
+}
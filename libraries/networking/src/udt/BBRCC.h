@@ -0,0 +1,137 @@
+//
+//  BBRCC.h
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_BBRCC_h
+#define hifi_BBRCC_h
+
+#include <array>
+#include <deque>
+
+#include "CongestionControl.h"
+#include "Constants.h"
+
+namespace udt {
+
+// Congestion control after BBR (https://queue.acm.org/detail.cfm?id=3022184): rather than backing off on loss or
+// delay, it models the path from the rate packets are delivered at and the lowest RTT seen, and paces packets at
+// that bottleneck bandwidth with about two bandwidth-delay products in flight, probing now and then for more.
+// Losses are left to selective ACKs and timeouts, which is what lets it keep a long, lossy path full.
+class BBRCC : public CongestionControl {
+public:
+    BBRCC();
+
+    virtual bool onACK(SequenceNumber ackNum, p_high_resolution_clock::time_point receiveTime) override;
+    virtual void onSelectiveACK(SequenceNumber start, SequenceNumber end,
+                                p_high_resolution_clock::time_point receiveTime) override;
+    virtual void onTimeout() override;
+
+    virtual void onPacketSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) override;
+    virtual void onPacketReSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) override;
+
+    virtual int estimatedTimeout() const override;
+    virtual int estimatedRTT() const override { return std::max(_ewmaRTT, 0); }
+    virtual int estimatedBandwidth() const override { return (int)getBottleneckBandwidth(); }
+
+protected:
+    virtual void setInitialSendSequenceNumber(SequenceNumber seqNum) override { _lastACK = seqNum - 1; }
+
+private:
+    enum class Mode {
+        Startup, // doubles the sending rate every round until the bandwidth stops growing
+        Drain, // drains the queue built up during startup
+        ProbeBandwidth, // cycles the pacing gain around 1 to probe for more bandwidth
+        ProbeRTT // shrinks the window for a moment to measure the RTT without our own queue
+    };
+
+    struct SentPacketData {
+        SequenceNumber sequenceNumber;
+        p_high_resolution_clock::time_point timePoint;
+        uint64_t deliveredAtSend; // packets delivered when it was sent
+        p_high_resolution_clock::time_point deliveredTimeAtSend;
+        p_high_resolution_clock::time_point firstSentTimeAtSend; // when the packet delivered last was sent
+        bool wasResent { false };
+        bool wasDelivered { false };
+        bool isLost { false };
+    };
+
+    SentPacketData* findSentPacket(SequenceNumber seqNum);
+    void markDelivered(SentPacketData& packet, p_high_resolution_clock::time_point receiveTime);
+    void detectLosses();
+
+    void updateModel(p_high_resolution_clock::time_point now);
+    void updateRTT(int rtt, p_high_resolution_clock::time_point now);
+    void checkFullPipe();
+    void updateMode(p_high_resolution_clock::time_point now);
+    void enterProbeBandwidth(p_high_resolution_clock::time_point now);
+    void updateControlParameters(int numNewlyDelivered);
+
+    double getBottleneckBandwidth() const; // packets per second
+    int getBandwidthDelayProduct() const; // packets
+
+    Mode _mode { Mode::Startup };
+
+    // the packets sent since the last ACK, in sequence so they can be found by offset from the first
+    std::deque<SentPacketData> _sentPacketDatas;
+    int _numInFlight { 0 }; // sent packets that are neither ACKed, selectively ACKed nor lost
+    int _highestSelectiveACKIndex { -1 }; // the furthest packet selectively ACKed, in _sentPacketDatas
+    int _numLossChecked { 0 }; // the packets at the front of _sentPacketDatas that were checked for loss
+
+    uint64_t _delivered { 0 };
+    uint64_t _deliveredAtLastUpdate { 0 }; // the ACK packet processed last was up to here
+    p_high_resolution_clock::time_point _deliveredTime;
+    p_high_resolution_clock::time_point _firstSentTime; // when the packet delivered last was sent
+
+    int _window; // packets in flight we aim for, the congestion window adds those selectively ACKed
+
+    // the most recently sent packet delivered since the last model update, the delivery rate is measured since it was sent
+    bool _hasRateSample { false };
+    SentPacketData _rateSamplePacket;
+
+    // a round ends when a packet sent after the start of the round is delivered
+    uint64_t _roundCount { 0 };
+    uint64_t _nextRoundDelivered { 0 };
+    bool _isRoundStart { false };
+
+    // max filter of the delivery rate over the last rounds, one slot per round
+    static const int BANDWIDTH_FILTER_ROUNDS = 10;
+    std::array<double, BANDWIDTH_FILTER_ROUNDS> _bandwidthSamples {{ 0.0 }};
+
+    int _minRTT { -1 }; // in microseconds
+    p_high_resolution_clock::time_point _minRTTTimestamp;
+    bool _isMinRTTExpired { false };
+
+    int _ewmaRTT { -1 }; // for the timeout, as for TCPVegasCC
+    int _rttVariance { 0 };
+    int _numTimeouts { 0 }; // in a row, each doubles the timeout until there is a new RTT sample
+
+    double _pacingGain;
+    double _windowGain;
+    int _cycleIndex { 0 };
+    p_high_resolution_clock::time_point _cycleTimestamp;
+
+    double _fullBandwidth { 0.0 };
+    int _fullBandwidthCount { 0 };
+    bool _isPipeFilled { false };
+
+    p_high_resolution_clock::time_point _probeRTTDoneTimestamp;
+    bool _isProbeRTTDoneTimestampSet { false };
+    bool _isProbeRTTRoundDone { false };
+    int _windowBeforeProbeRTT { 0 }; // given back once done, the model of the path hasn't changed
+
+    SequenceNumber _lastACK;
+    int _duplicateACKCount { 0 };
+    bool _isPeerSendingSelectiveACKs { false }; // the duplicate ACK fast re-transmit is only for peers that don't
+};
+
+}
+
+#endif // hifi_BBRCC_h
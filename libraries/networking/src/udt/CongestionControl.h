@@ -42,6 +42,9 @@ public:
     // return value specifies if connection should perform a fast re-transmit of ACK + 1 (used in TCP style congestion control)
     virtual bool onACK(SequenceNumber ackNum, p_high_resolution_clock::time_point receiveTime) { return false; }
 
+    // the peer received the packets from start to end, past the ACK, called before onACK for the same ACK packet
+    virtual void onSelectiveACK(SequenceNumber start, SequenceNumber end, p_high_resolution_clock::time_point receiveTime) {}
+
     virtual void onTimeout() {}
 
     virtual void onPacketSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) {}
@@ -49,6 +52,10 @@ public:
 
     virtual int estimatedTimeout() const = 0;
 
+    // for connection stats, in microseconds and packets per second, zero when unknown
+    virtual int estimatedRTT() const { return 0; }
+    virtual int estimatedBandwidth() const { return 0; }
+
 protected:
     void setMSS(int mss) { _mss = mss; }
     virtual void setInitialSendSequenceNumber(SequenceNumber seqNum) = 0;
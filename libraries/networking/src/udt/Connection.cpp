@@ -13,7 +13,6 @@
 
 #include <random>
 
-#include <QtCore/QThread>
 
 #include <NumericalConstants.h>
 
@@ -30,6 +29,8 @@
 using namespace udt;
 using namespace std::chrono;
 
+static const int MAX_SACK_RANGES = 4; // received ranges past the ACK that fit in an ACK packet
+
 Connection::Connection(Socket* parentSocket, HifiSockAddr destination, std::unique_ptr<CongestionControl> congestionControl) :
     _parentSocket(parentSocket),
     _destination(destination),
@@ -40,8 +41,8 @@ Connection::Connection(Socket* parentSocket, HifiSockAddr destination, std::uniq
     Q_ASSERT_X(_congestionControl, "Connection::Connection", "Must be called with a valid CongestionControl object");
     _congestionControl->init();
 
-    // Setup packets
-    static const int ACK_PACKET_PAYLOAD_BYTES = sizeof(SequenceNumber);
+    // Setup packets, ACKs have room for the ACK number and the selective ACK ranges that follow it
+    static const int ACK_PACKET_PAYLOAD_BYTES = sizeof(SequenceNumber) * (1 + 2 * MAX_SACK_RANGES);
     static const int HANDSHAKE_ACK_PAYLOAD_BYTES = sizeof(SequenceNumber);
 
     _ackPacket = ControlPacket::create(ControlPacket::ACK, ACK_PACKET_PAYLOAD_BYTES);
@@ -67,21 +68,11 @@ Connection::~Connection() {
 }
 
 void Connection::stopSendQueue() {
-    if (auto sendQueue = _sendQueue.release()) {
-        // grab the send queue thread so we can wait on it
-        QThread* sendQueueThread = sendQueue->thread();
-        
-        // tell the send queue to stop and be deleted
-        
+    if (auto sendQueue = std::move(_sendQueue)) {
+        // tell the send queue to stop, deleting it waits for a scheduler worker that may be servicing it
         sendQueue->stop();
 
         _lastMessageNumber = sendQueue->getCurrentMessageNumber();
-
-        sendQueue->deleteLater();
-        
-        // wait on the send queue thread so we know the send queue is gone
-        sendQueueThread->quit();
-        sendQueueThread->wait();
     }
 }
 
@@ -219,6 +210,12 @@ void Connection::sendACK() {
     // pack in the ACK number
     _ackPacket->writePrimitive(nextACKNumber);
 
+    // when packets are missing, tell the sender which ones past the ACK we did receive so it only re-sends the holes,
+    // peers that don't know about selective ACKs only read the ACK number and ignore the rest
+    if (!_lossList.isEmpty()) {
+        _lossList.writeReceivedRanges(*_ackPacket, _lastReceivedSequenceNumber, MAX_SACK_RANGES);
+    }
+
     // have the socket send off our packet
     _parentSocket->writeBasePacket(*_ackPacket, _destination);
     
@@ -340,6 +337,20 @@ void Connection::processACK(ControlPacketPointer controlPacket) {
         return;
     }
 
+    // read the selective ACK ranges that may follow, keeping those that are past the ACK and were sent
+    _sackRanges.clear();
+    auto currentSequenceNumber = getSendQueue().getCurrentSequenceNumber();
+    while (controlPacket->bytesLeftToRead() >= (qint64)(2 * sizeof(SequenceNumber))
+           && (int)_sackRanges.size() < MAX_SACK_RANGES) {
+        SequenceRange range;
+        controlPacket->readPrimitive(&range.first);
+        controlPacket->readPrimitive(&range.second);
+
+        if (range.first > ack && range.first <= range.second && range.second <= currentSequenceNumber) {
+            _sackRanges.push_back(range);
+        }
+    }
+
     if (ack > _lastReceivedACK) {
         // this is not a repeated ACK, so update our member and tell the send queue
         _lastReceivedACK = ack;
@@ -348,8 +359,17 @@ void Connection::processACK(ControlPacketPointer controlPacket) {
         getSendQueue().ack(ack);
     }
 
+    if (!_sackRanges.empty()) {
+        // even a repeated ACK can tell us about new packets received past a hole
+        getSendQueue().selectiveACK(ack, _sackRanges);
+    }
+
     // give this ACK to the congestion control and update the send queue parameters
     updateCongestionControlAndSendQueue([this, ack, &controlPacket] {
+        for (auto& range : _sackRanges) {
+            _congestionControl->onSelectiveACK(range.first, range.second, controlPacket->getReceiveTime());
+        }
+
         if (_congestionControl->onACK(ack, controlPacket->getReceiveTime())) {
             // the congestion control has told us it needs a fast re-transmit of ack + 1, add that now
             _sendQueue->fastRetransmit(ack + 1);
@@ -443,6 +463,8 @@ void Connection::updateCongestionControlAndSendQueue(std::function<void ()> cong
     // record connection stats
     _stats.recordPacketSendPeriod(_congestionControl->_packetSendPeriod);
     _stats.recordCongestionWindowSize(_congestionControl->_congestionWindowSize);
+    _stats.recordRTT(_congestionControl->estimatedRTT());
+    _stats.recordEstimatedBandwidth(_congestionControl->estimatedBandwidth());
 }
 
 void PendingReceivedMessage::enqueuePacket(std::unique_ptr<Packet> packet) {
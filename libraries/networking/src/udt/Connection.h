@@ -120,6 +120,7 @@ private:
     MessageNumber _lastMessageNumber { 0 };
 
     LossList _lossList; // List of all missing packets
+    SequenceRanges _sackRanges; // Selective ACK ranges of the ACK being processed, kept to re-use the storage
     SequenceNumber _lastReceivedSequenceNumber; // The largest sequence number received from the peer
     SequenceNumber _lastReceivedACK; // The last ACK received
     
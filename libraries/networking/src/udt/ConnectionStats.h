@@ -93,6 +93,8 @@ public:
 
     void recordCongestionWindowSize(int sample);
     void recordPacketSendPeriod(int sample);
+    void recordRTT(int sample);
+    void recordEstimatedBandwidth(int sample);
     
 private:
     Stats _currentSample;
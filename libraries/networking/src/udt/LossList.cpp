@@ -11,11 +11,20 @@
 
 #include "LossList.h"
 
+#include <algorithm>
+
 #include "ControlPacket.h"
 
 using namespace udt;
 using namespace std;
 
+LossList::Ranges::iterator LossList::findRange(SequenceNumber seq) {
+    // ranges are sorted and don't overlap, so their ends are sorted too
+    return partition_point(_lossList.begin(), _lossList.end(), [&seq](const Range& range) {
+        return range.second < seq;
+    });
+}
+
 void LossList::append(SequenceNumber seq) {
     Q_ASSERT_X(_lossList.empty() || (_lossList.back().second < seq), "LossList::append(SequenceNumber)",
                "SequenceNumber appended is not greater than the last SequenceNumber in the list");
@@ -47,9 +56,7 @@ void LossList::insert(SequenceNumber start, SequenceNumber end) {
     Q_ASSERT_X(start <= end,
                "LossList::insert(SequenceNumber, SequenceNumber)", "Range start greater than range end");
     
-    auto it = find_if_not(_lossList.begin(), _lossList.end(), [&start](pair<SequenceNumber, SequenceNumber> pair){
-        return pair.second < start;
-    });
+    auto it = findRange(start);
     
     if (it == _lossList.end() || end < it->first) {
         // No overlap, simply insert
@@ -68,29 +75,28 @@ void LossList::insert(SequenceNumber start, SequenceNumber end) {
             it->second = end;
         }
         
-        auto it2 = it;
-        ++it2;
         // For all ranges touching the current range
-        while (it2 != _lossList.end() && it->second >= it2->first - 1) {
+        auto it2 = it + 1;
+        auto lastMerged = it2;
+        while (lastMerged != _lossList.end() && it->second >= lastMerged->first - 1) {
             // extend current range if necessary
-            if (it->second < it2->second) {
-                _length += seqlen(it->second + 1, it2->second);
-                it->second = it2->second;
+            if (it->second < lastMerged->second) {
+                _length += seqlen(it->second + 1, lastMerged->second);
+                it->second = lastMerged->second;
             }
             
             // Remove overlapping range
-            _length -= seqlen(it2->first, it2->second);
-            it2 = _lossList.erase(it2);
+            _length -= seqlen(lastMerged->first, lastMerged->second);
+            ++lastMerged;
         }
+        _lossList.erase(it2, lastMerged);
     }
 }
 
 bool LossList::remove(SequenceNumber seq) {
-    auto it = find_if(_lossList.begin(), _lossList.end(), [&seq](pair<SequenceNumber, SequenceNumber> pair) {
-        return pair.first <= seq && seq <= pair.second;
-    });
+    auto it = findRange(seq);
     
-    if (it != end(_lossList)) {
+    if (it != _lossList.end() && it->first <= seq) {
         if (it->first == it->second) {
             _lossList.erase(it);
         } else if (seq == it->first) {
@@ -100,7 +106,7 @@ bool LossList::remove(SequenceNumber seq) {
         } else {
             auto temp = it->second;
             it->second = seq - 1;
-            _lossList.insert(++it, make_pair(seq + 1, temp));
+            _lossList.insert(it + 1, make_pair(seq + 1, temp));
         }
         _length -= 1;
         
@@ -116,42 +122,51 @@ void LossList::remove(SequenceNumber start, SequenceNumber end) {
     Q_ASSERT_X(start <= end,
                "LossList::remove(SequenceNumber, SequenceNumber)", "Range start greater than range end");
     // Find the first segment sharing sequence numbers
-    auto it = find_if(_lossList.begin(), _lossList.end(), [&start, &end](pair<SequenceNumber, SequenceNumber> pair) {
-        return (pair.first <= start && start <= pair.second) || (start <= pair.first && pair.first <= end);
-    });
-    
-    // If we found one
-    if (it != _lossList.end()) {
-        
-        // While the end of the current segment is contained, either shorten it (first one only - sometimes)
-        // or remove it altogether since it is fully contained it the range
-        while (it != _lossList.end() && end >= it->second) {
-            if (start <= it->first) {
-                // Segment is contained, update new length and erase it.
-                _length -= seqlen(it->first, it->second);
-                it = _lossList.erase(it);
-            } else {
-                // Beginning of segment not contained, modify end of segment.
-                // Will only occur sometimes one the first loop
-                _length -= seqlen(start, it->second);
-                it->second = start - 1;
-                ++it;
-            }
+    auto it = findRange(start);
+    if (it == _lossList.end() || end < it->first) {
+        return;
+    }
+
+    if (it->first < start) {
+        if (end < it->second) {
+            // Cut it in half if the range we are removing is contained within one segment
+            _length -= seqlen(start, end);
+            auto temp = it->second;
+            it->second = start - 1;
+            _lossList.insert(it + 1, make_pair(end + 1, temp));
+            return;
         }
-        
-        // There might be more to remove
-        if (it != _lossList.end() && it->first <= end) {
-            if (start <= it->first) {
-                // Truncate beginning of segment
-                _length -= seqlen(it->first, end);
-                it->first = end + 1;
-            } else {
-                // Cut it in half if the range we are removing is contained within one segment
-                _length -= seqlen(start, end);
-                auto temp = it->second;
-                it->second = start - 1;
-                _lossList.insert(++it, make_pair(end + 1, temp));
-            }
+
+        // Beginning of segment not contained, modify end of segment.
+        _length -= seqlen(start, it->second);
+        it->second = start - 1;
+        ++it;
+    }
+
+    // Remove all the segments that are contained in the range
+    auto firstRemoved = it;
+    while (it != _lossList.end() && it->second <= end) {
+        _length -= seqlen(it->first, it->second);
+        ++it;
+    }
+    it = _lossList.erase(firstRemoved, it);
+
+    // Truncate beginning of the last segment
+    if (it != _lossList.end() && it->first <= end) {
+        _length -= seqlen(it->first, end);
+        it->first = end + 1;
+    }
+}
+
+void LossList::removeUpTo(SequenceNumber seq) {
+    while (!_lossList.empty() && _lossList.front().first <= seq) {
+        auto& front = _lossList.front();
+        if (front.second <= seq) {
+            _length -= seqlen(front.first, front.second);
+            _lossList.pop_front();
+        } else {
+            _length -= seqlen(front.first, seq);
+            front.first = seq + 1;
         }
     }
 }
@@ -163,7 +178,13 @@ SequenceNumber LossList::getFirstSequenceNumber() const {
 
 SequenceNumber LossList::popFirstSequenceNumber() {
     auto front = getFirstSequenceNumber();
-    remove(front);
+    auto& range = _lossList.front();
+    if (range.first == range.second) {
+        _lossList.pop_front();
+    } else {
+        ++range.first;
+    }
+    _length -= 1;
     return front;
 }
 
@@ -182,3 +203,26 @@ void LossList::write(ControlPacket& packet, int maxPairs) {
         }
     }
 }
+
+void LossList::writeReceivedRanges(ControlPacket& packet, SequenceNumber lastReceived, int maxPairs) const {
+    // a received range follows every loss, when they don't all fit this writes the one right after the first loss,
+    // which the ACK moves up to once that loss is recovered, and the most recent ones, those in between were
+    // written when they were the most recent
+    int numRanges = (int)_lossList.size();
+    int writtenPairs = 0;
+
+    for (int i = 0; i < numRanges && writtenPairs < maxPairs; ++i) {
+        if (i == 1 && numRanges > maxPairs) {
+            i = numRanges - (maxPairs - 1);
+        }
+
+        SequenceNumber start = _lossList[i].second + 1;
+        SequenceNumber end = (i + 1 < numRanges) ? _lossList[i + 1].first - 1 : lastReceived;
+
+        if (start <= end) {
+            packet.writePrimitive(start);
+            packet.writePrimitive(end);
+            ++writtenPairs;
+        }
+    }
+}
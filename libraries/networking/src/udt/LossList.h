@@ -12,14 +12,20 @@
 #ifndef hifi_LossList_h
 #define hifi_LossList_h
 
-#include <list>
+#include <deque>
+#include <vector>
 
 #include "SequenceNumber.h"
 
 namespace udt {
 
 class ControlPacket;
-    
+
+using SequenceRange = std::pair<SequenceNumber, SequenceNumber>; // first and last sequence numbers, inclusive
+using SequenceRanges = std::vector<SequenceRange>;
+
+// Sorted ranges of lost sequence numbers.  Losses are mostly appended at the back and taken or ACKed from the front,
+// which a deque does in constant time, and the ranges in between are found with a binary search.
 class LossList {
 public:
     LossList() {}
@@ -30,11 +36,12 @@ public:
     void append(SequenceNumber seq);
     void append(SequenceNumber start, SequenceNumber end);
     
-    // inserts anywhere - MUCH slower
+    // inserts anywhere - slower
     void insert(SequenceNumber start, SequenceNumber end);
     
     bool remove(SequenceNumber seq);
     void remove(SequenceNumber start, SequenceNumber end);
+    void removeUpTo(SequenceNumber seq); // removes everything up to and including seq
     
     int getLength() const { return _length; }
     bool isEmpty() const { return _length == 0; }
@@ -42,9 +49,18 @@ public:
     SequenceNumber popFirstSequenceNumber();
     
     void write(ControlPacket& packet, int maxPairs = -1);
+
+    // writes ranges received between the losses, and after them up to lastReceived, for selective ACKs
+    void writeReceivedRanges(ControlPacket& packet, SequenceNumber lastReceived, int maxPairs) const;
     
 private:
-    std::list<std::pair<SequenceNumber, SequenceNumber>> _lossList;
+    using Range = SequenceRange;
+    using Ranges = std::deque<Range>;
+
+    // the first range that ends at or after seq
+    Ranges::iterator findRange(SequenceNumber seq);
+
+    Ranges _lossList;
     int _length { 0 };
 };
     
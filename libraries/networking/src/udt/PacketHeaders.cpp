@@ -27,7 +27,9 @@ PacketVersion versionForPacketType(PacketType packetType) {
         case PacketType::StunResponse:
             return 17;
         case PacketType::DomainList:
-            return static_cast<PacketVersion>(DomainListVersion::HasConnectReason);
+            return static_cast<PacketVersion>(DomainListVersion::HasListVersionDeltas);
+        case PacketType::DomainListRequest:
+            return static_cast<PacketVersion>(DomainListRequestVersion::HasListVersion);
         case PacketType::EntityAdd:
         case PacketType::EntityClone:
         case PacketType::EntityEdit:
@@ -110,10 +112,14 @@ uint qHash(const PacketType& key, uint seed) {
     return qHash((quint8) key, seed);
 }
 
-QDebug operator<<(QDebug debug, const PacketType& type) {
+QString nameForPacketType(PacketType type) {
     QMetaObject metaObject = PacketTypeEnum::staticMetaObject;
     QMetaEnum metaEnum = metaObject.enumerator(metaObject.enumeratorOffset());
-    QString typeName = metaEnum.valueToKey((int) type);
+    return metaEnum.valueToKey((int) type);
+}
+
+QDebug operator<<(QDebug debug, const PacketType& type) {
+    QString typeName = nameForPacketType(type);
 
     debug.nospace().noquote() << (uint8_t) type << " (" << typeName << ")";
     return debug.space();
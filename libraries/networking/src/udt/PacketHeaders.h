@@ -223,6 +223,7 @@ void sendWrongProtocolVersionsSignature(bool sendWrongVersion); /// for debuggin
 #endif
 
 uint qHash(const PacketType& key, uint seed);
+QString nameForPacketType(PacketType type);
 QDebug operator<<(QDebug debug, const PacketType& type);
 
 // Due to the different legacy behaviour, we need special processing for domains that were created before
@@ -377,7 +378,14 @@ enum class DomainListVersion : PacketVersion {
     GetMachineFingerprintFromUUIDSupport,
     AuthenticationOptional,
     HasTimestamp,
-    HasConnectReason
+    HasConnectReason,
+    HasAuthenticationMethod,
+    HasListVersionDeltas
+};
+
+enum class DomainListRequestVersion : PacketVersion {
+    PreListVersion = 22,
+    HasListVersion
 };
 
 enum class AudioVersion : PacketVersion {
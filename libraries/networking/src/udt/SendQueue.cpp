@@ -12,12 +12,6 @@
 #include "SendQueue.h"
 
 #include <algorithm>
-#include <thread>
-
-#include <QtCore/QCoreApplication>
-#include <QtCore/QDateTime>
-#include <QtCore/QJsonObject>
-#include <QtCore/QThread>
 
 #include <LogHandler.h>
 #include <NumericalConstants.h>
@@ -27,7 +21,7 @@
 #include "ControlPacket.h"
 #include "Packet.h"
 #include "PacketList.h"
-#include "../UserActivityLogger.h"
+#include "SendScheduler.h"
 #include "Socket.h"
 #include <Trace.h>
 #include <Profile.h>
@@ -37,33 +31,18 @@
 using namespace udt;
 using namespace std::chrono;
 
-template <typename Mutex1, typename Mutex2>
-class DoubleLock {
-public:
-    using Lock = std::unique_lock<DoubleLock<Mutex1, Mutex2>>;
-    
-    DoubleLock(Mutex1& mutex1, Mutex2& mutex2) : _mutex1(mutex1), _mutex2(mutex2) { }
-    
-    DoubleLock(const DoubleLock&) = delete;
-    DoubleLock& operator=(const DoubleLock&) = delete;
-    
-    // Either locks all the mutexes or none of them
-    bool try_lock() { return (std::try_lock(_mutex1, _mutex2) == -1); }
-    
-    // Locks all the mutexes
-    void lock() { std::lock(_mutex1, _mutex2); }
-    
-     // Undefined behavior if not locked
-    void unlock() { _mutex1.unlock(); _mutex2.unlock(); }
-    
-private:
-    Mutex1& _mutex1;
-    Mutex2& _mutex2;
-};
-
 const microseconds SendQueue::MAXIMUM_ESTIMATED_TIMEOUT = seconds(5);
 const microseconds SendQueue::MINIMUM_ESTIMATED_TIMEOUT = milliseconds(10);
 
+static const auto HANDSHAKE_RESEND_INTERVAL = milliseconds(100);
+static const auto EMPTY_QUEUES_INACTIVE_TIMEOUT = seconds(5);
+
+// packets sent per service before going to the back of the line behind the other ready queues
+static const int MAX_PACKETS_PER_SERVICE = 16;
+
+// how many send periods a queue that fell behind may send back to back to catch up
+static const int MAX_CATCH_UP_PERIODS = 2;
+
 std::unique_ptr<SendQueue> SendQueue::create(Socket* socket, HifiSockAddr destination, SequenceNumber currentSequenceNumber,
                                              MessageNumber currentMessageNumber, bool hasReceivedHandshakeACK) {
     Q_ASSERT_X(socket, "SendQueue::create", "Must be called with a valid Socket*");
@@ -71,19 +50,8 @@ std::unique_ptr<SendQueue> SendQueue::create(Socket* socket, HifiSockAddr destin
     auto queue = std::unique_ptr<SendQueue>(new SendQueue(socket, destination, currentSequenceNumber,
                                                           currentMessageNumber, hasReceivedHandshakeACK));
 
-    // Setup queue private thread
-    QThread* thread = new QThread;
-    thread->setObjectName("Networking: SendQueue " + destination.objectName()); // Name thread for easier debug
-    
-    connect(thread, &QThread::started, queue.get(), &SendQueue::run);
-    
-    connect(queue.get(), &QObject::destroyed, thread, &QThread::quit); // Thread auto cleanup
-    connect(thread, &QThread::finished, thread, &QThread::deleteLater); // Thread auto cleanup
-    
-    // Move queue to private thread and start it
-    queue->moveToThread(thread);
-    
-    thread->start();
+    // the queue starts with a handshake, if it still needs one
+    SendScheduler::getInstance().add(queue.get());
     
     return queue;
 }
@@ -103,41 +71,32 @@ SendQueue::SendQueue(Socket* socket, HifiSockAddr dest, SequenceNumber currentSe
 }
 
 SendQueue::~SendQueue() {
+    // waits for a worker that may be servicing us
+    SendScheduler::getInstance().remove(this);
 }
 
 void SendQueue::queuePacket(std::unique_ptr<Packet> packet) {
     _packets.queuePacket(std::move(packet));
     
-    // call notify_one on the condition_variable_any in case the send thread is sleeping waiting for packets
-    _emptyCondition.notify_one();
-    
-    if (!thread()->isRunning() && _state == State::NotStarted) {
-        thread()->start();
-    }
+    // get serviced in case we're waiting for packets
+    SendScheduler::getInstance().wake(this);
 }
 
 void SendQueue::queuePacketList(std::unique_ptr<PacketList> packetList) {
     _packets.queuePacketList(std::move(packetList));
     
-    // call notify_one on the condition_variable_any in case the send thread is sleeping waiting for packets
-    _emptyCondition.notify_one();
-    
-    if (!thread()->isRunning() && _state == State::NotStarted) {
-        thread()->start();
-    }
+    // get serviced in case we're waiting for packets
+    SendScheduler::getInstance().wake(this);
 }
 
 void SendQueue::stop() {
-    
+    // the next service does nothing, the queue is taken off the scheduler when it is deleted
     _state = State::Stopped;
-    
-    // Notify all conditions in case we're waiting somewhere
-    _handshakeACKCondition.notify_one();
-    _emptyCondition.notify_one();
 }
     
 int SendQueue::sendPacket(const Packet& packet) {
-    _lastPacketSentAt = std::chrono::high_resolution_clock::now();
+    _lastPacketSentAt = p_high_resolution_clock::now();
+    std::lock_guard<std::mutex> destinationLocker(_destinationMutex);
     return _socket->writeDatagram(packet.getData(), packet.getDataSize(), _destination);
 }
     
@@ -149,23 +108,61 @@ void SendQueue::ack(SequenceNumber ack) {
     {
         // remove any ACKed packets from the map of sent packets
         QWriteLocker locker(&_sentLock);
-        for (auto seq = SequenceNumber { (uint32_t) _lastACKSequenceNumber }; seq <= ack; ++seq) {
-            _sentPackets.erase(seq);
-        }
+        _sentPackets.releaseUpTo(ack);
     }
     
     {   // remove any sequence numbers equal to or lower than this ACK in the loss list
         std::lock_guard<std::mutex> nakLocker(_naksLock);
-        
-        if (!_naks.isEmpty() && _naks.getFirstSequenceNumber() <= ack) {
-            _naks.remove(_naks.getFirstSequenceNumber(), ack);
-        }
+        _naks.removeUpTo(ack);
     }
     
     _lastACKSequenceNumber = (uint32_t) ack;
 
-    // call notify_one on the condition_variable_any in case the send thread is sleeping with a full congestion window
-    _emptyCondition.notify_one();
+    // get serviced in case we're waiting with a full congestion window
+    SendScheduler::getInstance().wake(this);
+}
+
+void SendQueue::selectiveACK(SequenceNumber ack, const SequenceRanges& ranges) {
+    // a packet is only taken as lost once this many packets sent after it were received, as it may just be late
+    static const int LOSS_REORDERING_THRESHOLD = 3;
+
+    int numReceivedAfter = 0;
+    for (auto& range : ranges) {
+        numReceivedAfter += seqlen(range.first, range.second);
+    }
+
+    bool hasNewLosses = false;
+    {
+        QWriteLocker locker(&_sentLock);
+        std::lock_guard<std::mutex> nakLocker(_naksLock);
+
+        auto holeStart = ack + 1;
+        for (auto& range : ranges) {
+            if (numReceivedAfter >= LOSS_REORDERING_THRESHOLD) {
+                // re-send the packets in the hole before this range once, a timeout catches them if they're lost again
+                for (auto seq = holeStart; seq < range.first; ++seq) {
+                    auto entry = _sentPackets.find(seq);
+                    // packets released by a previous selective ACK were received
+                    if (entry && entry->packet && !entry->wasReportedLost) {
+                        entry->wasReportedLost = true;
+                        _naks.insert(seq, seq);
+                        hasNewLosses = true;
+                    }
+                }
+            }
+
+            // the packets in the range were received, they won't need to be re-sent
+            _sentPackets.release(range.first, range.second);
+
+            numReceivedAfter -= seqlen(range.first, range.second);
+            holeStart = range.second + 1;
+        }
+    }
+
+    if (hasNewLosses) {
+        // get serviced to re-send them
+        SendScheduler::getInstance().wake(this);
+    }
 }
 
 void SendQueue::fastRetransmit(udt::SequenceNumber ack) {
@@ -174,35 +171,27 @@ void SendQueue::fastRetransmit(udt::SequenceNumber ack) {
         _naks.insert(ack, ack);
     }
 
-    // call notify_one on the condition_variable_any in case the send thread is sleeping waiting for losses to re-send
-    _emptyCondition.notify_one();
+    // get serviced in case we're waiting for losses to re-send
+    SendScheduler::getInstance().wake(this);
 }
 
 void SendQueue::sendHandshake() {
-    std::unique_lock<std::mutex> handshakeLock { _handshakeMutex };
-    if (!_hasReceivedHandshakeACK) {
-        // we haven't received a handshake ACK from the client, send another now
-        // if the handshake hasn't been completed, then the initial sequence number
-        // should be the current sequence number + 1
-        SequenceNumber initialSequenceNumber = _currentSequenceNumber + 1;
-        auto handshakePacket = ControlPacket::create(ControlPacket::Handshake, sizeof(SequenceNumber));
-        handshakePacket->writePrimitive(initialSequenceNumber);
-        _socket->writeBasePacket(*handshakePacket, _destination);
-        
-        // we wait for the ACK or the re-send interval to expire
-        static const auto HANDSHAKE_RESEND_INTERVAL = std::chrono::milliseconds(100);
-        _handshakeACKCondition.wait_for(handshakeLock, HANDSHAKE_RESEND_INTERVAL);
-    }
+    // we haven't received a handshake ACK from the client, send another now
+    // if the handshake hasn't been completed, then the initial sequence number
+    // should be the current sequence number + 1
+    SequenceNumber initialSequenceNumber = _currentSequenceNumber + 1;
+    auto handshakePacket = ControlPacket::create(ControlPacket::Handshake, sizeof(SequenceNumber));
+    handshakePacket->writePrimitive(initialSequenceNumber);
+
+    std::lock_guard<std::mutex> destinationLocker(_destinationMutex);
+    _socket->writeBasePacket(*handshakePacket, _destination);
 }
 
 void SendQueue::handshakeACK() {
-    {
-        std::lock_guard<std::mutex> locker { _handshakeMutex };
-        _hasReceivedHandshakeACK = true;
-    }
+    _hasReceivedHandshakeACK = true;
 
-    // Notify on the handshake ACK condition
-    _handshakeACKCondition.notify_one();
+    // start sending without waiting for the next handshake re-send
+    SendScheduler::getInstance().wake(this);
 }
 
 SequenceNumber SendQueue::getNextSequenceNumber() {
@@ -225,11 +214,8 @@ bool SendQueue::sendNewPacketAndAddToSentList(std::unique_ptr<Packet> newPacket,
     {
         // Insert the packet we have just sent in the sent list
         QWriteLocker locker(&_sentLock);
-        auto& entry = _sentPackets[newPacket->getSequenceNumber()];
-        entry.first = 0; // No resend
-        entry.second.swap(newPacket);
+        _sentPackets.append(sequenceNumber, std::move(newPacket));
     }
-    Q_ASSERT_X(!newPacket, "SendQueue::sendNewPacketAndAddToSentList()", "Overriden packet in sent list");
 
     if (bytesWritten < 0) {
         // this is a short-circuit loss - we failed to put this packet on the wire
@@ -246,113 +232,67 @@ bool SendQueue::sendNewPacketAndAddToSentList(std::unique_ptr<Packet> newPacket,
     }
 }
 
-void SendQueue::run() {
+p_high_resolution_clock::time_point SendQueue::service(p_high_resolution_clock::time_point now) {
     if (_state == State::Stopped) {
-        // we've already been asked to stop before we even got a chance to start
-        // don't start now
-#ifdef UDT_CONNECTION_DEBUG
-        qCDebug(networking) << "SendQueue asked to run after being told to stop. Will not run.";
-#endif
-        return;
-    } else if (_state == State::Running) {
-#ifdef UDT_CONNECTION_DEBUG
-        qCDebug(networking) << "SendQueue asked to run but is already running (according to state). Will not re-run.";
-#endif
-        return;
+        // we've been asked to stop, possibly before we even got a chance to start
+        return p_high_resolution_clock::time_point::max();
+    } else if (_state == State::NotStarted) {
+        _state = State::Running;
+        _nextPacketTimestamp = now;
+        _nextHandshakeTimestamp = now;
     }
-    
-    _state = State::Running;
-    
-    // Wait for handshake to be complete
-    while (_state == State::Running && !_hasReceivedHandshakeACK) {
-        sendHandshake();
 
-        // Keep processing events
-        QCoreApplication::sendPostedEvents(this);
-        
-        // Once we're here we've either received the handshake ACK or it's going to be time to re-send a handshake.
-        // Either way let's continue processing - no packets will be sent if no handshake ACK has been received.
+    // Wait for handshake to be complete, no packets will be sent until we have the handshake ACK
+    if (!_hasReceivedHandshakeACK) {
+        if (now >= _nextHandshakeTimestamp) {
+            sendHandshake();
+            _nextHandshakeTimestamp = now + HANDSHAKE_RESEND_INTERVAL;
+        }
+        return _nextHandshakeTimestamp;
     }
 
-    // Keep an HRC to know when the next packet should have been
-    auto nextPacketTimestamp = p_high_resolution_clock::now();
-
+    int numPacketsSent = 0;
     while (_state == State::Running) {
-        bool attemptedToSendPacket = maybeResendPacket();
-        
-        // if we didn't find a packet to re-send AND we think we can fit a new packet on the wire
-        // (this is according to the current flow window size) then we send out a new packet
-        auto newPacketCount = 0;
-        if (!attemptedToSendPacket) {
-            newPacketCount = maybeSendNewPacket();
-            attemptedToSendPacket = (newPacketCount > 0);
-        }
-        
-        // since we're a while loop, give the thread a chance to process events
-        QCoreApplication::sendPostedEvents(this);
-        
-        // we just processed events so check now if we were just told to stop
-        // If the send queue has been innactive, skip the sleep for
-        // Either _isRunning will have been set to false and we'll break
-        // Or something happened and we'll keep going
-        if (_state != State::Running || isInactive(attemptedToSendPacket)) {
-            return;
-        }
+        auto packetSendPeriod = microseconds(_packetSendPeriod);
+        if (packetSendPeriod.count() > 0) {
+            // we use _nextPacketTimestamp so that we don't fall behind, but a queue that has been waiting
+            // doesn't get to burst more than a couple of packets, nor wait for more than a period
+            if (_nextPacketTimestamp < now - MAX_CATCH_UP_PERIODS * packetSendPeriod) {
+                _nextPacketTimestamp = now - MAX_CATCH_UP_PERIODS * packetSendPeriod;
+            } else if (_nextPacketTimestamp > now + packetSendPeriod) {
+                _nextPacketTimestamp = now + packetSendPeriod;
+            }
 
-        if (_packetSendPeriod > 0) {
-            // push the next packet timestamp forwards by the current packet send period
-            auto nextPacketDelta = (newPacketCount == 2 ? 2 : 1) * _packetSendPeriod;
-            nextPacketTimestamp += std::chrono::microseconds(nextPacketDelta);
+            if (_nextPacketTimestamp > now) {
+                return _nextPacketTimestamp;
+            }
+        }
 
-            // sleep as long as we need for next packet send, if we can
-            auto now = p_high_resolution_clock::now();
+        if (numPacketsSent == MAX_PACKETS_PER_SERVICE) {
+            // let the other ready queues go first
+            return now;
+        }
 
-            auto timeToSleep = duration_cast<microseconds>(nextPacketTimestamp - now);
+        // if we didn't find a packet to re-send AND we think we can fit a new packet on the wire
+        // (this is according to the current flow window size) then we send out a new packet
+        if (!maybeResendPacket() && maybeSendNewPacket() == 0) {
+            break;
+        }
 
-            // we use nextPacketTimestamp so that we don't fall behind, not to force long sleeps
-            // we'll never allow nextPacketTimestamp to force us to sleep for more than nextPacketDelta
-            // so cap it to that value
-            if (timeToSleep > std::chrono::microseconds(nextPacketDelta)) {
-                // reset the nextPacketTimestamp so that it is correct next time we come around
-                nextPacketTimestamp = now + std::chrono::microseconds(nextPacketDelta);
+        ++numPacketsSent;
+        _idleDeadline = p_high_resolution_clock::time_point::max();
+        _timeoutDeadline = p_high_resolution_clock::time_point::max();
 
-                timeToSleep = std::chrono::microseconds(nextPacketDelta);
-            }
+        // push the next packet timestamp forwards by the current packet send period
+        _nextPacketTimestamp += packetSendPeriod;
+        now = p_high_resolution_clock::now();
+    }
 
-            // we're seeing SendQueues sleep for a long period of time here,
-            // which can lock the NodeList if it's attempting to clear connections
-            // for now we guard this by capping the time this thread and sleep for
-
-            const microseconds MAX_SEND_QUEUE_SLEEP_USECS { 2000000 };
-            if (timeToSleep > MAX_SEND_QUEUE_SLEEP_USECS) {
-                qWarning() << "udt::SendQueue wanted to sleep for" << timeToSleep.count() << "microseconds";
-                qWarning() << "Capping sleep to" << MAX_SEND_QUEUE_SLEEP_USECS.count();
-                qWarning() << "PSP:" << _packetSendPeriod << "NPD:" << nextPacketDelta
-                << "NPT:" << nextPacketTimestamp.time_since_epoch().count()
-                << "NOW:" << now.time_since_epoch().count();
-
-                // alright, we're in a weird state
-                // we want to know why this is happening so we can implement a better fix than this guard
-                // send some details up to the API (if the user allows us) that indicate how we could such a large timeToSleep
-                static const QString SEND_QUEUE_LONG_SLEEP_ACTION = "sendqueue-sleep";
-
-                // setup a json object with the details we want
-                QJsonObject longSleepObject;
-                longSleepObject["timeToSleep"] = qint64(timeToSleep.count());
-                longSleepObject["packetSendPeriod"] = _packetSendPeriod.load();
-                longSleepObject["nextPacketDelta"] = nextPacketDelta;
-                longSleepObject["nextPacketTimestamp"] = qint64(nextPacketTimestamp.time_since_epoch().count());
-                longSleepObject["then"] = qint64(now.time_since_epoch().count());
-
-                // hopefully send this event using the user activity logger
-                UserActivityLogger::getInstance().logAction(SEND_QUEUE_LONG_SLEEP_ACTION, longSleepObject);
-                
-                timeToSleep = MAX_SEND_QUEUE_SLEEP_USECS;
-            }
-            
-            std::this_thread::sleep_for(timeToSleep);
-        }
+    if (_state != State::Running) {
+        return p_high_resolution_clock::time_point::max();
     }
+
+    return checkForTimeouts(now);
 }
 
 int SendQueue::maybeSendNewPacket() {
@@ -395,20 +335,19 @@ bool SendQueue::maybeResendPacket() {
             QReadLocker sentLocker(&_sentLock);
             
             // see if we can find the packet to re-send
-            auto it = _sentPackets.find(resendNumber);
+            auto entry = _sentPackets.find(resendNumber);
 
-            if (it != _sentPackets.end()) {
+            if (entry) {
 
-                auto& entry = it->second;
                 // we found the packet - grab it
-                auto& resendPacket = *(entry.second);
-                ++entry.first; // Add 1 resend
+                auto& resendPacket = *(entry->packet);
+                ++entry->numResends; // Add 1 resend
 
-                Packet::ObfuscationLevel level = (Packet::ObfuscationLevel)(entry.first < 2 ? 0 : (entry.first - 2) % 4);
+                Packet::ObfuscationLevel level = (Packet::ObfuscationLevel)(entry->numResends < 2 ? 0 : (entry->numResends - 2) % 4);
 
                 auto wireSize = resendPacket.getWireSize();
                 auto payloadSize = resendPacket.getPayloadSize();
-                auto sequenceNumber = it->first;
+                auto sequenceNumber = resendNumber;
 
                 if (level != Packet::NoObfuscation) {
 #ifdef UDT_CONNECTION_DEBUG
@@ -463,88 +402,72 @@ bool SendQueue::maybeResendPacket() {
     return false;
 }
 
-bool SendQueue::isInactive(bool attemptedToSendPacket) {
-    // check for connection timeout first
+p_high_resolution_clock::time_point SendQueue::checkForTimeouts(p_high_resolution_clock::time_point now) {
+    const auto NO_DEADLINE = p_high_resolution_clock::time_point::max();
 
-    if (!attemptedToSendPacket) {
-        // During our processing above we didn't send any packets
-        
-        // If that is still the case we should use a condition_variable_any to sleep until we have data to handle.
-        // To confirm that the queue of packets and the NAKs list are still both empty we'll need to use the DoubleLock
-        using DoubleLock = DoubleLock<std::recursive_mutex, std::mutex>;
-        DoubleLock doubleLock(_packets.getLock(), _naksLock);
-        DoubleLock::Lock locker(doubleLock, std::try_to_lock);
-        
-        if (locker.owns_lock() && (_packets.isEmpty() || isFlowWindowFull()) && _naks.isEmpty()) {
-            // The packets queue and loss list mutexes are now both locked and they're both empty
-            
-            if (uint32_t(_lastACKSequenceNumber) == uint32_t(_currentSequenceNumber)) {
-                // we've sent the client as much data as we have (and they've ACKed it)
-                // either wait for new data to send or 5 seconds before cleaning up the queue
-                static const auto EMPTY_QUEUES_INACTIVE_TIMEOUT = std::chrono::seconds(5);
-                
-                // use our condition_variable_any to wait
-                auto cvStatus = _emptyCondition.wait_for(locker, EMPTY_QUEUES_INACTIVE_TIMEOUT);
-                
-                if (cvStatus == std::cv_status::timeout && (_packets.isEmpty() || isFlowWindowFull()) && _naks.isEmpty()) {
+    {
+        std::lock_guard<std::mutex> naksLocker(_naksLock);
+        if ((!_packets.isEmpty() && !isFlowWindowFull()) || !_naks.isEmpty()) {
+            // new work came in since we looked
+            return now;
+        }
+    }
 
+    if (uint32_t(_lastACKSequenceNumber) == uint32_t(_currentSequenceNumber)) {
+        // we've sent the client as much data as we have (and they've ACKed it)
+        // either wait for new data to send or 5 seconds before cleaning up the queue
+        _timeoutDeadline = NO_DEADLINE;
+
+        if (_idleDeadline == NO_DEADLINE) {
+            _idleDeadline = now + EMPTY_QUEUES_INACTIVE_TIMEOUT;
+        } else if (now >= _idleDeadline) {
 #ifdef UDT_CONNECTION_DEBUG
-                    qCDebug(networking) << "SendQueue to" << _destination << "has been empty for"
-                        << EMPTY_QUEUES_INACTIVE_TIMEOUT.count()
-                        << "seconds and receiver has ACKed all packets."
-                        << "The queue is now inactive and will be stopped.";
+            qCDebug(networking) << "SendQueue to" << _destination << "has been empty for"
+                << EMPTY_QUEUES_INACTIVE_TIMEOUT.count()
+                << "seconds and receiver has ACKed all packets."
+                << "The queue is now inactive and will be stopped.";
 #endif
 
-                    // we have the lock again - Make sure to unlock it
-                    locker.unlock();
-                    
-                    // Deactivate queue
-                    deactivate();
-                    return true;
-                }
+            // Deactivate queue
+            deactivate();
+            return NO_DEADLINE;
+        }
+        return _idleDeadline;
+    }
 
-            } else {
-                // We think the client is still waiting for data (based on the sequence number gap)
-                // Let's wait either for a response from the client or until the estimated timeout
-                // (plus the sync interval to allow the client to respond) has elapsed
-
-                auto estimatedTimeout = std::chrono::microseconds(_estimatedTimeout);
-
-                // Clamp timeout beween 10 ms and 5 s
-                estimatedTimeout = std::min(MAXIMUM_ESTIMATED_TIMEOUT, std::max(MINIMUM_ESTIMATED_TIMEOUT, estimatedTimeout));
-
-                // use our condition_variable_any to wait
-                auto cvStatus = _emptyCondition.wait_for(locker, estimatedTimeout);
-
-                // when we wake-up check if we're "stuck" either if we've slept for the estimated timeout
-                // or it has been that long since the last time we sent a packet
-
-                // we are stuck if all of the following are true
-                // - there are no new packets to send or the flow window is full and we can't send any new packets
-                // - there are no packets to resend
-                // - the client has yet to ACK some sent packets
-                auto now = std::chrono::high_resolution_clock::now();
-
-                if ((cvStatus == std::cv_status::timeout || (now - _lastPacketSentAt > estimatedTimeout))
-                    && (_packets.isEmpty() || isFlowWindowFull())
-                    && _naks.isEmpty()
-                    && SequenceNumber(_lastACKSequenceNumber) < _currentSequenceNumber) {
-                    // after a timeout if we still have sent packets that the client hasn't ACKed we
-                    // add them to the loss list
-                    
-                    // Note that thanks to the DoubleLock we have the _naksLock right now
-                    _naks.append(SequenceNumber(_lastACKSequenceNumber) + 1, _currentSequenceNumber);
-
-                    // we have the lock again - time to unlock it
-                    locker.unlock();
-                    
-                    emit timeout();
-                }
-            }
+    // We think the client is still waiting for data (based on the sequence number gap)
+    // Let's wait either for a response from the client or until the estimated timeout
+    // (plus the sync interval to allow the client to respond) has elapsed
+    _idleDeadline = NO_DEADLINE;
+
+    auto estimatedTimeout = microseconds(_estimatedTimeout);
+
+    // Clamp timeout beween 10 ms and 5 s
+    estimatedTimeout = std::min(MAXIMUM_ESTIMATED_TIMEOUT, std::max(MINIMUM_ESTIMATED_TIMEOUT, estimatedTimeout));
+
+    SequenceNumber lastACK { (uint32_t)_lastACKSequenceNumber };
+    if (_timeoutDeadline == NO_DEADLINE || lastACK != _timeoutACKSequenceNumber) {
+        // the client made progress, give it the whole timeout again
+        _timeoutDeadline = now + estimatedTimeout;
+        _timeoutACKSequenceNumber = lastACK;
+        if (now - _lastPacketSentAt <= estimatedTimeout) {
+            return _timeoutDeadline;
         }
+    } else if (now < _timeoutDeadline && now - _lastPacketSentAt <= estimatedTimeout) {
+        return _timeoutDeadline;
     }
-    
-    return false;
+
+    // we are stuck if we've waited for the estimated timeout or it has been that long since the last time
+    // we sent a packet, and the client has yet to ACK some sent packets
+    // after a timeout if we still have sent packets that the client hasn't ACKed we add them to the loss list
+    {
+        std::lock_guard<std::mutex> naksLocker(_naksLock);
+        _naks.append(lastACK + 1, _currentSequenceNumber);
+    }
+    _timeoutDeadline = NO_DEADLINE;
+
+    emit timeout();
+    return now;
 }
 
 void SendQueue::deactivate() {
@@ -559,5 +482,6 @@ bool SendQueue::isFlowWindowFull() const {
 }
 
 void SendQueue::updateDestinationAddress(HifiSockAddr newAddress) {
+    std::lock_guard<std::mutex> destinationLocker(_destinationMutex);
     _destination = newAddress;
 }
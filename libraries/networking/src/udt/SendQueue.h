@@ -13,12 +13,10 @@
 #define hifi_SendQueue_h
 
 #include <atomic>
-#include <condition_variable>
 #include <cstdint>
 #include <list>
 #include <memory>
 #include <mutex>
-#include <unordered_map>
 
 #include <QtCore/QObject>
 #include <QtCore/QReadWriteLock>
@@ -29,6 +27,7 @@
 
 #include "Constants.h"
 #include "PacketQueue.h"
+#include "SentPacketBuffer.h"
 #include "SequenceNumber.h"
 #include "LossList.h"
 
@@ -39,7 +38,8 @@ class ControlPacket;
 class Packet;
 class PacketList;
 class Socket;
-    
+
+// Has no thread of its own, the SendScheduler services it on one of its workers whenever it has something to do
 class SendQueue : public QObject {
     Q_OBJECT
     
@@ -68,11 +68,16 @@ public:
     void setPacketSendPeriod(int newPeriod) { _packetSendPeriod = newPeriod; }
     
     void setEstimatedTimeout(int estimatedTimeout) { _estimatedTimeout = estimatedTimeout; }
+
+    // Sends what it can as of now and returns when it next needs servicing, or time_point::max() to wait for new work.
+    // Only called by the SendScheduler, which never services the same queue on two threads at once.
+    p_high_resolution_clock::time_point service(p_high_resolution_clock::time_point now);
     
 public slots:
     void stop();
     
     void ack(SequenceNumber ack);
+    void selectiveACK(SequenceNumber ack, const SequenceRanges& ranges);
     void fastRetransmit(SequenceNumber ack);
     void handshakeACK();
     void updateDestinationAddress(HifiSockAddr newAddress);
@@ -85,9 +90,6 @@ signals:
 
     void timeout();
     
-private slots:
-    void run();
-    
 private:
     SendQueue(Socket* socket, HifiSockAddr dest, SequenceNumber currentSequenceNumber,
               MessageNumber currentMessageNumber, bool hasReceivedHandshakeACK);
@@ -102,7 +104,8 @@ private:
     int maybeSendNewPacket(); // Figures out what packet to send next
     bool maybeResendPacket(); // Determines whether to resend a packet and which one
     
-    bool isInactive(bool attemptedToSendPacket);
+    // Called when there was nothing to send, returns when to check again
+    p_high_resolution_clock::time_point checkForTimeouts(p_high_resolution_clock::time_point now);
     void deactivate(); // makes the queue inactive and cleans it up
 
     bool isFlowWindowFull() const;
@@ -113,6 +116,7 @@ private:
     PacketQueue _packets;
     
     Socket* _socket { nullptr }; // Socket to send packet on
+    std::mutex _destinationMutex; // Protects the destination, which changes on the connection's thread
     HifiSockAddr _destination; // Destination addr
     
     std::atomic<uint32_t> _lastACKSequenceNumber { 0 }; // Last ACKed sequence number
@@ -131,16 +135,17 @@ private:
     LossList _naks; // Sequence numbers of packets to resend
     
     mutable QReadWriteLock _sentLock; // Protects the sent packet list
-    using PacketResendPair = std::pair<uint8_t, std::unique_ptr<Packet>>; // Number of resend + packet ptr
-    std::unordered_map<SequenceNumber, PacketResendPair> _sentPackets; // Packets waiting for ACK.
+    SentPacketBuffer _sentPackets; // Packets waiting for ACK.
     
-    std::mutex _handshakeMutex; // Protects the handshake ACK condition_variable
     std::atomic<bool> _hasReceivedHandshakeACK { false }; // flag for receipt of handshake ACK from client
-    std::condition_variable _handshakeACKCondition;
-    
-    std::condition_variable_any _emptyCondition;
 
-    std::chrono::high_resolution_clock::time_point _lastPacketSentAt;
+    // only touched by service()
+    p_high_resolution_clock::time_point _lastPacketSentAt;
+    p_high_resolution_clock::time_point _nextPacketTimestamp; // when the next packet should go out, for pacing
+    p_high_resolution_clock::time_point _nextHandshakeTimestamp;
+    p_high_resolution_clock::time_point _idleDeadline { p_high_resolution_clock::time_point::max() };
+    p_high_resolution_clock::time_point _timeoutDeadline { p_high_resolution_clock::time_point::max() };
+    SequenceNumber _timeoutACKSequenceNumber; // last ACK when the timeout deadline was set
 
     static const std::chrono::microseconds MAXIMUM_ESTIMATED_TIMEOUT;
     static const std::chrono::microseconds MINIMUM_ESTIMATED_TIMEOUT;
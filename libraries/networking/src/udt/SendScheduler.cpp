@@ -0,0 +1,205 @@
+//
+//  SendScheduler.cpp
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SendScheduler.h"
+
+#include <algorithm>
+
+#include "SendQueue.h"
+
+using namespace udt;
+using namespace std::chrono;
+
+static const microseconds TICK_USECS { 100 };
+static const int MAX_NUM_WORKERS = 4;
+
+SendScheduler& SendScheduler::getInstance() {
+    static SendScheduler instance(std::max(1, std::min(MAX_NUM_WORKERS, (int)std::thread::hardware_concurrency() / 2)));
+    return instance;
+}
+
+SendScheduler::SendScheduler(int numWorkers) :
+    _startTime(p_high_resolution_clock::now())
+{
+    for (int i = 0; i < numWorkers; ++i) {
+        _workers.emplace_back(&SendScheduler::run, this);
+    }
+}
+
+SendScheduler::~SendScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _isStopping = true;
+    }
+    _workCondition.notify_all();
+    for (auto& worker : _workers) {
+        worker.join();
+    }
+}
+
+void SendScheduler::add(SendQueue* queue) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& state = _queues[queue];
+    makeReady(queue, state, p_high_resolution_clock::now());
+}
+
+void SendScheduler::wake(SendQueue* queue) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _queues.find(queue);
+    if (it == _queues.end() || it->second.isRemoving) {
+        return;
+    }
+
+    auto& state = it->second;
+    if (state.isServicing) {
+        // the worker will put it back in line when it is done
+        state.needsService = true;
+    } else if (!state.isReady) {
+        makeReady(queue, state, p_high_resolution_clock::now());
+    }
+}
+
+void SendScheduler::remove(SendQueue* queue) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    auto it = _queues.find(queue);
+    if (it == _queues.end()) {
+        return;
+    }
+
+    it->second.isRemoving = true;
+
+    // the wait lets go of the lock, and an add() of another queue may rehash the map and invalidate iterators into it
+    _servicedCondition.wait(lock, [&] {
+        auto it = _queues.find(queue);
+        return it == _queues.end() || !it->second.isServicing;
+    });
+    _queues.erase(queue);
+
+    // any timer left for it in the wheel is dropped when it comes due, since the queue is gone by then
+    _readyQueues.erase(std::remove_if(_readyQueues.begin(), _readyQueues.end(), [&](const Entry& entry) {
+        return entry.queue == queue;
+    }), _readyQueues.end());
+}
+
+SendScheduler::Stats SendScheduler::sampleStats() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    Stats stats = _stats;
+    stats.numQueues = (int)_queues.size();
+    _stats = Stats();
+    return stats;
+}
+
+void SendScheduler::makeReady(SendQueue* queue, QueueState& state, time_point dueTime) {
+    // a new generation makes any timer still in the wheel for this queue stale
+    state.generation = _nextGeneration++;
+    state.dueTime = dueTime;
+    state.isReady = true;
+    _readyQueues.push_back(Entry { queue, state.generation });
+    _workCondition.notify_one();
+}
+
+void SendScheduler::schedule(SendQueue* queue, QueueState& state, time_point dueTime, time_point now) {
+    if (dueTime == time_point::max()) {
+        // nothing to do until woken up
+        return;
+    }
+
+    uint64_t dueTick = toTick(dueTime);
+    if (dueTime <= now || dueTick <= _timers.getCurrentTick()) {
+        makeReady(queue, state, dueTime);
+        return;
+    }
+
+    state.generation = _nextGeneration++;
+    state.dueTime = dueTime;
+    _timers.insert(Entry { queue, state.generation }, dueTick);
+
+    // a waiting worker may be sleeping past this new timer
+    _workCondition.notify_one();
+}
+
+uint64_t SendScheduler::toTick(time_point time) const {
+    // round up, a queue is never serviced before the time it asked for
+    auto sinceStart = duration_cast<microseconds>(time - _startTime);
+    return (uint64_t)((sinceStart + TICK_USECS - microseconds(1)) / TICK_USECS);
+}
+
+SendScheduler::time_point SendScheduler::toTime(uint64_t tick) const {
+    return _startTime + tick * TICK_USECS;
+}
+
+void SendScheduler::run() {
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    while (!_isStopping) {
+        auto now = p_high_resolution_clock::now();
+
+        // the wheel is only moved up to the last tick that is fully past
+        auto currentTick = (uint64_t)(duration_cast<microseconds>(now - _startTime) / TICK_USECS);
+        _timers.advance(currentTick, [&](const Entry& entry) {
+            auto it = _queues.find(entry.queue);
+            if (it != _queues.end() && it->second.generation == entry.generation && !it->second.isRemoving) {
+                makeReady(entry.queue, it->second, it->second.dueTime);
+            }
+        });
+
+        if (_readyQueues.empty()) {
+            auto nextTick = _timers.getNextTick();
+            if (nextTick == TimerWheel<Entry>::NO_TICK) {
+                _workCondition.wait(lock);
+            } else {
+                _workCondition.wait_until(lock, toTime(nextTick));
+            }
+            continue;
+        }
+
+        auto entry = _readyQueues.front();
+        _readyQueues.pop_front();
+
+        auto it = _queues.find(entry.queue);
+        if (it == _queues.end() || it->second.generation != entry.generation || !it->second.isReady) {
+            continue;
+        }
+
+        // unlike iterators, references into the map stay valid through a rehash, and remove() waits for us before erasing it
+        auto queue = entry.queue;
+        auto& state = it->second;
+        state.isReady = false;
+        state.isServicing = true;
+        state.needsService = false;
+
+        if (now > state.dueTime) {
+            uint64_t lagUsecs = duration_cast<microseconds>(now - state.dueTime).count();
+            _stats.totalLagUsecs += lagUsecs;
+            _stats.maxLagUsecs = std::max(_stats.maxLagUsecs, lagUsecs);
+            if (lagUsecs > (uint64_t)TICK_USECS.count()) {
+                ++_stats.numLateServices;
+            }
+        }
+        ++_stats.numServices;
+
+        lock.unlock();
+        auto nextDueTime = queue->service(now);
+        lock.lock();
+
+        state.isServicing = false;
+        if (state.isRemoving) {
+            _servicedCondition.notify_all();
+            continue;
+        }
+
+        now = p_high_resolution_clock::now();
+        if (state.needsService) {
+            makeReady(queue, state, now);
+        } else {
+            schedule(queue, state, nextDueTime, now);
+        }
+    }
+}
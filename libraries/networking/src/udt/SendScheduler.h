@@ -0,0 +1,109 @@
+//
+//  SendScheduler.h
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_SendScheduler_h
+#define hifi_SendScheduler_h
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <PortableHighResolutionClock.h>
+
+#include "TimerWheel.h"
+
+namespace udt {
+
+class SendQueue;
+
+// Runs every SendQueue of the process on a small pool of worker threads instead of a thread per queue.
+// A queue is serviced when it is woken up by new work or when the time it asked for comes up on the timer wheel,
+// and is never serviced by two workers at once.  Queues that are ready are serviced in turn, each sending at most
+// a few packets before going to the back of the line, so one busy connection can't hold up the others.
+class SendScheduler {
+public:
+    using time_point = p_high_resolution_clock::time_point;
+
+    // how late queues were serviced compared to the time they asked for
+    class Stats {
+    public:
+        int numQueues { 0 };
+        uint64_t numServices { 0 };
+        uint64_t numLateServices { 0 };
+        uint64_t totalLagUsecs { 0 };
+        uint64_t maxLagUsecs { 0 };
+    };
+
+    static SendScheduler& getInstance();
+
+    explicit SendScheduler(int numWorkers);
+    ~SendScheduler();
+
+    // starts servicing the queue right away
+    void add(SendQueue* queue);
+
+    // services the queue as soon as possible, safe to call from any thread and while the queue is being serviced
+    void wake(SendQueue* queue);
+
+    // stops servicing the queue, waiting for a worker that is servicing it to be done
+    void remove(SendQueue* queue);
+
+    int getNumWorkers() const { return (int)_workers.size(); }
+
+    // How late queues were serviced since the last sample.
+    Stats sampleStats();
+
+private:
+    class QueueState {
+    public:
+        uint64_t generation { 0 }; // tells the wheel entries of this queue from those it left behind
+        time_point dueTime;
+        bool isReady { false };
+        bool isServicing { false };
+        bool needsService { false };
+        bool isRemoving { false };
+    };
+
+    class Entry {
+    public:
+        SendQueue* queue;
+        uint64_t generation;
+    };
+
+    void run();
+
+    void makeReady(SendQueue* queue, QueueState& state, time_point dueTime);
+    void schedule(SendQueue* queue, QueueState& state, time_point dueTime, time_point now);
+    uint64_t toTick(time_point time) const;
+    time_point toTime(uint64_t tick) const;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _workCondition;
+    std::condition_variable _servicedCondition;
+
+    std::unordered_map<SendQueue*, QueueState> _queues;
+    std::deque<Entry> _readyQueues;
+    TimerWheel<Entry> _timers;
+    const time_point _startTime;
+    uint64_t _nextGeneration { 1 };
+
+    Stats _stats;
+
+    std::vector<std::thread> _workers;
+    bool _isStopping { false };
+};
+
+}
+
+#endif // hifi_SendScheduler_h
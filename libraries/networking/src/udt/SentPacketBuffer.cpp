@@ -0,0 +1,108 @@
+//
+//  SentPacketBuffer.cpp
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SentPacketBuffer.h"
+
+#include <algorithm>
+
+using namespace udt;
+
+static const int MIN_CAPACITY = 64;
+
+void SentPacketBuffer::append(SequenceNumber sequenceNumber, std::unique_ptr<Packet> packet) {
+    if (_size == 0) {
+        _firstSequenceNumber = sequenceNumber;
+    }
+
+    int offset = seqoff(_firstSequenceNumber, sequenceNumber);
+    Q_ASSERT_X(offset >= _size, "SentPacketBuffer::append()", "SequenceNumber appended is not after the last one");
+    if (offset < _size) {
+        return;
+    }
+
+    // sequence numbers that were skipped, if any, are left empty
+    if (offset >= (int)_entries.size()) {
+        grow(offset + 1);
+    }
+    _size = offset + 1;
+
+    auto& entry = at(offset);
+    entry.numResends = 0;
+    entry.wasReportedLost = false;
+    entry.packet = std::move(packet);
+}
+
+SentPacketBuffer::Entry* SentPacketBuffer::find(SequenceNumber sequenceNumber) {
+    if (_size == 0) {
+        return nullptr;
+    }
+    int offset = seqoff(_firstSequenceNumber, sequenceNumber);
+    if (offset < 0 || offset >= _size) {
+        return nullptr;
+    }
+    auto& entry = at(offset);
+    return entry.packet ? &entry : nullptr;
+}
+
+int SentPacketBuffer::releaseUpTo(SequenceNumber sequenceNumber) {
+    if (_size == 0) {
+        return 0;
+    }
+    int offset = seqoff(_firstSequenceNumber, sequenceNumber);
+    if (offset < 0) {
+        return 0;
+    }
+
+    int numReleased = std::min(offset + 1, _size);
+    for (int i = 0; i < numReleased; ++i) {
+        at(i).packet.reset();
+    }
+    _head = (_head + numReleased) & (_entries.size() - 1);
+    _size -= numReleased;
+    _firstSequenceNumber += numReleased;
+    return numReleased;
+}
+
+int SentPacketBuffer::release(SequenceNumber start, SequenceNumber end) {
+    if (_size == 0) {
+        return 0;
+    }
+    int first = std::max(0, seqoff(_firstSequenceNumber, start));
+    int last = std::min(_size - 1, seqoff(_firstSequenceNumber, end));
+
+    int numReleased = 0;
+    for (int i = first; i <= last; ++i) {
+        auto& entry = at(i);
+        if (entry.packet) {
+            entry.packet.reset();
+            ++numReleased;
+        }
+    }
+    return numReleased;
+}
+
+void SentPacketBuffer::clear() {
+    releaseUpTo(_firstSequenceNumber + (_size - 1));
+}
+
+void SentPacketBuffer::grow(int minCapacity) {
+    size_t capacity = std::max((size_t)MIN_CAPACITY, _entries.size());
+    while (capacity < (size_t)minCapacity) {
+        capacity *= 2;
+    }
+
+    // unwrap the entries in the new buffer
+    std::vector<Entry> entries(capacity);
+    for (int i = 0; i < _size; ++i) {
+        entries[i] = std::move(at(i));
+    }
+    _entries.swap(entries);
+    _head = 0;
+}
@@ -0,0 +1,64 @@
+//
+//  SentPacketBuffer.h
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_SentPacketBuffer_h
+#define hifi_SentPacketBuffer_h
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Packet.h"
+#include "SequenceNumber.h"
+
+namespace udt {
+
+// Packets waiting for an ACK, in a circular buffer indexed by sequence number.  Packets are sent in sequence
+// and ACKed from the front, so finding one is an index and releasing everything an ACK covers pops the front.
+class SentPacketBuffer {
+public:
+    class Entry {
+    public:
+        uint8_t numResends { 0 };
+        bool wasReportedLost { false }; // a selective ACK skipped over it
+        std::unique_ptr<Packet> packet;
+    };
+
+    bool isEmpty() const { return _size == 0; }
+    int getSize() const { return _size; }
+    SequenceNumber getFirstSequenceNumber() const { return _firstSequenceNumber; }
+
+    // must always add after the last sequence number
+    void append(SequenceNumber sequenceNumber, std::unique_ptr<Packet> packet);
+
+    // nullptr if the packet isn't in the buffer, likely because it was ACKed
+    Entry* find(SequenceNumber sequenceNumber);
+
+    // releases the packets up to and including sequenceNumber, returns how many there were
+    int releaseUpTo(SequenceNumber sequenceNumber);
+
+    // releases the packets from start to end that are still held, for selective ACKs, returns how many there were
+    int release(SequenceNumber start, SequenceNumber end);
+
+    void clear();
+
+private:
+    Entry& at(int offset) { return _entries[(_head + offset) & (_entries.size() - 1)]; }
+    void grow(int minCapacity);
+
+    std::vector<Entry> _entries; // size is a power of two
+    size_t _head { 0 };
+    int _size { 0 };
+    SequenceNumber _firstSequenceNumber;
+};
+
+}
+
+#endif // hifi_SentPacketBuffer_h
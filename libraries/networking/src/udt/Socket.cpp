@@ -285,7 +285,9 @@ Connection* Socket::findOrCreateConnection(const HifiSockAddr& sockAddr, bool fi
 #endif // UDT_CONNECTION_DEBUG
             return nullptr;
         } else {
-            auto congestionControl = _ccFactory->create();
+            auto factoryIt = _destinationCCFactories.find(sockAddr);
+            auto& ccFactory = (factoryIt != _destinationCCFactories.end()) ? factoryIt->second : _ccFactory;
+            auto congestionControl = ccFactory->create();
             congestionControl->setMaxBandwidth(_maxBandwidth);
             auto connection = std::unique_ptr<Connection>(new Connection(this, sockAddr, std::move(congestionControl)));
             if (QThread::currentThread() != thread()) {
@@ -495,6 +497,12 @@ void Socket::setCongestionControlFactory(std::unique_ptr<CongestionControlVirtua
     _ccFactory.swap(ccFactory);
 }
 
+void Socket::setCongestionControlFactory(const HifiSockAddr& destination,
+                                         std::unique_ptr<CongestionControlVirtualFactory> ccFactory) {
+    Lock connectionsLock(_connectionsHashMutex);
+    _destinationCCFactories[destination] = std::move(ccFactory);
+}
+
 
 void Socket::setConnectionMaxBandwidth(int maxBandwidth) {
     qInfo() << "Setting socket's maximum bandwith to" << maxBandwidth << "bps. ("
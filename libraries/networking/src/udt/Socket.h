@@ -82,6 +82,11 @@ public:
         { _unfilteredHandlers[senderSockAddr] = handler; }
     
     void setCongestionControlFactory(std::unique_ptr<CongestionControlVirtualFactory> ccFactory);
+
+    // congestion control for connections to this destination only, taking effect when the connection is created
+    void setCongestionControlFactory(const HifiSockAddr& destination,
+                                     std::unique_ptr<CongestionControlVirtualFactory> ccFactory);
+
     void setConnectionMaxBandwidth(int maxBandwidth);
 
     void messageReceived(std::unique_ptr<Packet> packet);
@@ -140,6 +145,7 @@ private:
     int _maxBandwidth { -1 };
 
     std::unique_ptr<CongestionControlVirtualFactory> _ccFactory { new CongestionControlFactory<TCPVegasCC>() };
+    std::unordered_map<HifiSockAddr, std::unique_ptr<CongestionControlVirtualFactory>> _destinationCCFactories;
 
     bool _shouldChangeSocketOptions { true };
 
@@ -0,0 +1,166 @@
+//
+//  TimerWheel.h
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_TimerWheel_h
+#define hifi_TimerWheel_h
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace udt {
+
+// A hierarchical timer wheel of values due at integer ticks.  Inserting is constant time, and advancing runs in time
+// proportional to the ticks that hold timers, since the empty stretches of the wheel are skipped.
+// Each level has NUM_SLOTS slots, each NUM_SLOTS times wider than those of the level below, timers further out than
+// the last level are kept in its furthest slot and cascade down again from there.
+template <typename T>
+class TimerWheel {
+public:
+    static const int SLOT_BITS = 6;
+    static const int NUM_SLOTS = 1 << SLOT_BITS;
+    static const int NUM_LEVELS = 3;
+    static const uint64_t NO_TICK = std::numeric_limits<uint64_t>::max();
+
+    explicit TimerWheel(uint64_t currentTick = 0) : _currentTick(currentTick) {}
+
+    uint64_t getCurrentTick() const { return _currentTick; }
+    size_t size() const { return _size; }
+    bool isEmpty() const { return _size == 0; }
+
+    // Returns false when the value is already due, in which case it is not added
+    bool insert(T value, uint64_t dueTick) {
+        if (dueTick <= _currentTick) {
+            return false;
+        }
+        place(Timer { std::move(value), dueTick });
+        return true;
+    }
+
+    // Moves the wheel forward to tick, calling onDue(value) for every timer due by then in order of their ticks
+    template <typename F>
+    void advance(uint64_t tick, F&& onDue) {
+        while (_currentTick < tick && _size > 0) {
+            if (_levelSizes[0] == 0) {
+                // nothing in the lowest level, skip to where the next slot of the level above cascades down,
+                // or straight to the target if it comes first
+                uint64_t nextBoundary = (_currentTick | (NUM_SLOTS - 1)) + 1;
+                if (nextBoundary > tick) {
+                    break;
+                }
+                _currentTick = nextBoundary;
+            } else {
+                ++_currentTick;
+            }
+
+            cascade();
+
+            auto& slot = _slots[0][_currentTick & (NUM_SLOTS - 1)];
+            if (!slot.empty()) {
+                _dueTimers.swap(slot);
+                _levelSizes[0] -= _dueTimers.size();
+                _size -= _dueTimers.size();
+                for (auto& timer : _dueTimers) {
+                    onDue(timer.value);
+                }
+                _dueTimers.clear();
+            }
+        }
+        _currentTick = std::max(_currentTick, tick);
+    }
+
+    // A tick no later than the first timer, or NO_TICK when there is none.  It is exact for the timers in the
+    // lowest level, and the start of their slot for those above, where advance() has to go anyway to cascade them down.
+    uint64_t getNextTick() const {
+        uint64_t nextTick = NO_TICK;
+        uint64_t levelShift = 0;
+        for (int level = 0; level < NUM_LEVELS; ++level) {
+            if (_levelSizes[level] > 0) {
+                uint64_t position = _currentTick >> levelShift;
+                for (int i = 1; i <= NUM_SLOTS; ++i) {
+                    uint64_t slotTick = position + i;
+                    if (!_slots[level][slotTick & (NUM_SLOTS - 1)].empty()) {
+                        nextTick = std::min(nextTick, slotTick << levelShift);
+                        break;
+                    }
+                }
+            }
+            levelShift += SLOT_BITS;
+        }
+        return nextTick;
+    }
+
+private:
+    class Timer {
+    public:
+        T value;
+        uint64_t dueTick;
+    };
+
+    void place(Timer timer) {
+        uint64_t delta = timer.dueTick - _currentTick;
+        uint64_t levelShift = 0;
+        int level = 0;
+        while (level < NUM_LEVELS - 1 && delta >= ((uint64_t)NUM_SLOTS << levelShift)) {
+            ++level;
+            levelShift += SLOT_BITS;
+        }
+        uint64_t slotTick = timer.dueTick >> levelShift;
+        uint64_t lastSlotTick = ((_currentTick >> levelShift) + NUM_SLOTS - 1);
+        if (slotTick > lastSlotTick) {
+            // beyond the wheel, it will be placed again when that slot cascades
+            slotTick = lastSlotTick;
+        }
+        _slots[level][slotTick & (NUM_SLOTS - 1)].push_back(std::move(timer));
+        ++_levelSizes[level];
+        ++_size;
+    }
+
+    // when entering a new slot of the upper levels, spread its timers over the levels below
+    void cascade() {
+        uint64_t levelShift = SLOT_BITS;
+        for (int level = 1; level < NUM_LEVELS; ++level) {
+            if ((_currentTick & ((1ULL << levelShift) - 1)) != 0) {
+                break;
+            }
+            auto& slot = _slots[level][(_currentTick >> levelShift) & (NUM_SLOTS - 1)];
+            if (!slot.empty()) {
+                _cascadingTimers.swap(slot);
+                _levelSizes[level] -= _cascadingTimers.size();
+                _size -= _cascadingTimers.size();
+                for (auto& timer : _cascadingTimers) {
+                    if (timer.dueTick <= _currentTick) {
+                        // lands in the current tick of the lowest level, handled right after the cascade
+                        _slots[0][_currentTick & (NUM_SLOTS - 1)].push_back(std::move(timer));
+                        ++_levelSizes[0];
+                        ++_size;
+                    } else {
+                        place(std::move(timer));
+                    }
+                }
+                _cascadingTimers.clear();
+            }
+            levelShift += SLOT_BITS;
+        }
+    }
+
+    std::array<std::array<std::vector<Timer>, NUM_SLOTS>, NUM_LEVELS> _slots;
+    std::array<size_t, NUM_LEVELS> _levelSizes {{ 0, 0, 0 }};
+    std::vector<Timer> _dueTimers;
+    std::vector<Timer> _cascadingTimers;
+    uint64_t _currentTick { 0 };
+    size_t _size { 0 };
+};
+
+}
+
+#endif // hifi_TimerWheel_h
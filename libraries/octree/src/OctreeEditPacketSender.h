@@ -13,6 +13,7 @@
 #define hifi_OctreeEditPacketSender_h
 
 #include <unordered_map>
+#include <vector>
 
 #include <PacketSender.h>
 #include <udt/PacketHeaders.h>
@@ -23,6 +24,8 @@
 class OctreeEditPacketSender :  public PacketSender {
     Q_OBJECT
 public:
+    using EditMessagePair = std::pair<PacketType, QByteArray>;
+
     OctreeEditPacketSender();
     ~OctreeEditPacketSender();
 
@@ -31,6 +34,10 @@ public:
     /// MaxPendingMessages will be buffered and processed when servers are known.
     void queueOctreeEditMessage(PacketType type, QByteArray& editMessage);
 
+    /// Queues several edit messages at once, packing them into as few packets as possible for the server while
+    /// only looking the server up and taking the queue lock once.
+    void queueOctreeEditMessages(std::vector<EditMessagePair>& editMessages);
+
     /// Releases all queued messages even if those messages haven't filled an MTU packet. This will move the packed message
     /// packets onto the send queue. If running in threaded mode, the caller does not need to do any further processing to
     /// have these packets get sent. If running in non-threaded mode, the caller must still call process() on a regular
@@ -72,8 +79,7 @@ public slots:
     void nodeKilled(SharedNodePointer node);
 
 protected:
-    using EditMessagePair = std::pair<PacketType, QByteArray>;
-
+    void queueOctreeEditMessageToNode(const SharedNodePointer& node, PacketType type, QByteArray& editMessage);
     void queuePacketToNode(const QUuid& nodeID, std::unique_ptr<NLPacket> packet);
     void queuePacketListToNode(const QUuid& nodeUUID, std::unique_ptr<NLPacketList> packetList);
 
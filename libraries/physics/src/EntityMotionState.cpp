@@ -510,6 +510,15 @@ void EntityMotionState::sendBid(OctreeEditPacketSender* packetSender, uint32_t s
 }
 
 void EntityMotionState::sendUpdate(OctreeEditPacketSender* packetSender, uint32_t step) {
+    EntityTreeElementPointer element = _entity->getElement();
+    EntityTreePointer tree = element ? element->getTree() : nullptr;
+
+    std::vector<EntityEditPacketSender::EntityEdit> edits;
+    sendUpdate(edits, step);
+    static_cast<EntityEditPacketSender*>(packetSender)->queueEditEntityMessages(PacketType::EntityPhysics, tree, edits);
+}
+
+void EntityMotionState::sendUpdate(std::vector<EntityEditPacketSender::EntityEdit>& edits, uint32_t step) {
     DETAILED_PROFILE_RANGE(simulation_physics, "Send");
     assert(isLocallyOwned());
 
@@ -571,15 +580,12 @@ void EntityMotionState::sendUpdate(OctreeEditPacketSender* packetSender, uint32_
     }
 
     EntityItemID id(_entity->getID());
-    EntityEditPacketSender* entityPacketSender = static_cast<EntityEditPacketSender*>(packetSender);
-
-    EntityTreeElementPointer element = _entity->getElement();
-    EntityTreePointer tree = element ? element->getTree() : nullptr;
 
     properties.setEntityHostType(_entity->getEntityHostType());
     properties.setOwningAvatarID(_entity->getOwningAvatarID());
 
-    entityPacketSender->queueEditEntityMessage(PacketType::EntityPhysics, tree, id, properties);
+    quint64 lastEdited = properties.getLastEdited();
+    edits.emplace_back(id, std::move(properties));
     _entity->setLastBroadcast(now); // for debug/physics status icons
 
     // if we've moved an entity with children, check/update the queryAACube of all descendents and tell the server
@@ -590,12 +596,11 @@ void EntityMotionState::sendUpdate(OctreeEditPacketSender* packetSender, uint32_
             if (descendant->updateQueryAACube()) {
                 EntityItemProperties newQueryCubeProperties;
                 newQueryCubeProperties.setQueryAACube(descendant->getQueryAACube());
-                newQueryCubeProperties.setLastEdited(properties.getLastEdited());
+                newQueryCubeProperties.setLastEdited(lastEdited);
                 newQueryCubeProperties.setEntityHostType(entityDescendant->getEntityHostType());
                 newQueryCubeProperties.setOwningAvatarID(entityDescendant->getOwningAvatarID());
 
-                entityPacketSender->queueEditEntityMessage(PacketType::EntityPhysics, tree,
-                                                           descendant->getID(), newQueryCubeProperties);
+                edits.emplace_back(descendant->getID(), std::move(newQueryCubeProperties));
                 entityDescendant->setLastBroadcast(now); // for debug/physics status icons
             }
         }
@@ -12,6 +12,7 @@
 #ifndef hifi_EntityMotionState_h
 #define hifi_EntityMotionState_h
 
+#include <EntityEditPacketSender.h>
 #include <EntityItem.h>
 #include <EntityTypes.h>
 #include <AACube.h>
@@ -54,6 +55,8 @@ public:
     bool shouldSendUpdate(uint32_t simulationStep);
     void sendBid(OctreeEditPacketSender* packetSender, uint32_t step);
     void sendUpdate(OctreeEditPacketSender* packetSender, uint32_t step);
+    // appends the update (and any descendant query cube changes) to edits instead of queueing it right away
+    void sendUpdate(std::vector<EntityEditPacketSender::EntityEdit>& edits, uint32_t step);
 
     virtual uint32_t getIncomingDirtyFlags() const override;
     virtual void clearIncomingDirtyFlags(uint32_t mask = DIRTY_PHYSICS_FLAGS) override;
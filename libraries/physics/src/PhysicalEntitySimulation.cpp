@@ -12,6 +12,9 @@
 
 #include "PhysicalEntitySimulation.h"
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 #include <Profile.h>
 
 #include "PhysicsHelpers.h"
@@ -298,7 +301,7 @@ void PhysicalEntitySimulation::buildMotionStatesForEntitiesThatNeedThem() {
                         // bummer, the hashes are different and we no longer want the shape we've received
                         ObjectMotionState::getShapeManager()->releaseShape(shape);
                         // try again
-                        shape = const_cast<btCollisionShape*>(ObjectMotionState::getShapeManager()->getShape(shapeInfo));
+                        shape = const_cast<btCollisionShape*>(ObjectMotionState::getShapeManager()->getShape(shapeInfo, true));
                         if (shape) {
                             buildMotionState(shape, entity);
                             requestItr = _shapeRequests.erase(requestItr);
@@ -372,7 +375,7 @@ void PhysicalEntitySimulation::buildMotionStatesForEntitiesThatNeedThem() {
                 ShapeInfo shapeInfo;
                 entity->computeShapeInfo(shapeInfo);
                 uint32_t requestCount = ObjectMotionState::getShapeManager()->getWorkRequestCount();
-                btCollisionShape* shape = const_cast<btCollisionShape*>(ObjectMotionState::getShapeManager()->getShape(shapeInfo));
+                btCollisionShape* shape = const_cast<btCollisionShape*>(ObjectMotionState::getShapeManager()->getShape(shapeInfo, true));
                 if (shape) {
                     buildMotionState(shape, entity);
                 } else if (requestCount != ObjectMotionState::getShapeManager()->getWorkRequestCount()) {
@@ -428,14 +431,14 @@ void PhysicalEntitySimulation::buildPhysicsTransaction(PhysicsEngine::Transactio
         bool needsNewShape = object->needsNewShape();
         if (needsNewShape) {
             ShapeType shapeType = object->getShapeType();
-            if (shapeType == SHAPE_TYPE_STATIC_MESH) {
+            if (ShapeFactory::isSlowToBuild(shapeType)) {
                 ShapeRequest shapeRequest(object->_entity);
                 ShapeRequests::iterator  requestItr = _shapeRequests.find(shapeRequest);
                 if (requestItr == _shapeRequests.end()) {
                     ShapeInfo shapeInfo;
                     object->_entity->computeShapeInfo(shapeInfo);
                     uint32_t requestCount = ObjectMotionState::getShapeManager()->getWorkRequestCount();
-                    btCollisionShape* shape = const_cast<btCollisionShape*>(ObjectMotionState::getShapeManager()->getShape(shapeInfo));
+                    btCollisionShape* shape = const_cast<btCollisionShape*>(ObjectMotionState::getShapeManager()->getShape(shapeInfo, true));
                     if (shape) {
                         object->setShape(shape);
                         handledFlags |= Simulation::DIRTY_SHAPE;
@@ -629,6 +632,9 @@ void PhysicalEntitySimulation::sendOwnedUpdates(uint32_t numSubsteps) {
         return;
     }
     PROFILE_RANGE_EX(simulation_physics, "Update", 0x00000000, (uint64_t)_owned.size());
+    uint64_t start = usecTimestampNow();
+
+    // first drop what we no longer own...
     uint32_t i = 0;
     while (i < _owned.size()) {
         if (!_owned[i]->isLocallyOwned()) {
@@ -639,12 +645,41 @@ void PhysicalEntitySimulation::sendOwnedUpdates(uint32_t numSubsteps) {
             }
             _owned.remove(i);
         } else {
-            if (_owned[i]->shouldSendUpdate(numSubsteps)) {
-                _owned[i]->sendUpdate(_entityPacketSender, numSubsteps);
-            }
             ++i;
         }
     }
+
+    // ...then decide which of the rest need an update.  shouldSendUpdate() only touches its own motion state
+    // and entity (we hold the tree's write lock), so with enough owned entities the checks run side by side.
+    const size_t MIN_OWNED_FOR_PARALLEL_CHECK = 128;
+    const size_t CHECK_GRAIN_SIZE = 32;
+    size_t numOwned = _owned.size();
+    _ownedNeedsUpdate.resize(numOwned);
+    auto checkOwned = [&](size_t begin, size_t end) {
+        for (size_t j = begin; j < end; ++j) {
+            _ownedNeedsUpdate[j] = _owned[j]->shouldSendUpdate(numSubsteps) ? 1 : 0;
+        }
+    };
+    if (numOwned < MIN_OWNED_FOR_PARALLEL_CHECK) {
+        checkOwned(0, numOwned);
+    } else {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, numOwned, CHECK_GRAIN_SIZE), [&](const tbb::blocked_range<size_t>& range) {
+            checkOwned(range.begin(), range.end());
+        });
+    }
+    uint64_t now = usecTimestampNow();
+    _physicsEngine->addHarvestStageTime(PhysicsEngine::HARVEST_CHECK_UPDATES, now - start);
+    start = now;
+
+    // finally send the updates together, so they are coalesced into as few packets as possible
+    _outgoingEdits.clear();
+    for (size_t j = 0; j < numOwned; ++j) {
+        if (_ownedNeedsUpdate[j]) {
+            _owned[j]->sendUpdate(_outgoingEdits, numSubsteps);
+        }
+    }
+    _entityPacketSender->queueEditEntityMessages(PacketType::EntityPhysics, getEntityTree(), _outgoingEdits);
+    _physicsEngine->addHarvestStageTime(PhysicsEngine::HARVEST_QUEUE_EDITS, usecTimestampNow() - start);
 }
 
 void PhysicalEntitySimulation::handleCollisionEvents(const CollisionEvents& collisionEvents) {
@@ -124,6 +124,8 @@ private:
 
     VectorOfEntityMotionStates _owned;
     VectorOfEntityMotionStates _bids;
+    std::vector<uint8_t> _ownedNeedsUpdate; // parallel to _owned, filled in by sendOwnedUpdates()
+    std::vector<EntityEditPacketSender::EntityEdit> _outgoingEdits;
     SetOfEntities _deadAvatarEntities; // to remove from Avatar's lists
     std::vector<EntityItemPointer> _entitiesToDeleteLater;
 
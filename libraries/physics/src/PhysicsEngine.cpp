@@ -12,21 +12,39 @@
 #include "PhysicsEngine.h"
 
 #include <functional>
+#include <mutex>
 
 #include <QFile>
 
 #include <PerfStat.h>
 #include <PhysicsCollisionGroups.h>
 #include <Profile.h>
+#include <SharedUtil.h>
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
 #include <BulletCollision/CollisionShapes/btTriangleShape.h>
 
 #include "CharacterController.h"
 #include "ObjectMotionState.h"
 #include "PhysicsHelpers.h"
 #include "PhysicsDebugDraw.h"
+#include "PhysicsTaskScheduler.h"
 #include "ThreadSafeDynamicsWorld.h"
 #include "PhysicsLogging.h"
 
+int PhysicsEngine::_numSimulationThreads { 1 };
+
+// with a multithreaded narrowphase new contact points are created on several threads at once,
+// so the contact added callback is serialized through this wrapper
+static std::mutex contactAddedCallbackMutex;
+static PhysicsEngine::ContactAddedCallback contactAddedCallback { nullptr };
+
+static bool serializedContactAddedCallback(btManifoldPoint& cp,
+        const btCollisionObjectWrapper* colObj0Wrap, int partId0, int index0,
+        const btCollisionObjectWrapper* colObj1Wrap, int partId1, int index1) {
+    std::lock_guard<std::mutex> lock(contactAddedCallbackMutex);
+    return contactAddedCallback && contactAddedCallback(cp, colObj0Wrap, partId0, index0, colObj1Wrap, partId1, index1);
+}
+
 PhysicsEngine::PhysicsEngine(const glm::vec3& offset) :
         _originOffset(offset),
         _myAvatarController(nullptr) {
@@ -44,10 +62,24 @@ PhysicsEngine::~PhysicsEngine() {
 
 void PhysicsEngine::init() {
     if (!_dynamicsWorld) {
+        auto taskScheduler = PhysicsTaskScheduler::getInstance();
+        taskScheduler->setNumThreads(_numSimulationThreads);
+        btSetTaskScheduler(taskScheduler);
+        int numThreads = taskScheduler->getNumThreads();
+        if (numThreads > 1) {
+            qCDebug(physics) << "Simulating physics on" << numThreads << "threads";
+        }
+
         _collisionConfig = new btDefaultCollisionConfiguration();
-        _collisionDispatcher = new btCollisionDispatcher(_collisionConfig);
+        if (numThreads > 1) {
+            _collisionDispatcher = new btCollisionDispatcherMt(_collisionConfig);
+        } else {
+            _collisionDispatcher = new btCollisionDispatcher(_collisionConfig);
+        }
         _broadphaseFilter = new btDbvtBroadphase();
-        _constraintSolver = new btSequentialImpulseConstraintSolver;
+        // one solver per thread, so that islands can be solved side by side.  With one thread the islands are solved
+        // in turn on this thread, in batches like btDiscreteDynamicsWorld's, and no constraint spans two islands
+        _constraintSolver = new btConstraintSolverPoolMt(numThreads);
         _dynamicsWorld = new ThreadSafeDynamicsWorld(_collisionDispatcher, _broadphaseFilter, _constraintSolver, _collisionConfig);
         _physicsDebugDraw.reset(new PhysicsDebugDraw());
 
@@ -415,6 +447,15 @@ void PhysicsEngine::harvestPerformanceStats() {
             itr->Next();
         }
     }
+
+    static const std::array<QString, NUM_HARVEST_STAGES> HARVEST_STAGE_NAMES {{
+        "physics/harvest/motionStates",
+        "physics/harvest/checkUpdates",
+        "physics/harvest/queueEdits"
+    }};
+    for (int i = 0; i < NUM_HARVEST_STAGES; ++i) {
+        PerformanceTimer::addTimerRecord(HARVEST_STAGE_NAMES[i], _harvestStageTimes[i]);
+    }
 }
 
 void PhysicsEngine::printPerformanceStatsToFile(const QString& filename) {
@@ -606,6 +647,10 @@ const CollisionEvents& PhysicsEngine::getCollisionEvents() {
 const VectorOfMotionStates& PhysicsEngine::getChangedMotionStates() {
     BT_PROFILE("copyOutgoingChanges");
 
+    // a new harvest begins
+    _harvestStageTimes.fill(0);
+    uint64_t start = usecTimestampNow();
+
     _dynamicsWorld->synchronizeMotionStates();
 
     // Bullet will not deactivate static objects (it doesn't expect them to be active)
@@ -622,6 +667,7 @@ const VectorOfMotionStates& PhysicsEngine::getChangedMotionStates() {
     }
     _activeStaticBodies.clear();
 
+    addHarvestStageTime(HARVEST_MOTION_STATES, usecTimestampNow() - start);
     _hasOutgoingChanges = false;
     return _dynamicsWorld->getChangedMotionStates();
 }
@@ -823,7 +869,13 @@ void PhysicsEngine::setContactAddedCallback(PhysicsEngine::ContactAddedCallback
     // gContactAddedCallback is a special feature hook in Bullet
     // if non-null AND one of the colliding objects has btCollisionObject::CF_CUSTOM_MATERIAL_CALLBACK flag set
     // then it is called whenever a new candidate contact point is created
-    gContactAddedCallback = newCb;
+    if (_numSimulationThreads > 1 && newCb) {
+        std::lock_guard<std::mutex> lock(contactAddedCallbackMutex);
+        contactAddedCallback = newCb;
+        gContactAddedCallback = serializedContactAddedCallback;
+    } else {
+        gContactAddedCallback = newCb;
+    }
 }
 
 struct AllContactsCallback : public btCollisionWorld::ContactResultCallback {
@@ -13,6 +13,7 @@
 #define hifi_PhysicsEngine_h
 
 #include <stdint.h>
+#include <array>
 #include <set>
 #include <vector>
 
@@ -96,6 +97,11 @@ public:
     ~PhysicsEngine();
     void init();
 
+    // The number of threads the world may use for narrowphase collision detection and per-island constraint
+    // solving. Takes effect in init(), 1 (the default) keeps the whole step on the physics thread.
+    static void setNumSimulationThreads(int numThreads) { _numSimulationThreads = numThreads; }
+    static int getNumSimulationThreads() { return _numSimulationThreads; }
+
     uint32_t getNumSubsteps() const;
     int32_t getNumCollisionObjects() const;
 
@@ -110,6 +116,15 @@ public:
 
     void stepSimulation();
     void harvestPerformanceStats();
+
+    // the bookkeeping that follows each step, timed per stage and reported by harvestPerformanceStats()
+    enum HarvestStage {
+        HARVEST_MOTION_STATES = 0,
+        HARVEST_CHECK_UPDATES,
+        HARVEST_QUEUE_EDITS,
+        NUM_HARVEST_STAGES
+    };
+    void addHarvestStageTime(HarvestStage stage, uint64_t usecs) { _harvestStageTimes[stage] += usecs; }
     void printPerformanceStatsToFile(const QString& filename);
     void updateContactMap();
     void doOwnershipInfectionForConstraints();
@@ -172,7 +187,7 @@ private:
     btDefaultCollisionConfiguration* _collisionConfig = NULL;
     btCollisionDispatcher* _collisionDispatcher = NULL;
     btBroadphaseInterface* _broadphaseFilter = NULL;
-    btSequentialImpulseConstraintSolver* _constraintSolver = NULL;
+    btConstraintSolverPoolMt* _constraintSolver = NULL;
     ThreadSafeDynamicsWorld* _dynamicsWorld = NULL;
     btGhostPairCallback* _ghostPairCallback = NULL;
     std::unique_ptr<PhysicsDebugDraw> _physicsDebugDraw;
@@ -194,6 +209,9 @@ private:
     bool _saveNextStats { false };
     bool _hasOutgoingChanges { false };
 
+    std::array<uint64_t, NUM_HARVEST_STAGES> _harvestStageTimes {{ 0, 0, 0 }};
+
+    static int _numSimulationThreads;
 };
 
 typedef std::shared_ptr<PhysicsEngine> PhysicsEnginePointer;
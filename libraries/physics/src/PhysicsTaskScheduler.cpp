@@ -0,0 +1,81 @@
+//
+//  PhysicsTaskScheduler.cpp
+//  libraries/physics/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PhysicsTaskScheduler.h"
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/task_arena.h>
+
+PhysicsTaskScheduler* PhysicsTaskScheduler::getInstance() {
+    static PhysicsTaskScheduler instance;
+    return &instance;
+}
+
+PhysicsTaskScheduler::PhysicsTaskScheduler() : btITaskScheduler("TBB") {
+}
+
+PhysicsTaskScheduler::~PhysicsTaskScheduler() {
+}
+
+int PhysicsTaskScheduler::getMaxNumThreads() const {
+#if !BT_THREADSAFE
+    // a bullet built without BULLET2_MULTITHREADING runs every parallel loop inline, whatever the scheduler offers
+    return 1;
+#else
+    return std::max(1, std::min((int)std::thread::hardware_concurrency(), (int)BT_MAX_THREAD_COUNT));
+#endif
+}
+
+void PhysicsTaskScheduler::setNumThreads(int numThreads) {
+    numThreads = std::max(1, std::min(numThreads, getMaxNumThreads()));
+    if (numThreads != _numThreads) {
+        _numThreads = numThreads;
+        // the arena caps how many of the shared TBB workers physics may occupy at once
+        _arena.reset(_numThreads > 1 ? new tbb::task_arena(_numThreads) : nullptr);
+    }
+}
+
+void PhysicsTaskScheduler::parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody& body) {
+    if (!_arena || iEnd - iBegin <= grainSize) {
+        body.forLoop(iBegin, iEnd);
+        return;
+    }
+
+    btPushThreadsAreRunning();
+    _arena->execute([&] {
+        tbb::parallel_for(tbb::blocked_range<int>(iBegin, iEnd, grainSize), [&](const tbb::blocked_range<int>& range) {
+            body.forLoop(range.begin(), range.end());
+        });
+    });
+    btPopThreadsAreRunning();
+}
+
+btScalar PhysicsTaskScheduler::parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody& body) {
+    if (!_arena || iEnd - iBegin <= grainSize) {
+        return body.sumLoop(iBegin, iEnd);
+    }
+
+    btScalar sum = btScalar(0);
+    btPushThreadsAreRunning();
+    _arena->execute([&] {
+        sum = tbb::parallel_reduce(tbb::blocked_range<int>(iBegin, iEnd, grainSize), btScalar(0),
+            [&](const tbb::blocked_range<int>& range, btScalar partialSum) {
+                return partialSum + body.sumLoop(range.begin(), range.end());
+            }, std::plus<btScalar>());
+    });
+    btPopThreadsAreRunning();
+    return sum;
+}
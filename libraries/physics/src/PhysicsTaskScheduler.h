@@ -0,0 +1,43 @@
+//
+//  PhysicsTaskScheduler.h
+//  libraries/physics/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PhysicsTaskScheduler_h
+#define hifi_PhysicsTaskScheduler_h
+
+#include <memory>
+
+#include <LinearMath/btThreads.h>
+
+namespace tbb {
+    class task_arena;
+}
+
+// Runs Bullet's parallel loops (narrowphase pairs, per-island solving, integration) on the TBB worker threads
+// that the rest of the application already shares, instead of letting Bullet start a thread pool of its own.
+// With a single thread every loop runs inline on the calling thread.
+class PhysicsTaskScheduler : public btITaskScheduler {
+public:
+    static PhysicsTaskScheduler* getInstance();
+
+    PhysicsTaskScheduler();
+    ~PhysicsTaskScheduler();
+
+    int getMaxNumThreads() const override;
+    int getNumThreads() const override { return _numThreads; }
+    void setNumThreads(int numThreads) override;
+    void parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody& body) override;
+    btScalar parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody& body) override;
+
+private:
+    int _numThreads { 1 };
+    std::unique_ptr<tbb::task_arena> _arena;
+};
+
+#endif // hifi_PhysicsTaskScheduler_h
@@ -0,0 +1,171 @@
+//
+//  ShapeCache.cpp
+//  libraries/physics/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ShapeCache.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDataStream>
+#include <QtCore/QFile>
+
+#include <SettingHandle.h>
+
+#include "ShapeFactory.h"
+
+const int ShapeCache::CURRENT_VERSION = 0x01;
+const int ShapeCache::INVALID_VERSION = 0x00;
+const char* ShapeCache::SETTING_VERSION_NAME = "hifi.shape.cache_version";
+
+static const std::string SHAPE_CACHE_EXTENSION { "shape" };
+static const quint32 SHAPE_FILE_MAGIC = 0x48465348; // "HFSH"
+
+enum SerializedShapeType : quint8 {
+    SERIALIZED_HULL = 0,
+    SERIALIZED_COMPOUND
+};
+
+static QByteArray computeFingerprint(const ShapeInfo& info) {
+    QCryptographicHash hasher(QCryptographicHash::Md5);
+    for (auto& points : info.getPointCollection()) {
+        hasher.addData(reinterpret_cast<const char*>(points.data()), (int)(points.size() * sizeof(glm::vec3)));
+    }
+    auto& indices = info.getTriangleIndices();
+    hasher.addData(reinterpret_cast<const char*>(indices.data()), (int)(indices.size() * sizeof(int32_t)));
+    return hasher.result();
+}
+
+// the fingerprint is part of the key, so an entry built from stale points is simply never found again
+// and ages out of the cache like any other unused file
+static cache::FileCache::Key getKey(const ShapeInfo& info) {
+    return (QString::number(info.getHash(), 16) + "_" + computeFingerprint(info).toHex()).toStdString();
+}
+
+static bool writeShape(QDataStream& stream, const btCollisionShape* shape) {
+    if (shape->getShapeType() == (int)CONVEX_HULL_SHAPE_PROXYTYPE) {
+        auto hull = static_cast<const btConvexHullShape*>(shape);
+        int numPoints = hull->getNumPoints();
+        stream << (quint8)SERIALIZED_HULL << (float)hull->getMargin() << (qint32)numPoints;
+        const btVector3* points = hull->getUnscaledPoints();
+        for (int i = 0; i < numPoints; ++i) {
+            stream << (float)points[i].getX() << (float)points[i].getY() << (float)points[i].getZ();
+        }
+        return true;
+    } else if (shape->getShapeType() == (int)COMPOUND_SHAPE_PROXYTYPE) {
+        auto compound = static_cast<const btCompoundShape*>(shape);
+        int numChildren = compound->getNumChildShapes();
+        stream << (quint8)SERIALIZED_COMPOUND << (qint32)numChildren;
+        for (int i = 0; i < numChildren; ++i) {
+            const btTransform& transform = compound->getChildTransform(i);
+            btQuaternion rotation = transform.getRotation();
+            stream << (float)transform.getOrigin().getX() << (float)transform.getOrigin().getY()
+                << (float)transform.getOrigin().getZ();
+            stream << (float)rotation.getX() << (float)rotation.getY() << (float)rotation.getZ() << (float)rotation.getW();
+            if (!writeShape(stream, compound->getChildShape(i))) {
+                return false;
+            }
+        }
+        return true;
+    }
+    // not a shape type we know how to restore
+    return false;
+}
+
+static btCollisionShape* readShape(QDataStream& stream) {
+    quint8 type;
+    stream >> type;
+    if (type == SERIALIZED_HULL) {
+        float margin;
+        qint32 numPoints;
+        stream >> margin >> numPoints;
+        if (stream.status() != QDataStream::Ok || numPoints <= 0) {
+            return nullptr;
+        }
+        auto hull = new btConvexHullShape();
+        for (qint32 i = 0; i < numPoints; ++i) {
+            float x, y, z;
+            stream >> x >> y >> z;
+            hull->addPoint(btVector3(x, y, z), false);
+        }
+        hull->setMargin(margin);
+        hull->recalcLocalAabb();
+        return hull;
+    } else if (type == SERIALIZED_COMPOUND) {
+        qint32 numChildren;
+        stream >> numChildren;
+        if (stream.status() != QDataStream::Ok || numChildren < 0) {
+            return nullptr;
+        }
+        auto compound = new btCompoundShape();
+        for (qint32 i = 0; i < numChildren; ++i) {
+            float x, y, z, qx, qy, qz, qw;
+            stream >> x >> y >> z >> qx >> qy >> qz >> qw;
+            btCollisionShape* child = readShape(stream);
+            if (!child) {
+                ShapeFactory::deleteShape(compound);
+                return nullptr;
+            }
+            compound->addChildShape(btTransform(btQuaternion(qx, qy, qz, qw), btVector3(x, y, z)), child);
+        }
+        return compound;
+    }
+    return nullptr;
+}
+
+ShapeCache::ShapeCache(const std::string& dir) :
+    FileCache(dir, SHAPE_CACHE_EXTENSION) { }
+
+void ShapeCache::initialize() {
+    FileCache::initialize();
+    Setting::Handle<int> cacheVersionHandle(SETTING_VERSION_NAME, INVALID_VERSION);
+    auto cacheVersion = cacheVersionHandle.get();
+    if (cacheVersion != CURRENT_VERSION) {
+        wipe();
+        cacheVersionHandle.set(CURRENT_VERSION);
+    }
+}
+
+const btCollisionShape* ShapeCache::loadShape(const ShapeInfo& info) {
+    auto file = getFile(getKey(info));
+    if (!file) {
+        return nullptr;
+    }
+
+    QFile shapeFile(QString::fromStdString(file->getFilepath()));
+    if (!shapeFile.open(QIODevice::ReadOnly)) {
+        return nullptr;
+    }
+    QDataStream stream(&shapeFile);
+    stream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+
+    quint32 magic;
+    qint32 version;
+    quint64 hash;
+    stream >> magic >> version >> hash;
+    if (stream.status() != QDataStream::Ok || magic != SHAPE_FILE_MAGIC || version != CURRENT_VERSION ||
+            hash != info.getHash()) {
+        return nullptr;
+    }
+
+    btCollisionShape* shape = readShape(stream);
+    if (shape && stream.status() != QDataStream::Ok) {
+        ShapeFactory::deleteShape(shape);
+        shape = nullptr;
+    }
+    return shape;
+}
+
+void ShapeCache::saveShape(const ShapeInfo& info, const btCollisionShape* shape) {
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+    stream << SHAPE_FILE_MAGIC << (qint32)CURRENT_VERSION << (quint64)info.getHash();
+    if (writeShape(stream, shape)) {
+        writeFile(data.constData(), Metadata(getKey(info), (size_t)data.size()));
+    }
+}
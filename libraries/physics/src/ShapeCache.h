@@ -0,0 +1,48 @@
+//
+//  ShapeCache.h
+//  libraries/physics/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ShapeCache_h
+#define hifi_ShapeCache_h
+
+#include <btBulletDynamicsCommon.h>
+
+#include <shared/FileCache.h>
+#include <ShapeInfo.h>
+
+// A persistent cache of built collision shapes, keyed by ShapeInfo hash.
+//
+// Only the hull based shapes of models (COMPOUND and SIMPLE_COMPOUND) are stored, since those are the ones
+// that are expensive to build.  Entries are also keyed by a fingerprint of the points they were built from,
+// because the hash of those shape types only covers the model URL and dimensions: if the model changes behind
+// the same URL the stale entry is not found and the shape is rebuilt.
+class ShapeCache : public cache::FileCache {
+    Q_OBJECT
+
+public:
+    // Whenever a change is made to the serialized format, or to how ShapeFactory builds cached shape types,
+    // this value should be incremented.  This will force the shape cache to be wiped
+    static const int CURRENT_VERSION;
+    static const int INVALID_VERSION;
+    static const char* SETTING_VERSION_NAME;
+
+    static bool canCache(ShapeType type) { return type == SHAPE_TYPE_COMPOUND || type == SHAPE_TYPE_SIMPLE_COMPOUND; }
+
+    ShapeCache(const std::string& dir);
+
+    void initialize() override;
+
+    // returns a new shape restored from the cache, or nullptr if there is no valid entry for info
+    const btCollisionShape* loadShape(const ShapeInfo& info);
+    void saveShape(const ShapeInfo& info, const btCollisionShape* shape);
+};
+
+using ShapeCachePointer = std::shared_ptr<ShapeCache>;
+
+#endif // hifi_ShapeCache_h
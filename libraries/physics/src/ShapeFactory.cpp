@@ -16,6 +16,7 @@
 #include <SharedUtil.h> // for MILLIMETERS_PER_METER
 
 #include "BulletUtil.h"
+#include "ShapeCache.h"
 
 
 class StaticMeshShape : public btBvhTriangleMeshShape {
@@ -488,7 +489,25 @@ void ShapeFactory::deleteShape(const btCollisionShape* shape) {
     delete nonConstShape;
 }
 
+bool ShapeFactory::isSlowToBuild(ShapeType type) {
+    return type == SHAPE_TYPE_STATIC_MESH || type == SHAPE_TYPE_COMPOUND || type == SHAPE_TYPE_SIMPLE_COMPOUND;
+}
+
+void ShapeFactory::Worker::build() {
+    uint64_t start = usecTimestampNow();
+    bool useCache = shapeCache && ShapeCache::canCache(shapeInfo.getType());
+    shape = useCache ? shapeCache->loadShape(shapeInfo) : nullptr;
+    loadedFromCache = (shape != nullptr);
+    if (!shape) {
+        shape = ShapeFactory::createShapeFromInfo(shapeInfo);
+        if (shape && useCache) {
+            shapeCache->saveShape(shapeInfo, shape);
+        }
+    }
+    buildTime = usecTimestampNow() - start;
+}
+
 void ShapeFactory::Worker::run() {
-    shape = ShapeFactory::createShapeFromInfo(shapeInfo);
+    build();
     emit submitWork(this);
 }
@@ -12,6 +12,8 @@
 #ifndef hifi_ShapeFactory_h
 #define hifi_ShapeFactory_h
 
+#include <memory>
+
 #include <btBulletDynamicsCommon.h>
 #include <glm/glm.hpp>
 #include <QObject>
@@ -19,19 +21,31 @@
 
 #include <ShapeInfo.h>
 
+class ShapeCache;
+
 // The ShapeFactory assembles and correctly disassembles btCollisionShapes.
 
 namespace ShapeFactory {
     const btCollisionShape* createShapeFromInfo(const ShapeInfo& info);
     void deleteShape(const btCollisionShape* shape);
 
+    // shapes that involve hull reduction or copying whole triangle meshes, which ShapeManager builds off-thread
+    bool isSlowToBuild(ShapeType type);
+
     class Worker : public QObject, public QRunnable {
         Q_OBJECT
     public:
         Worker(const ShapeInfo& info) : shapeInfo(info), shape(nullptr) {}
         void run() override;
+
+        // restores the shape from shapeCache when possible, else creates it (and stores it there)
+        void build();
+
         ShapeInfo shapeInfo;
+        std::shared_ptr<ShapeCache> shapeCache;
         const btCollisionShape* shape;
+        uint64_t buildTime { 0 }; // usecs
+        bool loadedFromCache { false };
     signals:
         void submitWork(Worker*);
     };
@@ -12,18 +12,26 @@
 #include "ShapeManager.h"
 
 #include <glm/gtx/norm.hpp>
+#include <QThread>
 #include <QThreadPool>
 
 #include <NumericalConstants.h>
 
+#include "PhysicsLogging.h"
+
 const int MAX_RING_SIZE = 256;
+const size_t MAX_SHAPE_CACHE_SIZE = MB_TO_BYTES(512);
 
 ShapeManager::ShapeManager() {
     _garbageRing.reserve(MAX_RING_SIZE);
     _nextOrphanExpiry = std::chrono::steady_clock::now();
+
+    // leave room for the threads that are already busy loading the same content
+    _workerPool.setMaxThreadCount(std::max(1, QThread::idealThreadCount() / 2));
 }
 
 ShapeManager::~ShapeManager() {
+    _workerPool.waitForDone();
     int numShapes = _shapeMap.size();
     for (int i = 0; i < numShapes; ++i) {
         ShapeReference* shapeRef = _shapeMap.getAtIndex(i);
@@ -36,7 +44,15 @@ ShapeManager::~ShapeManager() {
     }
 }
 
-const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
+void ShapeManager::enableShapeCache(const std::string& dirname) {
+    if (!_shapeCache) {
+        _shapeCache = std::make_shared<ShapeCache>(dirname);
+        _shapeCache->setMaxSize(MAX_SHAPE_CACHE_SIZE);
+        _shapeCache->initialize();
+    }
+}
+
+const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info, bool allowAsync) {
     if (info.getType() == SHAPE_TYPE_NONE) {
         return nullptr;
     }
@@ -47,17 +63,18 @@ const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
         return shapeRef->shape;
     }
     const btCollisionShape* shape = nullptr;
-    if (info.getType() == SHAPE_TYPE_STATIC_MESH) {
+    bool isSlow = ShapeFactory::isSlowToBuild(info.getType());
+    if (info.getType() == SHAPE_TYPE_STATIC_MESH || (isSlow && allowAsync)) {
         uint64_t hash = info.getHash();
 
         // bump the request count to the caller knows we're 
         // starting or waiting on a thread.
         ++_workRequestCount;
 
-        const auto itr = std::find(_pendingMeshShapes.begin(), _pendingMeshShapes.end(), hash);
-        if (itr == _pendingMeshShapes.end()) {
+        const auto itr = std::find(_pendingShapes.begin(), _pendingShapes.end(), hash);
+        if (itr == _pendingShapes.end()) {
             // start a worker
-            _pendingMeshShapes.push_back(hash);
+            _pendingShapes.push_back(hash);
             // try to recycle old deadWorker
             ShapeFactory::Worker* worker = _deadWorker;
             if (!worker) {
@@ -66,14 +83,23 @@ const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
                 worker->shapeInfo = info;
                 _deadWorker = nullptr;
             }
+            worker->shapeCache = _shapeCache;
             // we will delete worker manually later
             worker->setAutoDelete(false);
             QObject::connect(worker, &ShapeFactory::Worker::submitWork, this, &ShapeManager::acceptWork);
-            QThreadPool::globalInstance()->start(worker);
+            _workerPool.start(worker);
         }
         // else we're still waiting for the shape to be created on another thread
     } else {
-        shape = ShapeFactory::createShapeFromInfo(info);
+        if (isSlow) {
+            ShapeFactory::Worker worker(info);
+            worker.shapeCache = _shapeCache;
+            worker.build();
+            recordBuild(worker);
+            shape = worker.shape;
+        } else {
+            shape = ShapeFactory::createShapeFromInfo(info);
+        }
         if (shape) {
             ShapeReference newRef;
             newRef.refCount = 1;
@@ -208,8 +234,10 @@ bool ShapeManager::hasShape(const btCollisionShape* shape) const {
 
 // slot: called when ShapeFactory::Worker is done building shape
 void ShapeManager::acceptWork(ShapeFactory::Worker* worker) {
-    auto itr = std::find(_pendingMeshShapes.begin(), _pendingMeshShapes.end(), worker->shapeInfo.getHash());
-    if (itr == _pendingMeshShapes.end()) {
+    recordBuild(*worker);
+
+    auto itr = std::find(_pendingShapes.begin(), _pendingShapes.end(), worker->shapeInfo.getHash());
+    if (itr == _pendingShapes.end()) {
         // we've received a shape but don't remember asking for it
         // (should not fall in here, but if we do: delete the unwanted shape)
         if (worker->shape) {
@@ -217,8 +245,8 @@ void ShapeManager::acceptWork(ShapeFactory::Worker* worker) {
         }
     } else {
         // clear pending status
-        *itr = _pendingMeshShapes.back();
-        _pendingMeshShapes.pop_back();
+        *itr = _pendingShapes.back();
+        _pendingShapes.pop_back();
 
         // cache the new shape
         if (worker->shape) {
@@ -277,6 +305,28 @@ void ShapeManager::acceptWork(ShapeFactory::Worker* worker) {
     // save this dead worker for later
     worker->shapeInfo.clear();
     worker->shape = nullptr;
+    worker->shapeCache.reset();
     _deadWorker = worker;
     ++_workDeliveryCount;
+
+    if (_pendingShapes.empty() && _batchShapesBuilt > 0) {
+        // a wave of off-thread work (typically a domain or model load) has drained
+        qCDebug(physics) << "ShapeManager built" << _batchShapesBuilt << "shapes in"
+            << (float)_batchBuildTime / (float)USECS_PER_MSEC << "msecs of worker time,"
+            << _batchShapeCacheHits << "restored from the shape cache";
+        _batchShapesBuilt = 0;
+        _batchShapeCacheHits = 0;
+        _batchBuildTime = 0;
+    }
+}
+
+void ShapeManager::recordBuild(const ShapeFactory::Worker& worker) {
+    ++_numShapesBuilt;
+    ++_batchShapesBuilt;
+    _totalBuildTime += worker.buildTime;
+    _batchBuildTime += worker.buildTime;
+    if (worker.loadedFromCache) {
+        ++_numShapeCacheHits;
+        ++_batchShapeCacheHits;
+    }
 }
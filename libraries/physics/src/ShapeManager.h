@@ -17,11 +17,13 @@
 #include <vector>
 
 #include <QObject>
+#include <QThreadPool>
 #include <btBulletDynamicsCommon.h>
 #include <LinearMath/btHashMap.h>
 
 #include <ShapeInfo.h>
 
+#include "ShapeCache.h"
 #include "ShapeFactory.h"
 #include "HashKey.h"
 
@@ -46,6 +48,12 @@
 // doesn't delete it right away.  Instead it puts the shape's key on a list delete
 // later.  When that list grows big enough the ShapeManager will remove any matching
 // entries that still have zero ref-count.
+//
+// Shapes that are slow to build (see ShapeFactory::isSlowToBuild()) may be built on the
+// ShapeManager's worker pool instead: getShape() then returns nullptr and bumps the work
+// request count, and the shape shows up in the map once the work delivery count changes.
+// When a shape cache is enabled the hull based shapes of models are also saved to disk,
+// so they can be restored instead of rebuilt the next time they are needed.
 
 
 class ShapeManager : public QObject {
@@ -55,8 +63,12 @@ public:
     ShapeManager();
     ~ShapeManager();
 
-    /// \return pointer to shape
-    const btCollisionShape* getShape(const ShapeInfo& info);
+    /// enable the persistent shape cache in dirname (relative to the application local data, or a full path)
+    void enableShapeCache(const std::string& dirname);
+
+    /// \return pointer to shape, or nullptr if the shape could not be built or is being built on a worker thread
+    /// (which always happens for static meshes, and for other slow shapes when allowAsync is true)
+    const btCollisionShape* getShape(const ShapeInfo& info, bool allowAsync = false);
     const btCollisionShape* getShapeByKey(uint64_t key);
     bool hasShapeWithKey(uint64_t key) const;
 
@@ -74,12 +86,18 @@ public:
     uint32_t getWorkRequestCount() const { return _workRequestCount; }
     uint32_t getWorkDeliveryCount() const { return _workDeliveryCount; }
 
+    // build statistics for the slow shapes
+    uint32_t getNumShapesBuilt() const { return _numShapesBuilt; }
+    uint32_t getNumShapeCacheHits() const { return _numShapeCacheHits; }
+    uint64_t getTotalBuildTime() const { return _totalBuildTime; } // usecs
+
 protected slots:
     void acceptWork(ShapeFactory::Worker* worker);
 
 private:
     void addToGarbage(uint64_t key);
     bool releaseShapeByKey(uint64_t key);
+    void recordBuild(const ShapeFactory::Worker& worker);
 
     class ShapeReference {
     public:
@@ -100,13 +118,22 @@ private:
     // btHashMap is required because it supports memory alignment of the btCollisionShapes
     btHashMap<HashKey, ShapeReference> _shapeMap;
     std::vector<uint64_t> _garbageRing;
-    std::vector<uint64_t> _pendingMeshShapes;
+    std::vector<uint64_t> _pendingShapes;
     std::vector<KeyExpiry> _orphans;
     ShapeFactory::Worker* _deadWorker { nullptr };
     TimePoint _nextOrphanExpiry;
     uint32_t _ringIndex { 0 };
     std::atomic_uint _workRequestCount { 0 };
     std::atomic_uint _workDeliveryCount { 0 };
+
+    QThreadPool _workerPool;
+    ShapeCachePointer _shapeCache;
+    uint32_t _numShapesBuilt { 0 };
+    uint32_t _numShapeCacheHits { 0 };
+    uint64_t _totalBuildTime { 0 };
+    uint32_t _batchShapesBuilt { 0 };
+    uint32_t _batchShapeCacheHits { 0 };
+    uint64_t _batchBuildTime { 0 };
 };
 
 #endif // hifi_ShapeManager_h
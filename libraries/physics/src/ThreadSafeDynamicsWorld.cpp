@@ -24,9 +24,9 @@
 ThreadSafeDynamicsWorld::ThreadSafeDynamicsWorld(
         btDispatcher* dispatcher,
         btBroadphaseInterface* pairCache,
-        btConstraintSolver* constraintSolver,
+        btConstraintSolverPoolMt* constraintSolverPool,
         btCollisionConfiguration* collisionConfiguration)
-    :   btDiscreteDynamicsWorld(dispatcher, pairCache, constraintSolver, collisionConfiguration) {
+    :   btDiscreteDynamicsWorldMt(dispatcher, pairCache, constraintSolverPool, nullptr, collisionConfiguration) {
 }
 
 int ThreadSafeDynamicsWorld::stepSimulationWithSubstepCallback(btScalar timeStep, int maxSubSteps,
@@ -97,6 +97,21 @@ void ThreadSafeDynamicsWorld::synchronizeMotionState(btRigidBody* body) {
     btAssert(body);
     btAssert(body->getMotionState());
 
+    btTransform interpolatedTransform;
+    if (!body->isKinematicObject()) {
+        computeInterpolatedTransform(body, interpolatedTransform);
+    }
+    applyInterpolatedTransform(body, interpolatedTransform);
+}
+
+void ThreadSafeDynamicsWorld::computeInterpolatedTransform(const btRigidBody* body, btTransform& interpolatedTransform) const {
+    btTransformUtil::integrateTransform(body->getInterpolationWorldTransform(),
+        body->getInterpolationLinearVelocity(),body->getInterpolationAngularVelocity(),
+        (m_latencyMotionStateInterpolation && m_fixedTimeStep) ? m_localTime - m_fixedTimeStep : m_localTime*body->getHitFraction(),
+        interpolatedTransform);
+}
+
+void ThreadSafeDynamicsWorld::applyInterpolatedTransform(btRigidBody* body, const btTransform& interpolatedTransform) {
     if (body->isKinematicObject()) {
         ObjectMotionState* objectMotionState = static_cast<ObjectMotionState*>(body->getMotionState());
         if (objectMotionState->hasInternalKinematicChanges()) {
@@ -109,14 +124,39 @@ void ThreadSafeDynamicsWorld::synchronizeMotionState(btRigidBody* body) {
         }
         return;
     }
-    btTransform interpolatedTransform;
-    btTransformUtil::integrateTransform(body->getInterpolationWorldTransform(),
-        body->getInterpolationLinearVelocity(),body->getInterpolationAngularVelocity(),
-        (m_latencyMotionStateInterpolation && m_fixedTimeStep) ? m_localTime - m_fixedTimeStep : m_localTime*body->getHitFraction(),
-        interpolatedTransform);
     body->getMotionState()->setWorldTransform(interpolatedTransform);
 }
 
+namespace {
+    class InterpolateTransformsLoop : public btIParallelForBody {
+    public:
+        InterpolateTransformsLoop(std::function<void(int, int)> loop) : _loop(loop) {}
+        void forLoop(int iBegin, int iEnd) const override { _loop(iBegin, iEnd); }
+    private:
+        std::function<void(int, int)> _loop;
+    };
+}
+
+void ThreadSafeDynamicsWorld::harvestActiveTransforms() {
+    // the integration only reads the bodies so it can be spread over the task scheduler,
+    // whereas the motion states write into entities and avatars and are updated in order on this thread
+    const int INTERPOLATION_GRAIN_SIZE = 64;
+    int numBodies = _harvestedBodies.size();
+    _harvestedTransforms.resizeNoInitialize(numBodies);
+    InterpolateTransformsLoop interpolateTransforms([this](int iBegin, int iEnd) {
+        for (int i = iBegin; i < iEnd; ++i) {
+            if (!_harvestedBodies[i]->isKinematicObject()) {
+                computeInterpolatedTransform(_harvestedBodies[i], _harvestedTransforms[i]);
+            }
+        }
+    });
+    btParallelFor(0, numBodies, INTERPOLATION_GRAIN_SIZE, interpolateTransforms);
+
+    for (int i = 0; i < numBodies; ++i) {
+        applyInterpolatedTransform(_harvestedBodies[i], _harvestedTransforms[i]);
+    }
+}
+
 void ThreadSafeDynamicsWorld::synchronizeMotionStates() {
     PROFILE_RANGE(simulation_physics, "SyncMotionStates");
     BT_PROFILE("syncMotionStates");
@@ -140,12 +180,13 @@ void ThreadSafeDynamicsWorld::synchronizeMotionStates() {
         // that remembers a list of objects deactivated last step
         _activeStates.clear();
         _deactivatedStates.clear();
+        _harvestedBodies.resize(0);
         for (int i=0;i<m_nonStaticRigidBodies.size();i++) {
             btRigidBody* body = m_nonStaticRigidBodies[i];
             ObjectMotionState* motionState = static_cast<ObjectMotionState*>(body->getMotionState());
             if (motionState) {
                 if (body->isActive()) {
-                    synchronizeMotionState(body);
+                    _harvestedBodies.push_back(body);
                     _changedMotionStates.push_back(motionState);
                     _activeStates.insert(motionState);
                 } else if (_lastActiveStates.find(motionState) != _lastActiveStates.end()) {
@@ -154,6 +195,7 @@ void ThreadSafeDynamicsWorld::synchronizeMotionStates() {
                 }
             }
         }
+        harvestActiveTransforms();
     }
     _activeStates.swap(_lastActiveStates);
 }
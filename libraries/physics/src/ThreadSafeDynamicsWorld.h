@@ -19,7 +19,7 @@
 #define hifi_ThreadSafeDynamicsWorld_h
 
 #include <BulletDynamics/Dynamics/btRigidBody.h>
-#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorld.h>
+#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
 
 #include "ObjectMotionState.h"
 
@@ -27,14 +27,18 @@
 
 using SubStepCallback = std::function<void()>;
 
-ATTRIBUTE_ALIGNED16(class) ThreadSafeDynamicsWorld : public btDiscreteDynamicsWorld {
+// Built on Bullet's multithreaded world: the islands found each substep are solved in parallel by the pooled
+// solvers, and a btCollisionDispatcherMt runs the narrowphase in parallel, using whatever task scheduler is set
+// with btSetTaskScheduler(). Everything that touches ObjectMotionStates (kinematic state, motion state
+// synchronization, the substep callback) still runs on the calling thread, between the parallel stages.
+ATTRIBUTE_ALIGNED16(class) ThreadSafeDynamicsWorld : public btDiscreteDynamicsWorldMt {
 public:
     BT_DECLARE_ALIGNED_ALLOCATOR();
 
     ThreadSafeDynamicsWorld(
             btDispatcher* dispatcher,
             btBroadphaseInterface* pairCache,
-            btConstraintSolver* constraintSolver,
+            btConstraintSolverPoolMt* constraintSolverPool,
             btCollisionConfiguration* collisionConfiguration);
 
     int getNumSubsteps() const { return _numSubsteps; }
@@ -58,6 +62,9 @@ public:
 private:
     // call this instead of non-virtual btDiscreteDynamicsWorld::synchronizeSingleMotionState()
     void synchronizeMotionState(btRigidBody* body);
+    void computeInterpolatedTransform(const btRigidBody* body, btTransform& interpolatedTransform) const;
+    void applyInterpolatedTransform(btRigidBody* body, const btTransform& interpolatedTransform);
+    void harvestActiveTransforms();
     void drawConnectedSpheres(btIDebugDraw* drawer, btScalar radius1, btScalar radius2, const btVector3& position1, 
                               const btVector3& position2, const btVector3& color);
 
@@ -65,6 +72,12 @@ private:
     VectorOfMotionStates _deactivatedStates;
     SetOfMotionStates _activeStates;
     SetOfMotionStates _lastActiveStates;
+
+    // structure-of-arrays harvest of the active bodies: the interpolated transforms are computed
+    // for all of them in one parallel pass before they are handed to their motion states
+    btAlignedObjectArray<btRigidBody*> _harvestedBodies;
+    btAlignedObjectArray<btTransform> _harvestedTransforms;
+
     int _numSubsteps { 0 };
 };
 
@@ -1236,6 +1236,13 @@ void Model::setURL(const QUrl& url) {
     onInvalidate();
 }
 
+void Model::setLoadingPriority(float priority) {
+    if (priority != _loadingPriority) {
+        _loadingPriority = priority;
+        _renderWatcher.setLoadPriority(this, _loadingPriority);
+    }
+}
+
 void Model::loadURLFinished(bool success) {
     if (!success) {
         _visualGeometryRequestFailed = true;
@@ -580,6 +580,7 @@ void CullShadowBounds::run(const render::RenderContextPointer& renderContext, co
         assert(lightStage);
         const auto globalLightDir = currentKeyLight->getDirection();
         auto castersFilter = render::ItemFilter::Builder(filter).withShadowCaster().build();
+        uint8_t tests = render::CullTest::FRUSTUM | render::CullTest::SOLID_ANGLE | (antiFrustum ? render::CullTest::ANTI_FRUSTUM : 0);
 
         for (auto& inItems : inShapes) {
             auto key = inItems.first;
@@ -591,34 +592,20 @@ void CullShadowBounds::run(const render::RenderContextPointer& renderContext, co
 
             details._considered += (int)inItems.second.size();
 
-            if (antiFrustum == nullptr) {
-                for (auto& item : inItems.second) {
-                    if (test.solidAngleTest(item.bound) && test.frustumTest(item.bound)) {
-                        const auto shapeKey = scene->getItem(item.id).getKey();
-                        if (castersFilter.test(shapeKey)) {
-                            outItems->second.emplace_back(item);
-                            outBounds += item.bound;
-                        } else {
-                            // Receivers are not rendered but they still increase the bounds of the shadow scene
-                            // although only in the direction of the light direction so as to have a correct far
-                            // distance without decreasing the near distance.
-                            merge(outBounds, item.bound, globalLightDir);
-                        }
-                    }
-                }
-            } else {
-                for (auto& item : inItems.second) {
-                    if (test.solidAngleTest(item.bound) && test.frustumTest(item.bound) && test.antiFrustumTest(item.bound)) {
-                        const auto shapeKey = scene->getItem(item.id).getKey();
-                        if (castersFilter.test(shapeKey)) {
-                            outItems->second.emplace_back(item);
-                            outBounds += item.bound;
-                        } else {
-                            // Receivers are not rendered but they still increase the bounds of the shadow scene
-                            // although only in the direction of the light direction so as to have a correct far
-                            // distance without decreasing the near distance.
-                            merge(outBounds, item.bound, globalLightDir);
-                        }
+            _passes.resize(inItems.second.size());
+            test.testItems(inItems.second.data(), inItems.second.size(), tests, _passes.data());
+            for (size_t i = 0; i < inItems.second.size(); ++i) {
+                if (_passes[i]) {
+                    auto& item = inItems.second[i];
+                    const auto shapeKey = scene->getItem(item.id).getKey();
+                    if (castersFilter.test(shapeKey)) {
+                        outItems->second.emplace_back(item);
+                        outBounds += item.bound;
+                    } else {
+                        // Receivers are not rendered but they still increase the bounds of the shadow scene
+                        // although only in the direction of the light direction so as to have a correct far
+                        // distance without decreasing the near distance.
+                        merge(outBounds, item.bound, globalLightDir);
                     }
                 }
             }
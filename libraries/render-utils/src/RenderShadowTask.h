@@ -180,6 +180,9 @@ public:
     using JobModel = render::Job::ModelIO<CullShadowBounds, Inputs, Outputs>;
 
     void run(const render::RenderContextPointer& renderContext, const Inputs& inputs, Outputs& outputs);
+
+private:
+    std::vector<uint8_t> _passes;
 };
 
 #endif // hifi_RenderShadowTask_h
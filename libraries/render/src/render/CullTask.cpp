@@ -12,14 +12,21 @@
 #include "CullTask.h"
 
 #include <algorithm>
+#include <array>
 #include <assert.h>
 
+#include <tbb/parallel_for.h>
+
 #include <PerfStat.h>
 #include <OctreeUtils.h>
 
 using namespace render;
 
-CullTest::CullTest(CullFunctor& functor, RenderArgs* pargs, RenderDetails::Item& renderDetails, ViewFrustumPointer antiFrustum) :
+// Items are culled in chunks of this many, on the worker pool when there is more than one chunk,
+// since below that culling on the render thread is cheaper than waking the pool.
+static const size_t CULL_CHUNK_SIZE = 512;
+
+CullTest::CullTest(const CullFunctor& functor, RenderArgs* pargs, RenderDetails::Item& renderDetails, ViewFrustumPointer antiFrustum) :
     _functor(functor),
     _args(pargs),
     _renderDetails(renderDetails),
@@ -64,6 +71,55 @@ bool CullTest::solidAngleTest(const AABox& bound) {
     return true;
 }
 
+void CullTest::testItems(const ItemBound* items, size_t numItems, uint8_t tests, uint8_t* passes) {
+    const ViewFrustum& frustum = _args->getViewFrustum();
+    const ViewFrustum* antiFrustum = (tests & ANTI_FRUSTUM) ? _antiFrustum.get() : nullptr;
+    assert(antiFrustum || !(tests & ANTI_FRUSTUM));
+
+    // every chunk counts for itself, and the counts are added up after
+    size_t numChunks = (numItems + CULL_CHUNK_SIZE - 1) / CULL_CHUNK_SIZE;
+    std::vector<RenderDetails::Item> chunkDetails(numChunks);
+
+    auto testChunk = [&](size_t chunk) {
+        size_t begin = chunk * CULL_CHUNK_SIZE;
+        size_t numChunkItems = std::min(numItems - begin, CULL_CHUNK_SIZE);
+        const ItemBound* chunkItems = items + begin;
+        uint8_t* chunkPasses = passes + begin;
+        auto& details = chunkDetails[chunk];
+
+        if (tests & FRUSTUM) {
+            frustum.boxesIntersectFrustum(&chunkItems[0].bound, numChunkItems, sizeof(ItemBound), chunkPasses);
+        } else {
+            std::fill(chunkPasses, chunkPasses + numChunkItems, (uint8_t)1);
+        }
+        std::array<uint8_t, CULL_CHUNK_SIZE> insideAntiFrustum;
+        if (antiFrustum) {
+            antiFrustum->boxesInsideFrustum(&chunkItems[0].bound, numChunkItems, sizeof(ItemBound), insideAntiFrustum.data());
+        }
+
+        for (size_t i = 0; i < numChunkItems; ++i) {
+            if (!chunkPasses[i] || (antiFrustum && insideAntiFrustum[i])) {
+                chunkPasses[i] = 0;
+                details._outOfView++;
+            } else if ((tests & SOLID_ANGLE) && !_functor(_args, chunkItems[i].bound)) {
+                chunkPasses[i] = 0;
+                details._tooSmall++;
+            }
+        }
+    };
+
+    if (numChunks > 1) {
+        tbb::parallel_for((size_t)0, numChunks, testChunk);
+    } else if (numChunks == 1) {
+        testChunk(0);
+    }
+
+    for (auto& details : chunkDetails) {
+        _renderDetails._outOfView += details._outOfView;
+        _renderDetails._tooSmall += details._tooSmall;
+    }
+}
+
 void render::cullItems(const RenderContextPointer& renderContext, const CullFunctor& cullFunctor, RenderDetails::Item& details,
                        const ItemBounds& inItems, ItemBounds& outItems) {
     assert(renderContext->args);
@@ -205,6 +261,36 @@ void CullSpatialSelection::run(const RenderContextPointer& renderContext,
     if (!srcFilter.selectsNothing()) {
         auto filter = render::ItemFilter::Builder(srcFilter).withoutSubMetaCulled().build();
 
+        // Filter one list of items and output those passing the tests along with the sub items of meta cull groups.
+        // The payloads are only ever touched from this thread, the tests of the bounds run in parallel in between.
+        auto cullItemList = [&](const ItemIDs& itemIDs, uint8_t tests) {
+            _candidates.clear();
+            for (auto id : itemIDs) {
+                auto& item = scene->getItem(id);
+                if (filter.test(item.getKey())) {
+                    _candidates.emplace_back(id, item.getBound());
+                }
+            }
+
+            _passes.resize(_candidates.size());
+            if (tests) {
+                test.testItems(_candidates.data(), _candidates.size(), tests, _passes.data());
+            } else {
+                std::fill(_passes.begin(), _passes.end(), (uint8_t)1);
+            }
+
+            for (size_t i = 0; i < _candidates.size(); ++i) {
+                if (_passes[i]) {
+                    const ItemBound& itemBound = _candidates[i];
+                    outItems.emplace_back(itemBound);
+                    auto& item = scene->getItem(itemBound.id);
+                    if (item.getKey().isMetaCullGroup()) {
+                        item.fetchMetaSubItemBounds(outItems, (*scene));
+                    }
+                }
+            }
+        };
+
         // Now get the bound, and
         // filter individually against the _filter
         // visibility cull if partially selected ( octree cell contianing it was partial)
@@ -213,61 +299,25 @@ void CullSpatialSelection::run(const RenderContextPointer& renderContext,
             // inside & fit items: filter only, culling is disabled
             {
                 PerformanceTimer perfTimer("insideFitItems");
-                for (auto id : inSelection.insideItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene));
-                        }
-                    }
-                }
+                cullItemList(inSelection.insideItems, 0);
             }
 
             // inside & subcell items: filter only, culling is disabled
             {
                 PerformanceTimer perfTimer("insideSmallItems");
-                for (auto id : inSelection.insideSubcellItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene));
-                        }
-                    }
-                }
+                cullItemList(inSelection.insideSubcellItems, 0);
             }
 
             // partial & fit items: filter only, culling is disabled
             {
                 PerformanceTimer perfTimer("partialFitItems");
-                for (auto id : inSelection.partialItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene));
-                        }
-                    }
-                }
+                cullItemList(inSelection.partialItems, 0);
             }
 
             // partial & subcell items: filter only, culling is disabled
             {
                 PerformanceTimer perfTimer("partialSmallItems");
-                for (auto id : inSelection.partialSubcellItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene));
-                        }
-                    }
-                }
+                cullItemList(inSelection.partialSubcellItems, 0);
             }
 
         } else {
@@ -275,69 +325,25 @@ void CullSpatialSelection::run(const RenderContextPointer& renderContext,
             // inside & fit items: easy, just filter
             {
                 PerformanceTimer perfTimer("insideFitItems");
-                for (auto id : inSelection.insideItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene));
-                        }
-                    }
-                }
+                cullItemList(inSelection.insideItems, 0);
             }
 
             // inside & subcell items: filter & distance cull
             {
                 PerformanceTimer perfTimer("insideSmallItems");
-                for (auto id : inSelection.insideSubcellItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        if (test.solidAngleTest(itemBound.bound)) {
-                            outItems.emplace_back(itemBound);
-                            if (item.getKey().isMetaCullGroup()) {
-                                item.fetchMetaSubItemBounds(outItems, (*scene));
-                            }
-                        }
-                    }
-                }
+                cullItemList(inSelection.insideSubcellItems, CullTest::SOLID_ANGLE);
             }
 
             // partial & fit items: filter & frustum cull
             {
                 PerformanceTimer perfTimer("partialFitItems");
-                for (auto id : inSelection.partialItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        if (test.frustumTest(itemBound.bound)) {
-                            outItems.emplace_back(itemBound);
-                            if (item.getKey().isMetaCullGroup()) {
-                                item.fetchMetaSubItemBounds(outItems, (*scene));
-                            }
-                        }
-                    }
-                }
+                cullItemList(inSelection.partialItems, CullTest::FRUSTUM);
             }
 
             // partial & subcell items:: filter & frutum cull & solidangle cull
             {
                 PerformanceTimer perfTimer("partialSmallItems");
-                for (auto id : inSelection.partialSubcellItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        if (test.frustumTest(itemBound.bound)) {
-                            if (test.solidAngleTest(itemBound.bound)) {
-                                outItems.emplace_back(itemBound);
-                                if (item.getKey().isMetaCullGroup()) {
-                                    item.fetchMetaSubItemBounds(outItems, (*scene));
-                                }
-                            }
-                        }
-                    }
-                }
+                cullItemList(inSelection.partialSubcellItems, CullTest::FRUSTUM | CullTest::SOLID_ANGLE);
             }
         }
     }
@@ -374,6 +380,7 @@ void CullShapeBounds::run(const RenderContextPointer& renderContext, const Input
         auto& details = args->_details.edit(_detailType);
         CullTest test(_cullFunctor, args, details, antiFrustum);
         auto scene = args->_scene;
+        uint8_t tests = CullTest::FRUSTUM | CullTest::SOLID_ANGLE | (antiFrustum ? CullTest::ANTI_FRUSTUM : 0);
 
         for (auto& inItems : inShapes) {
             auto key = inItems.first;
@@ -385,28 +392,17 @@ void CullShapeBounds::run(const RenderContextPointer& renderContext, const Input
 
             details._considered += (int)inItems.second.size();
 
-            if (antiFrustum == nullptr) {
-                for (auto& item : inItems.second) {
-                    if (test.solidAngleTest(item.bound) && test.frustumTest(item.bound)) {
-                        const auto shapeKey = scene->getItem(item.id).getKey();
-                        if (cullFilter.test(shapeKey)) {
-                            outItems->second.emplace_back(item);
-                        }
-                        if (boundsFilter.test(shapeKey)) {
-                            outBounds += item.bound;
-                        }
+            _passes.resize(inItems.second.size());
+            test.testItems(inItems.second.data(), inItems.second.size(), tests, _passes.data());
+            for (size_t i = 0; i < inItems.second.size(); ++i) {
+                if (_passes[i]) {
+                    auto& item = inItems.second[i];
+                    const auto shapeKey = scene->getItem(item.id).getKey();
+                    if (cullFilter.test(shapeKey)) {
+                        outItems->second.emplace_back(item);
                     }
-                }
-            } else {
-                for (auto& item : inItems.second) {
-                    if (test.solidAngleTest(item.bound) && test.frustumTest(item.bound) && test.antiFrustumTest(item.bound)) {
-                        const auto shapeKey = scene->getItem(item.id).getKey();
-                        if (cullFilter.test(shapeKey)) {
-                            outItems->second.emplace_back(item);
-                        }
-                        if (boundsFilter.test(shapeKey)) {
-                            outBounds += item.bound;
-                        }
+                    if (boundsFilter.test(shapeKey)) {
+                        outBounds += item.bound;
                     }
                 }
             }
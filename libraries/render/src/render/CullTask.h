@@ -31,11 +31,22 @@ namespace render {
         glm::vec3 _eyePos;
         float _squareTanAlpha;
 
-        CullTest(CullFunctor& functor, RenderArgs* pargs, RenderDetails::Item& renderDetails, ViewFrustumPointer antiFrustum = nullptr);
+        CullTest(const CullFunctor& functor, RenderArgs* pargs, RenderDetails::Item& renderDetails, ViewFrustumPointer antiFrustum = nullptr);
 
         bool frustumTest(const AABox& bound);
         bool antiFrustumTest(const AABox& bound);
         bool solidAngleTest(const AABox& bound);
+
+        enum Tests : uint8_t {
+            FRUSTUM = 1,
+            ANTI_FRUSTUM = 2,
+            SOLID_ANGLE = 4,
+        };
+
+        // Runs the tests, in that order, on numItems items and sets passes[i] to 1 for those passing all of them, 0 otherwise.
+        // Big ranges are split in chunks tested in parallel on the worker pool, the frustum tests four boxes at a time,
+        // and the details count the same as running the tests one item at a time.
+        void testItems(const ItemBound* items, size_t numItems, uint8_t tests, uint8_t* passes);
     };
 
     class FetchNonspatialItems {
@@ -121,6 +132,11 @@ namespace render {
 
         void configure(const Config& config);
         void run(const RenderContextPointer& renderContext, const Inputs& inputs, ItemBounds& outItems);
+
+    private:
+        // the filtered items of one list of the selection, and whether they passed the culling tests
+        ItemBounds _candidates;
+        std::vector<uint8_t> _passes;
     };
 
     class CullShapeBounds {
@@ -143,7 +159,7 @@ namespace render {
 
         CullFunctor _cullFunctor;
         RenderDetails::Type _detailType{ RenderDetails::OTHER };
-
+        std::vector<uint8_t> _passes;
     };
 
     class ApplyCullFunctorOnItemBounds {
@@ -512,8 +512,21 @@ public:
     typedef std::function<void(T&)> Func;
     Func _func;
 
+    UpdateFunctor() {}
     UpdateFunctor(Func func): _func(func) {}
     ~UpdateFunctor() {}
+
+    virtual void apply(T& data) { _func(data); }
+};
+
+// Holds the update lambda itself rather than a std::function, so that it is allocated along with the functor
+template <class T, class F> class UpdateLambda : public UpdateFunctor<T> {
+public:
+    F _lambda;
+
+    UpdateLambda(F lambda) : _lambda(std::move(lambda)) {}
+
+    void apply(T& data) override { _lambda(data); }
 };
 
 
@@ -566,7 +579,7 @@ protected:
 
     // Update mechanics
     virtual void update(const UpdateFunctorPointer& functor) override {
-        std::static_pointer_cast<Updater>(functor)->_func((*_data));
+        std::static_pointer_cast<Updater>(functor)->apply((*_data));
     }
     friend class Item;
 };
@@ -10,7 +10,10 @@
 //
 #include "Scene.h"
 
+#include <algorithm>
 #include <numeric>
+
+#include <SharedUtil.h>
 #include <gpu/Batch.h>
 #include "Logging.h"
 #include "TransitionStage.h"
@@ -67,7 +70,24 @@ void Transaction::querySelectionHighlight(const std::string& selectionName, cons
     _highlightQueries.emplace_back(selectionName, func);
 }
 
+static const Transaction& getTransaction(const Transaction& transaction) {
+    return transaction;
+}
+
+static const Transaction& getTransaction(const Transaction* transaction) {
+    return *transaction;
+}
+
 void Transaction::reserve(const std::vector<Transaction>& transactionContainer) {
+    reserveAll(transactionContainer);
+}
+
+void Transaction::reserve(const std::vector<Transaction*>& transactionContainer) {
+    reserveAll(transactionContainer);
+}
+
+template <typename Transactions>
+void Transaction::reserveAll(const Transactions& transactionContainer) {
     size_t resetItemsCount = 0;
     size_t removedItemsCount = 0;
     size_t updatedItemsCount = 0;
@@ -80,7 +100,8 @@ void Transaction::reserve(const std::vector<Transaction>& transactionContainer)
     size_t highlightRemovesCount = 0;
     size_t highlightQueriesCount = 0;
 
-    for (const auto& transaction : transactionContainer) {
+    for (const auto& element : transactionContainer) {
+        const Transaction& transaction = getTransaction(element);
         resetItemsCount += transaction._resetItems.size();
         removedItemsCount += transaction._removedItems.size();
         updatedItemsCount += transaction._updatedItems.size();
@@ -180,6 +201,26 @@ void Transaction::clear() {
     _highlightQueries.clear();
 }
 
+template <typename T> static void shrinkVector(std::vector<T>& vector, size_t maxCapacity) {
+    if (vector.capacity() > maxCapacity) {
+        std::vector<T>().swap(vector);
+    }
+}
+
+void Transaction::shrink(size_t maxCapacity) {
+    shrinkVector(_resetItems, maxCapacity);
+    shrinkVector(_removedItems, maxCapacity);
+    shrinkVector(_updatedItems, maxCapacity);
+    shrinkVector(_resetSelections, maxCapacity);
+    shrinkVector(_resetTransitions, maxCapacity);
+    shrinkVector(_removeTransitions, maxCapacity);
+    shrinkVector(_queriedTransitions, maxCapacity);
+    shrinkVector(_transitionFinishedOperators, maxCapacity);
+    shrinkVector(_highlightResets, maxCapacity);
+    shrinkVector(_highlightRemoves, maxCapacity);
+    shrinkVector(_highlightQueries, maxCapacity);
+}
+
 
 Scene::Scene(glm::vec3 origin, float size) :
     _masterSpatialTree(origin, size)
@@ -189,6 +230,16 @@ Scene::Scene(glm::vec3 origin, float size) :
 
 Scene::~Scene() {
     qCDebug(renderlogging) << "Scene::~Scene()";
+
+    TransactionNode* node = _transactionQueueHead.exchange(nullptr);
+    while (node) {
+        TransactionNode* next = node->next;
+        delete node;
+        node = next;
+    }
+    while (_freeTransactionNodes.try_pop(node)) {
+        delete node;
+    }
 }
 
 ItemID Scene::allocateID() {
@@ -200,30 +251,90 @@ bool Scene::isAllocatedID(const ItemID& id) const {
     return Item::isValidID(id) && (id < _numAllocatedItems.load());
 }
 
+// Enough for the transactions of a busy frame, more nodes are allocated and freed as needed.
+static const size_t MAX_FREE_TRANSACTION_NODES = 256;
+// Entries kept in each vector of a pooled transaction, one that held a large load of content gives the memory back.
+static const size_t MAX_FREE_TRANSACTION_CAPACITY = 1024;
+
+Scene::TransactionNode* Scene::allocateTransactionNode() {
+    TransactionNode* node;
+    if (_freeTransactionNodes.try_pop(node)) {
+        _numFreeTransactionNodes.fetch_sub(1, std::memory_order_relaxed);
+    } else {
+        node = new TransactionNode();
+    }
+    return node;
+}
+
+void Scene::pushTransactionNode(TransactionNode* node) {
+    TransactionNode* head = _transactionQueueHead.load(std::memory_order_relaxed);
+    do {
+        node->next = head;
+    } while (!_transactionQueueHead.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void Scene::freeTransactionNode(TransactionNode* node) {
+    // counted before it is pushed, so the pool never grows past its limit
+    if (_numFreeTransactionNodes.fetch_add(1, std::memory_order_relaxed) >= MAX_FREE_TRANSACTION_NODES) {
+        _numFreeTransactionNodes.fetch_sub(1, std::memory_order_relaxed);
+        delete node;
+        return;
+    }
+
+    node->transaction.clear();
+    node->transaction.shrink(MAX_FREE_TRANSACTION_CAPACITY);
+    node->next = nullptr;
+    _freeTransactionNodes.push(node);
+}
+
 /// Enqueue change batch to the scene
 void Scene::enqueueTransaction(const Transaction& transaction) {
-    std::unique_lock<std::mutex> lock(_transactionQueueMutex);
-    _transactionQueue.emplace_back(transaction);
+    TransactionNode* node = allocateTransactionNode();
+    node->transaction.merge(transaction);
+    pushTransactionNode(node);
 }
 
 void Scene::enqueueTransaction(Transaction&& transaction) {
-    std::unique_lock<std::mutex> lock(_transactionQueueMutex);
-    _transactionQueue.emplace_back(std::move(transaction));
+    TransactionNode* node = allocateTransactionNode();
+    node->transaction.merge(std::move(transaction));
+    pushTransactionNode(node);
 }
 
 uint32_t Scene::enqueueFrame() {
     PROFILE_RANGE(render, __FUNCTION__);
-    TransactionQueue localTransactionQueue;
-    {
-        std::unique_lock<std::mutex> lock(_transactionQueueMutex);
-        localTransactionQueue.swap(_transactionQueue);
+    auto mergeStart = usecTimestampNow();
+
+    // take the whole list, it was pushed in reverse order
+    std::vector<Transaction*> queuedTransactions;
+    std::vector<TransactionNode*> queuedNodes;
+    TransactionNode* node = _transactionQueueHead.exchange(nullptr, std::memory_order_acquire);
+    for (; node; node = node->next) {
+        queuedNodes.push_back(node);
+    }
+    std::reverse(queuedNodes.begin(), queuedNodes.end());
+    queuedTransactions.reserve(queuedNodes.size());
+    for (auto queuedNode : queuedNodes) {
+        queuedTransactions.push_back(&queuedNode->transaction);
     }
 
     Transaction consolidatedTransaction;
-    consolidatedTransaction.merge(std::move(localTransactionQueue));
+    consolidatedTransaction.reserve(queuedTransactions);
+    for (auto queuedNode : queuedNodes) {
+        consolidatedTransaction.merge(std::move(queuedNode->transaction));
+        freeTransactionNode(queuedNode);
+    }
+
+    PROFILE_COUNTER(render, "transactions", {
+        { "transactions", (uint32_t)queuedNodes.size() },
+        { "resetItems", (uint32_t)consolidatedTransaction._resetItems.size() },
+        { "updatedItems", (uint32_t)consolidatedTransaction._updatedItems.size() },
+        { "removedItems", (uint32_t)consolidatedTransaction._removedItems.size() },
+        { "mergeUsecs", usecTimestampNow() - mergeStart }
+    });
+
     {
         std::unique_lock<std::mutex> lock(_transactionFramesMutex);
-        _transactionFrames.push_back(consolidatedTransaction);
+        _transactionFrames.push_back(std::move(consolidatedTransaction));
     }
 
     return ++_transactionFrameNumber;
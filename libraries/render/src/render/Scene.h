@@ -12,6 +12,8 @@
 #ifndef hifi_render_Scene_h
 #define hifi_render_Scene_h
 
+#include <TBBHelpers.h>
+
 #include "Item.h"
 #include "SpatialTree.h"
 #include "Stage.h"
@@ -50,8 +52,8 @@ public:
     void resetItem(ItemID id, const PayloadPointer& payload);
     void removeItem(ItemID id);
     bool hasRemovedItems() const { return !_removedItems.empty(); }
-    template <class T> void updateItem(ItemID id, std::function<void(T&)> func) {
-        updateItem(id, std::make_shared<UpdateFunctor<T>>(func));
+    template <class T, class F> void updateItem(ItemID id, F&& func) {
+        updateItem(id, std::make_shared<UpdateLambda<T, typename std::decay<F>::type>>(std::forward<F>(func)));
     }
     void updateItem(ItemID id, const UpdateFunctorPointer& functor);
     void updateItem(ItemID id) { updateItem(id, nullptr); }
@@ -70,6 +72,7 @@ public:
     void querySelectionHighlight(const std::string& selectionName, const SelectionHighlightQueryFunc& func);
 
     void reserve(const std::vector<Transaction>& transactionContainer);
+    void reserve(const std::vector<Transaction*>& transactionContainer);
     void merge(const std::vector<Transaction>& transactionContainer);
     void merge(std::vector<Transaction>&& transactionContainer);
     void merge(const Transaction& transaction);
@@ -77,6 +80,9 @@ public:
     void clear();
 
 protected:
+    template <typename Transactions> void reserveAll(const Transactions& transactionContainer);
+    // Frees the vectors holding more than maxCapacity entries, call once cleared.
+    void shrink(size_t maxCapacity);
 
     using Reset = std::tuple<ItemID, PayloadPointer>;
     using Remove = ItemID;
@@ -199,10 +205,22 @@ protected:
     // Thread safe elements that can be accessed from anywhere
     std::atomic<unsigned int> _IDAllocator{ 1 }; // first valid itemID will be One
     std::atomic<unsigned int> _numAllocatedItems{ 1 }; // num of allocated items, matching the _items.size()
-    std::mutex _transactionQueueMutex;
-    TransactionQueue _transactionQueue;
 
-    
+    // Transactions are enqueued from any thread without locking: each one is moved into a node pushed on a lock free
+    // list that enqueueFrame() takes whole.  The nodes are then pooled, with the capacity of their transaction's vectors.
+    class TransactionNode {
+    public:
+        Transaction transaction;
+        TransactionNode* next { nullptr };
+    };
+    std::atomic<TransactionNode*> _transactionQueueHead { nullptr };
+    tbb::concurrent_queue<TransactionNode*> _freeTransactionNodes;
+    std::atomic<size_t> _numFreeTransactionNodes { 0 };
+
+    TransactionNode* allocateTransactionNode();
+    void pushTransactionNode(TransactionNode* node);
+    void freeTransactionNode(TransactionNode* node);
+
     std::mutex _transactionFramesMutex;
     using TransactionFrames = std::vector<Transaction>;
     TransactionFrames _transactionFrames;
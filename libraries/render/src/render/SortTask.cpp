@@ -13,86 +13,72 @@
 #include "ShapePipeline.h"
 
 #include <assert.h>
-#include <ViewFrustum.h>
-
-using namespace render;
+#include <string.h>
+#include <algorithm>
 
-struct ItemBoundSort {
-    float _centerDepth = 0.0f;
-    float _nearDepth = 0.0f;
-    float _farDepth = 0.0f;
-    ItemID _id = 0;
-    AABox _bounds;
+#include <tbb/parallel_for.h>
 
-    ItemBoundSort() {}
-    ItemBoundSort(float centerDepth, float nearDepth, float farDepth, ItemID id, const AABox& bounds) : _centerDepth(centerDepth), _nearDepth(nearDepth), _farDepth(farDepth), _id(id), _bounds(bounds) {}
-};
+#include <RadixSort.h>
+#include <ViewFrustum.h>
 
-struct FrontToBackSort {
-    bool operator() (const ItemBoundSort& left, const ItemBoundSort& right) {
-        return (left._centerDepth < right._centerDepth);
-    }
-};
+using namespace render;
 
-struct BackToFrontSort {
-    bool operator() (const ItemBoundSort& left, const ItemBoundSort& right) {
-        return (left._centerDepth > right._centerDepth);
-    }
-};
+// below this many items std::sort beats the setup cost of the radix passes
+static const size_t MIN_RADIX_SORT_SIZE = 1024;
 
 void render::depthSortItems(const RenderContextPointer& renderContext, bool frontToBack, 
                             const ItemBounds& inItems, ItemBounds& outItems, AABox* bounds) {
     assert(renderContext->args);
     assert(renderContext->args->hasViewFrustum());
 
-    auto& scene = renderContext->_scene;
     RenderArgs* args = renderContext->args;
-
+    const ViewFrustum& viewFrustum = args->getViewFrustum();
 
     // Allocate and simply copy
     outItems.clear();
     outItems.reserve(inItems.size());
 
-
-    // Make a local dataset of the center distance and closest point distance
-    std::vector<ItemBoundSort> itemBoundSorts;
-    itemBoundSorts.reserve(outItems.size());
-
-    for (auto itemDetails : inItems) {
-        auto item = scene->getItem(itemDetails.id);
-        auto bound = itemDetails.bound; // item.getBound();
-        float distanceSquared = args->getViewFrustum().distanceToCameraSquared(bound.calcCenter());
-
-        itemBoundSorts.emplace_back(ItemBoundSort(distanceSquared, distanceSquared, distanceSquared, itemDetails.id, bound));
+    // Sort keys hold the depth in the high bits and the index of the item in the low bits.  A squared
+    // distance is never negative, so its bits order the same as its value, and flipping them sorts back to front.
+    std::vector<uint64_t> keys;
+    keys.reserve(inItems.size());
+    const uint32_t depthMask = frontToBack ? 0 : 0xffffffff;
+    for (size_t i = 0; i < inItems.size(); ++i) {
+        float distanceSquared = viewFrustum.distanceToCameraSquared(inItems[i].bound.calcCenter());
+        uint32_t depthBits;
+        memcpy(&depthBits, &distanceSquared, sizeof(depthBits));
+        keys.push_back(((uint64_t)(depthBits ^ depthMask) << 32) | (uint64_t)i);
     }
 
     // sort against Z
-    if (frontToBack) {
-        FrontToBackSort frontToBackSort;
-        std::sort(itemBoundSorts.begin(), itemBoundSorts.end(), frontToBackSort);
+    if (keys.size() >= MIN_RADIX_SORT_SIZE) {
+        std::vector<uint64_t> scratch;
+        const int FIRST_DEPTH_BYTE = 4;
+        radixSort(keys, scratch, FIRST_DEPTH_BYTE);
     } else {
-        BackToFrontSort  backToFrontSort;
-        std::sort(itemBoundSorts.begin(), itemBoundSorts.end(), backToFrontSort);
+        std::sort(keys.begin(), keys.end());
     }
 
     // Finally once sorted result to a list of itemID and keep uniques
     render::ItemID previousID = Item::INVALID_ITEM_ID;
     if (!bounds) {
-        for (auto& item : itemBoundSorts) {
-            if (item._id != previousID) {
-                outItems.emplace_back(ItemBound(item._id, item._bounds));
-                previousID = item._id;
+        for (auto key : keys) {
+            auto& item = inItems[(uint32_t)key];
+            if (item.id != previousID) {
+                outItems.emplace_back(item);
+                previousID = item.id;
             }
         }
-    } else if (!itemBoundSorts.empty()) {
+    } else if (!keys.empty()) {
         if (bounds->isNull()) {
-            *bounds = itemBoundSorts.front()._bounds;
+            *bounds = inItems[(uint32_t)keys.front()].bound;
         }
-        for (auto& item : itemBoundSorts) {
-            if (item._id != previousID) {
-                outItems.emplace_back(ItemBound(item._id, item._bounds));
-                previousID = item._id;
-                *bounds += item._bounds;
+        for (auto key : keys) {
+            auto& item = inItems[(uint32_t)key];
+            if (item.id != previousID) {
+                outItems.emplace_back(item);
+                previousID = item.id;
+                *bounds += item.bound;
             }
         }
     }
@@ -118,39 +104,47 @@ void PipelineSortShapes::run(const RenderContextPointer& renderContext, const It
     }
 }
 
-void DepthSortShapes::run(const RenderContextPointer& renderContext, const ShapeBounds& inShapes, ShapeBounds& outShapes) {
+// Creates an empty output list for every pipeline, serially, so that they can then be filled in parallel.
+static void prepareSortedShapes(const ShapeBounds& inShapes, ShapeBounds& outShapes,
+                                std::vector<std::pair<const ItemBounds*, ItemBounds*>>& lists) {
     outShapes.clear();
     outShapes.reserve(inShapes.size());
-
+    lists.clear();
+    lists.reserve(inShapes.size());
     for (auto& pipeline : inShapes) {
-        auto& inItems = pipeline.second;
         auto outItems = outShapes.find(pipeline.first);
         if (outItems == outShapes.end()) {
             outItems = outShapes.insert(std::make_pair(pipeline.first, ItemBounds{})).first;
         }
-
-        depthSortItems(renderContext, _frontToBack, inItems, outItems->second);
+        lists.emplace_back(&pipeline.second, &outItems->second);
     }
 }
 
+void DepthSortShapes::run(const RenderContextPointer& renderContext, const ShapeBounds& inShapes, ShapeBounds& outShapes) {
+    std::vector<std::pair<const ItemBounds*, ItemBounds*>> lists;
+    prepareSortedShapes(inShapes, outShapes, lists);
+
+    tbb::parallel_for((size_t)0, lists.size(), [&](size_t i) {
+        depthSortItems(renderContext, _frontToBack, *lists[i].first, *lists[i].second);
+    });
+}
+
 void DepthSortShapesAndComputeBounds::run(const RenderContextPointer& renderContext, const ShapeBounds& inShapes, Outputs& outputs) {
     auto& outShapes = outputs.edit0();
     auto& outBounds = outputs.edit1();
 
-    outShapes.clear();
-    outShapes.reserve(inShapes.size());
-    outBounds = AABox();
+    std::vector<std::pair<const ItemBounds*, ItemBounds*>> lists;
+    prepareSortedShapes(inShapes, outShapes, lists);
 
-    for (auto& pipeline : inShapes) {
-        auto& inItems = pipeline.second;
-        auto outItems = outShapes.find(pipeline.first);
-        if (outItems == outShapes.end()) {
-            outItems = outShapes.insert(std::make_pair(pipeline.first, ItemBounds{})).first;
-        }
-        AABox bounds;
+    std::vector<AABox> bounds(lists.size());
+    tbb::parallel_for((size_t)0, lists.size(), [&](size_t i) {
+        depthSortItems(renderContext, _frontToBack, *lists[i].first, *lists[i].second, &bounds[i]);
+    });
 
-        depthSortItems(renderContext, _frontToBack, inItems, outItems->second, &bounds);
-        outBounds += bounds;
+    // merged in pipeline order, like the lists were
+    outBounds = AABox();
+    for (auto& pipelineBounds : bounds) {
+        outBounds += pipelineBounds;
     }
 }
 
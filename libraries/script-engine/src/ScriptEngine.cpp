@@ -15,7 +15,9 @@
 #include <thread>
 
 #include <QtCore/QCoreApplication>
+#include <QtCore/QDir>
 #include <QtCore/QEventLoop>
+#include <QtCore/QFile>
 #include <QtCore/QFileInfo>
 #include <QtCore/QTimer>
 #include <QtCore/QThread>
@@ -70,6 +72,7 @@
 #include "ScriptAvatarData.h"
 #include "ScriptCache.h"
 #include "ScriptEngineLogging.h"
+#include "ScriptProfiler.h"
 #include "TypedArrays.h"
 #include "XMLHttpRequestClass.h"
 #include "WebSocketClass.h"
@@ -90,6 +93,7 @@ const QString ScriptEngine::_SETTINGS_ENABLE_EXTENDED_EXCEPTIONS {
 
 static const int MAX_MODULE_ID_LENGTH { 4096 };
 static const int MAX_DEBUG_VALUE_LENGTH { 80 };
+static const QString SCRIPT_PROFILES_DIRECTORY { "script-profiles" };
 
 static const QScriptEngine::QObjectWrapOptions DEFAULT_QOBJECT_WRAP_OPTIONS =
                 QScriptEngine::ExcludeDeleteLater | QScriptEngine::ExcludeChildObjects;
@@ -771,6 +775,9 @@ void ScriptEngine::init() {
 
     registerGlobalObject("Entities", entityScriptingInterface.data());
     registerFunction("Entities", "getMultipleEntityProperties", EntityScriptingInterface::getMultipleEntityProperties);
+    registerFunction("Entities", "getMultipleEntityPropertyArrays", EntityScriptingInterface::getMultipleEntityPropertyArrays);
+    registerFunction("Entities", "editMultipleEntities", EntityScriptingInterface::editMultipleEntities);
+    registerFunction("Entities", "findEntitiesInSpheres", EntityScriptingInterface::findEntitiesInSpheres);
     registerGlobalObject("Quat", &_quatLibrary);
     registerGlobalObject("Vec3", &_vec3Library);
     registerGlobalObject("Mat4", &_mat4Library);
@@ -1279,7 +1286,13 @@ void ScriptEngine::run() {
                 auto preUpdate = clock::now();
                 {
                     PROFILE_RANGE(script, "ScriptUpdate");
+                    if (_isProfiling) {
+                        _profiler->beginSection("Script.update");
+                    }
                     emit update(deltaTime);
+                    if (_isProfiling) {
+                        _profiler->endSection();
+                    }
                 }
                 auto postUpdate = clock::now();
                 auto elapsed = (postUpdate - preUpdate);
@@ -1300,6 +1313,7 @@ void ScriptEngine::run() {
 
     stopAllTimers(); // make sure all our timers are stopped if the script is ending
     emit scriptEnding();
+    stopProfiling();
 
     if (entityScriptingInterface->getEntityPacketSender()->serversExist()) {
         // release the queue of edit entity messages.
@@ -1419,6 +1433,7 @@ void ScriptEngine::timerFired() {
 
     QTimer* callingTimer = reinterpret_cast<QTimer*>(sender());
     CallbackData timerData = _timerFunctionMap.value(callingTimer);
+    bool isSingleShot = callingTimer->isSingleShot();
 
     if (!callingTimer->isActive()) {
         // this timer is done, we can kill it
@@ -1429,9 +1444,15 @@ void ScriptEngine::timerFired() {
     // call the associated JS function, if it exists
     if (timerData.function.isValid()) {
         PROFILE_RANGE(script, __FUNCTION__);
+        if (_isProfiling) {
+            _profiler->beginSection(isSingleShot ? "Script.setTimeout" : "Script.setInterval");
+        }
         auto preTimer = p_high_resolution_clock::now();
         callWithEnvironment(timerData.definingEntityIdentifier, timerData.definingSandboxURL, timerData.function, timerData.function, QScriptValueList());
         auto postTimer = p_high_resolution_clock::now();
+        if (_isProfiling) {
+            _profiler->endSection();
+        }
         auto elapsed = (postTimer - preTimer);
         _totalTimerExecution += std::chrono::duration_cast<std::chrono::microseconds>(elapsed);
     } else {
@@ -1550,6 +1571,68 @@ void ScriptEngine::endProfileRange(const QString& label) const {
     PROFILE_SYNC_END(script, label.toStdString().c_str(), label.toStdString().c_str());
 }
 
+bool ScriptEngine::startProfiling(int intervalMS) {
+    if (!IS_THREADSAFE_INVOCATION(thread(), __FUNCTION__)) {
+        return false;
+    }
+    if (_isProfiling) {
+        return true;
+    }
+    // the profiler watches the script as the engine's agent, and the engine has only one, which the debugger uses
+    if (agent()) {
+        scriptWarningMessage("Script.startProfiling() isn't available while the script is being debugged");
+        return false;
+    }
+    _profiler.reset(new ScriptProfiler(this, intervalMS));
+    setAgent(_profiler.get());
+    _isProfiling = true;
+    return true;
+}
+
+void ScriptEngine::stopProfiling() {
+    if (!IS_THREADSAFE_INVOCATION(thread(), __FUNCTION__)) {
+        return;
+    }
+    if (!_isProfiling) {
+        return;
+    }
+    // the profiler is kept, until profiling starts again, so that its samples can still be read
+    setAgent(nullptr);
+    _profiler->stop();
+    _isProfiling = false;
+    scriptInfoMessage(QString("Script profile: %1 samples, %2 ms").arg(_profiler->getNumSamples())
+        .arg(_profiler->getSampledUsecs() / USECS_PER_MSEC));
+}
+
+QString ScriptEngine::getProfile() const {
+    return _profiler ? _profiler->getFoldedStacks() : QString();
+}
+
+QString ScriptEngine::saveProfile(const QString& filename) const {
+    if (!_profiler) {
+        return QString();
+    }
+    // any script may profile itself, so it may only name a file in the profiles directory, not say where to write
+    static const QRegularExpression PROFILE_FILENAME("^[A-Za-z0-9_\\-][A-Za-z0-9_.\\-]*$");
+    if (!PROFILE_FILENAME.match(filename).hasMatch()) {
+        scriptWarningMessage("Script.saveProfile() filename must be a file name without a path: " + filename);
+        return QString();
+    }
+    QDir profilesDir(PathUtils::getAppLocalDataFilePath(SCRIPT_PROFILES_DIRECTORY));
+    if (!profilesDir.mkpath(".")) {
+        qCWarning(scriptengine) << "Script.saveProfile() couldn't create" << profilesDir.path();
+        return QString();
+    }
+    QString path = profilesDir.absoluteFilePath(filename);
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+        qCWarning(scriptengine) << "Script.saveProfile() couldn't write" << path;
+        return QString();
+    }
+    file.write(_profiler->getFoldedStacks().toUtf8());
+    return path;
+}
+
 // Script.require.resolve -- like resolvePath, but performs more validation and throws exceptions on invalid module identifiers (for consistency with Node.js)
 QString ScriptEngine::_requireResolve(const QString& moduleId, const QString& relativeTo) {
     if (!IS_THREADSAFE_INVOCATION(thread(), __FUNCTION__)) {
@@ -2117,6 +2200,8 @@ QVariant ScriptEngine::cloneEntityScriptDetails(const EntityItemID& entityID) {
             map["status"] = EntityScriptStatus_::valueToKey(scriptDetails.status).toLower();
             map["errorInfo"] = scriptDetails.errorInfo;
             map["entityID"] = entityID.toString();
+            map["scriptUsecs"] = (qulonglong)scriptDetails.scriptUsecs;
+            map["numScriptCalls"] = (qulonglong)scriptDetails.numScriptCalls;
 #ifdef DEBUG_ENTITY_STATES
             {
                 auto debug = QVariantMap();
@@ -2573,6 +2658,10 @@ void ScriptEngine::doWithEnvironment(const EntityItemID& entityID, const QUrl& s
     currentEntityIdentifier = entityID;
     currentSandboxURL = sandboxURL;
 
+    quint64 startTime = usecTimestampNow();
+    quint64 outerNestedUsecs = _nestedEntityScriptUsecs;
+    _nestedEntityScriptUsecs = 0;
+
 #if DEBUG_CURRENT_ENTITY
     QScriptValue oldData = this->globalObject().property("debugEntityID");
     this->globalObject().setProperty("debugEntityID", entityID.toScriptValue(this)); // Make the entityID available to javascript as a global.
@@ -2582,6 +2671,22 @@ void ScriptEngine::doWithEnvironment(const EntityItemID& entityID, const QUrl& s
     operation();
 #endif
     maybeEmitUncaughtException(!entityID.isNull() ? entityID.toString() : __FUNCTION__);
+
+    // charge this entity for its own time, the scripts it called charged theirs
+    quint64 elapsedUsecs = usecTimestampNow() - startTime;
+    quint64 ownUsecs = elapsedUsecs - std::min(elapsedUsecs, _nestedEntityScriptUsecs);
+    _nestedEntityScriptUsecs = outerNestedUsecs + elapsedUsecs;
+    if (!entityID.isNull()) {
+        _entityScriptUsecs += ownUsecs;
+
+        QWriteLocker locker { &_entityScriptsLock };
+        auto it = _entityScripts.find(entityID);
+        if (it != _entityScripts.end()) {
+            it->scriptUsecs += ownUsecs;
+            ++it->numScriptCalls;
+        }
+    }
+
     currentEntityIdentifier = oldIdentifier;
     currentSandboxURL = oldSandboxURL;
 }
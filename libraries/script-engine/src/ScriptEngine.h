@@ -12,6 +12,7 @@
 #ifndef hifi_ScriptEngine_h
 #define hifi_ScriptEngine_h
 
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -47,6 +48,7 @@
 #include "Profile.h"
 
 class QScriptEngineDebugger;
+class ScriptProfiler;
 
 static const QString NO_SCRIPT("");
 
@@ -97,6 +99,10 @@ public:
     QScriptValue scriptObject { QScriptValue() };
     int64_t lastModified { 0 };
     QUrl definingSandboxURL { QUrl("about:EntityScript") };
+
+    // Time spent running this entity's script on the engine thread, not counting other entities' scripts it called.
+    quint64 scriptUsecs { 0 };
+    quint64 numScriptCalls { 0 };
 };
 
 /**jsdoc
@@ -543,6 +549,50 @@ public:
      */
     Q_INVOKABLE void endProfileRange(const QString& label) const;
 
+    /**jsdoc
+     * Starts sampling what the script is running, to find where it spends its time. Each sample records the stack of script
+     * functions and API calls being run, and whether they were run for <code>Script.update</code> or a
+     * <code>Script.setInterval</code> or <code>Script.setTimeout</code> callback. Samples are also recorded in traces taken
+     * with the <code>trace.script</code> logging category enabled.
+     * <p><strong>Warning:</strong> Scripts run more slowly while they are profiled. Profiling isn't available while the
+     * script is being debugged.</p>
+     * @function Script.startProfiling
+     * @param {number} [intervalMS=1] - The time between samples, in ms.
+     * @returns {boolean} <code>true</code> if profiling started, <code>false</code> if it couldn't be.
+     */
+    Q_INVOKABLE bool startProfiling(int intervalMS = 1);
+
+    /**jsdoc
+     * Stops sampling what the script is running. The samples taken are kept until profiling is started again.
+     * @function Script.stopProfiling
+     */
+    Q_INVOKABLE void stopProfiling();
+
+    /**jsdoc
+     * Gets the samples taken since profiling was started, in the folded format read by flame graph tools: a line per stack
+     * sampled, with its frames from the outermost separated by semicolons, then a space and the microseconds charged to it.
+     * @function Script.getProfile
+     * @returns {string} The samples taken, or <code>""</code> if profiling hasn't been started.
+     */
+    Q_INVOKABLE QString getProfile() const;
+
+    /**jsdoc
+     * Saves the samples taken since profiling was started to a file in the <code>script-profiles</code> directory of the
+     * application's local data directory, in the format returned by {@link Script.getProfile|getProfile}. An existing file
+     * of the same name is overwritten.
+     * @function Script.saveProfile
+     * @param {string} filename - The name of the file to write, without a path: letters, digits, <code>_</code>,
+     *     <code>-</code>, and <code>.</code> after the first character.
+     * @returns {string} The path of the file written, or <code>""</code> if it couldn't be.
+     * @example <caption>Profile a script for 10s then save the samples.</caption>
+     * Script.startProfiling();
+     * Script.setTimeout(function () {
+     *     Script.stopProfiling();
+     *     print("Profile saved to " + Script.saveProfile("myScript.folded"));
+     * }, 10000);
+     */
+    Q_INVOKABLE QString saveProfile(const QString& filename) const;
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Entity Script Related methods
 
@@ -666,6 +716,8 @@ public:
     void clearDebugLogWindow();
     int getNumRunningEntityScripts() const;
     bool getEntityScriptDetails(const EntityItemID& entityID, EntityScriptDetails &details) const;
+    // Total time spent running entity scripts on the engine thread.
+    quint64 getEntityScriptUsecs() const { return _entityScriptUsecs; }
     bool hasEntityScriptDetails(const EntityItemID& entityID) const;
 
     void setScriptEngines(QSharedPointer<ScriptEngines>& scriptEngines) { _scriptEngines = scriptEngines; }
@@ -921,6 +973,8 @@ protected:
 
     EntityItemID currentEntityIdentifier; // Contains the defining entity script entity id during execution, if any. Empty for interface script execution.
     QUrl currentSandboxURL; // The toplevel url string for the entity script that loaded the code being executed, else empty.
+    quint64 _nestedEntityScriptUsecs { 0 }; // time spent in the entity scripts called by the one being executed
+    std::atomic<quint64> _entityScriptUsecs { 0 };
     void doWithEnvironment(const EntityItemID& entityID, const QUrl& sandboxURL, std::function<void()> operation);
     void callWithEnvironment(const EntityItemID& entityID, const QUrl& sandboxURL, QScriptValue function, QScriptValue thisObject, QScriptValueList args);
 
@@ -963,6 +1017,8 @@ protected:
     std::recursive_mutex _lock;
 
     std::chrono::microseconds _totalTimerExecution { 0 };
+    std::unique_ptr<ScriptProfiler> _profiler;
+    bool _isProfiling { false };
 
     static const QString _SETTINGS_ENABLE_EXTENDED_MODULE_COMPAT;
     static const QString _SETTINGS_ENABLE_EXTENDED_EXCEPTIONS;
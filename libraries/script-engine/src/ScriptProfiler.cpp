@@ -0,0 +1,147 @@
+//
+//  ScriptProfiler.cpp
+//  libraries/script-engine/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ScriptProfiler.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include <QtCore/QFileInfo>
+#include <QtScript/QScriptContext>
+#include <QtScript/QScriptContextInfo>
+#include <QtScript/QScriptEngine>
+
+#include <Profile.h>
+#include <SharedUtil.h>
+
+ScriptProfiler::ScriptProfiler(QScriptEngine* engine, int intervalMsecs) :
+    QScriptEngineAgent(engine),
+    _intervalMsecs(std::max(intervalMsecs, 1)),
+    _lastSampleTime(usecTimestampNow())
+{
+    _sampler = std::thread([this] {
+        std::unique_lock<std::mutex> lock(_samplerMutex);
+        while (!_samplerCondition.wait_for(lock, std::chrono::milliseconds(_intervalMsecs), [this] { return _stopSampler; })) {
+            _sampleDue.store(true, std::memory_order_relaxed);
+        }
+    });
+}
+
+ScriptProfiler::~ScriptProfiler() {
+    stop();
+}
+
+void ScriptProfiler::stop() {
+    if (!_sampler.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(_samplerMutex);
+        _stopSampler = true;
+    }
+    _samplerCondition.notify_one();
+    _sampler.join();
+    _sampleDue.store(false, std::memory_order_relaxed);
+}
+
+void ScriptProfiler::beginSection(const QString& name) {
+    maybeSample();
+    _sections.push_back(name);
+}
+
+void ScriptProfiler::endSection() {
+    maybeSample();
+    if (!_sections.isEmpty()) {
+        _sections.pop_back();
+    }
+}
+
+void ScriptProfiler::functionEntry(qint64 scriptId) {
+    if (_depth++ == 0) {
+        _activeSince = usecTimestampNow();
+    }
+    maybeSample();
+}
+
+void ScriptProfiler::functionExit(qint64 scriptId, const QScriptValue& returnValue) {
+    // the engine is still in the function returning, so a sample that fell due during a call to C++ is charged to it
+    maybeSample();
+    _depth = std::max(_depth - 1, 0);
+}
+
+void ScriptProfiler::positionChange(qint64 scriptId, int lineNumber, int columnNumber) {
+    maybeSample();
+}
+
+QString ScriptProfiler::describeFrame(QScriptContext* context) {
+    QScriptContextInfo info(context);
+    QString name = info.functionName();
+    switch (info.functionType()) {
+        case QScriptContextInfo::ScriptFunction:
+            if (name.isEmpty()) {
+                name = "(anonymous)";
+            }
+            return QString("%1 (%2:%3)").arg(name).arg(QFileInfo(info.fileName()).fileName())
+                .arg(info.functionStartLineNumber());
+
+        case QScriptContextInfo::QtFunction:
+        case QScriptContextInfo::QtPropertyFunction: {
+            QObject* object = context->thisObject().toQObject();
+            return object ? QString("%1::%2").arg(object->metaObject()->className()).arg(name) : name;
+        }
+        default:
+            return name.isEmpty() ? "(native)" : name;
+    }
+}
+
+void ScriptProfiler::sample() {
+    _sampleDue.store(false, std::memory_order_relaxed);
+    if (_depth == 0 && _sections.isEmpty()) {
+        // the engine is between sections, running no script, so the time since the last sample isn't the script's
+        _lastSampleTime = usecTimestampNow();
+        return;
+    }
+
+    quint64 now = usecTimestampNow();
+    quint64 usecs = now - std::max(_lastSampleTime, _activeSince);
+    if (_depth == 0) {
+        // top level code, which isn't entered as a function, so we don't know when it started
+        usecs = std::min(usecs, (quint64)_intervalMsecs * USECS_PER_MSEC);
+    }
+    _lastSampleTime = now;
+
+    QStringList frames;
+    for (QScriptContext* context = engine()->currentContext(); context && context->parentContext();
+            context = context->parentContext()) {
+        frames.push_front(describeFrame(context).replace(';', ','));
+    }
+    for (int i = _sections.size() - 1; i >= 0; i--) {
+        frames.push_front(_sections.at(i));
+    }
+    QString stack = frames.join(';');
+
+    _stackUsecs[stack] += usecs;
+    _numSamples++;
+    _sampledUsecs += usecs;
+
+    if (trace_script().isDebugEnabled()) {
+        instant(trace_script(), "scriptSample", "t", { { "stack", stack }, { "usecs", usecs } });
+    }
+}
+
+QString ScriptProfiler::getFoldedStacks() const {
+    QStringList stacks = _stackUsecs.keys();
+    stacks.sort();
+    QString folded;
+    for (const auto& stack : stacks) {
+        folded += QString("%1 %2\n").arg(stack).arg(_stackUsecs.value(stack));
+    }
+    return folded;
+}
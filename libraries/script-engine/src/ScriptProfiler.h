@@ -0,0 +1,82 @@
+//
+//  ScriptProfiler.h
+//  libraries/script-engine/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ScriptProfiler_h
+#define hifi_ScriptProfiler_h
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <QtCore/QHash>
+#include <QtCore/QStringList>
+#include <QtScript/QScriptEngineAgent>
+
+class QScriptContext;
+
+// Samples what a script engine is running, to find where its scripts spend their time.
+//
+// A thread marks a sample due every interval, and the engine's next call, return or statement takes it: the script stack
+// there, with a frame per function named by its script file or C++ class, beneath the section the engine is running it
+// for, like a timer callback.  A sample is charged the script time since the one before, so one that falls due during a
+// long call to C++, like Entities.findEntities(), is charged to that call when it returns.
+//
+// It watches the engine as its QScriptEngineAgent, which stops QtScript compiling scripts, so it slows them while it runs.
+// Apart from the sampling thread it is only used on the engine's thread.
+class ScriptProfiler : public QScriptEngineAgent {
+public:
+    ScriptProfiler(QScriptEngine* engine, int intervalMsecs);
+    ~ScriptProfiler();
+
+    // Stops sampling, keeping what was sampled so far.
+    void stop();
+
+    // Sections nest, and a sample's stack starts with those it is taken in.
+    void beginSection(const QString& name);
+    void endSection();
+
+    // The stacks sampled and the microseconds charged to each, a line per stack with its frames from the outermost,
+    // separated by semicolons, then the microseconds after a space: the folded format that flame graph tools read.
+    QString getFoldedStacks() const;
+    int getNumSamples() const { return _numSamples; }
+    quint64 getSampledUsecs() const { return _sampledUsecs; }
+
+    void functionEntry(qint64 scriptId) override;
+    void functionExit(qint64 scriptId, const QScriptValue& returnValue) override;
+    void positionChange(qint64 scriptId, int lineNumber, int columnNumber) override;
+
+private:
+    void maybeSample() {
+        if (_sampleDue.load(std::memory_order_relaxed)) {
+            sample();
+        }
+    }
+    void sample();
+    static QString describeFrame(QScriptContext* context);
+
+    const int _intervalMsecs;
+    std::atomic<bool> _sampleDue { false };
+    std::mutex _samplerMutex;
+    std::condition_variable _samplerCondition;
+    bool _stopSampler { false };
+    std::thread _sampler;
+
+    int _depth { 0 }; // of script and C++ functions the engine is in
+    quint64 _activeSince { 0 }; // when the engine last went from idle to running script
+    quint64 _lastSampleTime { 0 };
+    QStringList _sections;
+
+    QHash<QString, quint64> _stackUsecs;
+    int _numSamples { 0 };
+    quint64 _sampledUsecs { 0 };
+};
+
+#endif // hifi_ScriptProfiler_h
@@ -0,0 +1,599 @@
+//
+//  AABoxTree.h
+//  libraries/shared/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AABoxTree_h
+#define hifi_AABoxTree_h
+
+#include <float.h>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#define AABOX_TREE_SSE
+#include <xmmintrin.h>
+#endif
+
+#include "AABox.h"
+
+/**
+ * A bounding volume hierarchy over axis-aligned boxes that each carry a payload, for finding which of many boxes
+ * touch a box, a sphere or any other shape, or are hit by a ray, without testing them all.
+ *
+ * Boxes are inserted, moved and removed one at a time, and the tree is rebalanced by rotations as they are, as in
+ * Box2D's dynamic tree.  Each leaf holds its box enlarged by a margin, so that small moves leave the tree as it is;
+ * queries therefore return boxes that come within about that margin of the query, and callers test them exactly.
+ *
+ * The nodes live in one array so that queries walk contiguous memory, and box and ray tests on x86 use SSE.  Any
+ * number of threads may query at once, but not while the tree is being changed.
+ */
+template <typename T>
+class AABoxTree {
+public:
+    using Proxy = int32_t;
+    static const Proxy NULL_PROXY = -1;
+
+    // Returns the proxy that stands for the box until it is removed.
+    Proxy insert(const AABox& box, const T& payload);
+    void remove(Proxy proxy);
+    // Returns false, and leaves the tree as it is, if the box still fits the proxy's enlarged box.
+    bool update(Proxy proxy, const AABox& box);
+    void clear();
+
+    const T& getPayload(Proxy proxy) const { return _payloads[proxy]; }
+    AABox getEnlargedBox(Proxy proxy) const;
+    int getSize() const { return _size; }
+    int getHeight() const { return _root == NULL_PROXY ? 0 : _nodes[_root].height; }
+
+    // Calls visitor(payload) for each box that touches the box.
+    template <typename F> void findTouchingBox(const AABox& box, F visitor) const;
+    // Calls visitor(payload) for each box that touches the sphere.
+    template <typename F> void findTouchingSphere(const glm::vec3& center, float radius, F visitor) const;
+    // Calls visitor(payload) for each box that boxTest(const AABox&) accepts, where boxTest must accept any box
+    // that contains one it accepts.
+    template <typename BoxTest, typename F> void findTouching(BoxTest boxTest, F visitor) const;
+    // Calls visitor(payload, entryDistance) for each box that the ray enters closer than maxDistance, trying nearer
+    // boxes first.  The visitor returns the distance to search within from then on, so that returning the distance to a
+    // hit skips every box beyond it.  Distances are in units of the length of direction.
+    template <typename F>
+    void findRayHits(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, F visitor) const;
+
+private:
+    class Node {
+    public:
+        // w is -FLT_MAX in minimum and FLT_MAX in maximum, so that four-wide tests decide on xyz alone
+        glm::vec4 minimum;
+        glm::vec4 maximum;
+        Proxy parent; // or the next free node, once freed
+        Proxy children[2];
+        int32_t height; // 0 for leaves, -1 for free nodes
+
+        bool isLeaf() const { return children[0] == NULL_PROXY; }
+    };
+
+    // Depth first traversal stack, held on the call stack unless the tree is unusually deep.
+    template <typename Entry>
+    class Stack {
+    public:
+        bool isEmpty() const { return _size == 0; }
+        void push(const Entry& entry) {
+            if (_size < INLINE_CAPACITY) {
+                _inline[_size] = entry;
+            } else {
+                _overflow.push_back(entry);
+            }
+            ++_size;
+        }
+        Entry pop() {
+            --_size;
+            if (_size < INLINE_CAPACITY) {
+                return _inline[_size];
+            }
+            Entry entry = _overflow.back();
+            _overflow.pop_back();
+            return entry;
+        }
+
+    private:
+        static const int INLINE_CAPACITY = 64;
+        Entry _inline[INLINE_CAPACITY];
+        std::vector<Entry> _overflow;
+        int _size { 0 };
+    };
+
+    class RayEntry {
+    public:
+        Proxy node;
+        float distance;
+    };
+
+    Proxy allocateNode();
+    void freeNode(Proxy index);
+    void insertLeaf(Proxy leaf);
+    void removeLeaf(Proxy leaf);
+    void refit(Proxy index);
+    Proxy balance(Proxy index);
+    void replaceChild(Proxy parent, Proxy oldChild, Proxy newChild);
+
+    static glm::vec3 getMargin(const AABox& box);
+    static void setBounds(Node& node, const glm::vec3& minimum, const glm::vec3& maximum);
+    static void setUnion(Node& node, const Node& first, const Node& second);
+    static float surfaceArea(const glm::vec3& minimum, const glm::vec3& maximum);
+    static bool touches(const Node& node, const glm::vec4& minimum, const glm::vec4& maximum);
+    static float rayEntryDistance(const Node& node, const glm::vec4& origin, const glm::vec4& inverseDirection);
+
+    std::vector<Node> _nodes;
+    std::vector<T> _payloads; // parallel to _nodes, so that queries only touch them at leaves
+    Proxy _root { NULL_PROXY };
+    Proxy _freeList { NULL_PROXY };
+    int _size { 0 };
+};
+
+template <typename T>
+const typename AABoxTree<T>::Proxy AABoxTree<T>::NULL_PROXY;
+
+template <typename T>
+typename AABoxTree<T>::Proxy AABoxTree<T>::insert(const AABox& box, const T& payload) {
+    Proxy leaf = allocateNode();
+    glm::vec3 margin = getMargin(box);
+    setBounds(_nodes[leaf], box.getMinimumPoint() - margin, box.getMaximumPoint() + margin);
+    _payloads[leaf] = payload;
+    insertLeaf(leaf);
+    ++_size;
+    return leaf;
+}
+
+template <typename T>
+void AABoxTree<T>::remove(Proxy proxy) {
+    removeLeaf(proxy);
+    freeNode(proxy);
+    --_size;
+}
+
+template <typename T>
+bool AABoxTree<T>::update(Proxy proxy, const AABox& box) {
+    // enlarged boxes that have grown far larger than their box, as when it shrinks, are made again
+    const float MAX_MARGINS = 4.0f;
+    Node& node = _nodes[proxy];
+    glm::vec3 minimum = box.getMinimumPoint();
+    glm::vec3 maximum = box.getMaximumPoint();
+    glm::vec3 margin = getMargin(box);
+    glm::vec3 enlargedMinimum(node.minimum);
+    glm::vec3 enlargedMaximum(node.maximum);
+    if (glm::all(glm::lessThanEqual(enlargedMinimum, minimum)) && glm::all(glm::greaterThanEqual(enlargedMaximum, maximum)) &&
+            glm::all(glm::lessThanEqual(enlargedMaximum - enlargedMinimum, maximum - minimum + MAX_MARGINS * margin))) {
+        return false;
+    }
+    removeLeaf(proxy);
+    setBounds(_nodes[proxy], minimum - margin, maximum + margin);
+    insertLeaf(proxy);
+    return true;
+}
+
+template <typename T>
+void AABoxTree<T>::clear() {
+    _nodes.clear();
+    _payloads.clear();
+    _root = NULL_PROXY;
+    _freeList = NULL_PROXY;
+    _size = 0;
+}
+
+template <typename T>
+AABox AABoxTree<T>::getEnlargedBox(Proxy proxy) const {
+    const Node& node = _nodes[proxy];
+    return AABox(glm::vec3(node.minimum), glm::vec3(node.maximum - node.minimum));
+}
+
+template <typename T>
+template <typename F>
+void AABoxTree<T>::findTouchingBox(const AABox& box, F visitor) const {
+    if (_root == NULL_PROXY) {
+        return;
+    }
+    glm::vec4 minimum(box.getMinimumPoint(), 0.0f);
+    glm::vec4 maximum(box.getMaximumPoint(), 0.0f);
+    Stack<Proxy> stack;
+    stack.push(_root);
+    while (!stack.isEmpty()) {
+        Proxy index = stack.pop();
+        const Node& node = _nodes[index];
+        if (!touches(node, minimum, maximum)) {
+            continue;
+        }
+        if (node.isLeaf()) {
+            visitor(_payloads[index]);
+        } else {
+            stack.push(node.children[1]);
+            stack.push(node.children[0]);
+        }
+    }
+}
+
+template <typename T>
+template <typename F>
+void AABoxTree<T>::findTouchingSphere(const glm::vec3& center, float radius, F visitor) const {
+    if (_root == NULL_PROXY) {
+        return;
+    }
+    // cull by the sphere's bounding box first, which is cheaper, then by the sphere itself
+    glm::vec4 minimum(center - glm::vec3(radius), 0.0f);
+    glm::vec4 maximum(center + glm::vec3(radius), 0.0f);
+    float radiusSquared = radius * radius;
+    Stack<Proxy> stack;
+    stack.push(_root);
+    while (!stack.isEmpty()) {
+        Proxy index = stack.pop();
+        const Node& node = _nodes[index];
+        if (!touches(node, minimum, maximum)) {
+            continue;
+        }
+        glm::vec3 nearest = glm::clamp(center, glm::vec3(node.minimum), glm::vec3(node.maximum));
+        glm::vec3 offset = nearest - center;
+        if (glm::dot(offset, offset) > radiusSquared) {
+            continue;
+        }
+        if (node.isLeaf()) {
+            visitor(_payloads[index]);
+        } else {
+            stack.push(node.children[1]);
+            stack.push(node.children[0]);
+        }
+    }
+}
+
+template <typename T>
+template <typename BoxTest, typename F>
+void AABoxTree<T>::findTouching(BoxTest boxTest, F visitor) const {
+    if (_root == NULL_PROXY) {
+        return;
+    }
+    Stack<Proxy> stack;
+    stack.push(_root);
+    while (!stack.isEmpty()) {
+        Proxy index = stack.pop();
+        const Node& node = _nodes[index];
+        if (!boxTest(AABox(glm::vec3(node.minimum), glm::vec3(node.maximum - node.minimum)))) {
+            continue;
+        }
+        if (node.isLeaf()) {
+            visitor(_payloads[index]);
+        } else {
+            stack.push(node.children[1]);
+            stack.push(node.children[0]);
+        }
+    }
+}
+
+template <typename T>
+template <typename F>
+void AABoxTree<T>::findRayHits(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, F visitor) const {
+    if (_root == NULL_PROXY) {
+        return;
+    }
+    // tiny components stand in for zero ones, so that the slab tests see huge distances rather than NaNs
+    const float MIN_COMPONENT = 1.0e-20f;
+    glm::vec4 inverseDirection(1.0f);
+    for (int i = 0; i < 3; ++i) {
+        float component = direction[i];
+        inverseDirection[i] = 1.0f / (component < 0.0f ? glm::min(component, -MIN_COMPONENT) :
+            glm::max(component, MIN_COMPONENT));
+    }
+    glm::vec4 rayOrigin(origin, 0.0f);
+
+    Stack<RayEntry> stack;
+    float rootDistance = rayEntryDistance(_nodes[_root], rayOrigin, inverseDirection);
+    if (rootDistance < maxDistance) {
+        stack.push({ _root, rootDistance });
+    }
+    while (!stack.isEmpty()) {
+        RayEntry entry = stack.pop();
+        if (entry.distance >= maxDistance) {
+            continue;
+        }
+        const Node& node = _nodes[entry.node];
+        if (node.isLeaf()) {
+            maxDistance = visitor(_payloads[entry.node], entry.distance);
+            continue;
+        }
+        RayEntry nearer { node.children[0], rayEntryDistance(_nodes[node.children[0]], rayOrigin, inverseDirection) };
+        RayEntry farther { node.children[1], rayEntryDistance(_nodes[node.children[1]], rayOrigin, inverseDirection) };
+        if (farther.distance < nearer.distance) {
+            std::swap(nearer, farther);
+        }
+        if (farther.distance < maxDistance) {
+            stack.push(farther);
+        }
+        if (nearer.distance < maxDistance) {
+            stack.push(nearer);
+        }
+    }
+}
+
+template <typename T>
+typename AABoxTree<T>::Proxy AABoxTree<T>::allocateNode() {
+    Proxy index = _freeList;
+    if (index == NULL_PROXY) {
+        index = (Proxy)_nodes.size();
+        _nodes.emplace_back();
+        _payloads.emplace_back();
+    } else {
+        _freeList = _nodes[index].parent;
+    }
+    Node& node = _nodes[index];
+    node.parent = NULL_PROXY;
+    node.children[0] = NULL_PROXY;
+    node.children[1] = NULL_PROXY;
+    node.height = 0;
+    return index;
+}
+
+template <typename T>
+void AABoxTree<T>::freeNode(Proxy index) {
+    Node& node = _nodes[index];
+    node.parent = _freeList;
+    node.height = -1;
+    _payloads[index] = T();
+    _freeList = index;
+}
+
+template <typename T>
+void AABoxTree<T>::insertLeaf(Proxy leaf) {
+    if (_root == NULL_PROXY) {
+        _root = leaf;
+        _nodes[leaf].parent = NULL_PROXY;
+        return;
+    }
+
+    // descend to the sibling that adds the least surface area to the tree, the area being what a query pays for
+    glm::vec3 leafMinimum(_nodes[leaf].minimum);
+    glm::vec3 leafMaximum(_nodes[leaf].maximum);
+    Proxy index = _root;
+    while (!_nodes[index].isLeaf()) {
+        const Node& node = _nodes[index];
+        glm::vec3 minimum(node.minimum);
+        glm::vec3 maximum(node.maximum);
+        float area = surfaceArea(minimum, maximum);
+        float combinedArea = surfaceArea(glm::min(minimum, leafMinimum), glm::max(maximum, leafMaximum));
+
+        // the cost of pairing the leaf with this node, versus pushing it further down, which enlarges this node anyway
+        float cost = 2.0f * combinedArea;
+        float inheritanceCost = 2.0f * (combinedArea - area);
+        float childCosts[2];
+        for (int i = 0; i < 2; ++i) {
+            const Node& child = _nodes[node.children[i]];
+            glm::vec3 childMinimum(child.minimum);
+            glm::vec3 childMaximum(child.maximum);
+            float enlargedArea = surfaceArea(glm::min(childMinimum, leafMinimum), glm::max(childMaximum, leafMaximum));
+            childCosts[i] = inheritanceCost +
+                (child.isLeaf() ? enlargedArea : enlargedArea - surfaceArea(childMinimum, childMaximum));
+        }
+        if (cost < childCosts[0] && cost < childCosts[1]) {
+            break;
+        }
+        index = childCosts[0] < childCosts[1] ? node.children[0] : node.children[1];
+    }
+
+    Proxy sibling = index;
+    Proxy oldParent = _nodes[sibling].parent;
+    Proxy newParent = allocateNode(); // may grow _nodes, so no references are held across it
+    Node& parentNode = _nodes[newParent];
+    parentNode.parent = oldParent;
+    parentNode.children[0] = sibling;
+    parentNode.children[1] = leaf;
+    parentNode.height = _nodes[sibling].height + 1;
+    setUnion(parentNode, _nodes[sibling], _nodes[leaf]);
+    _nodes[sibling].parent = newParent;
+    _nodes[leaf].parent = newParent;
+    if (oldParent == NULL_PROXY) {
+        _root = newParent;
+    } else {
+        replaceChild(oldParent, sibling, newParent);
+    }
+    refit(_nodes[leaf].parent);
+}
+
+template <typename T>
+void AABoxTree<T>::removeLeaf(Proxy leaf) {
+    if (leaf == _root) {
+        _root = NULL_PROXY;
+        return;
+    }
+    Proxy parent = _nodes[leaf].parent;
+    Proxy grandParent = _nodes[parent].parent;
+    Proxy sibling = _nodes[parent].children[0] == leaf ? _nodes[parent].children[1] : _nodes[parent].children[0];
+    _nodes[sibling].parent = grandParent;
+    freeNode(parent);
+    if (grandParent == NULL_PROXY) {
+        _root = sibling;
+    } else {
+        replaceChild(grandParent, parent, sibling);
+        refit(grandParent);
+    }
+}
+
+template <typename T>
+void AABoxTree<T>::refit(Proxy index) {
+    while (index != NULL_PROXY) {
+        index = balance(index);
+        Node& node = _nodes[index];
+        const Node& first = _nodes[node.children[0]];
+        const Node& second = _nodes[node.children[1]];
+        node.height = 1 + glm::max(first.height, second.height);
+        setUnion(node, first, second);
+        index = node.parent;
+    }
+}
+
+// If the heights of a node's children differ by more than one, rotates the taller child up into the node's place.
+// Returns the index of the node now at that place.
+template <typename T>
+typename AABoxTree<T>::Proxy AABoxTree<T>::balance(Proxy iA) {
+    Node& A = _nodes[iA];
+    if (A.isLeaf() || A.height < 2) {
+        return iA;
+    }
+    Proxy iB = A.children[0];
+    Proxy iC = A.children[1];
+    Node& B = _nodes[iB];
+    Node& C = _nodes[iC];
+    int32_t imbalance = C.height - B.height;
+
+    if (imbalance > 1) {
+        Proxy iF = C.children[0];
+        Proxy iG = C.children[1];
+        Node& F = _nodes[iF];
+        Node& G = _nodes[iG];
+        C.children[0] = iA;
+        C.parent = A.parent;
+        A.parent = iC;
+        if (C.parent == NULL_PROXY) {
+            _root = iC;
+        } else {
+            replaceChild(C.parent, iA, iC);
+        }
+        // keep the taller of C's children under C, and give A the other
+        if (F.height > G.height) {
+            C.children[1] = iF;
+            A.children[1] = iG;
+            G.parent = iA;
+            setUnion(A, B, G);
+            setUnion(C, A, F);
+            A.height = 1 + glm::max(B.height, G.height);
+            C.height = 1 + glm::max(A.height, F.height);
+        } else {
+            C.children[1] = iG;
+            A.children[1] = iF;
+            F.parent = iA;
+            setUnion(A, B, F);
+            setUnion(C, A, G);
+            A.height = 1 + glm::max(B.height, F.height);
+            C.height = 1 + glm::max(A.height, G.height);
+        }
+        return iC;
+    }
+
+    if (imbalance < -1) {
+        Proxy iD = B.children[0];
+        Proxy iE = B.children[1];
+        Node& D = _nodes[iD];
+        Node& E = _nodes[iE];
+        B.children[0] = iA;
+        B.parent = A.parent;
+        A.parent = iB;
+        if (B.parent == NULL_PROXY) {
+            _root = iB;
+        } else {
+            replaceChild(B.parent, iA, iB);
+        }
+        if (D.height > E.height) {
+            B.children[1] = iD;
+            A.children[0] = iE;
+            E.parent = iA;
+            setUnion(A, C, E);
+            setUnion(B, A, D);
+            A.height = 1 + glm::max(C.height, E.height);
+            B.height = 1 + glm::max(A.height, D.height);
+        } else {
+            B.children[1] = iE;
+            A.children[0] = iD;
+            D.parent = iA;
+            setUnion(A, C, D);
+            setUnion(B, A, E);
+            A.height = 1 + glm::max(C.height, D.height);
+            B.height = 1 + glm::max(A.height, E.height);
+        }
+        return iB;
+    }
+    return iA;
+}
+
+template <typename T>
+void AABoxTree<T>::replaceChild(Proxy parent, Proxy oldChild, Proxy newChild) {
+    Node& node = _nodes[parent];
+    if (node.children[0] == oldChild) {
+        node.children[0] = newChild;
+    } else {
+        node.children[1] = newChild;
+    }
+}
+
+template <typename T>
+glm::vec3 AABoxTree<T>::getMargin(const AABox& box) {
+    const float MARGIN_FRACTION = 0.1f;
+    const float MIN_MARGIN = 0.05f;
+    return glm::max(box.getDimensions() * MARGIN_FRACTION, glm::vec3(MIN_MARGIN));
+}
+
+template <typename T>
+void AABoxTree<T>::setBounds(Node& node, const glm::vec3& minimum, const glm::vec3& maximum) {
+    node.minimum = glm::vec4(minimum, -FLT_MAX);
+    node.maximum = glm::vec4(maximum, FLT_MAX);
+}
+
+template <typename T>
+void AABoxTree<T>::setUnion(Node& node, const Node& first, const Node& second) {
+    node.minimum = glm::min(first.minimum, second.minimum);
+    node.maximum = glm::max(first.maximum, second.maximum);
+}
+
+template <typename T>
+float AABoxTree<T>::surfaceArea(const glm::vec3& minimum, const glm::vec3& maximum) {
+    glm::vec3 size = maximum - minimum;
+    return size.x * size.y + size.y * size.z + size.z * size.x;
+}
+
+template <typename T>
+bool AABoxTree<T>::touches(const Node& node, const glm::vec4& minimum, const glm::vec4& maximum) {
+#ifdef AABOX_TREE_SSE
+    __m128 below = _mm_cmple_ps(_mm_loadu_ps(&node.minimum.x), _mm_loadu_ps(&maximum.x));
+    __m128 above = _mm_cmpge_ps(_mm_loadu_ps(&node.maximum.x), _mm_loadu_ps(&minimum.x));
+    return _mm_movemask_ps(_mm_and_ps(below, above)) == 0xf;
+#else
+    return glm::all(glm::lessThanEqual(node.minimum, maximum)) && glm::all(glm::greaterThanEqual(node.maximum, minimum));
+#endif
+}
+
+// The distance along the ray to where it enters the node's box: zero if it starts inside, FLT_MAX if it misses.
+template <typename T>
+float AABoxTree<T>::rayEntryDistance(const Node& node, const glm::vec4& origin, const glm::vec4& inverseDirection) {
+    float entry;
+    float exit;
+#ifdef AABOX_TREE_SSE
+    __m128 rayOrigin = _mm_loadu_ps(&origin.x);
+    __m128 inverse = _mm_loadu_ps(&inverseDirection.x);
+    __m128 toMinimum = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&node.minimum.x), rayOrigin), inverse);
+    __m128 toMaximum = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&node.maximum.x), rayOrigin), inverse);
+    __m128 entries = _mm_min_ps(toMinimum, toMaximum);
+    __m128 exits = _mm_max_ps(toMinimum, toMaximum);
+    // the w lanes enter at -FLT_MAX and exit at FLT_MAX, so they drop out of the horizontal max and min
+    entries = _mm_max_ps(entries, _mm_shuffle_ps(entries, entries, _MM_SHUFFLE(2, 3, 0, 1)));
+    entries = _mm_max_ps(entries, _mm_shuffle_ps(entries, entries, _MM_SHUFFLE(1, 0, 3, 2)));
+    exits = _mm_min_ps(exits, _mm_shuffle_ps(exits, exits, _MM_SHUFFLE(2, 3, 0, 1)));
+    exits = _mm_min_ps(exits, _mm_shuffle_ps(exits, exits, _MM_SHUFFLE(1, 0, 3, 2)));
+    entry = _mm_cvtss_f32(entries);
+    exit = _mm_cvtss_f32(exits);
+#else
+    glm::vec3 toMinimum = (glm::vec3(node.minimum) - glm::vec3(origin)) * glm::vec3(inverseDirection);
+    glm::vec3 toMaximum = (glm::vec3(node.maximum) - glm::vec3(origin)) * glm::vec3(inverseDirection);
+    glm::vec3 entries = glm::min(toMinimum, toMaximum);
+    glm::vec3 exits = glm::max(toMinimum, toMaximum);
+    entry = glm::max(entries.x, glm::max(entries.y, entries.z));
+    exit = glm::min(exits.x, glm::min(exits.y, exits.z));
+#endif
+    if (exit < entry || exit < 0.0f) {
+        return FLT_MAX;
+    }
+    return glm::max(entry, 0.0f);
+}
+
+#endif // hifi_AABoxTree_h
@@ -0,0 +1,57 @@
+//
+//  RadixSort.h
+//  libraries/shared/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_RadixSort_h
+#define hifi_RadixSort_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/**
+ * Sorts unsigned integer keys in linear time, one byte at a time starting from the least significant,
+ * which keeps keys that compare equal in their original order.
+ *
+ * Only the bytes [firstByte, sizeof(UInt)) are compared, so lower bytes can carry a payload, like the
+ * index of the sorted element.  Unlike radix2InplaceSort() it needs scratch space as large as the keys,
+ * but it reads every key only twice per byte and skips the bytes that every key has in common, which
+ * makes it the faster of the two past a few hundred keys.
+ */
+template <typename UInt>
+void radixSort(std::vector<UInt>& keys, std::vector<UInt>& scratch, int firstByte = 0) {
+    const int NUM_BUCKETS = 256;
+    const int BITS_PER_BYTE = 8;
+    size_t numKeys = keys.size();
+    scratch.resize(numKeys);
+
+    for (int byte = firstByte; byte < (int)sizeof(UInt); ++byte) {
+        int shift = byte * BITS_PER_BYTE;
+        size_t offsets[NUM_BUCKETS] = { 0 };
+        for (auto key : keys) {
+            offsets[(key >> shift) & (NUM_BUCKETS - 1)]++;
+        }
+        if (numKeys == 0 || offsets[(keys[0] >> shift) & (NUM_BUCKETS - 1)] == numKeys) {
+            continue;
+        }
+
+        size_t offset = 0;
+        for (int i = 0; i < NUM_BUCKETS; ++i) {
+            size_t count = offsets[i];
+            offsets[i] = offset;
+            offset += count;
+        }
+        for (auto key : keys) {
+            scratch[offsets[(key >> shift) & (NUM_BUCKETS - 1)]++] = key;
+        }
+        keys.swap(scratch);
+    }
+}
+
+#endif // hifi_RadixSort_h
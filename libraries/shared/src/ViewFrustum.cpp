@@ -21,6 +21,10 @@
 
 #include <QtCore/QDebug>
 
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#include <emmintrin.h>
+#endif
+
 #include "GeometryUtil.h"
 #include "GLMHelpers.h"
 #include "NumericalConstants.h"
@@ -231,6 +235,75 @@ bool ViewFrustum::boxInsideFrustum(const AABox& box) const {
     return true;
 }
 
+// Tests each box against the planes with the vertex farthest along each plane normal, or the nearest one,
+// computed the same way as AABox::getFarthestVertex() and getNearestVertex() so the results match exactly.
+static void testBoxesAgainstPlanes(const ::Plane* planes, bool useNearestVertex, const AABox* boxes, size_t numBoxes,
+                                   size_t stride, uint8_t* results) {
+    auto getBox = [&](size_t i) -> const AABox& {
+        return *reinterpret_cast<const AABox*>(reinterpret_cast<const uint8_t*>(boxes) + i * stride);
+    };
+
+    size_t i = 0;
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+    // four boxes at a time, one plane at a time
+    for (; i + 4 <= numBoxes; i += 4) {
+        const AABox& box0 = getBox(i);
+        const AABox& box1 = getBox(i + 1);
+        const AABox& box2 = getBox(i + 2);
+        const AABox& box3 = getBox(i + 3);
+        __m128 cornerX = _mm_setr_ps(box0.getCorner().x, box1.getCorner().x, box2.getCorner().x, box3.getCorner().x);
+        __m128 cornerY = _mm_setr_ps(box0.getCorner().y, box1.getCorner().y, box2.getCorner().y, box3.getCorner().y);
+        __m128 cornerZ = _mm_setr_ps(box0.getCorner().z, box1.getCorner().z, box2.getCorner().z, box3.getCorner().z);
+        __m128 oppositeX = _mm_add_ps(cornerX, _mm_setr_ps(box0.getScale().x, box1.getScale().x, box2.getScale().x, box3.getScale().x));
+        __m128 oppositeY = _mm_add_ps(cornerY, _mm_setr_ps(box0.getScale().y, box1.getScale().y, box2.getScale().y, box3.getScale().y));
+        __m128 oppositeZ = _mm_add_ps(cornerZ, _mm_setr_ps(box0.getScale().z, box1.getScale().z, box2.getScale().z, box3.getScale().z));
+
+        __m128 passes = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (int j = 0; j < NUM_FRUSTUM_PLANES; j++) {
+            const glm::vec3& normal = planes[j].getNormal();
+            bool useOppositeX = useNearestVertex ? (normal.x < 0.0f) : (normal.x > 0.0f);
+            bool useOppositeY = useNearestVertex ? (normal.y < 0.0f) : (normal.y > 0.0f);
+            bool useOppositeZ = useNearestVertex ? (normal.z < 0.0f) : (normal.z > 0.0f);
+            __m128 vertexX = useOppositeX ? oppositeX : cornerX;
+            __m128 vertexY = useOppositeY ? oppositeY : cornerY;
+            __m128 vertexZ = useOppositeZ ? oppositeZ : cornerZ;
+
+            __m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(normal.x), vertexX), _mm_mul_ps(_mm_set1_ps(normal.y), vertexY)),
+                                    _mm_mul_ps(_mm_set1_ps(normal.z), vertexZ));
+            __m128 distance = _mm_add_ps(_mm_set1_ps(planes[j].getDCoefficient()), dot);
+            passes = _mm_and_ps(passes, _mm_cmpnlt_ps(distance, _mm_setzero_ps()));
+        }
+
+        int mask = _mm_movemask_ps(passes);
+        results[i] = (uint8_t)(mask & 1);
+        results[i + 1] = (uint8_t)((mask >> 1) & 1);
+        results[i + 2] = (uint8_t)((mask >> 2) & 1);
+        results[i + 3] = (uint8_t)((mask >> 3) & 1);
+    }
+#endif
+
+    // portable reference code
+    for (; i < numBoxes; i++) {
+        const AABox& box = getBox(i);
+        bool passes = true;
+        for (int j = 0; j < NUM_FRUSTUM_PLANES && passes; j++) {
+            const glm::vec3& normal = planes[j].getNormal();
+            glm::vec3 vertex = useNearestVertex ? box.getNearestVertex(normal) : box.getFarthestVertex(normal);
+            passes = !(planes[j].distance(vertex) < 0.0f);
+        }
+        results[i] = (uint8_t)passes;
+    }
+}
+
+void ViewFrustum::boxesIntersectFrustum(const AABox* boxes, size_t numBoxes, size_t stride, uint8_t* results) const {
+    testBoxesAgainstPlanes(_planes, false, boxes, numBoxes, stride, results);
+}
+
+void ViewFrustum::boxesInsideFrustum(const AABox* boxes, size_t numBoxes, size_t stride, uint8_t* results) const {
+    testBoxesAgainstPlanes(_planes, true, boxes, numBoxes, stride, results);
+}
+
 bool ViewFrustum::sphereIntersectsKeyhole(const glm::vec3& center, float radius) const {
     // check positive touch against central sphere
     if (glm::length(center - _position) <= (radius + _centerSphereRadius)) {
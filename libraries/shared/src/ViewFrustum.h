@@ -107,6 +107,11 @@ public:
     bool boxIntersectsFrustum(const AABox& box) const;
     bool boxInsideFrustum(const AABox& box) const;
 
+    // Same as boxIntersectsFrustum() and boxInsideFrustum() for numBoxes boxes at once, setting results[i] to 0 or 1.
+    // The boxes are read stride bytes apart, so they can be members of a larger struct.
+    void boxesIntersectFrustum(const AABox* boxes, size_t numBoxes, size_t stride, uint8_t* results) const;
+    void boxesInsideFrustum(const AABox* boxes, size_t numBoxes, size_t stride, uint8_t* results) const;
+
     bool sphereIntersectsKeyhole(const glm::vec3& center, float radius) const;
     bool cubeIntersectsKeyhole(const AACube& cube) const;
     bool boxIntersectsKeyhole(const AABox& box) const;
@@ -10,9 +10,11 @@
 #ifndef hifi_ReadWriteLockable_h
 #define hifi_ReadWriteLockable_h
 
+#include <atomic>
 #include <utility>
 
 #include <QtCore/QReadWriteLock>
+#include <QtCore/QThread>
 
 #include "QTryReadLocker.h"
 #include "QTryWriteLocker.h"
@@ -53,14 +55,37 @@ public:
 
     QReadWriteLock& getLock() const { return _lock; }
 
+    // Only true while the calling thread holds the write lock taken through one of the methods above
+    bool isWriteLockedByCurrentThread() const { return _writeLockOwner.load() == QThread::currentThreadId(); }
+
 private:
+    // Notes the thread holding the write lock for as long as it is held, including recursively
+    class WriteLockOwner {
+    public:
+        WriteLockOwner(const ReadWriteLockable& lockable) : _lockable(lockable) {
+            if (_lockable._writeLockDepth++ == 0) {
+                _lockable._writeLockOwner.store(QThread::currentThreadId());
+            }
+        }
+        ~WriteLockOwner() {
+            if (--_lockable._writeLockDepth == 0) {
+                _lockable._writeLockOwner.store(nullptr);
+            }
+        }
+    private:
+        const ReadWriteLockable& _lockable;
+    };
+
     mutable QReadWriteLock _lock { QReadWriteLock::Recursive };
+    mutable std::atomic<Qt::HANDLE> _writeLockOwner { nullptr };
+    mutable int _writeLockDepth { 0 }; // only touched by the thread holding the write lock
 };
 
 // ReadWriteLockable
 template <typename F>
 inline void ReadWriteLockable::withWriteLock(F&& f) const {
     QWriteLocker locker(&_lock);
+    WriteLockOwner owner(*this);
     f();
 }
 
@@ -87,6 +112,7 @@ template <typename F>
 inline bool ReadWriteLockable::withTryWriteLock(F&& f) const {
     QTryWriteLocker locker(&_lock);
     if (locker.isLocked()) {
+        WriteLockOwner owner(*this);
         f();
         return true;
     }
@@ -97,6 +123,7 @@ template <typename F>
 inline bool ReadWriteLockable::withTryWriteLock(F&& f, int timeout) const {
     QTryWriteLocker locker(&_lock, timeout);
     if (locker.isLocked()) {
+        WriteLockOwner owner(*this);
         f();
         return true;
     }
@@ -18,6 +18,10 @@
 
 #include <glm/gtx/quaternion.hpp>
 
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#include <emmintrin.h>
+#endif
+
 using namespace workload;
 
 Space::Space() : Collection() {
@@ -38,6 +42,12 @@ void Space::processTransactionFrame(const Transaction& transaction) {
     processResets(transaction._resetItems);
     processUpdates(transaction._updatedItems);
     processRemoves(transaction._removedItems);
+
+    if (_dirtyProxies.size() > _proxies.size()) {
+        // nobody is categorizing, don't grow without bound
+        _dirtyProxies.clear();
+        _needsFullCategorization = true;
+    }
 }
 
 void Space::processResets(const Transaction::Resets& transactions) {
@@ -56,6 +66,9 @@ void Space::processResets(const Transaction::Resets& transactions) {
         item.prevRegion = item.region = Region::UNKNOWN;
 
         _owners[proxyID] = (std::get<2>(reset));
+
+        _grid.update(proxyID, item.sphere);
+        _dirtyProxies.push_back(proxyID);
     }
 }
 
@@ -72,6 +85,8 @@ void Space::processRemoves(const Transaction::Removes& transactions) {
         // Kill it
         item.prevRegion = item.region = Region::INVALID;
         _owners[removedID] = Owner();
+
+        _grid.remove(removedID);
     }
 }
 
@@ -87,15 +102,146 @@ void Space::processUpdates(const Transaction::Updates& transactions) {
 
         // Update the item
         item.sphere = (std::get<1>(update));
+
+        _grid.update(updateID, item.sphere);
+        _dirtyProxies.push_back(updateID);
+    }
+}
+
+static bool haveSameRegions(const Views& a, const Views& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        for (uint32_t j = 0; j < Region::NUM_TRACKED_REGIONS; ++j) {
+            if (a[i].regions[j] != b[i].regions[j]) {
+                return false;
+            }
+        }
     }
+    return true;
 }
 
 void Space::categorizeAndGetChanges(std::vector<Space::Change>& changes) {
     std::unique_lock<std::mutex> lock(_proxiesMutex);
-    uint32_t numProxies = (uint32_t)_proxies.size();
+
+    // proxies that are not categorized again keep their region, so only those that changed last time
+    // need their prevRegion brought up to date.
+    for (auto proxyID : _changedProxies) {
+        Proxy& proxy = _proxies[proxyID];
+        if (proxy.region < Region::INVALID) {
+            proxy.prevRegion = proxy.region;
+        }
+    }
+    _changedProxies.clear();
+
+    if (_needsFullCategorization || _views.size() != _categorizedViews.size()) {
+        _proxiesToCategorize.resize(_proxies.size());
+        for (uint32_t i = 0; i < (uint32_t)_proxies.size(); ++i) {
+            _proxiesToCategorize[i] = (int32_t)i;
+        }
+        _needsFullCategorization = false;
+    } else {
+        _proxiesToCategorize.swap(_dirtyProxies);
+        if (!haveSameRegions(_views, _categorizedViews)) {
+            _grid.findProxiesNearRegionChanges(_categorizedViews, _views, _proxiesToCategorize);
+        }
+
+        // a proxy may be both dirty and near a boundary, or updated more than once
+        _isQueued.resize(_proxies.size(), false);
+        size_t numToCategorize = 0;
+        for (auto proxyID : _proxiesToCategorize) {
+            if (!_isQueued[proxyID]) {
+                _isQueued[proxyID] = true;
+                _proxiesToCategorize[numToCategorize++] = proxyID;
+            }
+        }
+        _proxiesToCategorize.resize(numToCategorize);
+        for (auto proxyID : _proxiesToCategorize) {
+            _isQueued[proxyID] = false;
+        }
+    }
+    _dirtyProxies.clear();
+    _categorizedViews = _views;
+
+    categorizeProxies(_proxiesToCategorize.data(), (uint32_t)_proxiesToCategorize.size(), changes);
+    _proxiesToCategorize.clear();
+}
+
+void Space::categorizeProxies(const int32_t* proxyIDs, uint32_t numProxyIDs, std::vector<Change>& changes) {
     uint32_t numViews = (uint32_t)_views.size();
-    for (uint32_t i = 0; i < numProxies; ++i) {
-        Proxy& proxy = _proxies[i];
+
+    auto setRegion = [&](int32_t proxyID, uint8_t region) {
+        Proxy& proxy = _proxies[proxyID];
+        proxy.prevRegion = proxy.region;
+        proxy.region = region;
+        if (proxy.region != proxy.prevRegion) {
+            changes.emplace_back(Space::Change(proxyID, proxy.region, proxy.prevRegion));
+            _changedProxies.push_back(proxyID);
+        }
+    };
+
+    uint32_t i = 0;
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+    // four proxies at a time: a proxy's region is the lowest region it touches in any view
+    const uint32_t BATCH_SIZE = 4;
+    int32_t batch[BATCH_SIZE];
+    uint32_t batchSize = 0;
+    for (; i < numProxyIDs; ++i) {
+        int32_t proxyID = proxyIDs[i];
+        if (_proxies[proxyID].region >= Region::INVALID) {
+            continue;
+        }
+        batch[batchSize++] = proxyID;
+        if (batchSize < BATCH_SIZE) {
+            continue;
+        }
+        batchSize = 0;
+
+        const Sphere& s0 = _proxies[batch[0]].sphere;
+        const Sphere& s1 = _proxies[batch[1]].sphere;
+        const Sphere& s2 = _proxies[batch[2]].sphere;
+        const Sphere& s3 = _proxies[batch[3]].sphere;
+        __m128 x = _mm_setr_ps(s0.x, s1.x, s2.x, s3.x);
+        __m128 y = _mm_setr_ps(s0.y, s1.y, s2.y, s3.y);
+        __m128 z = _mm_setr_ps(s0.z, s1.z, s2.z, s3.z);
+        __m128 radius = _mm_setr_ps(s0.w, s1.w, s2.w, s3.w);
+
+        const __m128 outside = _mm_set1_ps((float)Region::R4);
+        __m128 region = outside;
+        for (uint32_t j = 0; j < numViews; ++j) {
+            auto& view = _views[j];
+            for (uint32_t k = 0; k < Region::NUM_TRACKED_REGIONS; ++k) {
+                const Sphere& regionSphere = view.regions[k];
+                __m128 dx = _mm_sub_ps(x, _mm_set1_ps(regionSphere.x));
+                __m128 dy = _mm_sub_ps(y, _mm_set1_ps(regionSphere.y));
+                __m128 dz = _mm_sub_ps(z, _mm_set1_ps(regionSphere.z));
+                __m128 distance2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+                __m128 touchDistance = _mm_add_ps(radius, _mm_set1_ps(regionSphere.w));
+                __m128 touches = _mm_cmplt_ps(distance2, _mm_mul_ps(touchDistance, touchDistance));
+                __m128 touchedRegion = _mm_or_ps(_mm_and_ps(touches, _mm_set1_ps((float)k)), _mm_andnot_ps(touches, outside));
+                region = _mm_min_ps(region, touchedRegion);
+            }
+        }
+
+        float regions[BATCH_SIZE];
+        _mm_storeu_ps(regions, region);
+        for (uint32_t j = 0; j < BATCH_SIZE; ++j) {
+            setRegion(batch[j], (uint8_t)regions[j]);
+        }
+    }
+
+    // finish the last partial batch below
+    proxyIDs = batch;
+    numProxyIDs = batchSize;
+    i = 0;
+#endif
+
+    // portable reference code
+    for (; i < numProxyIDs; ++i) {
+        int32_t proxyID = proxyIDs[i];
+        Proxy& proxy = _proxies[proxyID];
         if (proxy.region < Region::INVALID) {
             glm::vec3 proxyCenter = glm::vec3(proxy.sphere);
             float proxyRadius = proxy.sphere.w;
@@ -111,11 +257,7 @@ void Space::categorizeAndGetChanges(std::vector<Space::Change>& changes) {
                     }
                 }
             }
-            proxy.prevRegion = proxy.region;
-            proxy.region = region;
-            if (proxy.region != proxy.prevRegion) {
-                changes.emplace_back(Space::Change((int32_t)i, proxy.region, proxy.prevRegion));
-            }
+            setRegion(proxyID, region);
         }
     }
 }
@@ -161,6 +303,12 @@ void Space::clear() {
     _IDAllocator.clear();
     _proxies.clear();
     _owners.clear();
+    _grid.clear();
+    _dirtyProxies.clear();
+    _changedProxies.clear();
+    _isQueued.clear();
+    _categorizedViews.clear();
+    _needsFullCategorization = true;
     _views.clear();
 }
 
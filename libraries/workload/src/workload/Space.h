@@ -19,6 +19,7 @@
 #include <vector>
 #include <glm/glm.hpp>
 
+#include "SpaceGrid.h"
 #include "Transaction.h"
 
 namespace workload {
@@ -60,11 +61,23 @@ private:
     void processRemoves(const Transaction::Removes& transactions);
     void processUpdates(const Transaction::Updates& transactions);
 
+    void categorizeProxies(const int32_t* proxyIDs, uint32_t numProxyIDs, std::vector<Change>& changes);
+
     // The database of proxies is protected for editing by a mutex
     mutable std::mutex _proxiesMutex;
     Proxy::Vector _proxies;
     std::vector<Owner> _owners;
 
+    // Only the proxies that were reset or updated since the last categorization, and those the grid finds near the
+    // boundaries of regions that moved, can change region.
+    SpaceGrid _grid;
+    std::vector<int32_t> _dirtyProxies;
+    std::vector<int32_t> _proxiesToCategorize;
+    std::vector<int32_t> _changedProxies;
+    std::vector<bool> _isQueued;  // by proxyID, only set while removing duplicates from _proxiesToCategorize
+    Views _categorizedViews;
+    bool _needsFullCategorization { true };
+
     Views _views;
 };
 
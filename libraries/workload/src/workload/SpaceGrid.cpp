@@ -0,0 +1,241 @@
+//
+//  SpaceGrid.cpp
+//  libraries/workload/src/workload
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SpaceGrid.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+using namespace workload;
+
+// proxies are bucketed into cells by their center, and cells into blocks of CELLS_PER_BLOCK^3 cells,
+// so that whole blocks far from any region boundary are skipped with a single test.
+static const float CELL_SIZE = 64.0f;
+static const int32_t CELLS_PER_BLOCK = 4;
+static const float BLOCK_SIZE = CELL_SIZE * (float)CELLS_PER_BLOCK;
+
+// a proxy bigger than its cell would make the cell overlap every region boundary near it.
+static const float MAX_CELL_PROXY_RADIUS = CELL_SIZE;
+
+static const float EMPTY_CELL_RADIUS = -1.0f;
+
+// keeps the bounds tests conservative in the face of float rounding, next to the exact per proxy tests.
+static const float INSIDE_MARGIN = 0.9999f;
+static const float OUTSIDE_MARGIN = 1.0001f;
+
+static uint64_t computeKey(const glm::ivec3& coord) {
+    const int32_t OFFSET = 1 << 20;
+    const uint64_t MASK = (1 << 21) - 1;
+    return (((uint64_t)(coord.x + OFFSET) & MASK) << 42) | (((uint64_t)(coord.y + OFFSET) & MASK) << 21) |
+        ((uint64_t)(coord.z + OFFSET) & MASK);
+}
+
+static int32_t floorDivide(int32_t value, int32_t divisor) {
+    return (value >= 0) ? (value / divisor) : ((value - divisor + 1) / divisor);
+}
+
+static float computeFarthestDistance2(const glm::vec3& boxMin, const glm::vec3& boxMax, const glm::vec3& point) {
+    glm::vec3 farthest = glm::max(glm::abs(point - boxMin), glm::abs(point - boxMax));
+    return glm::dot(farthest, farthest);
+}
+
+static float computeNearestDistance2(const glm::vec3& boxMin, const glm::vec3& boxMax, const glm::vec3& point) {
+    glm::vec3 nearest = glm::clamp(point, boxMin, boxMax) - point;
+    return glm::dot(nearest, nearest);
+}
+
+// whether the spheres of the proxies centered in the box, no bigger than maxRadius, may touch the region
+// differently before and after it moved.  They don't when they all touch it both times, or none of them do.
+// Written without branches, since it runs for every cell near the regions.
+static bool mayCrossRegion(const glm::vec3& boxMin, const glm::vec3& boxMax, float maxRadius, const Sphere& prevRegion, const Sphere& region) {
+    float prevTouchDistance = prevRegion.w + maxRadius;
+    float touchDistance = region.w + maxRadius;
+    bool wasInside = computeFarthestDistance2(boxMin, boxMax, glm::vec3(prevRegion)) < prevRegion.w * prevRegion.w * INSIDE_MARGIN;
+    bool isInside = computeFarthestDistance2(boxMin, boxMax, glm::vec3(region)) < region.w * region.w * INSIDE_MARGIN;
+    bool wasOutside = computeNearestDistance2(boxMin, boxMax, glm::vec3(prevRegion)) >= prevTouchDistance * prevTouchDistance * OUTSIDE_MARGIN;
+    bool isOutside = computeNearestDistance2(boxMin, boxMax, glm::vec3(region)) >= touchDistance * touchDistance * OUTSIDE_MARGIN;
+    return !((wasInside & isInside) | (wasOutside & isOutside));
+}
+
+void SpaceGrid::update(int32_t proxyID, const Sphere& sphere) {
+    if (proxyID < 0) {
+        return;
+    }
+    if (proxyID >= (int32_t)_entries.size()) {
+        _entries.resize(proxyID + 1);
+    }
+    Entry& entry = _entries[proxyID];
+
+    glm::vec3 center = glm::vec3(sphere);
+    float radius = sphere.w;
+    bool isFinite = std::isfinite(center.x) && std::isfinite(center.y) && std::isfinite(center.z);
+    if (!isFinite || !(radius >= 0.0f && radius <= MAX_CELL_PROXY_RADIUS)) {
+        if (entry.cell != OVERSIZED_CELL) {
+            removeFromCell(proxyID, entry);
+            entry.cell = OVERSIZED_CELL;
+            entry.slot = (int32_t)_oversizedProxies.size();
+            _oversizedProxies.push_back(proxyID);
+        }
+        return;
+    }
+
+    glm::ivec3 coord = glm::ivec3(glm::floor(center / CELL_SIZE));
+    if (entry.cell < 0 || _cells[entry.cell].coord != coord) {
+        removeFromCell(proxyID, entry);
+        int32_t cellIndex = findOrAddCell(coord);
+        Cell& cell = _cells[cellIndex];
+        entry.cell = cellIndex;
+        entry.slot = (int32_t)cell.proxies.size();
+        cell.proxies.push_back(proxyID);
+        _blocks[cell.block].numProxies++;
+    }
+
+    // the bounds only ever grow while a cell is in use, which keeps them conservative
+    Cell& cell = _cells[entry.cell];
+    Block& block = _blocks[cell.block];
+    float& cellMaxRadius = block.cellBounds[cell.blockSlot].w;
+    cellMaxRadius = std::max(cellMaxRadius, radius);
+    block.maxRadius = std::max(block.maxRadius, radius);
+}
+
+void SpaceGrid::remove(int32_t proxyID) {
+    if (proxyID >= 0 && proxyID < (int32_t)_entries.size()) {
+        removeFromCell(proxyID, _entries[proxyID]);
+    }
+}
+
+void SpaceGrid::clear() {
+    _entries.clear();
+    _cells.clear();
+    _blocks.clear();
+    _cellIndices.clear();
+    _blockIndices.clear();
+    _oversizedProxies.clear();
+}
+
+int32_t SpaceGrid::findOrAddCell(const glm::ivec3& coord) {
+    auto cellItr = _cellIndices.find(computeKey(coord));
+    if (cellItr != _cellIndices.end()) {
+        return cellItr->second;
+    }
+
+    glm::ivec3 blockCoord(floorDivide(coord.x, CELLS_PER_BLOCK), floorDivide(coord.y, CELLS_PER_BLOCK),
+                          floorDivide(coord.z, CELLS_PER_BLOCK));
+    int32_t blockIndex;
+    auto blockItr = _blockIndices.find(computeKey(blockCoord));
+    if (blockItr != _blockIndices.end()) {
+        blockIndex = blockItr->second;
+    } else {
+        blockIndex = (int32_t)_blocks.size();
+        _blocks.emplace_back();
+        _blocks.back().coord = blockCoord;
+        _blockIndices[computeKey(blockCoord)] = blockIndex;
+    }
+
+    int32_t cellIndex = (int32_t)_cells.size();
+    _cells.emplace_back();
+    _cells.back().coord = coord;
+    _cells.back().block = blockIndex;
+    _cellIndices[computeKey(coord)] = cellIndex;
+    Block& block = _blocks[blockIndex];
+    _cells.back().blockSlot = (int32_t)block.cells.size();
+    block.cells.push_back(cellIndex);
+    block.cellBounds.push_back(glm::vec4(glm::vec3(coord) * CELL_SIZE, EMPTY_CELL_RADIUS));
+    return cellIndex;
+}
+
+void SpaceGrid::removeFromCell(int32_t proxyID, Entry& entry) {
+    std::vector<int32_t>* proxies = nullptr;
+    if (entry.cell == OVERSIZED_CELL) {
+        proxies = &_oversizedProxies;
+    } else if (entry.cell >= 0) {
+        proxies = &(_cells[entry.cell].proxies);
+    }
+
+    if (proxies) {
+        // swap the last proxy of the cell into the slot of the removed one
+        int32_t lastProxyID = proxies->back();
+        (*proxies)[entry.slot] = lastProxyID;
+        _entries[lastProxyID].slot = entry.slot;
+        proxies->pop_back();
+
+        if (entry.cell >= 0) {
+            Cell& cell = _cells[entry.cell];
+            Block& block = _blocks[cell.block];
+            block.numProxies--;
+            if (cell.proxies.empty()) {
+                block.cellBounds[cell.blockSlot].w = EMPTY_CELL_RADIUS;
+            }
+            if (block.numProxies == 0) {
+                block.maxRadius = 0.0f;
+            }
+        }
+    }
+    entry.cell = NO_CELL;
+}
+
+void SpaceGrid::findProxiesNearRegionChanges(const Views& prevViews, const Views& views, std::vector<int32_t>& proxyIDs) const {
+    assert(prevViews.size() == views.size());
+
+    // a region that did not move changes nothing for the proxies that did not move either,
+    // regions are numbered view * NUM_TRACKED_REGIONS + region.
+    std::vector<uint32_t> movedRegions;
+    for (uint32_t i = 0; i < (uint32_t)views.size(); ++i) {
+        for (uint32_t j = 0; j < Region::NUM_TRACKED_REGIONS; ++j) {
+            if (prevViews[i].regions[j] != views[i].regions[j]) {
+                movedRegions.push_back(i * Region::NUM_TRACKED_REGIONS + j);
+            }
+        }
+    }
+
+    if (!movedRegions.empty()) {
+        std::vector<uint32_t> blockRegions;
+        std::vector<uint8_t> cellMayCross;
+        for (auto& block : _blocks) {
+            if (block.numProxies == 0) {
+                continue;
+            }
+            glm::vec3 blockMin = glm::vec3(block.coord) * BLOCK_SIZE;
+            glm::vec3 blockMax = blockMin + glm::vec3(BLOCK_SIZE);
+            blockRegions.clear();
+            for (auto region : movedRegions) {
+                const Sphere& prevSphere = prevViews[region / Region::NUM_TRACKED_REGIONS].regions[region % Region::NUM_TRACKED_REGIONS];
+                const Sphere& sphere = views[region / Region::NUM_TRACKED_REGIONS].regions[region % Region::NUM_TRACKED_REGIONS];
+                if (mayCrossRegion(blockMin, blockMax, block.maxRadius, prevSphere, sphere)) {
+                    blockRegions.push_back(region);
+                }
+            }
+            if (blockRegions.empty()) {
+                continue;
+            }
+
+            // the cells only need testing against the regions that cross their block
+            size_t numCells = block.cells.size();
+            cellMayCross.assign(numCells, 0);
+            for (auto region : blockRegions) {
+                const Sphere& prevSphere = prevViews[region / Region::NUM_TRACKED_REGIONS].regions[region % Region::NUM_TRACKED_REGIONS];
+                const Sphere& sphere = views[region / Region::NUM_TRACKED_REGIONS].regions[region % Region::NUM_TRACKED_REGIONS];
+                for (size_t i = 0; i < numCells; ++i) {
+                    const glm::vec4& bounds = block.cellBounds[i];
+                    glm::vec3 cellMin = glm::vec3(bounds);
+                    cellMayCross[i] |= (uint8_t)mayCrossRegion(cellMin, cellMin + glm::vec3(CELL_SIZE), bounds.w, prevSphere, sphere);
+                }
+            }
+            for (size_t i = 0; i < numCells; ++i) {
+                if (cellMayCross[i] && block.cellBounds[i].w >= 0.0f) {
+                    const Cell& cell = _cells[block.cells[i]];
+                    proxyIDs.insert(proxyIDs.end(), cell.proxies.begin(), cell.proxies.end());
+                }
+            }
+        }
+    }
+    proxyIDs.insert(proxyIDs.end(), _oversizedProxies.begin(), _oversizedProxies.end());
+}
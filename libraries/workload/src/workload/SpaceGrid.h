@@ -0,0 +1,84 @@
+//
+//  SpaceGrid.h
+//  libraries/workload/src/workload
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+#ifndef hifi_workload_SpaceGrid_h
+#define hifi_workload_SpaceGrid_h
+
+#include <unordered_map>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "View.h"
+
+namespace workload {
+
+// A two level loose grid of proxy spheres, bucketed by center.  Space keeps it up to date as proxies are
+// reset, updated and removed, and uses it to find the few proxies that could change region when the views move:
+// a cell whose bounds are entirely inside or entirely outside of every region sphere, both before and after the
+// move, holds no such proxy.
+class SpaceGrid {
+public:
+    SpaceGrid() = default;
+
+    // adds the proxy, or moves it to the cell of its new sphere
+    void update(int32_t proxyID, const Sphere& sphere);
+    void remove(int32_t proxyID);
+    void clear();
+
+    uint32_t getNumCells() const { return (uint32_t)_cells.size(); }
+
+    // appends the proxies whose overlap with any region sphere may differ between prevViews and views,
+    // which must have the same number of views.
+    void findProxiesNearRegionChanges(const Views& prevViews, const Views& views, std::vector<int32_t>& proxyIDs) const;
+
+private:
+    class Cell {
+    public:
+        glm::ivec3 coord;
+        int32_t block { 0 };
+        int32_t blockSlot { 0 };
+        std::vector<int32_t> proxies;
+    };
+
+    class Block {
+    public:
+        glm::ivec3 coord;
+        float maxRadius { 0.0f };
+        uint32_t numProxies { 0 };
+        std::vector<int32_t> cells;
+        // parallel to cells and packed together so that finding the cells near a boundary stays in cache:
+        // the min corner of the cell and the radius of its biggest proxy, negative when it has none.
+        std::vector<glm::vec4> cellBounds;
+    };
+
+    class Entry {
+    public:
+        int32_t cell { NO_CELL };
+        int32_t slot { 0 };
+    };
+
+    static const int32_t NO_CELL { -1 };
+    static const int32_t OVERSIZED_CELL { -2 };
+
+    int32_t findOrAddCell(const glm::ivec3& coord);
+    void removeFromCell(int32_t proxyID, Entry& entry);
+
+    std::vector<Entry> _entries;  // by proxyID
+    std::vector<Cell> _cells;
+    std::vector<Block> _blocks;
+    std::unordered_map<uint64_t, int32_t> _cellIndices;
+    std::unordered_map<uint64_t, int32_t> _blockIndices;
+
+    // proxies too big to make a cell's bounds useful, always re-evaluated when the views move.
+    std::vector<int32_t> _oversizedProxies;
+};
+
+} // namespace workload
+
+#endif // hifi_workload_SpaceGrid_h
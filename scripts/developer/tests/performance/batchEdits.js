@@ -0,0 +1,117 @@
+"use strict";
+/*jslint nomen: true, plusplus: true, vars: true*/
+/*global Entities, Script, print, Vec3, Quat, MyAvatar, Float32Array */
+//
+//  batchEdits.js
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+//  Creates a grid of local boxes in front of you and swirls them about, alternating between moving them with
+//  Entities.editEntity() for each and with Entities.editMultipleEntities() for all at once.  Reports the edits per second
+//  and gets per second that each way manages, so that you can measure what batching saves.
+//
+var ROWS_X = 30;
+var ROWS_Z = 30;
+var SEPARATION = 0.5;
+var SIZE = 0.2;
+var ROUNDS_PER_PHASE = 60;
+var NUM_PHASES = 6;
+
+var origin = Vec3.sum(MyAvatar.position, Vec3.multiplyQbyV(MyAvatar.orientation, { x: 0, y: 0, z: -ROWS_Z * SEPARATION }));
+var ids = [];
+var x, z;
+for (x = 0; x < ROWS_X; x++) {
+    for (z = 0; z < ROWS_Z; z++) {
+        ids.push(Entities.addEntity({
+            type: "Box",
+            name: "batchEditsTest",
+            position: Vec3.sum(origin, { x: (x - ROWS_X / 2) * SEPARATION, y: 0, z: (z - ROWS_Z / 2) * SEPARATION }),
+            dimensions: { x: SIZE, y: SIZE, z: SIZE },
+            color: { red: x / ROWS_X * 255, green: 128, blue: z / ROWS_Z * 255 },
+            collisionless: true,
+            lifetime: 300
+        }, "local"));
+    }
+}
+print("batchEdits: created " + ids.length + " entities");
+
+var homes = Entities.getMultipleEntityPropertyArrays(ids, "position").position;
+var positions = new Float32Array(3 * ids.length);
+var rotations = new Float32Array(4 * ids.length);
+var round = 0;
+var phase = 0;
+var stats = { single: { edits: 0, gets: 0, editMsecs: 0, getMsecs: 0 },
+              batch: { edits: 0, gets: 0, editMsecs: 0, getMsecs: 0 } };
+
+function swirl(i, t) {
+    var angle = t + i * 0.01;
+    return {
+        position: { x: homes[3 * i] + 0.2 * Math.cos(angle), y: homes[3 * i + 1] + 0.2 * Math.sin(2 * angle),
+                    z: homes[3 * i + 2] + 0.2 * Math.sin(angle) },
+        rotation: Quat.fromPitchYawRollRadians(0, angle, 0)
+    };
+}
+
+function update() {
+    var t = round * 0.1;
+    var isBatch = (phase % 2) === 1;
+    var phaseStats = isBatch ? stats.batch : stats.single;
+    var i, edit, start;
+
+    start = Date.now();
+    if (isBatch) {
+        for (i = 0; i < ids.length; i++) {
+            edit = swirl(i, t);
+            positions[3 * i] = edit.position.x;
+            positions[3 * i + 1] = edit.position.y;
+            positions[3 * i + 2] = edit.position.z;
+            rotations[4 * i] = edit.rotation.x;
+            rotations[4 * i + 1] = edit.rotation.y;
+            rotations[4 * i + 2] = edit.rotation.z;
+            rotations[4 * i + 3] = edit.rotation.w;
+        }
+        Entities.editMultipleEntities(ids, { position: positions, rotation: rotations });
+    } else {
+        for (i = 0; i < ids.length; i++) {
+            Entities.editEntity(ids[i], swirl(i, t));
+        }
+    }
+    phaseStats.editMsecs += Date.now() - start;
+    phaseStats.edits += ids.length;
+
+    start = Date.now();
+    if (isBatch) {
+        Entities.getMultipleEntityPropertyArrays(ids, ["position", "rotation"]);
+    } else {
+        for (i = 0; i < ids.length; i++) {
+            Entities.getEntityProperties(ids[i], ["position", "rotation"]);
+        }
+    }
+    phaseStats.getMsecs += Date.now() - start;
+    phaseStats.gets += ids.length;
+
+    if (++round % ROUNDS_PER_PHASE === 0) {
+        print("batchEdits: " + (isBatch ? "editMultipleEntities" : "editEntity") + " " +
+              Math.round(1000 * phaseStats.edits / phaseStats.editMsecs) + " edits/s, " +
+              (isBatch ? "getMultipleEntityPropertyArrays" : "getEntityProperties") + " " +
+              Math.round(1000 * phaseStats.gets / phaseStats.getMsecs) + " gets/s");
+        if (++phase === NUM_PHASES) {
+            print("batchEdits: batching edits " +
+                  (stats.single.editMsecs / stats.single.edits / (stats.batch.editMsecs / stats.batch.edits)).toFixed(1) +
+                  "x and gets " +
+                  (stats.single.getMsecs / stats.single.gets / (stats.batch.getMsecs / stats.batch.gets)).toFixed(1) +
+                  "x faster");
+            Script.stop();
+        }
+    }
+}
+
+Script.update.connect(update);
+Script.scriptEnding.connect(function () {
+    ids.forEach(function (id) {
+        Entities.deleteEntity(id);
+    });
+});
@@ -0,0 +1,397 @@
+//
+//  main.cpp
+//  tests-manual/render-bench/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+//  Measures the CPU side of the render engine without a GPU: a synthetic scene of shapes, models and lights is
+//  fetched, culled, sorted and recorded into batches by the full main view task graph, against the null backend.
+//  The timings of every job, from its task Config, are written out as JSON.
+//
+//  The run-render-bench target runs it on a small scene, as the Linux pull request build does.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <random>
+
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtGui/QGuiApplication>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <gpu/Context.h>
+#include <gpu/null/NullBackend.h>
+
+#include <DependencyManager.h>
+#include <GLMHelpers.h>
+#include <NumericalConstants.h>
+#include <PathUtils.h>
+#include <ResourceCache.h>
+#include <ResourceManager.h>
+#include <StatTracker.h>
+#include <Trace.h>
+#include <ViewFrustum.h>
+
+#include <render/Engine.h>
+#include <render/Scene.h>
+
+#include <DeferredLightingEffect.h>
+#include <FadeEffect.h>
+#include <FramebufferCache.h>
+#include <GeometryCache.h>
+#include <LightPayload.h>
+#include <RenderViewTask.h>
+#include <TextureCache.h>
+#include <UpdateSceneTask.h>
+
+// A simple shape, standing alone or as the part of a model
+class BenchShape {
+public:
+    using Payload = render::Payload<BenchShape>;
+    using Pointer = Payload::DataPointer;
+
+    Transform transform;
+    AABox bound;
+    GeometryCache::Shape shape { GeometryCache::Cube };
+    glm::vec4 color;
+    bool isModelPart { false };
+};
+
+// A model is a meta item culled as a whole, along with its parts
+class BenchModel {
+public:
+    using Payload = render::Payload<BenchModel>;
+    using Pointer = Payload::DataPointer;
+
+    AABox bound;
+    render::ItemIDs parts;
+};
+
+namespace render {
+    template <> const ItemKey payloadGetKey(const BenchShape::Pointer& payload) {
+        auto builder = ItemKey::Builder::opaqueShape().withTagBits(ItemKey::TAG_BITS_ALL);
+        if (payload->isModelPart) {
+            builder.withSubMetaCulled();
+        }
+        return builder.build();
+    }
+    template <> const Item::Bound payloadGetBound(const BenchShape::Pointer& payload) {
+        return payload->bound;
+    }
+    template <> const ShapeKey shapeGetShapeKey(const BenchShape::Pointer& payload) {
+        return ShapeKey::Builder().withOwnPipeline();
+    }
+    template <> void payloadRender(const BenchShape::Pointer& payload, RenderArgs* args) {
+        if (args->_batch) {
+            auto geometryCache = DependencyManager::get<GeometryCache>();
+            auto pipeline = geometryCache->getShapePipelinePointer(false, false, args->_renderMethod == Args::RenderMethod::FORWARD);
+            args->_batch->setModelTransform(payload->transform);
+            geometryCache->renderSolidShapeInstance(args, *args->_batch, payload->shape, payload->color, pipeline);
+        }
+    }
+
+    template <> const ItemKey payloadGetKey(const BenchModel::Pointer& payload) {
+        return ItemKey::Builder::opaqueShape().withTypeMeta().withMetaCullGroup().withTagBits(ItemKey::TAG_BITS_ALL).build();
+    }
+    template <> const Item::Bound payloadGetBound(const BenchModel::Pointer& payload) {
+        return payload->bound;
+    }
+    template <> uint32_t metaFetchMetaSubItems(const BenchModel::Pointer& payload, ItemIDs& subItems) {
+        subItems.insert(subItems.end(), payload->parts.begin(), payload->parts.end());
+        return (uint32_t)payload->parts.size();
+    }
+}
+
+class BenchSettings {
+public:
+    int numShapes { 10000 };
+    int numModels { 1000 };
+    int numPartsPerModel { 8 };
+    int numLights { 100 };
+    int numFrames { 300 };
+    int numWarmupFrames { 30 };
+    float sceneSize { 200.0f };
+    bool isForward { false };
+    QString outputPath;
+};
+
+// Accumulates the run time of every enabled job over the measured frames, by path in the task graph
+class JobTimings {
+public:
+    void add(const QObject* config, const QString& path) {
+        auto jobConfig = qobject_cast<const task::JobConfig*>(config);
+        if (!jobConfig || !jobConfig->isEnabled()) {
+            return;
+        }
+        auto& timing = _timings[path];
+        double runTime = jobConfig->getCPURunTime();
+        timing.total += runTime;
+        timing.max = std::max(timing.max, runTime);
+        timing.count++;
+        for (auto subConfig : jobConfig->getSubConfigs()) {
+            add(subConfig, path + "." + subConfig->objectName());
+        }
+    }
+
+    QJsonObject toJson() const {
+        QJsonObject jobs;
+        for (auto& timing : _timings) {
+            QJsonObject job;
+            job["meanMs"] = timing.second.total / (double)timing.second.count;
+            job["maxMs"] = timing.second.max;
+            jobs[timing.first] = job;
+        }
+        return jobs;
+    }
+
+private:
+    class Timing {
+    public:
+        double total { 0.0 };
+        double max { 0.0 };
+        int count { 0 };
+    };
+    std::map<QString, Timing> _timings;
+};
+
+static void setupDependencies() {
+    DependencyManager::set<tracing::Tracer>();
+    DependencyManager::set<StatTracker>();
+    DependencyManager::set<PathUtils>();
+    DependencyManager::set<ResourceManager>();
+    DependencyManager::set<ResourceCacheSharedItems>();
+    DependencyManager::set<TextureCache>();
+    DependencyManager::set<FramebufferCache>();
+    DependencyManager::set<GeometryCache>();
+    DependencyManager::set<DeferredLightingEffect>();
+    DependencyManager::set<FadeEffect>();
+}
+
+static void destroyDependencies() {
+    DependencyManager::destroy<FadeEffect>();
+    DependencyManager::destroy<DeferredLightingEffect>();
+    DependencyManager::destroy<GeometryCache>();
+    DependencyManager::destroy<FramebufferCache>();
+    DependencyManager::destroy<TextureCache>();
+    DependencyManager::get<ResourceManager>()->cleanup();
+}
+
+static void buildScene(const render::ScenePointer& scene, const BenchSettings& settings) {
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<float> position(-0.5f * settings.sceneSize, 0.5f * settings.sceneSize);
+    std::uniform_real_distribution<float> size(0.2f, 2.0f);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    const GeometryCache::Shape SHAPES[] = { GeometryCache::Cube, GeometryCache::Sphere, GeometryCache::Cylinder, GeometryCache::Cone };
+    const int NUM_SHAPE_TYPES = sizeof(SHAPES) / sizeof(SHAPES[0]);
+
+    auto makeShape = [&](const glm::vec3& center, float shapeSize, bool isModelPart) {
+        auto shape = std::make_shared<BenchShape>();
+        shape->transform.setTranslation(center);
+        shape->transform.setScale(shapeSize);
+        shape->bound = AABox(center - glm::vec3(0.5f * shapeSize), shapeSize);
+        shape->shape = SHAPES[generator() % NUM_SHAPE_TYPES];
+        shape->color = glm::vec4(unit(generator), unit(generator), unit(generator), 1.0f);
+        shape->isModelPart = isModelPart;
+        return shape;
+    };
+
+    render::Transaction transaction;
+    for (int i = 0; i < settings.numShapes; ++i) {
+        glm::vec3 center(position(generator), position(generator), position(generator));
+        transaction.resetItem(scene->allocateID(), std::make_shared<BenchShape::Payload>(makeShape(center, size(generator), false)));
+    }
+
+    for (int i = 0; i < settings.numModels; ++i) {
+        auto model = std::make_shared<BenchModel>();
+        glm::vec3 modelCenter(position(generator), position(generator), position(generator));
+        for (int j = 0; j < settings.numPartsPerModel; ++j) {
+            glm::vec3 offset(size(generator), size(generator), size(generator));
+            float partSize = 0.5f * size(generator);
+            auto part = makeShape(modelCenter + offset, partSize, true);
+            if (j == 0) {
+                model->bound = part->bound;
+            } else {
+                model->bound += part->bound;
+            }
+
+            auto partID = scene->allocateID();
+            model->parts.push_back(partID);
+            transaction.resetItem(partID, std::make_shared<BenchShape::Payload>(part));
+        }
+        transaction.resetItem(scene->allocateID(), std::make_shared<BenchModel::Payload>(model));
+    }
+
+    const float LIGHT_RADIUS = 10.0f;
+    for (int i = 0; i < settings.numLights; ++i) {
+        auto light = std::make_shared<LightPayload>();
+        glm::vec3 center(position(generator), position(generator), position(generator));
+        auto lightData = light->editLight();
+        lightData->setType(graphics::Light::POINT);
+        lightData->setPosition(center);
+        lightData->setColor(glm::vec3(unit(generator), unit(generator), unit(generator)));
+        lightData->setFalloffRadius(0.1f * LIGHT_RADIUS);
+        lightData->setMaximumRadius(LIGHT_RADIUS);
+        light->editBound() = AABox(center - glm::vec3(LIGHT_RADIUS), 2.0f * LIGHT_RADIUS);
+        transaction.resetItem(scene->allocateID(), std::make_shared<LightPayload::Payload>(light));
+    }
+
+    scene->enqueueTransaction(std::move(transaction));
+}
+
+static BenchSettings parseSettings(const QCoreApplication& app) {
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Headless benchmark of the CPU side of the render engine, on the null gpu backend");
+    parser.addHelpOption();
+    QCommandLineOption shapesOption("shapes", "Number of shapes", "count", "10000");
+    QCommandLineOption modelsOption("models", "Number of models", "count", "1000");
+    QCommandLineOption partsOption("parts", "Number of parts per model", "count", "8");
+    QCommandLineOption lightsOption("lights", "Number of point lights", "count", "100");
+    QCommandLineOption framesOption("frames", "Number of measured frames", "count", "300");
+    QCommandLineOption warmupOption("warmup", "Number of frames run before measuring", "count", "30");
+    QCommandLineOption sizeOption("size", "Size of the scene in meters", "meters", "200");
+    QCommandLineOption forwardOption("forward", "Run the forward renderer rather than the deferred one");
+    QCommandLineOption outputOption("output", "Write the JSON timings to this file rather than stdout", "path");
+    parser.addOptions({ shapesOption, modelsOption, partsOption, lightsOption, framesOption, warmupOption, sizeOption,
+                        forwardOption, outputOption });
+    parser.process(app);
+
+    BenchSettings settings;
+    settings.numShapes = parser.value(shapesOption).toInt();
+    settings.numModels = parser.value(modelsOption).toInt();
+    settings.numPartsPerModel = std::max(1, parser.value(partsOption).toInt());
+    settings.numLights = parser.value(lightsOption).toInt();
+    settings.numFrames = std::max(1, parser.value(framesOption).toInt());
+    settings.numWarmupFrames = parser.value(warmupOption).toInt();
+    settings.sceneSize = parser.value(sizeOption).toFloat();
+    settings.isForward = parser.isSet(forwardOption);
+    settings.outputPath = parser.value(outputOption);
+    return settings;
+}
+
+// the size of the spatial tree of the scene, as in the interface
+static const float SCENE_TREE_SIZE = 32768.0f;
+
+int main(int argc, char** argv) {
+    // no window is ever shown
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+    QGuiApplication app(argc, argv);
+    BenchSettings settings = parseSettings(app);
+
+    setupDependencies();
+    gpu::Context::init<gpu::null::Backend>();
+    auto gpuContext = std::make_shared<gpu::Context>();
+    DependencyManager::get<TextureCache>()->setGPUContext(gpuContext);
+
+    auto scene = std::make_shared<render::Scene>(glm::vec3(-0.5f * SCENE_TREE_SIZE), SCENE_TREE_SIZE);
+    auto engine = std::make_shared<render::RenderEngine>();
+    render::CullFunctor cullFunctor = [](const RenderArgs* args, const AABox& bounds) {
+        // same test as LODManager::shouldRender()
+        auto position = args->getViewFrustum().getPosition() - bounds.calcCenter();
+        auto dimensions = bounds.getDimensions();
+        return 0.25f * glm::dot(dimensions, dimensions) >= args->_lodAngleHalfTanSq * glm::dot(position, position);
+    };
+    engine->addJob<UpdateSceneTask>("UpdateScene");
+    engine->addJob<RenderViewTask>("RenderMainView", cullFunctor);
+    engine->registerScene(scene);
+    DependencyManager::get<GeometryCache>()->initializeShapePipelines();
+
+    auto switchConfig = qobject_cast<render::SwitchConfig*>(engine->getConfiguration()->getConfig("RenderMainView.DeferredForwardSwitch"));
+    if (switchConfig) {
+        switchConfig->setBranch(settings.isForward ? (int)render::Args::FORWARD : (int)render::Args::DEFERRED);
+    }
+
+    buildScene(scene, settings);
+
+    const QSize FRAMEBUFFER_SIZE(1920, 1080);
+    auto framebufferCache = DependencyManager::get<FramebufferCache>();
+    framebufferCache->setFrameBufferSize(FRAMEBUFFER_SIZE);
+
+    JobTimings jobTimings;
+    std::vector<double> frameTimes;
+    int numTotalFrames = settings.numWarmupFrames + settings.numFrames;
+    for (int frame = 0; frame < numTotalFrames; ++frame) {
+        scene->enqueueFrame();
+        scene->processTransactionQueue();
+
+        // orbit the center of the scene, a full turn over the measured frames
+        float angle = TWO_PI * (float)frame / (float)settings.numFrames;
+        float orbitRadius = 0.5f * settings.sceneSize;
+        ViewFrustum viewFrustum;
+        viewFrustum.setProjection(glm::perspective(glm::radians(60.0f), (float)FRAMEBUFFER_SIZE.width() / (float)FRAMEBUFFER_SIZE.height(), 0.1f, 1000.0f));
+        viewFrustum.setPosition(glm::vec3(orbitRadius * cosf(angle), 0.1f * orbitRadius, orbitRadius * sinf(angle)));
+        viewFrustum.setOrientation(glm::quat_cast(glm::inverse(glm::lookAt(viewFrustum.getPosition(), glm::vec3(0.0f), Vectors::UNIT_Y))));
+        viewFrustum.calculate();
+
+        RenderArgs renderArgs(gpuContext);
+        renderArgs._blitFramebuffer = framebufferCache->getFramebuffer();
+        renderArgs._viewport = glm::ivec4(0, 0, FRAMEBUFFER_SIZE.width(), FRAMEBUFFER_SIZE.height());
+        renderArgs.setViewFrustum(viewFrustum);
+        renderArgs._scene = scene;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        gpuContext->beginFrame();
+        engine->getRenderContext()->args = &renderArgs;
+        engine->run();
+        auto gpuFrame = gpuContext->endFrame();
+        auto frameTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+        gpuContext->executeFrame(gpuFrame);
+        framebufferCache->releaseFramebuffer(renderArgs._blitFramebuffer);
+
+        if (frame >= settings.numWarmupFrames) {
+            frameTimes.push_back(frameTime);
+            jobTimings.add(engine->getConfiguration().get(), "Engine");
+        }
+    }
+
+    std::sort(frameTimes.begin(), frameTimes.end());
+    double totalFrameTime = 0.0;
+    for (auto frameTime : frameTimes) {
+        totalFrameTime += frameTime;
+    }
+    QJsonObject frames;
+    frames["count"] = (int)frameTimes.size();
+    frames["meanMs"] = totalFrameTime / (double)frameTimes.size();
+    frames["medianMs"] = frameTimes[frameTimes.size() / 2];
+    frames["p95Ms"] = frameTimes[(frameTimes.size() * 95) / 100];
+    frames["maxMs"] = frameTimes.back();
+
+    QJsonObject sceneJson;
+    sceneJson["shapes"] = settings.numShapes;
+    sceneJson["models"] = settings.numModels;
+    sceneJson["partsPerModel"] = settings.numPartsPerModel;
+    sceneJson["lights"] = settings.numLights;
+    sceneJson["items"] = (int)scene->getNumItems();
+
+    QJsonObject results;
+    results["renderMethod"] = settings.isForward ? "forward" : "deferred";
+    results["scene"] = sceneJson;
+    results["frames"] = frames;
+    results["jobs"] = jobTimings.toJson();
+    QByteArray json = QJsonDocument(results).toJson();
+
+    if (settings.outputPath.isEmpty()) {
+        fprintf(stdout, "%s", json.constData());
+    } else {
+        QFile file(settings.outputPath);
+        if (!file.open(QIODevice::WriteOnly)) {
+            qWarning() << "Could not write" << settings.outputPath;
+            return 1;
+        }
+        file.write(json);
+    }
+
+    engine.reset();
+    scene.reset();
+    gpuContext->shutdown();
+    destroyDependencies();
+    return 0;
+}
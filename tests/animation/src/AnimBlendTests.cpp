@@ -0,0 +1,261 @@
+//
+//  AnimBlendTests.cpp
+//  tests/animation/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AnimBlendTests.h"
+
+#include <random>
+
+#include <AnimBlendDirectional.h>
+#include <AnimBlendLinear.h>
+#include <AnimOverlay.h>
+#include <AnimUtil.h>
+#include <GLMHelpers.h>
+#include <NumericalConstants.h>
+
+#include <test-utils/QTestExtensions.h>
+
+QTEST_MAIN(AnimBlendTests)
+
+const float TEST_EPSILON = 0.0001f;
+
+// not a multiple of the simd block size, so the remainder path is covered as well
+const size_t NUM_TEST_POSES = 37;
+
+static AnimPoseVec makeRandomPoses(std::mt19937& generator, size_t numPoses) {
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    AnimPoseVec poses;
+    for (size_t i = 0; i < numPoses; i++) {
+        glm::vec3 scale(1.0f + 0.5f * distribution(generator), 1.0f + 0.5f * distribution(generator), 1.0f + 0.5f * distribution(generator));
+        glm::quat rot = glm::normalize(glm::quat(distribution(generator), distribution(generator), distribution(generator), distribution(generator)));
+        glm::vec3 trans(distribution(generator), distribution(generator), distribution(generator));
+        poses.push_back(AnimPose(scale, rot, trans));
+    }
+    return poses;
+}
+
+static void comparePoses(const AnimPoseVec& result, const AnimPoseVec& expected) {
+    QCOMPARE(result.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        QCOMPARE_WITH_ABS_ERROR(result[i].scale(), expected[i].scale(), TEST_EPSILON);
+        QCOMPARE_QUATS(result[i].rot(), expected[i].rot(), TEST_EPSILON);
+        QCOMPARE_WITH_ABS_ERROR(result[i].trans(), expected[i].trans(), TEST_EPSILON);
+    }
+}
+
+void AnimBlendTests::testBlend() {
+    std::mt19937 generator(1);
+    AnimPoseVec a = makeRandomPoses(generator, NUM_TEST_POSES);
+    AnimPoseVec b = makeRandomPoses(generator, NUM_TEST_POSES);
+    const float alpha = 0.3f;
+
+    AnimPoseVec expected(NUM_TEST_POSES);
+    for (size_t i = 0; i < NUM_TEST_POSES; i++) {
+        expected[i].scale() = lerp(a[i].scale(), b[i].scale(), alpha);
+        expected[i].rot() = safeLerp(a[i].rot(), b[i].rot(), alpha);
+        expected[i].trans() = lerp(a[i].trans(), b[i].trans(), alpha);
+    }
+
+    AnimPoseVec result(NUM_TEST_POSES);
+    ::blend(NUM_TEST_POSES, &a[0], &b[0], alpha, &result[0]);
+    comparePoses(result, expected);
+
+    // blending in place
+    ::blend(NUM_TEST_POSES, &a[0], &b[0], alpha, &a[0]);
+    comparePoses(a, expected);
+}
+
+void AnimBlendTests::testBlend4() {
+    std::mt19937 generator(2);
+    AnimPoseVec a = makeRandomPoses(generator, NUM_TEST_POSES);
+    AnimPoseVec b = makeRandomPoses(generator, NUM_TEST_POSES);
+    AnimPoseVec c = makeRandomPoses(generator, NUM_TEST_POSES);
+    AnimPoseVec d = makeRandomPoses(generator, NUM_TEST_POSES);
+    float alphas[4] = { 0.1f, 0.2f, 0.3f, 0.4f };
+
+    AnimPoseVec expected(NUM_TEST_POSES);
+    for (size_t i = 0; i < NUM_TEST_POSES; i++) {
+        expected[i].scale() = alphas[0] * a[i].scale() + alphas[1] * b[i].scale() + alphas[2] * c[i].scale() + alphas[3] * d[i].scale();
+        expected[i].rot() = safeLinearCombine4(a[i].rot(), b[i].rot(), c[i].rot(), d[i].rot(), alphas);
+        expected[i].trans() = alphas[0] * a[i].trans() + alphas[1] * b[i].trans() + alphas[2] * c[i].trans() + alphas[3] * d[i].trans();
+    }
+
+    AnimPoseVec result(NUM_TEST_POSES);
+    ::blend4(NUM_TEST_POSES, &a[0], &b[0], &c[0], &d[0], alphas, &result[0]);
+    comparePoses(result, expected);
+
+    for (size_t i = 0; i < NUM_TEST_POSES; i++) {
+        expected[i].scale() = alphas[0] * a[i].scale() + alphas[1] * b[i].scale() + alphas[2] * c[i].scale();
+        expected[i].rot() = safeLinearCombine3(a[i].rot(), b[i].rot(), c[i].rot(), alphas);
+        expected[i].trans() = alphas[0] * a[i].trans() + alphas[1] * b[i].trans() + alphas[2] * c[i].trans();
+    }
+
+    ::blend3(NUM_TEST_POSES, &a[0], &b[0], &c[0], alphas, &result[0]);
+    comparePoses(result, expected);
+}
+
+void AnimBlendTests::testBlendAdd() {
+    std::mt19937 generator(3);
+    AnimPoseVec a = makeRandomPoses(generator, NUM_TEST_POSES);
+    AnimPoseVec b = makeRandomPoses(generator, NUM_TEST_POSES);
+    const float alpha = 0.7f;
+
+    AnimPoseVec expected(NUM_TEST_POSES);
+    for (size_t i = 0; i < NUM_TEST_POSES; i++) {
+        expected[i].scale() = a[i].scale() * lerp(glm::vec3(1.0f), b[i].scale(), alpha);
+        glm::quat delta = b[i].rot();
+        if (delta.w < 0.0f) {
+            delta = -delta;
+        }
+        delta = glm::lerp(glm::quat(), delta, alpha);
+        expected[i].rot() = glm::normalize(a[i].rot() * delta);
+        expected[i].trans() = a[i].trans() + alpha * b[i].trans();
+    }
+
+    AnimPoseVec result(NUM_TEST_POSES);
+    ::blendAdd(NUM_TEST_POSES, &a[0], &b[0], alpha, &result[0]);
+    comparePoses(result, expected);
+}
+
+//
+// Avatar graph benchmark
+//
+
+static const int NUM_AVATARS = 100;
+static const int NUM_AVATAR_JOINTS = 58;
+static const int NUM_CLIP_FRAMES = 30;
+static const int NUM_EVALUATIONS = 300;
+static const float EVALUATION_DT = 1.0f / 90.0f;
+
+using ClipFrames = std::vector<AnimPoseVec>;
+
+// Stands in for an AnimClip, whose fbx animation can't be fetched by a headless test.
+// It samples a shared set of frames the same way AnimClip does, by blending the two nearest frames.
+class FrameClipNode : public AnimNode {
+public:
+    FrameClipNode(const QString& id, std::shared_ptr<ClipFrames> frames, float startFrame) :
+        AnimNode(AnimNode::Type::Clip, id), _frames(frames), _frame(startFrame) {}
+
+    const AnimPoseVec& evaluate(const AnimVariantMap& animVars, const AnimContext& context, float dt, AnimVariantMap& triggersOut) override {
+        const float FRAMES_PER_SECOND = 30.0f;
+        _frame = fmodf(_frame + dt * FRAMES_PER_SECOND, (float)NUM_CLIP_FRAMES);
+        int prevIndex = (int)_frame;
+        int nextIndex = (prevIndex + 1) % NUM_CLIP_FRAMES;
+        const AnimPoseVec& prevPoses = (*_frames)[prevIndex];
+        const AnimPoseVec& nextPoses = (*_frames)[nextIndex];
+        _poses.resize(prevPoses.size());
+        ::blend(_poses.size(), &prevPoses[0], &nextPoses[0], _frame - (float)prevIndex, &_poses[0]);
+        return _poses;
+    }
+
+protected:
+    const AnimPoseVec& getPosesInternal() const override { return _poses; }
+
+    std::shared_ptr<ClipFrames> _frames;
+    float _frame;
+    AnimPoseVec _poses;
+};
+
+static std::shared_ptr<ClipFrames> makeClipFrames(std::mt19937& generator) {
+    auto frames = std::make_shared<ClipFrames>();
+    for (int i = 0; i < NUM_CLIP_FRAMES; i++) {
+        frames->push_back(makeRandomPoses(generator, NUM_AVATAR_JOINTS));
+    }
+    return frames;
+}
+
+static AnimSkeleton::Pointer makeAvatarSkeleton() {
+    std::vector<HFMJoint> joints;
+    for (int i = 0; i < NUM_AVATAR_JOINTS; i++) {
+        HFMJoint joint;
+        joint.isFree = false;
+        joint.parentIndex = i - 1;
+        joint.distanceToParent = 0.1f;
+        joint.translation = glm::vec3(0.0f, 0.1f, 0.0f);
+        joint.rotationMin = glm::vec3(-PI);
+        joint.rotationMax = glm::vec3(PI);
+        joint.name = QString("joint%1").arg(i);
+        joint.isSkeletonJoint = true;
+        joints.push_back(joint);
+    }
+    return std::make_shared<AnimSkeleton>(joints, QMap<int, glm::quat>());
+}
+
+// Mirrors the blending layers of the default avatar graph: a directional locomotion blend, a linear blend
+// into it, an additive layer on top and a full body overlay at the root.
+static AnimNode::Pointer makeAvatarGraph(const std::vector<std::shared_ptr<ClipFrames>>& clips, float startFrame) {
+    auto makeClip = [&](const QString& id, size_t clipIndex) {
+        return std::make_shared<FrameClipNode>(id, clips[clipIndex % clips.size()], startFrame);
+    };
+
+    auto strafe = std::make_shared<AnimBlendDirectional>("strafe", glm::vec3(0.3f, 0.6f, 0.0f), "center",
+                                                         "up", "down", "left", "right", "upLeft", "upRight", "downLeft", "downRight");
+    const QString STRAFE_CHILDREN[] = { "center", "up", "down", "left", "right", "upLeft", "upRight", "downLeft", "downRight" };
+    size_t clipIndex = 0;
+    for (auto& id : STRAFE_CHILDREN) {
+        strafe->addChild(makeClip(id, clipIndex++));
+    }
+    strafe->lookupChildIds();
+
+    auto locomotion = std::make_shared<AnimBlendLinear>("locomotion", 0.4f, AnimBlendType_Normal);
+    locomotion->addChild(strafe);
+    locomotion->addChild(makeClip("walk", clipIndex++));
+
+    auto additive = std::make_shared<AnimBlendLinear>("additive", 0.5f, AnimBlendType_AddRelative);
+    additive->addChild(makeClip("idle", clipIndex++));
+    additive->addChild(makeClip("fidget", clipIndex++));
+
+    auto overlay = std::make_shared<AnimOverlay>("overlay", AnimOverlay::FullBodyBoneSet, 0.5f);
+    overlay->addChild(additive);
+    overlay->addChild(locomotion);
+    return overlay;
+}
+
+void AnimBlendTests::benchmarkAvatarGraphs() {
+    std::mt19937 generator(4);
+    std::vector<std::shared_ptr<ClipFrames>> clips;
+    const int NUM_CLIPS = 4;
+    for (int i = 0; i < NUM_CLIPS; i++) {
+        clips.push_back(makeClipFrames(generator));
+    }
+
+    auto skeleton = makeAvatarSkeleton();
+    std::vector<AnimNode::Pointer> avatars;
+    for (int i = 0; i < NUM_AVATARS; i++) {
+        auto root = makeAvatarGraph(clips, (float)(i % NUM_CLIP_FRAMES));
+        root->setSkeleton(skeleton);
+        avatars.push_back(root);
+    }
+
+    AnimContext context(false, false, false, glm::mat4(), glm::mat4(), 0);
+    AnimVariantMap animVars;
+    AnimVariantMap triggers;
+
+    // warm up, so that every node has sized its pose buffers
+    for (auto& avatar : avatars) {
+        avatar->evaluate(animVars, context, EVALUATION_DT, triggers);
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < NUM_EVALUATIONS; i++) {
+        for (auto& avatar : avatars) {
+            triggers.clearMap();
+            avatar->evaluate(animVars, context, EVALUATION_DT, triggers);
+        }
+    }
+    float msecsPerFrame = (float)timer.nsecsElapsed() / (float)(NSECS_PER_MSEC * NUM_EVALUATIONS);
+
+    qDebug() << "Evaluated" << NUM_AVATARS << "avatar graphs of" << NUM_AVATAR_JOINTS << "joints:"
+        << msecsPerFrame << "msecs/frame," << (msecsPerFrame * USECS_PER_MSEC) / NUM_AVATARS << "usecs/avatar";
+
+    for (auto& avatar : avatars) {
+        QCOMPARE(avatar->getPoses().size(), (size_t)NUM_AVATAR_JOINTS);
+    }
+}
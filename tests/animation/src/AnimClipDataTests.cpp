@@ -0,0 +1,219 @@
+//
+//  AnimClipDataTests.cpp
+//  tests/animation/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AnimClipDataTests.h"
+
+#include <random>
+
+#include <AnimClipData.h>
+#include <AnimUtil.h>
+#include <GLMHelpers.h>
+#include <NumericalConstants.h>
+
+#include <test-utils/QTestExtensions.h>
+
+QTEST_MAIN(AnimClipDataTests)
+
+static const int NUM_JOINTS = 58;
+static const int NUM_FRAMES = 300;
+
+// Something like a retargeted mocap clip: every joint swings smoothly around its own axis, only the hips translate,
+// and the scales are those of the default pose.
+static std::vector<AnimPoseVec> makeClip(std::mt19937& generator) {
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    std::vector<AnimPoseVec> anim(NUM_FRAMES, AnimPoseVec(NUM_JOINTS));
+    for (int joint = 0; joint < NUM_JOINTS; joint++) {
+        glm::vec3 axis = glm::normalize(glm::vec3(distribution(generator), distribution(generator), distribution(generator)));
+        float amplitude = 0.5f * fabsf(distribution(generator));
+        float frequency = 0.05f + 0.1f * fabsf(distribution(generator));
+        float phase = PI * distribution(generator);
+        for (int frame = 0; frame < NUM_FRAMES; frame++) {
+            float angle = amplitude * sinf(frequency * (float)frame + phase);
+            anim[frame][joint].rot() = glm::angleAxis(angle, axis);
+            if (joint == 0) {
+                anim[frame][joint].trans() = glm::vec3(5.0f * sinf(frequency * (float)frame), 90.0f + cosf(2.0f * frequency * (float)frame), 0.5f * (float)frame);
+            } else {
+                anim[frame][joint].trans() = glm::vec3(0.0f, 10.0f, 0.0f);
+            }
+            anim[frame][joint].scale() = glm::vec3(1.0f);
+        }
+    }
+    return anim;
+}
+
+// for small angles, twice the distance between two aligned unit quaternions is the angle between them.
+static float rotationError(const glm::quat& a, const glm::quat& b) {
+    glm::quat aligned = glm::dot(a, b) < 0.0f ? -b : b;
+    glm::vec4 delta(a.x - aligned.x, a.y - aligned.y, a.z - aligned.z, a.w - aligned.w);
+    return 2.0f * glm::length(delta);
+}
+
+static float vec3Error(const glm::vec3& a, const glm::vec3& b) {
+    glm::vec3 delta = glm::abs(a - b);
+    return std::max(delta.x, std::max(delta.y, delta.z));
+}
+
+void AnimClipDataTests::testCompressWithinTolerance() {
+    std::mt19937 generator(1);
+    auto anim = makeClip(generator);
+
+    AnimClipData::Tolerances tolerances;
+    tolerances.translation = 0.01f;
+    auto clipData = AnimClipData::compress(anim, tolerances);
+    QCOMPARE(clipData->getNumFrames(), NUM_FRAMES);
+    QCOMPARE(clipData->getNumJoints(), NUM_JOINTS);
+    QVERIFY(clipData->getNumKeys() < (size_t)(NUM_FRAMES * NUM_JOINTS));
+    QVERIFY(clipData->getMemorySize() < AnimClipData::getUncompressedMemorySize(anim));
+
+    // a little slack for the float math of measuring the error
+    const float SLACK = 1.0e-5f;
+    auto decompressed = clipData->decompress();
+    QCOMPARE((int)decompressed.size(), NUM_FRAMES);
+    for (int frame = 0; frame < NUM_FRAMES; frame++) {
+        for (int joint = 0; joint < NUM_JOINTS; joint++) {
+            const AnimPose& expected = anim[frame][joint];
+            const AnimPose& result = decompressed[frame][joint];
+            QVERIFY(rotationError(result.rot(), expected.rot()) <= tolerances.rotation + SLACK);
+            QVERIFY(vec3Error(result.trans(), expected.trans()) <= tolerances.translation + SLACK);
+            QVERIFY(vec3Error(result.scale(), expected.scale()) <= tolerances.scale + SLACK);
+        }
+    }
+}
+
+void AnimClipDataTests::testSampleBetweenFrames() {
+    std::mt19937 generator(2);
+    auto anim = makeClip(generator);
+    AnimClipData::Tolerances tolerances;
+    tolerances.translation = 0.01f;
+    auto clipData = AnimClipData::compress(anim, tolerances);
+
+    // halfway between two frames is within tolerance of blending the two source frames.
+    const float EPSILON = 0.002f;
+    AnimClipData::Cursors cursors;
+    AnimPoseVec poses(NUM_JOINTS);
+    AnimPoseVec expected(NUM_JOINTS);
+    for (int frame = 0; frame < NUM_FRAMES - 1; frame += 7) {
+        clipData->sample((float)frame + 0.5f, &poses[0], cursors);
+        ::blend(NUM_JOINTS, &anim[frame][0], &anim[frame + 1][0], 0.5f, &expected[0]);
+        for (int joint = 0; joint < NUM_JOINTS; joint++) {
+            QCOMPARE_QUATS(poses[joint].rot(), expected[joint].rot(), EPSILON);
+            QCOMPARE_WITH_ABS_ERROR(poses[joint].trans(), expected[joint].trans(), EPSILON * 10.0f);
+        }
+    }
+
+    // frames outside of the clip are clamped to its ends.
+    AnimPoseVec first(NUM_JOINTS);
+    AnimPoseVec last(NUM_JOINTS);
+    clipData->sample(0.0f, &first[0], cursors);
+    clipData->sample((float)(NUM_FRAMES - 1), &last[0], cursors);
+    clipData->sample(-10.0f, &poses[0], cursors);
+    for (int joint = 0; joint < NUM_JOINTS; joint++) {
+        QCOMPARE_QUATS(poses[joint].rot(), first[joint].rot(), EPSILON);
+    }
+    clipData->sample((float)(NUM_FRAMES + 10), &poses[0], cursors);
+    for (int joint = 0; joint < NUM_JOINTS; joint++) {
+        QCOMPARE_QUATS(poses[joint].rot(), last[joint].rot(), EPSILON);
+    }
+}
+
+void AnimClipDataTests::testSampleOutOfOrder() {
+    std::mt19937 generator(3);
+    auto anim = makeClip(generator);
+    auto clipData = AnimClipData::compress(anim, AnimClipData::Tolerances());
+    auto decompressed = clipData->decompress();
+
+    // jumping around, as a clip with a frame var or a looping clip does, gives the same poses as playing forward.
+    std::uniform_int_distribution<int> distribution(0, NUM_FRAMES - 1);
+    AnimClipData::Cursors cursors;
+    AnimPoseVec poses(NUM_JOINTS);
+    for (int i = 0; i < 100; i++) {
+        int frame = distribution(generator);
+        clipData->sample((float)frame, &poses[0], cursors);
+        for (int joint = 0; joint < NUM_JOINTS; joint++) {
+            QVERIFY(poses[joint].rot() == decompressed[frame][joint].rot());
+            QVERIFY(poses[joint].trans() == decompressed[frame][joint].trans());
+        }
+    }
+
+    // cursors follow the clip they are used with.
+    auto otherClipData = AnimClipData::compress(makeClip(generator), AnimClipData::Tolerances());
+    auto otherDecompressed = otherClipData->decompress();
+    otherClipData->sample(10.0f, &poses[0], cursors);
+    for (int joint = 0; joint < NUM_JOINTS; joint++) {
+        QVERIFY(poses[joint].rot() == otherDecompressed[10][joint].rot());
+    }
+}
+
+//
+// Sampling benchmark
+//
+
+static const int NUM_AVATARS = 100;
+static const int NUM_CLIPS = 4;
+static const int NUM_EVALUATIONS = 100;
+static const float FRAMES_PER_EVALUATION = 30.0f / 90.0f;
+
+void AnimClipDataTests::benchmarkClipSampling() {
+    std::mt19937 generator(4);
+    std::vector<std::vector<AnimPoseVec>> clips;
+    std::vector<AnimClipData::Pointer> clipData;
+    for (int i = 0; i < NUM_CLIPS; i++) {
+        clips.push_back(makeClip(generator));
+        clipData.push_back(AnimClipData::compress(clips.back(), AnimClipData::Tolerances()));
+    }
+
+    // before, every avatar retargeted its own copy of every clip it played.
+    std::vector<std::vector<std::vector<AnimPoseVec>>> avatarCopies(NUM_AVATARS, clips);
+    size_t uncompressedSize = 0;
+    for (auto& clip : clips) {
+        uncompressedSize += AnimClipData::getUncompressedMemorySize(clip);
+    }
+    size_t compressedSize = 0;
+    for (auto& data : clipData) {
+        compressedSize += data->getMemorySize();
+    }
+    std::vector<AnimClipData::Cursors> cursors(NUM_AVATARS * NUM_CLIPS);
+
+    qDebug() << NUM_AVATARS << "avatars playing" << NUM_CLIPS << "clips of" << NUM_FRAMES << "frames," << NUM_JOINTS << "joints:"
+        << (uncompressedSize * NUM_AVATARS) / BYTES_PER_KILOBYTE << "KB as copies per avatar,"
+        << compressedSize / BYTES_PER_KILOBYTE << "KB compressed and shared";
+
+    AnimPoseVec poses(NUM_JOINTS);
+    auto startFrame = [](int avatar) { return (float)((avatar * 7) % NUM_FRAMES); };
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < NUM_EVALUATIONS; i++) {
+        for (int avatar = 0; avatar < NUM_AVATARS; avatar++) {
+            float frame = fmodf(startFrame(avatar) + (float)i * FRAMES_PER_EVALUATION, (float)(NUM_FRAMES - 1));
+            int prevIndex = (int)frame;
+            for (int clip = 0; clip < NUM_CLIPS; clip++) {
+                auto& anim = avatarCopies[avatar][clip];
+                ::blend(NUM_JOINTS, &anim[prevIndex][0], &anim[prevIndex + 1][0], frame - (float)prevIndex, &poses[0]);
+            }
+        }
+    }
+    float uncompressedUsecs = (float)timer.nsecsElapsed() / (float)(NSECS_PER_USEC * NUM_EVALUATIONS * NUM_AVATARS * NUM_CLIPS);
+
+    timer.restart();
+    for (int i = 0; i < NUM_EVALUATIONS; i++) {
+        for (int avatar = 0; avatar < NUM_AVATARS; avatar++) {
+            float frame = fmodf(startFrame(avatar) + (float)i * FRAMES_PER_EVALUATION, (float)(NUM_FRAMES - 1));
+            for (int clip = 0; clip < NUM_CLIPS; clip++) {
+                clipData[clip]->sample(frame, &poses[0], cursors[avatar * NUM_CLIPS + clip]);
+            }
+        }
+    }
+    float compressedUsecs = (float)timer.nsecsElapsed() / (float)(NSECS_PER_USEC * NUM_EVALUATIONS * NUM_AVATARS * NUM_CLIPS);
+
+    qDebug() << "Sampled a clip:" << uncompressedUsecs << "usecs from per avatar copies," << compressedUsecs << "usecs compressed";
+
+    QVERIFY(compressedSize < uncompressedSize);
+}
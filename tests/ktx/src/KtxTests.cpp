@@ -15,6 +15,11 @@
 #include <ktx/KTX.h>
 #include <gpu/Texture.h>
 #include <image/Image.h>
+#include <SharedUtil.h>
+
+#ifdef Q_OS_LINUX
+#include <unistd.h>
+#endif
 
 
 QTEST_GUILESS_MAIN(KtxTests)
@@ -142,6 +147,136 @@ void KtxTests::testKtxSerialization() {
     testTexture->setKtxBacking(TEST_IMAGE_KTX.fileName().toStdString());
 }
 
+void KtxTests::testKtxBulkLoading() {
+    static const int NUM_KTX_FILES = 16;
+
+    const QString TEST_IMAGE = getRootPath() + "/scripts/developer/tests/cube_texture.png";
+    QImage image(TEST_IMAGE);
+    std::atomic<bool> abortSignal;
+    gpu::TexturePointer testTexture =
+        image::TextureUsage::process2DTextureColorFromImage(std::move(image), TEST_IMAGE.toStdString(), true, abortSignal);
+    auto ktxMemory = gpu::Texture::serialize(*testTexture);
+    QVERIFY(ktxMemory.get());
+    const auto& ktxStorage = ktxMemory->getStorage();
+
+    QTemporaryDir ktxFolder;
+    QVERIFY(ktxFolder.isValid());
+    std::vector<std::string> ktxFiles;
+    for (int i = 0; i < NUM_KTX_FILES; ++i) {
+        auto fileName = ktxFolder.filePath(QString::number(i) + ".ktx");
+        QFile file(fileName);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        QVERIFY(file.write((const char*)ktxStorage->data(), ktxStorage->size()) == (qint64)ktxStorage->size());
+        ktxFiles.push_back(fileName.toStdString());
+    }
+
+    std::vector<gpu::TexturePointer> textures;
+    for (const auto& ktxFile : ktxFiles) {
+        textures.push_back(gpu::Texture::unserialize(ktxFile));
+        QVERIFY(textures.back());
+    }
+
+    // loading again hits the cached descriptors
+    for (const auto& ktxFile : ktxFiles) {
+        auto descriptor = gpu::Texture::KtxStorage::getDescriptor(ktxFile);
+        QVERIFY(descriptor);
+        QCOMPARE(descriptor, gpu::Texture::KtxStorage::getDescriptor(ktxFile));
+    }
+
+    // mip views hold their file mapped, so they outlive the open files being released
+    std::vector<storage::StoragePointer> smallestMips;
+    for (const auto& texture : textures) {
+        auto mip = texture->getNumMips() - 1;
+        auto pixels = texture->accessStoredMipFace(mip);
+        QVERIFY(pixels && pixels->size() == texture->getStoredMipFaceSize(mip));
+        smallestMips.push_back(pixels);
+    }
+    gpu::Texture::KtxStorage::releaseOpenKtxFiles();
+    for (size_t i = 0; i < smallestMips.size(); ++i) {
+        auto mip = textures[i]->getNumMips() - 1;
+        QCOMPARE(smallestMips[i]->size(), (size_t)textures[i]->getStoredMipFaceSize(mip));
+    }
+}
+
+static uint64_t getResidentMemoryBytes() {
+#ifdef Q_OS_LINUX
+    // the resident page count is the second field
+    QFile statm("/proc/self/statm");
+    if (!statm.open(QIODevice::ReadOnly)) {
+        return 0;
+    }
+    auto fields = statm.readAll().split(' ');
+    return fields.size() > 1 ? fields[1].toULongLong() * sysconf(_SC_PAGESIZE) : 0;
+#else
+    MemoryInfo info;
+    return getMemoryInfo(info) ? info.processUsedMemoryBytes : 0;
+#endif
+}
+
+// Writes thousands of KTX files, so it only runs when HIFI_KTX_BENCHMARK is set
+void KtxTests::benchmarkKtxBulkLoading() {
+    static const int NUM_KTX_FILES = 4000;
+
+    if (qEnvironmentVariableIsEmpty("HIFI_KTX_BENCHMARK")) {
+        QSKIP("set HIFI_KTX_BENCHMARK to load thousands of KTX files");
+    }
+
+    const QString TEST_IMAGE = getRootPath() + "/scripts/developer/tests/cube_texture.png";
+    QImage image(TEST_IMAGE);
+    std::atomic<bool> abortSignal;
+    gpu::TexturePointer testTexture =
+        image::TextureUsage::process2DTextureColorFromImage(std::move(image), TEST_IMAGE.toStdString(), true, abortSignal);
+    auto ktxMemory = gpu::Texture::serialize(*testTexture);
+    QVERIFY(ktxMemory.get());
+    const auto& ktxStorage = ktxMemory->getStorage();
+
+    QTemporaryDir ktxFolder;
+    QVERIFY(ktxFolder.isValid());
+    std::vector<std::string> ktxFiles;
+    ktxFiles.reserve(NUM_KTX_FILES);
+    for (int i = 0; i < NUM_KTX_FILES; ++i) {
+        auto fileName = ktxFolder.filePath(QString::number(i) + ".ktx");
+        QFile file(fileName);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        QVERIFY(file.write((const char*)ktxStorage->data(), ktxStorage->size()) == (qint64)ktxStorage->size());
+        ktxFiles.push_back(fileName.toStdString());
+    }
+
+    std::vector<gpu::TexturePointer> textures;
+    textures.reserve(NUM_KTX_FILES);
+    auto rssBefore = getResidentMemoryBytes();
+    QElapsedTimer timer;
+    timer.start();
+    QBENCHMARK_ONCE {
+        for (const auto& ktxFile : ktxFiles) {
+            textures.push_back(gpu::Texture::unserialize(ktxFile));
+        }
+    }
+    auto loadMSecs = timer.nsecsElapsed() / (float)NSECS_PER_MSEC;
+    auto rssLoaded = getResidentMemoryBytes();
+    for (const auto& texture : textures) {
+        QVERIFY(texture);
+    }
+
+    // pull the smallest mip of every texture, which is all a texture needs to first show up
+    timer.restart();
+    for (const auto& texture : textures) {
+        auto mip = texture->getNumMips() - 1;
+        auto pixels = texture->accessStoredMipFace(mip);
+        QVERIFY(pixels && pixels->size() == texture->getStoredMipFaceSize(mip));
+    }
+    auto smallestMipMSecs = timer.nsecsElapsed() / (float)NSECS_PER_MSEC;
+    auto rssSmallestMips = getResidentMemoryBytes();
+
+    qDebug() << "Loaded" << NUM_KTX_FILES << "KTX files of" << ktxStorage->size() << "bytes in" << loadMSecs << "ms,"
+        << smallestMipMSecs << "ms to read the smallest mips";
+    qDebug() << "Resident memory grew by" << (int64_t)(rssLoaded - rssBefore) / BYTES_PER_KILOBYTE << "KB after loading and"
+        << (int64_t)(rssSmallestMips - rssBefore) / BYTES_PER_KILOBYTE << "KB after reading the smallest mips";
+
+    textures.clear();
+    gpu::Texture::KtxStorage::releaseOpenKtxFiles();
+}
+
 #if 0
 
 static const QString TEST_FOLDER { "H:/ktx_cacheold" };
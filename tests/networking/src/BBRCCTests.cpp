@@ -0,0 +1,249 @@
+//
+//  BBRCCTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BBRCCTests.h"
+
+#include <deque>
+#include <random>
+#include <set>
+#include <vector>
+
+#include <udt/BBRCC.h>
+#include <udt/ControlPacket.h>
+#include <udt/LossList.h>
+
+QTEST_MAIN(BBRCCTests)
+
+using namespace udt;
+using namespace std::chrono;
+
+class TestBBRCC : public BBRCC {
+public:
+    using BBRCC::setInitialSendSequenceNumber;
+    using CongestionControl::setSendCurrentSequenceNumber;
+
+    int getCongestionWindowSize() const { return _congestionWindowSize; }
+    double getPacketSendPeriod() const { return _packetSendPeriod; }
+};
+
+class PathResult {
+public:
+    double deliveredPerSecond { 0.0 };
+    double meanQueueLength { 0.0 };
+    int estimatedBandwidth { 0 };
+};
+
+// Sends as fast as the congestion control lets it over a simulated path with a bottleneck link, and returns what the
+// path looked like over the last seconds.  The receiver ACKs every packet with selective ACK ranges like Connection,
+// and the sender re-sends the losses they show like SendQueue, or everything not ACKed after a timeout.
+static PathResult simulatePath(double linkPacketsPerSecond, double lossRate, int oneWayDelayUsecs, int numSeconds) {
+    static const int STEP_USECS = 10;
+    static const int MEASURE_SECONDS = 2;
+    static const int MAX_SACK_RANGES = 4;
+    static const int LOSS_REORDERING_THRESHOLD = 3;
+    static const int PACKET_SIZE = 1400;
+
+    struct InFlight {
+        int index;
+        microseconds arrival;
+    };
+    struct ACK {
+        int index;
+        SequenceRanges ranges;
+        microseconds arrival;
+    };
+
+    // start right before the sequence numbers wrap around
+    const SequenceNumber first { SequenceNumber::MAX - 1000 };
+    auto toIndex = [&](SequenceNumber seq) { return seqoff(first, seq); };
+
+    TestBBRCC cc;
+    cc.setInitialSendSequenceNumber(first);
+
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    std::deque<int> linkQueue;
+    std::deque<InFlight> toReceiver;
+    std::deque<ACK> toSender;
+    microseconds linkFreeAt { 0 };
+    auto transmitTime = microseconds((int64_t)(1000000 / linkPacketsPerSecond));
+
+    LossList lossList;
+    SequenceNumber lastReceived = first - 1;
+    auto ackPacket = ControlPacket::create(ControlPacket::ACK, sizeof(SequenceNumber) * 2 * MAX_SACK_RANGES);
+
+    int lastSent = -1;
+    int lastACK = -1;
+    std::vector<bool> isReceived; // what the sender knows, by index
+    std::vector<bool> isReportedLost;
+    std::set<int> losses;
+    microseconds nextSendTime { 0 };
+    microseconds lastProgressTime { 0 };
+
+    PathResult result;
+    int numDelivered = 0;
+    int64_t queueLengthSum = 0;
+    int64_t numQueueSamples = 0;
+
+    auto measureStart = seconds(numSeconds - MEASURE_SECONDS);
+    for (microseconds now { 0 }; now < seconds(numSeconds); now += microseconds(STEP_USECS)) {
+        auto timePoint = p_high_resolution_clock::time_point() + now;
+
+        // the bottleneck link
+        while (!linkQueue.empty() && linkFreeAt <= now) {
+            linkFreeAt = now + transmitTime;
+            if (distribution(generator) >= lossRate) {
+                toReceiver.push_back({ linkQueue.front(), linkFreeAt + microseconds(oneWayDelayUsecs) });
+            }
+            linkQueue.pop_front();
+        }
+
+        // the receiver
+        while (!toReceiver.empty() && toReceiver.front().arrival <= now) {
+            SequenceNumber seq = first + toReceiver.front().index;
+            toReceiver.pop_front();
+
+            bool isNew = true;
+            if (seq > lastReceived) {
+                if (seq > lastReceived + 1) {
+                    lossList.append(lastReceived + 1, seq - 1);
+                }
+                lastReceived = seq;
+            } else {
+                isNew = lossList.remove(seq);
+            }
+            if (isNew && now >= measureStart) {
+                ++numDelivered;
+            }
+
+            auto ack = lossList.isEmpty() ? lastReceived : lossList.getFirstSequenceNumber() - 1;
+            ackPacket->reset();
+            lossList.writeReceivedRanges(*ackPacket, lastReceived, MAX_SACK_RANGES);
+            ackPacket->seek(0);
+
+            ACK ackInfo { toIndex(ack), {}, now + microseconds(oneWayDelayUsecs) };
+            while (ackPacket->bytesLeftToRead() >= (qint64)(2 * sizeof(SequenceNumber))) {
+                SequenceRange range;
+                ackPacket->readPrimitive(&range.first);
+                ackPacket->readPrimitive(&range.second);
+                ackInfo.ranges.push_back(range);
+            }
+            toSender.push_back(ackInfo);
+        }
+
+        // the sender
+        while (!toSender.empty() && toSender.front().arrival <= now) {
+            auto ack = toSender.front();
+            toSender.pop_front();
+            if (ack.index < lastACK) {
+                continue;
+            }
+
+            cc.setSendCurrentSequenceNumber(first + lastSent);
+
+            int numReceivedAfter = 0;
+            for (auto& range : ack.ranges) {
+                numReceivedAfter += seqlen(range.first, range.second);
+            }
+            int holeStart = ack.index + 1;
+            for (auto& range : ack.ranges) {
+                int start = toIndex(range.first);
+                int end = toIndex(range.second);
+                for (int i = holeStart; i < start && numReceivedAfter >= LOSS_REORDERING_THRESHOLD; ++i) {
+                    if (!isReceived[i] && !isReportedLost[i]) {
+                        isReportedLost[i] = true;
+                        losses.insert(i);
+                    }
+                }
+                for (int i = start; i <= end; ++i) {
+                    isReceived[i] = true;
+                }
+                numReceivedAfter -= seqlen(range.first, range.second);
+                holeStart = end + 1;
+
+                cc.onSelectiveACK(range.first, range.second, timePoint);
+            }
+
+            if (ack.index > lastACK) {
+                lastACK = ack.index;
+                lastProgressTime = now;
+            }
+            if (cc.onACK(first + ack.index, timePoint)) {
+                losses.insert(ack.index + 1);
+            }
+            losses.erase(losses.begin(), losses.upper_bound(lastACK));
+        }
+
+        if (lastACK < lastSent && now - lastProgressTime > microseconds(2 * cc.estimatedTimeout())) {
+            for (int i = lastACK + 1; i <= lastSent; ++i) {
+                if (!isReceived[i]) {
+                    losses.insert(i);
+                }
+            }
+            lastProgressTime = now;
+            cc.onTimeout();
+        }
+
+        if (now >= nextSendTime) {
+            if (!losses.empty()) {
+                int index = *losses.begin();
+                losses.erase(losses.begin());
+                cc.onPacketReSent(PACKET_SIZE, first + index, timePoint);
+                linkQueue.push_back(index);
+                nextSendTime = now + microseconds((int64_t)cc.getPacketSendPeriod());
+            } else if (lastSent - lastACK < cc.getCongestionWindowSize()) {
+                ++lastSent;
+                isReceived.push_back(false);
+                isReportedLost.push_back(false);
+                cc.onPacketSent(PACKET_SIZE, first + lastSent, timePoint);
+                linkQueue.push_back(lastSent);
+                nextSendTime = now + microseconds((int64_t)cc.getPacketSendPeriod());
+            }
+        }
+
+        if (now >= measureStart) {
+            queueLengthSum += linkQueue.size();
+            ++numQueueSamples;
+        }
+    }
+
+    result.deliveredPerSecond = (double)numDelivered / MEASURE_SECONDS;
+    result.meanQueueLength = (double)queueLengthSum / numQueueSamples;
+    result.estimatedBandwidth = cc.estimatedBandwidth();
+    return result;
+}
+
+void BBRCCTests::bottleneckTest() {
+    const double LINK_PACKETS_PER_SECOND = 10000.0;
+    const int ONE_WAY_DELAY_USECS = 20000;
+    const double BANDWIDTH_DELAY_PRODUCT = LINK_PACKETS_PER_SECOND * 2 * ONE_WAY_DELAY_USECS / 1000000.0;
+
+    auto result = simulatePath(LINK_PACKETS_PER_SECOND, 0.0, ONE_WAY_DELAY_USECS, 8);
+    qDebug() << "Lossless link:" << result.deliveredPerSecond << "packets per second, mean queue"
+        << result.meanQueueLength << "packets";
+
+    // the link is kept busy without building a standing queue
+    QVERIFY(result.deliveredPerSecond > 0.95 * LINK_PACKETS_PER_SECOND);
+    QVERIFY(result.meanQueueLength < 0.25 * BANDWIDTH_DELAY_PRODUCT);
+    QVERIFY(std::abs(result.estimatedBandwidth - LINK_PACKETS_PER_SECOND) < 0.05 * LINK_PACKETS_PER_SECOND);
+}
+
+void BBRCCTests::lossyLinkTest() {
+    const double LINK_PACKETS_PER_SECOND = 10000.0;
+    const int ONE_WAY_DELAY_USECS = 20000;
+
+    // random loss does not make it back off, the selective ACKs have the losses re-sent
+    auto result = simulatePath(LINK_PACKETS_PER_SECOND, 0.01, ONE_WAY_DELAY_USECS, 8);
+    qDebug() << "Link with 1% loss:" << result.deliveredPerSecond << "packets per second, mean queue"
+        << result.meanQueueLength << "packets";
+
+    QVERIFY(result.deliveredPerSecond > 0.85 * LINK_PACKETS_PER_SECOND);
+}
@@ -0,0 +1,23 @@
+//
+//  BBRCCTests.h
+//  tests/networking/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_BBRCCTests_h
+#define hifi_BBRCCTests_h
+
+#include <QtTest/QtTest>
+
+class BBRCCTests : public QObject {
+    Q_OBJECT
+private slots:
+    void bottleneckTest();
+    void lossyLinkTest();
+};
+
+#endif // hifi_BBRCCTests_h
@@ -0,0 +1,190 @@
+//
+//  HMACAuthTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "HMACAuthTests.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <QUuid>
+
+#include <HMACAuth.h>
+#include <NLPacket.h>
+
+QTEST_MAIN(HMACAuthTests)
+
+static QByteArray toByteArray(const HMACAuth::HMACHash& hash) {
+    return QByteArray((const char*)hash.data(), (int)hash.size());
+}
+
+void HMACAuthTests::md5Test() {
+    // RFC 2202 test case 2
+    const QByteArray key = "Jefe";
+    const QByteArray data = "what do ya want for nothing?";
+    const QByteArray expected = QByteArray::fromHex("750c783e6ab0b503eaa86e310a5db738");
+
+    HMACAuth hmacAuth;
+    QVERIFY(hmacAuth.setKey(key.constData(), key.size()));
+
+    HMACAuth::HMACHash hash;
+    QVERIFY(hmacAuth.calculateHash(hash, data.constData(), data.size()));
+    QCOMPARE(toByteArray(hash), expected);
+
+    // in pieces, and again to see the state is cleared for reuse
+    for (int i = 0; i < 2; ++i) {
+        QVERIFY(hmacAuth.addData(data.constData(), 10));
+        QVERIFY(hmacAuth.addData(data.constData() + 10, data.size() - 10));
+        QCOMPARE(toByteArray(hmacAuth.result()), expected);
+    }
+
+    // two instances hashing in pieces at once on the same thread keep their own state
+    HMACAuth otherHmacAuth;
+    QVERIFY(otherHmacAuth.setKey(key.constData(), key.size()));
+    QVERIFY(hmacAuth.addData(data.constData(), 10));
+    QVERIFY(otherHmacAuth.addData(data.constData(), 10));
+    QVERIFY(hmacAuth.addData(data.constData() + 10, data.size() - 10));
+    QVERIFY(otherHmacAuth.addData(data.constData() + 10, data.size() - 10));
+    QCOMPARE(toByteArray(hmacAuth.result()), expected);
+    QCOMPARE(toByteArray(otherHmacAuth.result()), expected);
+}
+
+void HMACAuthTests::sipHashTest() {
+    // vectors from the SipHash reference implementation, key 00 01 .. 0f and message 00 01 .. of each length
+    char key[16];
+    char message[16];
+    for (int i = 0; i < 16; ++i) {
+        key[i] = (char)i;
+        message[i] = (char)i;
+    }
+
+    HMACAuth hmacAuth(HMACAuth::SIPHASH);
+    QVERIFY(!hmacAuth.setKey(key, 8));
+    QVERIFY(hmacAuth.setKey(key, sizeof(key)));
+
+    HMACAuth::HMACHash hash;
+    QVERIFY(hmacAuth.calculateHash(hash, message, 0));
+    QCOMPARE(toByteArray(hash), QByteArray::fromHex("a3817f04ba25a8e66df67214c7550293"));
+    QVERIFY(hmacAuth.calculateHash(hash, message, 15));
+    QCOMPARE(toByteArray(hash), QByteArray::fromHex("5493e99933b0a8117e08ec0f97cfc3d9"));
+
+    QVERIFY(hmacAuth.addData(message, 3));
+    QVERIFY(hmacAuth.addData(message + 3, 12));
+    QCOMPARE(toByteArray(hmacAuth.result()), QByteArray::fromHex("5493e99933b0a8117e08ec0f97cfc3d9"));
+}
+
+void HMACAuthTests::setAuthMethodTest() {
+    const QUuid secret = QUuid::createUuid();
+    const QByteArray data = "payload";
+
+    HMACAuth switched;
+    QVERIFY(switched.setKey(secret));
+    QVERIFY(switched.setAuthMethod(HMACAuth::SIPHASH));
+    QCOMPARE(switched.getAuthMethod(), HMACAuth::SIPHASH);
+
+    HMACAuth sipHash(HMACAuth::SIPHASH);
+    QVERIFY(sipHash.setKey(secret));
+
+    HMACAuth::HMACHash switchedHash;
+    HMACAuth::HMACHash sipHashHash;
+    QVERIFY(switched.calculateHash(switchedHash, data.constData(), data.size()));
+    QVERIFY(sipHash.calculateHash(sipHashHash, data.constData(), data.size()));
+    QCOMPARE(toByteArray(switchedHash), toByteArray(sipHashHash));
+}
+
+void HMACAuthTests::threadedHashTest() {
+    // many threads hashing with the same instance, as when the packets of one node are handled on several threads
+    const int NUM_THREADS = 8;
+    const int NUM_HASHES = 20000;
+
+    for (auto authMethod : { HMACAuth::MD5, HMACAuth::SIPHASH }) {
+        HMACAuth hmacAuth(authMethod);
+        QVERIFY(hmacAuth.setKey(QUuid::createUuid()));
+
+        std::vector<QByteArray> payloads;
+        std::vector<QByteArray> expected;
+        for (int i = 0; i < 16; ++i) {
+            payloads.push_back(QByteArray(100 + i * 50, (char)i));
+            HMACAuth::HMACHash hash;
+            QVERIFY(hmacAuth.calculateHash(hash, payloads.back().constData(), payloads.back().size()));
+            expected.push_back(toByteArray(hash));
+        }
+
+        std::atomic<int> numMismatches { 0 };
+        std::vector<std::thread> threads;
+        for (int t = 0; t < NUM_THREADS; ++t) {
+            threads.emplace_back([&, t] {
+                HMACAuth::HMACHash hash;
+                for (int i = 0; i < NUM_HASHES; ++i) {
+                    int index = (i + t) % payloads.size();
+                    hmacAuth.calculateHash(hash, payloads[index].constData(), payloads[index].size());
+                    if (toByteArray(hash) != expected[index]) {
+                        ++numMismatches;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        QCOMPARE(numMismatches.load(), 0);
+    }
+}
+
+void HMACAuthTests::verificationBenchmark() {
+    // packets verified per second through the same path as LimitedNodeList, from one node on a growing number of threads
+    const int PAYLOAD_SIZE = 400; // about an audio mixer packet
+    const auto RUN_TIME = std::chrono::milliseconds(250);
+
+    auto packet = NLPacket::create(PacketType::MicrophoneAudioNoEcho, PAYLOAD_SIZE);
+    QByteArray payload(PAYLOAD_SIZE, 'x');
+    packet->write(payload);
+    packet->writeSourceID(1);
+
+    int maxThreads = std::max(1, (int)std::thread::hardware_concurrency());
+    for (auto authMethod : { HMACAuth::MD5, HMACAuth::SIPHASH }) {
+        HMACAuth hmacAuth(authMethod);
+        QVERIFY(hmacAuth.setKey(QUuid::createUuid()));
+        packet->writeVerificationHash(hmacAuth);
+        QVERIFY(NLPacket::isVerificationHashValid(*packet, hmacAuth));
+
+        for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+            std::atomic<bool> isRunning { true };
+            std::atomic<int64_t> numVerified { 0 };
+            std::atomic<int> numFailed { 0 };
+
+            std::vector<std::thread> threads;
+            for (int t = 0; t < numThreads; ++t) {
+                threads.emplace_back([&] {
+                    int64_t count = 0;
+                    while (isRunning) {
+                        if (!NLPacket::isVerificationHashValid(*packet, hmacAuth)) {
+                            ++numFailed;
+                        }
+                        ++count;
+                    }
+                    numVerified += count;
+                });
+            }
+            std::this_thread::sleep_for(RUN_TIME);
+            isRunning = false;
+            for (auto& thread : threads) {
+                thread.join();
+            }
+
+            QCOMPARE(numFailed.load(), 0);
+            auto packetsPerSecond = numVerified * 1000 / RUN_TIME.count();
+            qDebug() << (authMethod == HMACAuth::SIPHASH ? "SipHash" : "HMAC-MD5") << "on" << numThreads << "threads:"
+                << packetsPerSecond << "packets verified per second";
+        }
+    }
+}
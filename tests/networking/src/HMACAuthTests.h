@@ -0,0 +1,26 @@
+//
+//  HMACAuthTests.h
+//  tests/networking/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_HMACAuthTests_h
+#define hifi_HMACAuthTests_h
+
+#include <QtTest/QtTest>
+
+class HMACAuthTests : public QObject {
+    Q_OBJECT
+private slots:
+    void md5Test();
+    void sipHashTest();
+    void setAuthMethodTest();
+    void threadedHashTest();
+    void verificationBenchmark();
+};
+
+#endif // hifi_HMACAuthTests_h
@@ -0,0 +1,122 @@
+//
+//  LossListTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "LossListTests.h"
+
+#include <random>
+#include <set>
+
+#include <udt/LossList.h>
+
+QTEST_MAIN(LossListTests)
+
+using namespace udt;
+
+// sequence numbers as offsets from a base close to the wrap around, kept in a set for reference
+static const SequenceNumber BASE { (SequenceNumber::Type)(SequenceNumber::MAX - 500) };
+
+static SequenceNumber sequenceAt(int offset) {
+    return BASE + offset;
+}
+
+static void compare(LossList& lossList, const std::set<int>& expected) {
+    QCOMPARE(lossList.getLength(), (int)expected.size());
+    QCOMPARE(lossList.isEmpty(), expected.empty());
+    if (!expected.empty()) {
+        QCOMPARE(lossList.getFirstSequenceNumber(), sequenceAt(*expected.begin()));
+    }
+}
+
+void LossListTests::appendAndPopTest() {
+    LossList lossList;
+    std::set<int> expected;
+
+    lossList.append(sequenceAt(0));
+    lossList.append(sequenceAt(1), sequenceAt(10));
+    lossList.append(sequenceAt(20), sequenceAt(1000)); // wraps around MAX
+    for (int i = 0; i <= 10; ++i) {
+        expected.insert(i);
+    }
+    for (int i = 20; i <= 1000; ++i) {
+        expected.insert(i);
+    }
+    compare(lossList, expected);
+
+    while (!expected.empty()) {
+        QCOMPARE(lossList.popFirstSequenceNumber(), sequenceAt(*expected.begin()));
+        expected.erase(expected.begin());
+    }
+    QVERIFY(lossList.isEmpty());
+}
+
+void LossListTests::randomOperationsTest() {
+    const int RANGE = 2000;
+    const int NUM_OPERATIONS = 20000;
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> offsetDistribution(0, RANGE);
+    std::uniform_int_distribution<int> lengthDistribution(0, 20);
+    std::uniform_int_distribution<int> operationDistribution(0, 3);
+
+    LossList lossList;
+    std::set<int> expected;
+
+    for (int i = 0; i < NUM_OPERATIONS; ++i) {
+        int start = offsetDistribution(generator);
+        int end = std::min(RANGE, start + lengthDistribution(generator));
+
+        switch (operationDistribution(generator)) {
+            case 0:
+            case 1:
+                lossList.insert(sequenceAt(start), sequenceAt(end));
+                for (int j = start; j <= end; ++j) {
+                    expected.insert(j);
+                }
+                break;
+            case 2: {
+                bool wasLost = expected.erase(start) > 0;
+                QCOMPARE(lossList.remove(sequenceAt(start)), wasLost);
+                break;
+            }
+            case 3:
+                lossList.remove(sequenceAt(start), sequenceAt(end));
+                for (int j = start; j <= end; ++j) {
+                    expected.erase(j);
+                }
+                break;
+        }
+        compare(lossList, expected);
+    }
+
+    while (!expected.empty()) {
+        QCOMPARE(lossList.popFirstSequenceNumber(), sequenceAt(*expected.begin()));
+        expected.erase(expected.begin());
+    }
+}
+
+void LossListTests::removeUpToTest() {
+    LossList lossList;
+    lossList.append(sequenceAt(10), sequenceAt(20));
+    lossList.append(sequenceAt(30), sequenceAt(40));
+    lossList.append(sequenceAt(600), sequenceAt(700));
+
+    lossList.removeUpTo(sequenceAt(5));
+    QCOMPARE(lossList.getLength(), 11 + 11 + 101);
+
+    lossList.removeUpTo(sequenceAt(35));
+    QCOMPARE(lossList.getLength(), 5 + 101);
+    QCOMPARE(lossList.getFirstSequenceNumber(), sequenceAt(36));
+
+    lossList.removeUpTo(sequenceAt(650));
+    QCOMPARE(lossList.getLength(), 50);
+    QCOMPARE(lossList.getFirstSequenceNumber(), sequenceAt(651));
+
+    lossList.removeUpTo(sequenceAt(1000));
+    QVERIFY(lossList.isEmpty());
+}
@@ -0,0 +1,94 @@
+//
+//  SentPacketBufferTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SentPacketBufferTests.h"
+
+#include <udt/SentPacketBuffer.h>
+
+QTEST_MAIN(SentPacketBufferTests)
+
+using namespace udt;
+
+static std::unique_ptr<Packet> createPacket(SequenceNumber sequenceNumber) {
+    auto packet = Packet::create(-1, true);
+    packet->writeSequenceNumber(sequenceNumber);
+    return packet;
+}
+
+void SentPacketBufferTests::appendAndFindTest() {
+    SentPacketBuffer buffer;
+    SequenceNumber first { 1000 };
+    for (int i = 0; i < 10; ++i) {
+        buffer.append(first + i, createPacket(first + i));
+    }
+    QCOMPARE(buffer.getSize(), 10);
+
+    for (int i = 0; i < 10; ++i) {
+        auto entry = buffer.find(first + i);
+        QVERIFY(entry);
+        QCOMPARE(entry->packet->getSequenceNumber(), first + i);
+        QCOMPARE(entry->numResends, (uint8_t)0);
+    }
+    QVERIFY(!buffer.find(first - 1));
+    QVERIFY(!buffer.find(first + 10));
+
+    // skipped sequence numbers have no packet
+    buffer.append(first + 12, createPacket(first + 12));
+    QVERIFY(!buffer.find(first + 11));
+    QVERIFY(buffer.find(first + 12));
+}
+
+void SentPacketBufferTests::releaseTest() {
+    SentPacketBuffer buffer;
+    SequenceNumber first { 1 };
+    for (int i = 0; i < 100; ++i) {
+        buffer.append(first + i, createPacket(first + i));
+    }
+
+    // ACKs from before the buffer release nothing
+    QCOMPARE(buffer.releaseUpTo(first - 1), 0);
+
+    QCOMPARE(buffer.releaseUpTo(first + 49), 50);
+    QCOMPARE(buffer.getSize(), 50);
+    QCOMPARE(buffer.getFirstSequenceNumber(), first + 50);
+    QVERIFY(!buffer.find(first + 49));
+    QVERIFY(buffer.find(first + 50));
+
+    // ACKs past the end release everything
+    QCOMPARE(buffer.releaseUpTo(first + 500), 50);
+    QVERIFY(buffer.isEmpty());
+
+    buffer.append(first + 100, createPacket(first + 100));
+    QCOMPARE(buffer.getFirstSequenceNumber(), first + 100);
+    buffer.clear();
+    QVERIFY(buffer.isEmpty());
+}
+
+void SentPacketBufferTests::growAcrossWrapTest() {
+    // sequence numbers wrap around while the ring buffer both wraps and grows
+    SentPacketBuffer buffer;
+    SequenceNumber next { (SequenceNumber::Type)(SequenceNumber::MAX - 100) };
+    SequenceNumber firstUnacked = next;
+    for (int round = 0; round < 20; ++round) {
+        for (int i = 0; i < 40 + round * 10; ++i) {
+            buffer.append(next, createPacket(next));
+            ++next;
+        }
+        buffer.releaseUpTo(firstUnacked + 29);
+        firstUnacked += 30;
+
+        for (auto seq = firstUnacked; seq != next; ++seq) {
+            auto entry = buffer.find(seq);
+            QVERIFY(entry);
+            QCOMPARE(entry->packet->getSequenceNumber(), seq);
+        }
+    }
+    QCOMPARE(buffer.getSize(), seqlen(firstUnacked, next - 1));
+}
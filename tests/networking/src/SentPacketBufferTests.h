@@ -0,0 +1,24 @@
+//
+//  SentPacketBufferTests.h
+//  tests/networking/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_SentPacketBufferTests_h
+#define hifi_SentPacketBufferTests_h
+
+#include <QtTest/QtTest>
+
+class SentPacketBufferTests : public QObject {
+    Q_OBJECT
+private slots:
+    void appendAndFindTest();
+    void releaseTest();
+    void growAcrossWrapTest();
+};
+
+#endif // hifi_SentPacketBufferTests_h
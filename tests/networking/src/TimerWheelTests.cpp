@@ -0,0 +1,152 @@
+//
+//  TimerWheelTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "TimerWheelTests.h"
+
+#include <random>
+#include <vector>
+
+#include <udt/TimerWheel.h>
+
+QTEST_MAIN(TimerWheelTests)
+
+using namespace udt;
+
+using Wheel = TimerWheel<int>;
+
+static const uint64_t WHEEL_SPAN = (uint64_t)Wheel::NUM_SLOTS * Wheel::NUM_SLOTS * Wheel::NUM_SLOTS;
+
+void TimerWheelTests::fireOrderTest() {
+    // timers in every level, fired one tick at a time, must each fire exactly at their tick
+    const int NUM_TIMERS = 2000;
+    std::mt19937 generator(1);
+    std::uniform_int_distribution<uint64_t> dueDistribution(1, WHEEL_SPAN / 4);
+
+    Wheel wheel(1000);
+    std::vector<uint64_t> dueTicks(NUM_TIMERS);
+    for (int i = 0; i < NUM_TIMERS; ++i) {
+        dueTicks[i] = wheel.getCurrentTick() + dueDistribution(generator);
+        QVERIFY(wheel.insert(i, dueTicks[i]));
+    }
+    QCOMPARE(wheel.size(), (size_t)NUM_TIMERS);
+
+    std::vector<bool> fired(NUM_TIMERS, false);
+    uint64_t lastTick = 1000 + WHEEL_SPAN / 4;
+    while (wheel.getCurrentTick() < lastTick) {
+        uint64_t tick = wheel.getCurrentTick() + 1;
+        wheel.advance(tick, [&](int i) {
+            QCOMPARE(dueTicks[i], tick);
+            QVERIFY(!fired[i]);
+            fired[i] = true;
+        });
+    }
+    QVERIFY(wheel.isEmpty());
+    for (int i = 0; i < NUM_TIMERS; ++i) {
+        QVERIFY(fired[i]);
+    }
+}
+
+void TimerWheelTests::largeStepTest() {
+    // advancing by random strides fires every timer once, in order, and none early
+    const int NUM_TIMERS = 2000;
+    std::mt19937 generator(2);
+    std::uniform_int_distribution<uint64_t> dueDistribution(1, WHEEL_SPAN / 2);
+    std::uniform_int_distribution<uint64_t> strideDistribution(1, 5000);
+
+    Wheel wheel;
+    std::vector<uint64_t> dueTicks(NUM_TIMERS);
+    for (int i = 0; i < NUM_TIMERS; ++i) {
+        dueTicks[i] = dueDistribution(generator);
+        wheel.insert(i, dueTicks[i]);
+    }
+
+    int numFired = 0;
+    uint64_t lastFiredTick = 0;
+    while (!wheel.isEmpty()) {
+        uint64_t tick = wheel.getCurrentTick() + strideDistribution(generator);
+        wheel.advance(tick, [&](int i) {
+            QVERIFY(dueTicks[i] <= tick);
+            QVERIFY(dueTicks[i] >= lastFiredTick);
+            lastFiredTick = dueTicks[i];
+            ++numFired;
+        });
+        QCOMPARE(wheel.getCurrentTick(), tick);
+    }
+    QCOMPARE(numFired, NUM_TIMERS);
+}
+
+void TimerWheelTests::beyondWheelTest() {
+    // timers further out than the wheel spans wait in its last slot, and still fire on time
+    Wheel wheel;
+    const uint64_t FAR_TICK = 3 * WHEEL_SPAN + 17;
+    wheel.insert(0, FAR_TICK);
+    wheel.insert(1, 5);
+
+    int numFired = 0;
+    wheel.advance(FAR_TICK - 1, [&](int i) {
+        QCOMPARE(i, 1);
+        ++numFired;
+    });
+    QCOMPARE(numFired, 1);
+    QCOMPARE(wheel.size(), (size_t)1);
+
+    wheel.advance(FAR_TICK, [&](int i) {
+        QCOMPARE(i, 0);
+        ++numFired;
+    });
+    QCOMPARE(numFired, 2);
+
+    // due timers are refused
+    QVERIFY(!wheel.insert(2, FAR_TICK));
+    QVERIFY(wheel.isEmpty());
+}
+
+void TimerWheelTests::nextTickTest() {
+    // jumping from next tick to next tick, the way the scheduler sleeps, reaches every timer without passing it
+    const int NUM_TIMERS = 500;
+    std::mt19937 generator(3);
+    std::uniform_int_distribution<uint64_t> dueDistribution(1, WHEEL_SPAN / 8);
+
+    Wheel wheel(77);
+    QCOMPARE(wheel.getNextTick(), Wheel::NO_TICK);
+
+    std::vector<uint64_t> dueTicks(NUM_TIMERS);
+    uint64_t firstDueTick = Wheel::NO_TICK;
+    for (int i = 0; i < NUM_TIMERS; ++i) {
+        dueTicks[i] = wheel.getCurrentTick() + dueDistribution(generator);
+        firstDueTick = std::min(firstDueTick, dueTicks[i]);
+        wheel.insert(i, dueTicks[i]);
+    }
+
+    int numFired = 0;
+    int numJumps = 0;
+    while (!wheel.isEmpty()) {
+        uint64_t nextTick = wheel.getNextTick();
+        QVERIFY(nextTick > wheel.getCurrentTick());
+        QVERIFY(nextTick <= firstDueTick);
+        wheel.advance(nextTick, [&](int i) {
+            QCOMPARE(dueTicks[i], nextTick);
+            ++numFired;
+        });
+
+        firstDueTick = Wheel::NO_TICK;
+        for (int i = 0; i < NUM_TIMERS; ++i) {
+            if (dueTicks[i] > nextTick) {
+                firstDueTick = std::min(firstDueTick, dueTicks[i]);
+            }
+        }
+        ++numJumps;
+    }
+    QCOMPARE(numFired, NUM_TIMERS);
+    QCOMPARE(wheel.getNextTick(), Wheel::NO_TICK);
+
+    // far fewer wake ups than ticks
+    QVERIFY(numJumps < 2 * NUM_TIMERS);
+}
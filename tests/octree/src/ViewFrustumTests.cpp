@@ -11,6 +11,8 @@
 
 #include "ViewFrustumTests.h"
 
+#include <random>
+
 #include <glm/glm.hpp>
 
 #include <GLMHelpers.h>
@@ -1345,3 +1347,31 @@ void ViewFrustumTests::testBoxIntersectsKeyhole() {
     box.setBox(boxCenter - halfScaleOffset, boxScale);
     QCOMPARE(view.boxIntersectsKeyhole(box), false); // outside back
 }
+
+void ViewFrustumTests::testBoxesIntersectFrustum() {
+    ViewFrustum view;
+    view.setProjection(glm::perspective(glm::radians(60.0f), 1.5f, 0.1f, 100.0f));
+    view.setPosition(glm::vec3(1.0f, 2.0f, 3.0f));
+    view.setOrientation(glm::angleAxis(0.3f, glm::normalize(glm::vec3(1.0f, 1.0f, 0.0f))));
+    view.calculate();
+
+    std::mt19937 generator(3);
+    std::uniform_real_distribution<float> position(-120.0f, 120.0f);
+    std::uniform_real_distribution<float> size(0.0f, 20.0f);
+    const size_t NUM_BOXES = 1001;
+    std::vector<AABox> boxes;
+    for (size_t i = 0; i < NUM_BOXES; ++i) {
+        boxes.emplace_back(glm::vec3(position(generator), position(generator), position(generator)),
+                           glm::vec3(size(generator), size(generator), size(generator)));
+    }
+
+    // the batched tests agree with testing the boxes one at a time
+    std::vector<uint8_t> intersects(NUM_BOXES);
+    std::vector<uint8_t> inside(NUM_BOXES);
+    view.boxesIntersectFrustum(boxes.data(), NUM_BOXES, sizeof(AABox), intersects.data());
+    view.boxesInsideFrustum(boxes.data(), NUM_BOXES, sizeof(AABox), inside.data());
+    for (size_t i = 0; i < NUM_BOXES; ++i) {
+        QCOMPARE((bool)intersects[i], view.boxIntersectsFrustum(boxes[i]));
+        QCOMPARE((bool)inside[i], view.boxInsideFrustum(boxes[i]));
+    }
+}
@@ -0,0 +1,104 @@
+//
+//  PhysicsStressTests.cpp
+//  tests/physics/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PhysicsStressTests.h"
+
+#include <vector>
+
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
+
+#include <NumericalConstants.h>
+#include <PhysicsTaskScheduler.h>
+#include <ThreadSafeDynamicsWorld.h>
+
+QTEST_MAIN(PhysicsStressTests)
+
+static const int NUM_STACKS = 100;
+static const int BOXES_PER_STACK = 10;
+static const int NUM_STEPS = 300;
+static const float BOX_HALF_EXTENT = 0.5f;
+static const float STACK_SPACING = 4.0f * BOX_HALF_EXTENT;
+static const float FIXED_SUBSTEP = 1.0f / 90.0f;
+
+// Steps a world of NUM_STACKS towers of boxes that topple into each other and returns the average msecs per step.
+// The world is assembled from the same pieces PhysicsEngine::init() uses.
+static float stepStackedBoxes(int numThreads) {
+    auto taskScheduler = PhysicsTaskScheduler::getInstance();
+    taskScheduler->setNumThreads(numThreads);
+    btSetTaskScheduler(taskScheduler);
+    numThreads = taskScheduler->getNumThreads();
+
+    btDefaultCollisionConfiguration collisionConfig;
+    std::unique_ptr<btCollisionDispatcher> dispatcher;
+    if (numThreads > 1) {
+        dispatcher.reset(new btCollisionDispatcherMt(&collisionConfig));
+    } else {
+        dispatcher.reset(new btCollisionDispatcher(&collisionConfig));
+    }
+    btDbvtBroadphase broadphase;
+    btConstraintSolverPoolMt solverPool(numThreads);
+    ThreadSafeDynamicsWorld world(dispatcher.get(), &broadphase, &solverPool, &collisionConfig);
+    world.setGravity(btVector3(0.0f, -9.8f, 0.0f));
+
+    btBoxShape groundShape(btVector3(1000.0f, 1.0f, 1000.0f));
+    btRigidBody ground(0.0f, nullptr, &groundShape);
+    ground.getWorldTransform().setOrigin(btVector3(0.0f, -1.0f, 0.0f));
+    world.addRigidBody(&ground);
+
+    btBoxShape boxShape(btVector3(BOX_HALF_EXTENT, BOX_HALF_EXTENT, BOX_HALF_EXTENT));
+    btVector3 inertia;
+    const btScalar mass = 1.0f;
+    boxShape.calculateLocalInertia(mass, inertia);
+
+    // tilt every box a little so the stacks fall over and pile into their neighbours
+    std::vector<std::unique_ptr<btRigidBody>> boxes;
+    int stacksPerRow = (int)ceilf(sqrtf((float)NUM_STACKS));
+    for (int i = 0; i < NUM_STACKS; ++i) {
+        float x = (float)(i % stacksPerRow) * STACK_SPACING;
+        float z = (float)(i / stacksPerRow) * STACK_SPACING;
+        for (int j = 0; j < BOXES_PER_STACK; ++j) {
+            btRigidBody* box = new btRigidBody(mass, nullptr, &boxShape, inertia);
+            btTransform transform;
+            transform.setIdentity();
+            transform.setOrigin(btVector3(x, BOX_HALF_EXTENT + 2.01f * BOX_HALF_EXTENT * j, z));
+            transform.setRotation(btQuaternion(btVector3(1.0f, 0.0f, 1.0f).normalized(), 0.05f * (j % 3)));
+            box->setWorldTransform(transform);
+            world.addRigidBody(box);
+            boxes.emplace_back(box);
+        }
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < NUM_STEPS; ++i) {
+        world.stepSimulationWithSubstepCallback(FIXED_SUBSTEP, 1, FIXED_SUBSTEP, [] {});
+    }
+    float msecsPerStep = (float)timer.nsecsElapsed() / (float)(NSECS_PER_MSEC * NUM_STEPS);
+
+    for (auto& box : boxes) {
+        world.removeRigidBody(box.get());
+    }
+    world.removeRigidBody(&ground);
+    return msecsPerStep;
+}
+
+void PhysicsStressTests::benchmarkStackedBoxes() {
+    int numBodies = NUM_STACKS * BOXES_PER_STACK;
+    float serialMsecs = stepStackedBoxes(1);
+    qDebug() << "Stepped" << numBodies << "boxes on 1 thread:" << serialMsecs << "msecs/step";
+
+    int maxThreads = PhysicsTaskScheduler::getInstance()->getMaxNumThreads();
+    for (int numThreads = 2; numThreads <= maxThreads; numThreads *= 2) {
+        float msecs = stepStackedBoxes(numThreads);
+        qDebug() << "Stepped" << numBodies << "boxes on" << numThreads << "threads:" << msecs << "msecs/step"
+            << "(" << serialMsecs / msecs << "x )";
+    }
+    PhysicsTaskScheduler::getInstance()->setNumThreads(1);
+}
@@ -186,7 +186,7 @@ void ShapeManagerTests::addCapsuleShape() {
     */
 }
 
-void ShapeManagerTests::addCompoundShape() {
+static void computeCompoundShapeInfo(int numHulls, ShapeInfo& info) {
     // initialize some points for generating tetrahedral convex hulls
     QVector<glm::vec3> tetrahedron;
     tetrahedron.push_back(glm::vec3(1.0f, 1.0f, 1.0f));
@@ -197,7 +197,6 @@ void ShapeManagerTests::addCompoundShape() {
 
     // compute the points of the hulls
     ShapeInfo::PointCollection pointCollection;
-    int numHulls = 5;
     glm::vec3 offsetNormal(1.0f, 0.0f, 0.0f);
     Extents extents;
     for (int i = 0; i < numHulls; ++i) {
@@ -213,10 +212,15 @@ void ShapeManagerTests::addCompoundShape() {
     }
 
     // create the ShapeInfo
-    ShapeInfo info;
     glm::vec3 halfExtents = 0.5f * (extents.maximum - extents.minimum);
     info.setParams(SHAPE_TYPE_COMPOUND, halfExtents);
     info.setPointCollection(pointCollection);
+}
+
+void ShapeManagerTests::addCompoundShape() {
+    int numHulls = 5;
+    ShapeInfo info;
+    computeCompoundShapeInfo(numHulls, info);
 
     // create the shape
     ShapeManager shapeManager;
@@ -244,3 +248,37 @@ void ShapeManagerTests::addCompoundShape() {
     QCOMPARE(shapeManager.getNumShapes(), 0);
     QCOMPARE(shapeManager.getNumReferences(info), 0);
 }
+
+void ShapeManagerTests::addCompoundShapeAsync() {
+    int numHulls = 5;
+    ShapeInfo info;
+    computeCompoundShapeInfo(numHulls, info);
+
+    // an async request starts a worker rather than returning a shape
+    ShapeManager shapeManager;
+    uint32_t requestCount = shapeManager.getWorkRequestCount();
+    const btCollisionShape* shape = shapeManager.getShape(info, true);
+    QVERIFY(shape == nullptr);
+    QCOMPARE(shapeManager.getWorkRequestCount(), requestCount + 1);
+
+    // asking again while the worker is busy does not start another one
+    shape = shapeManager.getShape(info, true);
+    QVERIFY(shape == nullptr);
+
+    // the shape is delivered to the map with no references
+    QTRY_COMPARE(shapeManager.getWorkDeliveryCount(), (uint32_t)1);
+    QVERIFY(shapeManager.hasShapeWithKey(info.getHash()));
+    QCOMPARE(shapeManager.getNumReferences(info), 0);
+    QCOMPARE(shapeManager.getNumShapesBuilt(), (uint32_t)1);
+    QCOMPARE(shapeManager.getNumShapeCacheHits(), (uint32_t)0);
+
+    shape = shapeManager.getShapeByKey(info.getHash());
+    QVERIFY(shape != nullptr);
+    QCOMPARE(shape->getShapeType(), (int)COMPOUND_SHAPE_PROXYTYPE);
+    QCOMPARE(static_cast<const btCompoundShape*>(shape)->getNumChildShapes(), numHulls);
+    QCOMPARE(shapeManager.getNumReferences(info), 1);
+
+    shapeManager.releaseShape(shape);
+    shapeManager.collectGarbage();
+    QCOMPARE(shapeManager.getNumShapes(), 0);
+}
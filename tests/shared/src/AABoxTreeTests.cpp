@@ -0,0 +1,317 @@
+//
+//  AABoxTreeTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AABoxTreeTests.h"
+
+#include <algorithm>
+#include <random>
+
+#include <AABoxTree.h>
+
+QTEST_MAIN(AABoxTreeTests)
+
+namespace {
+    const float WORLD_SIZE = 1000.0f;
+
+    class TestBoxes {
+    public:
+        explicit TestBoxes(unsigned int seed) : generator(seed) { }
+
+        float random(float minimum, float maximum) {
+            return std::uniform_real_distribution<float>(minimum, maximum)(generator);
+        }
+
+        AABox randomBox(float maxSize) {
+            glm::vec3 corner(random(0.0f, WORLD_SIZE), random(0.0f, WORLD_SIZE), random(0.0f, WORLD_SIZE));
+            return AABox(corner, glm::vec3(random(0.1f, maxSize), random(0.1f, maxSize), random(0.1f, maxSize)));
+        }
+
+        void insert(const AABox& box) {
+            int index = (int)boxes.size();
+            boxes.push_back(box);
+            proxies.push_back(tree.insert(box, index));
+        }
+
+        void update(int index, const AABox& box) {
+            boxes[index] = box;
+            tree.update(proxies[index], box);
+        }
+
+        void remove(int index) {
+            tree.remove(proxies[index]);
+            proxies[index] = AABoxTree<int>::NULL_PROXY;
+        }
+
+        bool isLive(int index) const { return proxies[index] != AABoxTree<int>::NULL_PROXY; }
+
+        std::mt19937 generator;
+        AABoxTree<int> tree;
+        std::vector<AABox> boxes;
+        std::vector<AABoxTree<int>::Proxy> proxies;
+    };
+
+    bool sphereTouchesBox(const glm::vec3& center, float radius, const AABox& box) {
+        glm::vec3 offset = glm::clamp(center, box.getMinimumPoint(), box.getMaximumPoint()) - center;
+        return glm::dot(offset, offset) <= radius * radius;
+    }
+
+    // slab test, for checking the tree's
+    bool findRayEntry(const glm::vec3& origin, const glm::vec3& direction, const AABox& box, float& distance) {
+        float entry = 0.0f;
+        float exit = FLT_MAX;
+        for (int i = 0; i < 3; ++i) {
+            float minimum = box.getMinimumPoint()[i];
+            float maximum = box.getMaximumPoint()[i];
+            if (direction[i] == 0.0f) {
+                if (origin[i] < minimum || origin[i] > maximum) {
+                    return false;
+                }
+                continue;
+            }
+            float toMinimum = (minimum - origin[i]) / direction[i];
+            float toMaximum = (maximum - origin[i]) / direction[i];
+            entry = std::max(entry, std::min(toMinimum, toMaximum));
+            exit = std::min(exit, std::max(toMinimum, toMaximum));
+        }
+        if (exit < entry) {
+            return false;
+        }
+        distance = entry;
+        return true;
+    }
+
+    void populate(TestBoxes& boxes, int numBoxes) {
+        const float MAX_SIZE = 20.0f;
+        for (int i = 0; i < numBoxes; ++i) {
+            boxes.insert(boxes.randomBox(MAX_SIZE));
+        }
+        // nudge some a little, which mostly stays within their enlarged boxes, and move some far
+        for (int i = 0; i < numBoxes; i += 3) {
+            AABox box = boxes.boxes[i];
+            box.setBox(box.getMinimumPoint() + glm::vec3(boxes.random(-0.5f, 0.5f)), box.getDimensions());
+            boxes.update(i, box);
+        }
+        for (int i = 1; i < numBoxes; i += 5) {
+            boxes.update(i, boxes.randomBox(MAX_SIZE));
+        }
+        for (int i = 2; i < numBoxes; i += 4) {
+            boxes.remove(i);
+        }
+    }
+}
+
+void AABoxTreeTests::touchingTest() {
+    TestBoxes boxes(3);
+    const int NUM_BOXES = 3000;
+    populate(boxes, NUM_BOXES);
+
+    // the tree finds every box the query touches, and nothing farther than the enlarged box of what it finds
+    const int NUM_QUERIES = 200;
+    for (int i = 0; i < NUM_QUERIES; ++i) {
+        AABox queryBox = boxes.randomBox(100.0f);
+        std::vector<int> found;
+        boxes.tree.findTouchingBox(queryBox, [&](int index) {
+            found.push_back(index);
+        });
+        std::sort(found.begin(), found.end());
+        QVERIFY(std::unique(found.begin(), found.end()) == found.end());
+        for (int j = 0; j < NUM_BOXES; ++j) {
+            bool wasFound = std::binary_search(found.begin(), found.end(), j);
+            if (!boxes.isLive(j)) {
+                QVERIFY(!wasFound);
+            } else if (boxes.boxes[j].touches(queryBox)) {
+                QVERIFY(wasFound);
+            } else if (wasFound) {
+                QVERIFY(boxes.tree.getEnlargedBox(boxes.proxies[j]).touches(queryBox));
+            }
+        }
+
+        glm::vec3 center = queryBox.getMinimumPoint();
+        float radius = boxes.random(1.0f, 100.0f);
+        found.clear();
+        boxes.tree.findTouchingSphere(center, radius, [&](int index) {
+            found.push_back(index);
+        });
+        std::sort(found.begin(), found.end());
+        for (int j = 0; j < NUM_BOXES; ++j) {
+            bool wasFound = std::binary_search(found.begin(), found.end(), j);
+            if (!boxes.isLive(j)) {
+                QVERIFY(!wasFound);
+            } else if (sphereTouchesBox(center, radius, boxes.boxes[j])) {
+                QVERIFY(wasFound);
+            } else if (wasFound) {
+                QVERIFY(sphereTouchesBox(center, radius, boxes.tree.getEnlargedBox(boxes.proxies[j])));
+            }
+        }
+    }
+}
+
+void AABoxTreeTests::rayTest() {
+    TestBoxes boxes(5);
+    const int NUM_BOXES = 3000;
+    populate(boxes, NUM_BOXES);
+
+    const int NUM_RAYS = 500;
+    for (int i = 0; i < NUM_RAYS; ++i) {
+        glm::vec3 origin(boxes.random(0.0f, WORLD_SIZE), boxes.random(0.0f, WORLD_SIZE), boxes.random(0.0f, WORLD_SIZE));
+        glm::vec3 direction(boxes.random(-1.0f, 1.0f), boxes.random(-1.0f, 1.0f), boxes.random(-1.0f, 1.0f));
+        if (i % 10 == 0) {
+            // axis aligned rays have zero components
+            direction = glm::vec3(0.0f, 0.0f, 0.0f);
+            direction[i % 3] = 1.0f;
+        }
+
+        int expected = -1;
+        float expectedDistance = FLT_MAX;
+        for (int j = 0; j < NUM_BOXES; ++j) {
+            float distance;
+            if (boxes.isLive(j) && findRayEntry(origin, direction, boxes.boxes[j], distance) && distance < expectedDistance) {
+                expected = j;
+                expectedDistance = distance;
+            }
+        }
+
+        int nearest = -1;
+        float nearestDistance = FLT_MAX;
+        boxes.tree.findRayHits(origin, direction, FLT_MAX, [&](int index, float entryDistance) {
+            float distance;
+            if (findRayEntry(origin, direction, boxes.boxes[index], distance) && distance < nearestDistance) {
+                nearest = index;
+                nearestDistance = distance;
+            }
+            return nearestDistance;
+        });
+        // compare distances rather than boxes, which may tie when the ray starts inside more than one
+        QCOMPARE(nearest == -1, expected == -1);
+        QCOMPARE(nearestDistance, expectedDistance);
+    }
+}
+
+void AABoxTreeTests::balanceTest() {
+    // boxes inserted in order along a line would make a list of an unbalanced tree
+    AABoxTree<int> tree;
+    const int NUM_BOXES = 10000;
+    std::vector<AABoxTree<int>::Proxy> proxies;
+    for (int i = 0; i < NUM_BOXES; ++i) {
+        proxies.push_back(tree.insert(AABox(glm::vec3((float)i, 0.0f, 0.0f), 0.5f), i));
+    }
+    QCOMPARE(tree.getSize(), NUM_BOXES);
+    const int MAX_HEIGHT = 30;
+    QVERIFY(tree.getHeight() <= MAX_HEIGHT);
+
+    for (int i = 0; i < NUM_BOXES; i += 2) {
+        tree.remove(proxies[i]);
+    }
+    QCOMPARE(tree.getSize(), NUM_BOXES / 2);
+    QVERIFY(tree.getHeight() <= MAX_HEIGHT);
+
+    // removed proxies are reused
+    AABoxTree<int>::Proxy proxy = tree.insert(AABox(glm::vec3(0.0f), 1.0f), -1);
+    QVERIFY(proxy < 2 * NUM_BOXES);
+    QCOMPARE(tree.getPayload(proxy), -1);
+
+    tree.clear();
+    QCOMPARE(tree.getSize(), 0);
+    int numFound = 0;
+    tree.findTouchingBox(AABox(glm::vec3(0.0f), WORLD_SIZE), [&](int index) {
+        ++numFound;
+    });
+    QCOMPARE(numFound, 0);
+}
+
+namespace {
+    const int NUM_BENCHMARK_BOXES = 100000;
+    const int NUM_BENCHMARK_QUERIES = 500;
+
+    void insertBenchmarkBoxes(TestBoxes& boxes) {
+        const float MAX_SIZE = 5.0f;
+        for (int i = 0; i < NUM_BENCHMARK_BOXES; ++i) {
+            boxes.insert(boxes.randomBox(MAX_SIZE));
+        }
+    }
+
+    // the brute force rows test every box, as the entity queries did before the tree, for a baseline
+    void addBenchmarkRows() {
+        QTest::addColumn<bool>("useTree");
+        QTest::newRow("tree") << true;
+        QTest::newRow("brute force") << false;
+    }
+}
+
+void AABoxTreeTests::boxQueryBenchmark_data() {
+    addBenchmarkRows();
+}
+
+void AABoxTreeTests::boxQueryBenchmark() {
+    QFETCH(bool, useTree);
+    TestBoxes boxes(13);
+    insertBenchmarkBoxes(boxes);
+    std::vector<AABox> queryBoxes;
+    for (int i = 0; i < NUM_BENCHMARK_QUERIES; ++i) {
+        queryBoxes.push_back(boxes.randomBox(50.0f));
+    }
+
+    int numFound = 0;
+    QBENCHMARK {
+        for (auto& queryBox : queryBoxes) {
+            if (useTree) {
+                boxes.tree.findTouchingBox(queryBox, [&](int index) {
+                    numFound += boxes.boxes[index].touches(queryBox) ? 1 : 0;
+                });
+            } else {
+                for (auto& box : boxes.boxes) {
+                    numFound += box.touches(queryBox) ? 1 : 0;
+                }
+            }
+        }
+    }
+    QVERIFY(numFound > 0);
+}
+
+void AABoxTreeTests::rayQueryBenchmark_data() {
+    addBenchmarkRows();
+}
+
+void AABoxTreeTests::rayQueryBenchmark() {
+    QFETCH(bool, useTree);
+    TestBoxes boxes(13);
+    insertBenchmarkBoxes(boxes);
+    std::vector<glm::vec3> origins;
+    std::vector<glm::vec3> directions;
+    for (int i = 0; i < NUM_BENCHMARK_QUERIES; ++i) {
+        origins.push_back(glm::vec3(boxes.random(0.0f, WORLD_SIZE), boxes.random(0.0f, WORLD_SIZE), boxes.random(0.0f, WORLD_SIZE)));
+        directions.push_back(glm::vec3(boxes.random(-1.0f, 1.0f), boxes.random(-1.0f, 1.0f), boxes.random(-1.0f, 1.0f)));
+    }
+
+    int numHits = 0;
+    QBENCHMARK {
+        for (int i = 0; i < NUM_BENCHMARK_QUERIES; ++i) {
+            float nearestDistance = FLT_MAX;
+            if (useTree) {
+                boxes.tree.findRayHits(origins[i], directions[i], FLT_MAX, [&](int index, float entryDistance) {
+                    float distance;
+                    if (findRayEntry(origins[i], directions[i], boxes.boxes[index], distance)) {
+                        nearestDistance = std::min(nearestDistance, distance);
+                    }
+                    return nearestDistance;
+                });
+            } else {
+                for (auto& box : boxes.boxes) {
+                    float distance;
+                    if (findRayEntry(origins[i], directions[i], box, distance)) {
+                        nearestDistance = std::min(nearestDistance, distance);
+                    }
+                }
+            }
+            numHits += nearestDistance < FLT_MAX ? 1 : 0;
+        }
+    }
+    QVERIFY(numHits > 0);
+}
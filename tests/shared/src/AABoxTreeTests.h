@@ -0,0 +1,28 @@
+//
+//  AABoxTreeTests.h
+//  tests/shared/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AABoxTreeTests_h
+#define hifi_AABoxTreeTests_h
+
+#include <QtTest/QtTest>
+
+class AABoxTreeTests : public QObject {
+    Q_OBJECT
+private slots:
+    void touchingTest();
+    void rayTest();
+    void balanceTest();
+    void boxQueryBenchmark_data();
+    void boxQueryBenchmark();
+    void rayQueryBenchmark_data();
+    void rayQueryBenchmark();
+};
+
+#endif // hifi_AABoxTreeTests_h
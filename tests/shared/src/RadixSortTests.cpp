@@ -0,0 +1,54 @@
+//
+//  RadixSortTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "RadixSortTests.h"
+
+#include <algorithm>
+#include <random>
+
+#include <RadixSort.h>
+
+QTEST_MAIN(RadixSortTests)
+
+void RadixSortTests::sortTest() {
+    std::mt19937 generator(7);
+    std::vector<size_t> sizes = { 0, 1, 2, 100, 5000 };
+    for (auto size : sizes) {
+        std::vector<uint64_t> keys;
+        for (size_t i = 0; i < size; ++i) {
+            // few distinct high bytes, so that some bytes are skipped
+            keys.push_back(((uint64_t)(generator() % 3) << 56) | generator());
+        }
+        std::vector<uint64_t> expected = keys;
+        std::sort(expected.begin(), expected.end());
+
+        std::vector<uint64_t> scratch;
+        radixSort(keys, scratch);
+        QVERIFY(keys == expected);
+    }
+}
+
+void RadixSortTests::payloadTest() {
+    // the low bytes are not sorted, keys that compare equal keep their order
+    std::mt19937 generator(11);
+    const uint32_t NUM_KEYS = 3000;
+    std::vector<uint64_t> keys;
+    for (uint32_t i = 0; i < NUM_KEYS; ++i) {
+        keys.push_back(((uint64_t)(generator() % 50) << 32) | i);
+    }
+    std::vector<uint64_t> expected = keys;
+    std::stable_sort(expected.begin(), expected.end(), [](uint64_t a, uint64_t b) {
+        return (a >> 32) < (b >> 32);
+    });
+
+    std::vector<uint64_t> scratch;
+    radixSort(keys, scratch, 4);
+    QVERIFY(keys == expected);
+}
@@ -0,0 +1,23 @@
+//
+//  RadixSortTests.h
+//  tests/shared/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_RadixSortTests_h
+#define hifi_RadixSortTests_h
+
+#include <QtTest/QtTest>
+
+class RadixSortTests : public QObject {
+    Q_OBJECT
+private slots:
+    void sortTest();
+    void payloadTest();
+};
+
+#endif // hifi_RadixSortTests_h
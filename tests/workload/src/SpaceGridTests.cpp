@@ -0,0 +1,226 @@
+//
+//  SpaceGridTests.cpp
+//  tests/workload/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SpaceGridTests.h"
+
+#include <random>
+
+#include <glm/gtx/norm.hpp>
+
+#include <NumericalConstants.h>
+#include <workload/Space.h>
+
+QTEST_MAIN(SpaceGridTests)
+
+using namespace workload;
+
+static const float WORLD_WIDTH = 2000.0f;
+static const float REGION_RADII[Region::NUM_TRACKED_REGIONS] = { 50.0f, 150.0f, 400.0f };
+
+static View makeView(const glm::vec3& origin) {
+    View view;
+    view.origin = origin;
+    for (uint32_t i = 0; i < Region::NUM_TRACKED_REGIONS; ++i) {
+        view.regions[i] = Sphere(origin, REGION_RADII[i]);
+    }
+    return view;
+}
+
+static Sphere randomSphere(std::mt19937& generator) {
+    std::uniform_real_distribution<float> position(-0.5f * WORLD_WIDTH, 0.5f * WORLD_WIDTH);
+    std::uniform_real_distribution<float> radius(0.1f, 10.0f);
+    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+    // a few proxies are too big for the grid cells
+    float r = chance(generator) < 0.001f ? 100.0f : radius(generator);
+    return Sphere(position(generator), position(generator), position(generator), r);
+}
+
+// the classification every proxy had before the grid: the lowest region it touches in any view.
+static uint8_t computeRegion(const Sphere& sphere, const Views& views) {
+    uint8_t region = Region::R4;
+    for (auto& view : views) {
+        for (uint8_t k = 0; k < region; ++k) {
+            float touchDistance = sphere.w + view.regions[k].w;
+            if (glm::distance2(glm::vec3(sphere), glm::vec3(view.regions[k])) < touchDistance * touchDistance) {
+                region = k;
+                break;
+            }
+        }
+    }
+    return region;
+}
+
+static void processFrame(Space& space, const Transaction& transaction) {
+    space.enqueueTransaction(transaction);
+    space.enqueueFrame();
+    space.processTransactionQueue();
+}
+
+void SpaceGridTests::testCategorizeMatchesBruteForce() {
+    const uint32_t NUM_PROXIES = 5000;
+    const uint32_t NUM_FRAMES = 200;
+    std::mt19937 generator(11);
+    std::uniform_real_distribution<float> step(-20.0f, 20.0f);
+    std::uniform_int_distribution<uint32_t> pick(0, NUM_PROXIES - 1);
+
+    Space space;
+    std::vector<int32_t> proxyIDs;
+    std::vector<Sphere> spheres;
+    Transaction transaction;
+    for (uint32_t i = 0; i < NUM_PROXIES; ++i) {
+        proxyIDs.push_back(space.allocateID());
+        spheres.push_back(randomSphere(generator));
+        transaction.reset(proxyIDs.back(), spheres.back(), Owner());
+    }
+    processFrame(space, transaction);
+
+    Views views { makeView(glm::vec3(0.0f)), makeView(glm::vec3(300.0f, 0.0f, 0.0f)) };
+    std::vector<uint8_t> regions(NUM_PROXIES, Region::UNKNOWN);
+    std::vector<Space::Change> changes;
+    for (uint32_t frame = 0; frame < NUM_FRAMES; ++frame) {
+        // move the views, sometimes a long way
+        for (auto& view : views) {
+            glm::vec3 origin = view.origin + glm::vec3(step(generator), step(generator), step(generator));
+            if (frame % 50 == 49) {
+                origin = glm::vec3(randomSphere(generator));
+            }
+            view = makeView(origin);
+        }
+        space.setViews(views);
+
+        // and a few proxies
+        Transaction moves;
+        for (uint32_t i = 0; i < NUM_PROXIES / 100; ++i) {
+            uint32_t index = pick(generator);
+            spheres[index] = randomSphere(generator);
+            moves.update(proxyIDs[index], spheres[index]);
+        }
+        processFrame(space, moves);
+
+        changes.clear();
+        space.categorizeAndGetChanges(changes);
+        for (auto& change : changes) {
+            QCOMPARE(change.prevRegion, regions[change.proxyId]);
+            regions[change.proxyId] = change.region;
+        }
+        for (uint32_t i = 0; i < NUM_PROXIES; ++i) {
+            uint8_t expected = computeRegion(spheres[i], views);
+            QCOMPARE(space.getRegion(proxyIDs[i]), expected);
+            QCOMPARE(regions[i], expected);
+        }
+    }
+}
+
+void SpaceGridTests::testRemovedProxiesAreIgnored() {
+    Space space;
+    Views views { makeView(glm::vec3(0.0f)) };
+    space.setViews(views);
+
+    int32_t nearID = space.allocateID();
+    int32_t farID = space.allocateID();
+    Transaction transaction;
+    transaction.reset(nearID, Sphere(1.0f, 0.0f, 0.0f, 1.0f), Owner());
+    transaction.reset(farID, Sphere(1000.0f, 0.0f, 0.0f, 1.0f), Owner());
+    processFrame(space, transaction);
+
+    std::vector<Space::Change> changes;
+    space.categorizeAndGetChanges(changes);
+    QCOMPARE((int)changes.size(), 2);
+    QCOMPARE(space.getRegion(nearID), (uint8_t)Region::R1);
+    QCOMPARE(space.getRegion(farID), (uint8_t)Region::R4);
+
+    Transaction removal;
+    removal.remove(nearID);
+    processFrame(space, removal);
+
+    // sweep the view across both proxies: only the remaining one changes
+    views[0] = makeView(glm::vec3(1000.0f, 0.0f, 0.0f));
+    space.setViews(views);
+    changes.clear();
+    space.categorizeAndGetChanges(changes);
+    QCOMPARE((int)changes.size(), 1);
+    QCOMPARE(changes[0].proxyId, farID);
+    QCOMPARE(changes[0].prevRegion, (uint8_t)Region::R4);
+    QCOMPARE(changes[0].region, (uint8_t)Region::R1);
+    QCOMPARE(space.getRegion(nearID), (uint8_t)Region::INVALID);
+
+    // nothing moved: nothing changes
+    changes.clear();
+    space.categorizeAndGetChanges(changes);
+    QCOMPARE((int)changes.size(), 0);
+}
+
+void SpaceGridTests::benchmarkMovingViews() {
+    const uint32_t NUM_PROXIES = 100000;
+    const uint32_t NUM_FRAMES = 100;
+    const float VIEW_SPEED = 1.5f;  // per frame, about walking speed at 90Hz
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<float> step(-1.0f, 1.0f);
+    std::uniform_int_distribution<uint32_t> pick(0, NUM_PROXIES - 1);
+
+    Space space;
+    std::vector<int32_t> proxyIDs;
+    std::vector<Sphere> spheres;
+    Transaction transaction;
+    for (uint32_t i = 0; i < NUM_PROXIES; ++i) {
+        proxyIDs.push_back(space.allocateID());
+        spheres.push_back(randomSphere(generator));
+        transaction.reset(proxyIDs.back(), spheres.back(), Owner());
+    }
+    processFrame(space, transaction);
+
+    Views views { makeView(glm::vec3(0.0f)), makeView(glm::vec3(0.0f, 0.0f, 500.0f)) };
+    space.setViews(views);
+    std::vector<Space::Change> changes;
+    space.categorizeAndGetChanges(changes);
+
+    // 1% of the proxies move a little every frame
+    std::vector<Transaction> moves(NUM_FRAMES);
+    std::vector<Views> frameViews(NUM_FRAMES);
+    for (uint32_t frame = 0; frame < NUM_FRAMES; ++frame) {
+        for (uint32_t i = 0; i < NUM_PROXIES / 100; ++i) {
+            uint32_t index = pick(generator);
+            spheres[index] += Sphere(step(generator), step(generator), step(generator), 0.0f);
+            moves[frame].update(proxyIDs[index], spheres[index]);
+        }
+        for (size_t i = 0; i < views.size(); ++i) {
+            views[i] = makeView(views[i].origin + glm::vec3(VIEW_SPEED, 0.0f, 0.0f));
+        }
+        frameViews[frame] = views;
+    }
+
+    uint64_t numChanges = 0;
+    QElapsedTimer timer;
+    timer.start();
+    for (uint32_t frame = 0; frame < NUM_FRAMES; ++frame) {
+        processFrame(space, moves[frame]);
+        space.setViews(frameViews[frame]);
+        changes.clear();
+        space.categorizeAndGetChanges(changes);
+        numChanges += changes.size();
+    }
+    float gridMsecs = (float)timer.nsecsElapsed() / (float)(NSECS_PER_MSEC * NUM_FRAMES);
+
+    // what every frame cost when every proxy was tested against every region
+    std::vector<uint8_t> regions(NUM_PROXIES);
+    timer.start();
+    for (uint32_t frame = 0; frame < NUM_FRAMES; ++frame) {
+        for (uint32_t i = 0; i < NUM_PROXIES; ++i) {
+            regions[i] = computeRegion(spheres[i], frameViews[frame]);
+        }
+    }
+    float bruteForceMsecs = (float)timer.nsecsElapsed() / (float)(NSECS_PER_MSEC * NUM_FRAMES);
+
+    for (uint32_t i = 0; i < NUM_PROXIES; ++i) {
+        QCOMPARE(space.getRegion(proxyIDs[i]), regions[i]);
+    }
+    qDebug() << NUM_PROXIES << "proxies," << views.size() << "moving views:" << gridMsecs << "msec per frame with the grid,"
+        << bruteForceMsecs << "msec testing every proxy," << (float)numChanges / (float)NUM_FRAMES << "changes per frame";
+}
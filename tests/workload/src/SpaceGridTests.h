@@ -0,0 +1,25 @@
+//
+//  SpaceGridTests.h
+//  tests/workload/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_workload_SpaceGridTests_h
+#define hifi_workload_SpaceGridTests_h
+
+#include <QtTest/QtTest>
+
+class SpaceGridTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testCategorizeMatchesBruteForce();
+    void testRemovedProxiesAreIgnored();
+    void benchmarkMovingViews();
+};
+
+#endif // hifi_workload_SpaceGridTests_h
@@ -0,0 +1,186 @@
+//
+//  BakeCache.cpp
+//  tools/oven/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BakeCache.h"
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDebug>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QSaveFile>
+
+const int BakeCache::VERSION = 2;
+
+static const QString MANIFEST_FILE_NAME = "manifest.json";
+static const QString MANIFEST_FILES_KEY = "files";
+static const QString MANIFEST_MAIN_OUTPUT_KEY = "mainOutput";
+static const QString MANIFEST_DEPENDENCIES_KEY = "dependencies";
+static const QString ENTRY_FILES_FOLDER_NAME = "files";
+static const QString LOCK_FILE_SUFFIX = ".lock";
+
+// a claim older than this is considered left behind by a crashed oven and may be taken over
+static const int STALE_CLAIM_MSECS = 30 * 60 * 1000;
+
+BakeCache::BakeCache(const QString& cacheDirectory) :
+    _cacheDirectory(cacheDirectory)
+{
+    _isValid = _cacheDirectory.mkpath(".");
+    if (!_isValid) {
+        qWarning() << "Could not create bake cache folder" << cacheDirectory;
+    }
+}
+
+QString BakeCache::computeKey(const QByteArray& inputContent, const QString& bakerType, const QStringList& options) const {
+    QCryptographicHash hasher(QCryptographicHash::Sha256);
+    hasher.addData(QByteArray::number(VERSION));
+    hasher.addData(bakerType.toUtf8());
+    hasher.addData(options.join('\n').toUtf8());
+    hasher.addData(inputContent);
+    return hasher.result().toHex();
+}
+
+bool BakeCache::contains(const QString& key) const {
+    return QFile::exists(QDir(getEntryPath(key)).absoluteFilePath(MANIFEST_FILE_NAME));
+}
+
+BakeDependencies BakeCache::getDependencies(const QString& key) const {
+    BakeDependencies dependencies;
+    QFile manifestFile { QDir(getEntryPath(key)).absoluteFilePath(MANIFEST_FILE_NAME) };
+    if (manifestFile.open(QIODevice::ReadOnly)) {
+        auto manifestDependencies = QJsonDocument::fromJson(manifestFile.readAll()).object()[MANIFEST_DEPENDENCIES_KEY].toObject();
+        for (auto it = manifestDependencies.begin(); it != manifestDependencies.end(); ++it) {
+            dependencies[QUrl(it.key())] = it.value().toString().toLatin1();
+        }
+    }
+    return dependencies;
+}
+
+QString BakeCache::restore(const QString& key, const QString& outputDirectory) const {
+    QDir entryDir { getEntryPath(key) };
+
+    QFile manifestFile { entryDir.absoluteFilePath(MANIFEST_FILE_NAME) };
+    if (!manifestFile.open(QIODevice::ReadOnly)) {
+        return QString();
+    }
+    auto manifest = QJsonDocument::fromJson(manifestFile.readAll()).object();
+
+    QDir filesDir { entryDir.absoluteFilePath(ENTRY_FILES_FOLDER_NAME) };
+    QDir outputDir { outputDirectory };
+    if (!outputDir.mkpath(".")) {
+        qWarning() << "Could not create output folder" << outputDirectory << "for cached bake" << key;
+        return QString();
+    }
+
+    for (auto file : manifest[MANIFEST_FILES_KEY].toArray()) {
+        auto relativePath = file.toString();
+        auto destinationPath = outputDir.absoluteFilePath(relativePath);
+        QDir().mkpath(QFileInfo(destinationPath).absolutePath());
+        QFile::remove(destinationPath);
+        if (!QFile::copy(filesDir.absoluteFilePath(relativePath), destinationPath)) {
+            qWarning() << "Could not restore" << relativePath << "from cached bake" << key;
+            return QString();
+        }
+    }
+
+    return outputDir.absoluteFilePath(manifest[MANIFEST_MAIN_OUTPUT_KEY].toString());
+}
+
+bool BakeCache::store(const QString& key, const QString& rootDirectory, const QStringList& files, const QString& mainOutputFile,
+                      const BakeDependencies& dependencies) {
+    bool isReplacing = contains(key);
+    if (isReplacing && getDependencies(key) == dependencies) {
+        return true;
+    }
+
+    // write the entry to a private folder first and move it into place once complete, so that other ovens
+    // sharing this cache never see a partially written entry
+    auto partialPath = getEntryPath(key) + ".partial-" + QString::number(QCoreApplication::applicationPid());
+    QDir partialDir { partialPath };
+    partialDir.removeRecursively();
+    if (!partialDir.mkpath(ENTRY_FILES_FOLDER_NAME)) {
+        qWarning() << "Could not create bake cache entry" << partialPath;
+        return false;
+    }
+
+    QDir rootDir { rootDirectory };
+    QDir filesDir { partialDir.absoluteFilePath(ENTRY_FILES_FOLDER_NAME) };
+    QJsonArray relativeFiles;
+    for (auto& file : files) {
+        auto relativePath = rootDir.relativeFilePath(file);
+        auto destinationPath = filesDir.absoluteFilePath(relativePath);
+        QDir().mkpath(QFileInfo(destinationPath).absolutePath());
+        if (!QFile::copy(file, destinationPath)) {
+            qWarning() << "Could not copy" << file << "into bake cache entry" << key;
+            partialDir.removeRecursively();
+            return false;
+        }
+        relativeFiles.append(relativePath);
+    }
+
+    QJsonObject manifest;
+    manifest[MANIFEST_FILES_KEY] = relativeFiles;
+    manifest[MANIFEST_MAIN_OUTPUT_KEY] = rootDir.relativeFilePath(mainOutputFile);
+    QJsonObject manifestDependencies;
+    for (auto it = dependencies.begin(); it != dependencies.end(); ++it) {
+        manifestDependencies[it.key().toString()] = QString::fromLatin1(it.value());
+    }
+    manifest[MANIFEST_DEPENDENCIES_KEY] = manifestDependencies;
+
+    QSaveFile manifestFile { partialDir.absoluteFilePath(MANIFEST_FILE_NAME) };
+    if (!manifestFile.open(QIODevice::WriteOnly)
+        || manifestFile.write(QJsonDocument(manifest).toJson()) == -1
+        || !manifestFile.commit()) {
+        qWarning() << "Could not write manifest for bake cache entry" << key;
+        partialDir.removeRecursively();
+        return false;
+    }
+
+    if (isReplacing) {
+        // move the out of date entry aside first, since an entry can't be renamed over
+        auto stalePath = getEntryPath(key) + ".stale-" + QString::number(QCoreApplication::applicationPid());
+        if (_cacheDirectory.rename(getEntryPath(key), stalePath)) {
+            QDir(stalePath).removeRecursively();
+        }
+    }
+
+    if (!_cacheDirectory.rename(partialPath, getEntryPath(key))) {
+        // another oven may have stored the same entry first, which is just as good
+        partialDir.removeRecursively();
+        return contains(key);
+    }
+
+    return true;
+}
+
+bool BakeCache::tryClaim(const QString& key) {
+    if (_claims.contains(key)) {
+        return true;
+    }
+
+    auto lockFile = QSharedPointer<QLockFile>::create(getEntryPath(key) + LOCK_FILE_SUFFIX);
+    lockFile->setStaleLockTime(STALE_CLAIM_MSECS);
+    if (!lockFile->tryLock(0)) {
+        return false;
+    }
+
+    _claims.insert(key, lockFile);
+    return true;
+}
+
+void BakeCache::releaseClaim(const QString& key) {
+    auto lockFile = _claims.take(key);
+    if (lockFile) {
+        lockFile->unlock();
+    }
+}
@@ -0,0 +1,68 @@
+//
+//  BakeCache.h
+//  tools/oven/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_BakeCache_h
+#define hifi_BakeCache_h
+
+#include <QtCore/QDir>
+#include <QtCore/QHash>
+#include <QtCore/QLockFile>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QStringList>
+#include <QtCore/QUrl>
+
+#include <Baker.h>
+
+// A content-addressed store of baker output that lets repeated domain bakes skip assets that have not changed.
+//
+// Entries are keyed by a hash of the input content, the cache version and the baker options, and live in their own
+// folder below the cache directory. An entry also records the files the bake read besides its input, like a model's
+// textures, so that it can be baked again when one of them changes. Several oven processes may share one cache directory: a process claims a key
+// with a lock file before baking it, and the others wait for that entry to show up instead of baking it again.
+class BakeCache {
+public:
+    // Bump this whenever a baker changes its output, so that entries baked by an older oven are not re-used
+    static const int VERSION;
+
+    BakeCache(const QString& cacheDirectory);
+
+    bool isValid() const { return _isValid; }
+    QString getCacheDirectory() const { return _cacheDirectory.absolutePath(); }
+
+    QString computeKey(const QByteArray& inputContent, const QString& bakerType, const QStringList& options) const;
+
+    bool contains(const QString& key) const;
+
+    // The files the bake stored under key read besides its input
+    BakeDependencies getDependencies(const QString& key) const;
+
+    // Copies the cached files for key into outputDirectory and returns the path of the restored main output file,
+    // or an empty string if the entry could not be restored
+    QString restore(const QString& key, const QString& outputDirectory) const;
+
+    // Copies files (absolute paths below rootDirectory) into the cache under key, replacing an entry whose
+    // dependencies differ. mainOutputFile is the file that entities should reference once the entry is restored.
+    bool store(const QString& key, const QString& rootDirectory, const QStringList& files, const QString& mainOutputFile,
+               const BakeDependencies& dependencies);
+
+    // Returns true if this process now owns the bake for key, false if another oven process is already baking it
+    bool tryClaim(const QString& key);
+    void releaseClaim(const QString& key);
+
+private:
+    QString getEntryPath(const QString& key) const { return _cacheDirectory.absoluteFilePath(key); }
+
+    QDir _cacheDirectory;
+    bool _isValid { false };
+
+    QHash<QString, QSharedPointer<QLockFile>> _claims;
+};
+
+#endif // hifi_BakeCache_h
@@ -16,6 +16,7 @@
 #include <QtCore/QDebug>
 #include <QFile>
 
+#include <iostream>
 #include <unordered_map>
 
 #include "OvenCLIApplication.h"
@@ -24,6 +25,7 @@
 #include "JSBaker.h"
 #include "TextureBaker.h"
 #include "MaterialBaker.h"
+#include "DomainBaker.h"
 
 BakerCLI::BakerCLI(OvenCLIApplication* parent) : QObject(parent) {
     
@@ -42,6 +44,7 @@ void BakerCLI::bakeFile(QUrl inputUrl, const QString& outputPath, const QString&
     static const QString FBX_EXTENSION { "fbx" };     // legacy
     static const QString MATERIAL_EXTENSION { "material" };
     static const QString SCRIPT_EXTENSION { "js" };
+    static const QString DOMAIN_TYPE { "domain" };
 
     _outputPath = outputPath;
 
@@ -58,6 +61,16 @@ void BakerCLI::bakeFile(QUrl inputUrl, const QString& outputPath, const QString&
         // FIXME: disabled for now because it breaks some scripts
         //_baker = std::unique_ptr<Baker> { new JSBaker(inputUrl, outputPath) };
         //_baker->moveToThread(Oven::instance().getNextWorkerThread());
+    } else if (type == DOMAIN_TYPE) {
+        auto destinationUrl = OvenCLIApplication::getDestinationUrlParameter();
+        if (destinationUrl.isEmpty()) {
+            qCDebug(model_baking) << "Domain bakes need a destination URL to rewrite entity references to";
+            QCoreApplication::exit(OVEN_STATUS_CODE_FAIL);
+            return;
+        }
+        _baker = std::unique_ptr<Baker> { new DomainBaker(inputUrl, QString(), outputPath, destinationUrl, false,
+                                                          OvenCLIApplication::getBakeCacheParameter()) };
+        _baker->moveToThread(Oven::instance().getNextWorkerThread());
     } else if (type == MATERIAL_EXTENSION) {
         _baker = std::unique_ptr<Baker> { new MaterialBaker(inputUrl.toDisplayString(), true, outputPath) };
         _baker->moveToThread(Oven::instance().getNextWorkerThread());
@@ -113,6 +126,11 @@ void BakerCLI::bakeFile(QUrl inputUrl, const QString& outputPath, const QString&
 
 void BakerCLI::handleFinishedBaker() {
     qCDebug(model_baking) << "Finished baking file.";
+
+    if (auto domainBaker = dynamic_cast<DomainBaker*>(_baker.get())) {
+        printDomainBakeResults(*domainBaker);
+    }
+
     int exitCode = OVEN_STATUS_CODE_SUCCESS;
     // Do we need this?
     if (_baker->wasAborted()) {
@@ -127,3 +145,23 @@ void BakerCLI::handleFinishedBaker() {
     }
     QCoreApplication::exit(exitCode);
 }
+
+void BakerCLI::printDomainBakeResults(const DomainBaker& domainBaker) {
+    // printed straight to stdout so the report is readable without the rest of the baking log
+    int cacheHits = 0;
+    int failures = 0;
+    qint64 totalBakeTimeMSecs = 0;
+    for (auto& result : domainBaker.getAssetBakeResults()) {
+        QString status = result.failed ? "failed" : (result.wasCacheHit ? "cached" : "baked");
+        std::cout << QString("%1 %2 ms  %3").arg(status, -6).arg(result.bakeTimeMSecs, 8).arg(result.asset).toStdString() << std::endl;
+
+        cacheHits += result.wasCacheHit ? 1 : 0;
+        failures += result.failed ? 1 : 0;
+        totalBakeTimeMSecs += result.bakeTimeMSecs;
+    }
+
+    auto numResults = (int)domainBaker.getAssetBakeResults().size();
+    std::cout << QString("%1 assets, %2 baked, %3 from cache, %4 failed, %5 ms of bake time")
+        .arg(numResults).arg(numResults - cacheHits - failures).arg(cacheHits).arg(failures).arg(totalBakeTimeMSecs)
+        .toStdString() << std::endl;
+}
@@ -21,6 +21,8 @@
 #include "Baker.h"
 #include "OvenCLIApplication.h"
 
+class DomainBaker;
+
 static const int OVEN_STATUS_CODE_SUCCESS { 0 };
 static const int OVEN_STATUS_CODE_FAIL { 1 };
 static const int OVEN_STATUS_CODE_ABORT { 2 };
@@ -40,6 +42,8 @@ private slots:
     void handleFinishedBaker();  
 
 private:
+    void printDomainBakeResults(const DomainBaker& domainBaker);
+
     QDir _outputPath;
     std::unique_ptr<Baker> _baker;
 };
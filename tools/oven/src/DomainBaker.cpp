@@ -12,10 +12,15 @@
 #include "DomainBaker.h"
 
 #include <QtConcurrent>
-#include <QtCore/QEventLoop>
+#include <QtCore/QDirIterator>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
 #include <QtCore/QJsonObject>
+#include <QtNetwork/QNetworkReply>
+#include <QtNetwork/QNetworkRequest>
+
+#include <NetworkAccessManager.h>
+#include <SharedUtil.h>
 
 #include "Gzip.h"
 #include "Oven.h"
@@ -23,7 +28,7 @@
 
 DomainBaker::DomainBaker(const QUrl& localModelFileURL, const QString& domainName,
                          const QString& baseOutputPath, const QUrl& destinationPath,
-                         bool shouldRebakeOriginals) :
+                         bool shouldRebakeOriginals, const QString& bakeCacheDirectory) :
     _localEntitiesFileURL(localModelFileURL),
     _domainName(domainName),
     _baseOutputPath(baseOutputPath),
@@ -35,6 +40,13 @@ DomainBaker::DomainBaker(const QUrl& localModelFileURL, const QString& domainNam
     } else {
         _destinationPath = destinationPath;
     }
+
+    if (!bakeCacheDirectory.isEmpty()) {
+        _bakeCache = std::make_unique<BakeCache>(bakeCacheDirectory);
+        if (!_bakeCache->isValid()) {
+            _bakeCache.reset();
+        }
+    }
 }
 
 void DomainBaker::bake() {
@@ -56,6 +68,12 @@ void DomainBaker::bake() {
         return;
     }
 
+    // fetch what the bake cache lookups need, they go on to bake or restore as the files come in
+    startCacheLookups();
+
+    // pull in everything the bake cache already has, and wait on whatever other ovens are still baking
+    restoreCachedBakes();
+
     // in case we've baked and re-written all of our entities already, check if we're done
     checkIfRewritingComplete();
 }
@@ -144,34 +162,39 @@ void DomainBaker::loadLocalFile() {
     }
 }
 
+static const QString MODEL_BAKE_CACHE_TYPE = "model";
+static const QString TEXTURE_BAKE_CACHE_TYPE = "texture";
+
+static QUrl getTextureRewriteKey(const QUrl& textureURL, image::TextureUsage::Type type) {
+    // it doesn't really matter what this key is as long as it's consistent
+    return textureURL.toDisplayString() + "^" + QString::number(type);
+}
+
+static QStringList getBakeCacheOptions() {
+    return { "compression=" + QString::number(TextureBaker::isCompressionEnabled()) };
+}
+
 void DomainBaker::addModelBaker(const QString& property, const QString& url, const QJsonValueRef& jsonRef) {
     // grab a QUrl for the model URL
     QUrl bakeableModelURL = getBakeableModelURL(url);
     if (!bakeableModelURL.isEmpty() && (_shouldRebakeOriginals || !isModelBaked(bakeableModelURL))) {
         // setup a ModelBaker for this URL, as long as we don't already have one
-        bool haveBaker = _modelBakers.contains(bakeableModelURL);
+        bool haveBaker = _modelBakers.contains(bakeableModelURL) || _cachedBakes.contains(bakeableModelURL) ||
+            _cacheLookups.contains(bakeableModelURL);
         if (!haveBaker) {
-            QSharedPointer<ModelBaker> baker = QSharedPointer<ModelBaker>(getModelBaker(bakeableModelURL, _contentOutputPath).release(), &Baker::deleteLater);
-            if (baker) {
-                // Hold on to the old url userinfo/query/fragment data so ModelBaker::getFullOutputMappingURL retains that data from the original model URL
-                // Note: The ModelBaker currently doesn't store this in the FST because the equal signs mess up FST parsing.
-                //       There is a small chance this could break a server workflow relying on the old behavior.
-                //       Url suffix is still propagated to the baked URL if the input URL is an FST.
-                //       Url suffix has always been stripped from the URL when loading the original model file to be baked.
-                baker->setOutputURLSuffix(url);
-
-                // make sure our handler is called when the baker is done
-                connect(baker.data(), &Baker::finished, this, &DomainBaker::handleFinishedModelBaker);
-
-                // insert it into our bakers hash so we hold a strong pointer to it
-                _modelBakers.insert(bakeableModelURL, baker);
+            if (_bakeCache) {
+                // the baker is only started once the model is looked up in the bake cache
+                CachedBake cachedBake;
+                cachedBake.bakeURL = bakeableModelURL;
+                cachedBake.outputURLSuffix = url;
+                cachedBake.isModel = true;
+                addCacheLookup(bakeableModelURL, cachedBake, getBakeCacheOptions());
                 haveBaker = true;
+            } else {
+                haveBaker = startModelBaker(bakeableModelURL, url);
+            }
 
-                // move the baker to the baker thread
-                // and kickoff the bake
-                baker->moveToThread(Oven::instance().getNextWorkerThread());
-                QMetaObject::invokeMethod(baker.data(), "bake", Qt::QueuedConnection);
-
+            if (haveBaker) {
                 // keep track of the total number of baking entities
                 ++_totalNumberOfSubBakes;
             }
@@ -185,6 +208,39 @@ void DomainBaker::addModelBaker(const QString& property, const QString& url, con
     }
 }
 
+bool DomainBaker::startModelBaker(const QUrl& bakeableModelURL, const QString& url, const QByteArray& content) {
+    QSharedPointer<ModelBaker> baker = QSharedPointer<ModelBaker>(getModelBaker(bakeableModelURL, _contentOutputPath).release(), &Baker::deleteLater);
+    if (!baker) {
+        return false;
+    }
+
+    // don't download the model again if the cache lookup already did
+    if (!content.isEmpty() && baker->getModelURL() == bakeableModelURL) {
+        baker->setSourceContent(content);
+    }
+
+    // Hold on to the old url userinfo/query/fragment data so ModelBaker::getFullOutputMappingURL retains that data from the original model URL
+    // Note: The ModelBaker currently doesn't store this in the FST because the equal signs mess up FST parsing.
+    //       There is a small chance this could break a server workflow relying on the old behavior.
+    //       Url suffix is still propagated to the baked URL if the input URL is an FST.
+    //       Url suffix has always been stripped from the URL when loading the original model file to be baked.
+    baker->setOutputURLSuffix(url);
+
+    // make sure our handler is called when the baker is done
+    connect(baker.data(), &Baker::finished, this, &DomainBaker::handleFinishedModelBaker);
+
+    // insert it into our bakers hash so we hold a strong pointer to it
+    _modelBakers.insert(bakeableModelURL, baker);
+    _bakeTimers[bakeableModelURL].start();
+
+    // move the baker to the baker thread
+    // and kickoff the bake
+    baker->moveToThread(Oven::instance().getNextWorkerThread());
+    QMetaObject::invokeMethod(baker.data(), "bake", Qt::QueuedConnection);
+
+    return true;
+}
+
 void DomainBaker::addTextureBaker(const QString& property, const QString& url, image::TextureUsage::Type type, const QJsonValueRef& jsonRef) {
     QString cleanURL = QUrl(url).adjusted(QUrl::RemoveQuery | QUrl::RemoveFragment).toDisplayString();
     auto idx = cleanURL.lastIndexOf('.');
@@ -194,26 +250,20 @@ void DomainBaker::addTextureBaker(const QString& property, const QString& url, i
         // grab a clean version of the URL without a query or fragment
         QUrl textureURL = QUrl(url).adjusted(QUrl::RemoveQuery | QUrl::RemoveFragment);
         TextureKey key = { textureURL, type };
+        QUrl rewriteKey = getTextureRewriteKey(textureURL, type);
 
         // setup a texture baker for this URL, as long as we aren't baking a texture already
-        if (!_textureBakers.contains(key)) {
-            auto baseTextureFileName = _textureFileNamer.createBaseTextureFileName(textureURL.fileName(), type);
-
-            // setup a baker for this texture
-            QSharedPointer<TextureBaker> textureBaker {
-                new TextureBaker(textureURL, type, _contentOutputPath, baseTextureFileName),
-                &TextureBaker::deleteLater
-            };
-
-            // make sure our handler is called when the texture baker is done
-            connect(textureBaker.data(), &TextureBaker::finished, this, &DomainBaker::handleFinishedTextureBaker);
-
-            // insert it into our bakers hash so we hold a strong pointer to it
-            _textureBakers.insert(key, textureBaker);
-
-            // move the baker to a worker thread and kickoff the bake
-            textureBaker->moveToThread(Oven::instance().getNextWorkerThread());
-            QMetaObject::invokeMethod(textureBaker.data(), "bake", Qt::QueuedConnection);
+        if (!_textureBakers.contains(key) && !_cachedBakes.contains(rewriteKey) && !_cacheLookups.contains(rewriteKey)) {
+            if (_bakeCache) {
+                // the baker is only started once the texture is looked up in the bake cache
+                CachedBake cachedBake;
+                cachedBake.bakeURL = textureURL;
+                cachedBake.textureType = type;
+                cachedBake.isModel = false;
+                addCacheLookup(rewriteKey, cachedBake, getBakeCacheOptions() << "usage=" + QString::number(type));
+            } else {
+                startTextureBaker(textureURL, type);
+            }
 
             // keep track of the total number of baking entities
             ++_totalNumberOfSubBakes;
@@ -221,13 +271,372 @@ void DomainBaker::addTextureBaker(const QString& property, const QString& url, i
 
         // add this QJsonValueRef to our multi hash so that it can re-write the texture URL
         // to the baked version once the baker is complete
-        // it doesn't really matter what this key is as long as it's consistent
-        _entitiesNeedingRewrite.insert(textureURL.toDisplayString() + "^" + QString::number(type), { property, jsonRef });
+        _entitiesNeedingRewrite.insert(rewriteKey, { property, jsonRef });
     } else {
         qDebug() << "Texture extension not supported: " << extension;
     }
 }
 
+bool DomainBaker::startTextureBaker(const QUrl& textureURL, image::TextureUsage::Type type, const QByteArray& content) {
+    auto baseTextureFileName = _textureFileNamer.createBaseTextureFileName(textureURL.fileName(), type);
+
+    // setup a baker for this texture
+    QSharedPointer<TextureBaker> textureBaker {
+        new TextureBaker(textureURL, type, _contentOutputPath, baseTextureFileName, content),
+        &TextureBaker::deleteLater
+    };
+
+    // make sure our handler is called when the texture baker is done
+    connect(textureBaker.data(), &TextureBaker::finished, this, &DomainBaker::handleFinishedTextureBaker);
+
+    // insert it into our bakers hash so we hold a strong pointer to it
+    _textureBakers.insert({ textureURL, type }, textureBaker);
+    _bakeTimers[getTextureRewriteKey(textureURL, type)].start();
+
+    // move the baker to a worker thread and kickoff the bake
+    textureBaker->moveToThread(Oven::instance().getNextWorkerThread());
+    QMetaObject::invokeMethod(textureBaker.data(), "bake", Qt::QueuedConnection);
+
+    return true;
+}
+
+void DomainBaker::startBaker(const QUrl& rewriteKey, const CachedBake& cachedBake, const QByteArray& content) {
+    if (!cachedBake.isModel) {
+        startTextureBaker(cachedBake.bakeURL, cachedBake.textureType, content);
+    } else if (!startModelBaker(cachedBake.bakeURL, cachedBake.outputURLSuffix.toString(), content)) {
+        // leave the entities pointing at the original model
+        storeCachedBake(rewriteKey, QString(), QStringList(), QString(), BakeDependencies());
+        recordAssetBakeResult(rewriteKey, false, true);
+        _entitiesNeedingRewrite.remove(rewriteKey);
+        emit bakeProgress(++_completedSubBakes, _totalNumberOfSubBakes);
+    }
+}
+
+void DomainBaker::addCacheLookup(const QUrl& rewriteKey, const CachedBake& cachedBake, const QStringList& keyOptions) {
+    CacheLookup lookup;
+    lookup.cachedBake = cachedBake;
+    lookup.keyOptions = keyOptions;
+    _cacheLookups.insert(rewriteKey, lookup);
+    _bakeTimers[rewriteKey].start();
+}
+
+void DomainBaker::startCacheLookups() {
+    // fetch every input at once, each lookup moves on as soon as the files it needs are in
+    for (const auto& lookup : _cacheLookups) {
+        fetchFile(lookup.cachedBake.bakeURL, true);
+    }
+    for (const auto& rewriteKey : _cacheLookups.keys()) {
+        advanceCacheLookup(rewriteKey);
+    }
+
+    // the local files were read right away, and the lookups that needed their content have it now
+    for (auto& fetchedFile : _fetchedFiles) {
+        if (fetchedFile.isDone) {
+            fetchedFile.content.clear();
+        }
+    }
+}
+
+void DomainBaker::advanceCacheLookup(const QUrl& rewriteKey) {
+    auto it = _cacheLookups.find(rewriteKey);
+    if (it == _cacheLookups.end()) {
+        return;
+    }
+    CacheLookup& lookup = it.value();
+
+    if (lookup.cachedBake.key.isEmpty()) {
+        const FetchedFile& input = _fetchedFiles[lookup.cachedBake.bakeURL];
+        if (!input.isDone) {
+            _cacheLookupsWaitingOnFiles.insert(lookup.cachedBake.bakeURL, rewriteKey);
+            return;
+        }
+
+        if (input.hash.isEmpty()) {
+            // without the content there is nothing to look up, let the baker try and report the error
+            CachedBake cachedBake = lookup.cachedBake;
+            _cacheLookups.erase(it);
+            startBaker(rewriteKey, cachedBake);
+            return;
+        }
+
+        lookup.content = input.content;
+        lookup.cachedBake.key = _bakeCache->computeKey(lookup.content,
+                                                       lookup.cachedBake.isModel ? MODEL_BAKE_CACHE_TYPE : TEXTURE_BAKE_CACHE_TYPE,
+                                                       lookup.keyOptions);
+    }
+
+    if (_bakeCache->contains(lookup.cachedBake.key) && !fetchDependencies(lookup.cachedBake.key, rewriteKey)) {
+        return;
+    }
+
+    CacheLookup finishedLookup = it.value();
+    _cacheLookups.erase(it);
+    if (!addCachedBake(rewriteKey, finishedLookup.cachedBake)) {
+        startBaker(rewriteKey, finishedLookup.cachedBake, finishedLookup.content);
+    }
+}
+
+bool DomainBaker::fetchFile(const QUrl& url, bool shouldKeepContent) {
+    auto it = _fetchedFiles.find(url);
+    if (it != _fetchedFiles.end()) {
+        return it->isDone;
+    }
+
+    FetchedFile& fetchedFile = _fetchedFiles[url];
+    fetchedFile.shouldKeepContent = shouldKeepContent;
+
+    if (url.isLocalFile()) {
+        QFile file { url.toLocalFile() };
+        if (file.open(QIODevice::ReadOnly)) {
+            auto content = file.readAll();
+            fetchedFile.hash = Baker::hashContent(content);
+            if (shouldKeepContent) {
+                fetchedFile.content = content;
+            }
+        }
+        fetchedFile.isDone = true;
+        return true;
+    }
+
+    QNetworkRequest networkRequest;
+    networkRequest.setAttribute(QNetworkRequest::FollowRedirectsAttribute, true);
+    networkRequest.setAttribute(QNetworkRequest::CacheLoadControlAttribute, QNetworkRequest::AlwaysNetwork);
+    networkRequest.setHeader(QNetworkRequest::UserAgentHeader, HIGH_FIDELITY_USER_AGENT);
+    networkRequest.setUrl(url);
+
+    auto networkReply = NetworkAccessManager::getInstance().get(networkRequest);
+    connect(networkReply, &QNetworkReply::finished, this, [this, url, networkReply] {
+        handleFetchedFile(url, networkReply);
+    });
+    return false;
+}
+
+void DomainBaker::handleFetchedFile(const QUrl& url, QNetworkReply* reply) {
+    reply->deleteLater();
+
+    FetchedFile& fetchedFile = _fetchedFiles[url];
+    fetchedFile.isDone = true;
+    if (reply->error() == QNetworkReply::NoError) {
+        auto content = reply->readAll();
+        fetchedFile.hash = Baker::hashContent(content);
+        if (fetchedFile.shouldKeepContent) {
+            fetchedFile.content = content;
+        }
+    } else {
+        qWarning() << "Could not fetch" << url << "to look it up in the bake cache:" << reply->errorString();
+    }
+
+    if (_entitiesNeedingRewrite.isEmpty()) {
+        // nothing is waiting on this file anymore, the domain is done already
+        return;
+    }
+
+    for (const auto& rewriteKey : _cacheLookupsWaitingOnFiles.values(url)) {
+        advanceCacheLookup(rewriteKey);
+    }
+    _cacheLookupsWaitingOnFiles.remove(url);
+    _fetchedFiles[url].content.clear();
+
+    // cached bakes that were waiting on this file can be restored now, check if that was the last of them
+    restoreCachedBakes();
+    checkIfRewritingComplete();
+}
+
+bool DomainBaker::fetchDependencies(const QString& key, const QUrl& waitingRewriteKey) {
+    bool isFetched = true;
+    auto dependencies = _bakeCache->getDependencies(key);
+    for (auto it = dependencies.cbegin(); it != dependencies.cend(); ++it) {
+        if (!fetchFile(it.key(), false)) {
+            if (!waitingRewriteKey.isEmpty() && !_cacheLookupsWaitingOnFiles.contains(it.key(), waitingRewriteKey)) {
+                _cacheLookupsWaitingOnFiles.insert(it.key(), waitingRewriteKey);
+            }
+            isFetched = false;
+        }
+    }
+    return isFetched;
+}
+
+bool DomainBaker::isCachedBakeCurrent(const QString& key) const {
+    auto dependencies = _bakeCache->getDependencies(key);
+    for (auto it = dependencies.cbegin(); it != dependencies.cend(); ++it) {
+        if (_fetchedFiles.value(it.key()).hash != it.value()) {
+            qDebug() << "Cached bake" << key << "is out of date," << it.key() << "has changed";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool DomainBaker::addCachedBake(const QUrl& rewriteKey, const CachedBake& cachedBake) {
+    bool isCached = _bakeCache->contains(cachedBake.key) && isCachedBakeCurrent(cachedBake.key);
+    if (isCached || !_bakeCache->tryClaim(cachedBake.key)) {
+        // either this was baked before, or another oven sharing the cache is baking it right now
+        // in both cases restoreCachedBakes picks it up from the cache
+        _cachedBakes.insert(rewriteKey, cachedBake);
+        _bakeTimers[rewriteKey].start();
+        return true;
+    }
+
+    // we own this bake now, so remember to store the result in the cache when it is done
+    _claimedCacheKeys.insert(rewriteKey, cachedBake.key);
+    return false;
+}
+
+bool DomainBaker::restoreCachedBake(const QUrl& rewriteKey, const CachedBake& cachedBake) {
+    // restore into a fresh sub-folder so that the cached file names can not collide with anything baked here
+    QString outputFolderName;
+    if (cachedBake.isModel) {
+        auto filename = cachedBake.bakeURL.fileName();
+        outputFolderName = filename.left(filename.lastIndexOf('.')).left(filename.lastIndexOf(".baked"));
+    } else {
+        outputFolderName = _textureFileNamer.createBaseTextureFileName(cachedBake.bakeURL.fileName(), cachedBake.textureType);
+    }
+    QString uniqueFolderName = outputFolderName;
+    int i = 1;
+    while (QDir(_contentOutputPath + "/" + uniqueFolderName).exists()) {
+        uniqueFolderName = outputFolderName + "-" + QString::number(i++);
+    }
+    QString outputDirectory = _contentOutputPath + "/" + uniqueFolderName;
+    if (cachedBake.isModel) {
+        outputDirectory += "/baked";
+    }
+
+    auto mainOutputFile = _bakeCache->restore(cachedBake.key, outputDirectory);
+    if (mainOutputFile.isEmpty()) {
+        return false;
+    }
+
+    qDebug() << "Re-writing entity references to" << cachedBake.bakeURL << "from bake cache";
+
+    auto relativeFilePath = QDir(_contentOutputPath).relativeFilePath(mainOutputFile);
+    QUrl newURL = _destinationPath.resolved(relativeFilePath);
+    if (cachedBake.isModel) {
+        // match ModelBaker::getFullOutputMappingURL, which keeps the suffix of the original model URL
+        newURL.setFragment(cachedBake.outputURLSuffix.fragment());
+        newURL.setQuery(cachedBake.outputURLSuffix.query());
+        newURL.setUserInfo(cachedBake.outputURLSuffix.userInfo());
+    }
+
+    rewriteEntityURLs(rewriteKey, newURL, !cachedBake.isModel);
+    _entitiesNeedingRewrite.remove(rewriteKey);
+
+    recordAssetBakeResult(rewriteKey, true, false);
+    emit bakeProgress(++_completedSubBakes, _totalNumberOfSubBakes);
+
+    return true;
+}
+
+void DomainBaker::restoreCachedBakes() {
+    for (auto it = _cachedBakes.begin(); it != _cachedBakes.end();) {
+        QUrl rewriteKey = it.key();
+        const CachedBake& cachedBake = it.value();
+
+        bool isCached = _bakeCache->contains(cachedBake.key);
+        if (isCached && !fetchDependencies(cachedBake.key)) {
+            // picked up again once the files it depends on are fetched
+            ++it;
+        } else if (isCached && isCachedBakeCurrent(cachedBake.key) && restoreCachedBake(rewriteKey, cachedBake)) {
+            it = _cachedBakes.erase(it);
+        } else if (_bakeCache->tryClaim(cachedBake.key)) {
+            // whoever was baking this gave up on it (or the entry could not be read back), so bake it ourselves
+            _claimedCacheKeys.insert(rewriteKey, cachedBake.key);
+            CachedBake claimedBake = cachedBake;
+            it = _cachedBakes.erase(it);
+            startBaker(rewriteKey, claimedBake);
+        } else {
+            ++it;
+        }
+    }
+
+    if (!_cachedBakes.isEmpty()) {
+        if (!_cacheWaitTimer) {
+            static const int CACHE_WAIT_INTERVAL_MSECS = 1000;
+            _cacheWaitTimer = new QTimer(this);
+            _cacheWaitTimer->setInterval(CACHE_WAIT_INTERVAL_MSECS);
+            connect(_cacheWaitTimer, &QTimer::timeout, this, &DomainBaker::checkWaitingCachedBakes);
+        }
+        _cacheWaitTimer->start();
+    } else if (_cacheWaitTimer) {
+        _cacheWaitTimer->stop();
+    }
+}
+
+void DomainBaker::checkWaitingCachedBakes() {
+    restoreCachedBakes();
+
+    // check if that was the last entry we were waiting on and if we are done now
+    checkIfRewritingComplete();
+}
+
+void DomainBaker::storeCachedBake(const QUrl& rewriteKey, const QString& rootDirectory, const QStringList& files,
+                                  const QString& mainOutputFile, const BakeDependencies& dependencies) {
+    auto key = _claimedCacheKeys.take(rewriteKey);
+    if (!_bakeCache || key.isEmpty()) {
+        return;
+    }
+
+    if (!files.isEmpty() && !_bakeCache->store(key, rootDirectory, files, mainOutputFile, dependencies)) {
+        qWarning() << "Could not store" << rewriteKey << "in the bake cache";
+    }
+
+    // release the claim even if the bake failed, so another oven can try it
+    _bakeCache->releaseClaim(key);
+}
+
+void DomainBaker::recordAssetBakeResult(const QUrl& rewriteKey, bool wasCacheHit, bool failed) {
+    AssetBakeResult result;
+    result.asset = rewriteKey.toDisplayString();
+    result.bakeTimeMSecs = _bakeTimers.take(rewriteKey).elapsed();
+    result.wasCacheHit = wasCacheHit;
+    result.failed = failed;
+    _assetBakeResults.push_back(result);
+}
+
+void DomainBaker::rewriteEntityURLs(const QUrl& rewriteKey, const QUrl& newURL, bool copyTopLevelURLParts) {
+    // enumerate the QJsonRef values for this URL from our multi hash of
+    // entity objects needing a URL re-write
+    for (auto propertyEntityPair : _entitiesNeedingRewrite.values(rewriteKey)) {
+        QString property = propertyEntityPair.first;
+        // convert the entity QJsonValueRef to a QJsonObject so we can modify its URL
+        auto entity = propertyEntityPair.second.toObject();
+        QUrl entityURL = newURL;
+
+        if (!property.contains(".")) {
+            if (copyTopLevelURLParts) {
+                // grab the old URL
+                QUrl oldURL = entity[property].toString();
+
+                // copy the fragment and query, and user info from the old URL
+                entityURL.setQuery(oldURL.query());
+                entityURL.setFragment(oldURL.fragment());
+                entityURL.setUserInfo(oldURL.userInfo());
+            }
+
+            // set the new URL as the value in our temp QJsonObject
+            entity[property] = entityURL.toString();
+        } else {
+            // Group property
+            QStringList propertySplit = property.split(".");
+            assert(propertySplit.length() == 2);
+            // grab the old URL
+            auto oldObject = entity[propertySplit[0]].toObject();
+            QUrl oldURL = oldObject[propertySplit[1]].toString();
+
+            // copy the fragment and query, and user info from the old URL
+            entityURL.setQuery(oldURL.query());
+            entityURL.setFragment(oldURL.fragment());
+            entityURL.setUserInfo(oldURL.userInfo());
+
+            // set the new URL as the value in our temp QJsonObject
+            oldObject[propertySplit[1]] = entityURL.toString();
+            entity[propertySplit[0]] = oldObject;
+        }
+
+        // replace our temp object with the value referenced by our QJsonValueRef
+        propertyEntityPair.second = entity;
+    }
+}
+
 void DomainBaker::addScriptBaker(const QString& property, const QString& url, const QJsonValueRef& jsonRef) {
     // grab a clean version of the URL without a query or fragment
     QUrl scriptURL = QUrl(url).adjusted(QUrl::RemoveQuery | QUrl::RemoveFragment);
@@ -431,6 +840,8 @@ void DomainBaker::handleFinishedModelBaker() {
     auto baker = qobject_cast<ModelBaker*>(sender());
 
     if (baker) {
+        QUrl rewriteKey = baker->getOriginalInputModelURL();
+
         if (!baker->hasErrors()) {
             // this ModelBaker is done and everything went according to plan
             qDebug() << "Re-writing entity references to" << baker->getModelURL();
@@ -443,52 +854,34 @@ void DomainBaker::handleFinishedModelBaker() {
 
             QUrl newURL = _destinationPath.resolved(relativeMappingFilePath);
 
-            // enumerate the QJsonRef values for the URL of this model from our multi hash of
-            // entity objects needing a URL re-write
-            for (auto propertyEntityPair : _entitiesNeedingRewrite.values(baker->getOriginalInputModelURL())) {
-                QString property = propertyEntityPair.first;
-                // convert the entity QJsonValueRef to a QJsonObject so we can modify its URL
-                auto entity = propertyEntityPair.second.toObject();
-
-                if (!property.contains(".")) {
-                    // grab the old URL
-                    QUrl oldURL = entity[property].toString();
-
-                    // set the new URL as the value in our temp QJsonObject
-                    // The fragment, query, and user info from the original model URL should now be present on the filename in the FST file
-                    entity[property] = newURL.toString();
-                } else {
-                    // Group property
-                    QStringList propertySplit = property.split(".");
-                    assert(propertySplit.length() == 2);
-                    // grab the old URL
-                    auto oldObject = entity[propertySplit[0]].toObject();
-                    QUrl oldURL = oldObject[propertySplit[1]].toString();
-
-                    // copy the fragment and query, and user info from the old model URL
-                    newURL.setQuery(oldURL.query());
-                    newURL.setFragment(oldURL.fragment());
-                    newURL.setUserInfo(oldURL.userInfo());
-
-                    // set the new URL as the value in our temp QJsonObject
-                    oldObject[propertySplit[1]] = newURL.toString();
-                    entity[propertySplit[0]] = oldObject;
-                }
-
-                // replace our temp object with the value referenced by our QJsonValueRef
-                propertyEntityPair.second = entity;
+            // The fragment, query, and user info from the original model URL should now be present on the filename in the FST file,
+            // so only group properties need them copied over
+            rewriteEntityURLs(rewriteKey, newURL, false);
+
+            // the whole baked folder goes into the cache, since the model pulls its textures and materials from it
+            auto mappingFile = baker->getFullOutputMappingURL().adjusted(QUrl::RemoveQuery | QUrl::RemoveFragment | QUrl::RemoveUserInfo).toString();
+            auto bakedDirectory = QFileInfo(mappingFile).absolutePath();
+            QStringList bakedFiles;
+            QDirIterator it(bakedDirectory, QDir::Files, QDirIterator::Subdirectories);
+            while (it.hasNext()) {
+                bakedFiles << it.next();
             }
+            storeCachedBake(rewriteKey, bakedDirectory, bakedFiles, mappingFile, baker->getDependencies());
         } else {
             // this model failed to bake - this doesn't fail the entire bake but we need to add
             // the errors from the model to our warnings
             _warningList << baker->getErrors();
+
+            storeCachedBake(rewriteKey, QString(), QStringList(), QString(), BakeDependencies());
         }
 
+        recordAssetBakeResult(rewriteKey, false, baker->hasErrors());
+
         // remove the baked URL from the multi hash of entities needing a re-write
-        _entitiesNeedingRewrite.remove(baker->getOriginalInputModelURL());
+        _entitiesNeedingRewrite.remove(rewriteKey);
 
         // drop our shared pointer to this baker so that it gets cleaned up
-        _modelBakers.remove(baker->getOriginalInputModelURL());
+        _modelBakers.remove(rewriteKey);
 
         // emit progress to tell listeners how many models we have baked
         emit bakeProgress(++_completedSubBakes, _totalNumberOfSubBakes);
@@ -502,7 +895,7 @@ void DomainBaker::handleFinishedTextureBaker() {
     auto baker = qobject_cast<TextureBaker*>(sender());
 
     if (baker) {
-        QUrl rewriteKey = baker->getTextureURL().toDisplayString() + "^" + QString::number(baker->getTextureType());
+        QUrl rewriteKey = getTextureRewriteKey(baker->getTextureURL(), baker->getTextureType());
 
         if (!baker->hasErrors()) {
             // this TextureBaker is done and everything went according to plan
@@ -515,51 +908,23 @@ void DomainBaker::handleFinishedTextureBaker() {
             }
             auto newURL = _destinationPath.resolved(relativeTextureFilePath);
 
-            // enumerate the QJsonRef values for the URL of this texture from our multi hash of
-            // entity objects needing a URL re-write
-            for (auto propertyEntityPair : _entitiesNeedingRewrite.values(rewriteKey)) {
-                QString property = propertyEntityPair.first;
-                // convert the entity QJsonValueRef to a QJsonObject so we can modify its URL
-                auto entity = propertyEntityPair.second.toObject();
-
-                if (!property.contains(".")) {
-                    // grab the old URL
-                    QUrl oldURL = entity[property].toString();
-
-                    // copy the fragment and query, and user info from the old texture URL
-                    newURL.setQuery(oldURL.query());
-                    newURL.setFragment(oldURL.fragment());
-                    newURL.setUserInfo(oldURL.userInfo());
-
-                    // set the new URL as the value in our temp QJsonObject
-                    entity[property] = newURL.toString();
-                } else {
-                    // Group property
-                    QStringList propertySplit = property.split(".");
-                    assert(propertySplit.length() == 2);
-                    // grab the old URL
-                    auto oldObject = entity[propertySplit[0]].toObject();
-                    QUrl oldURL = oldObject[propertySplit[1]].toString();
+            rewriteEntityURLs(rewriteKey, newURL, true);
 
-                    // copy the fragment and query, and user info from the old texture URL
-                    newURL.setQuery(oldURL.query());
-                    newURL.setFragment(oldURL.fragment());
-                    newURL.setUserInfo(oldURL.userInfo());
-
-                    // set the new URL as the value in our temp QJsonObject
-                    oldObject[propertySplit[1]] = newURL.toString();
-                    entity[propertySplit[0]] = oldObject;
-                }
-
-                // replace our temp object with the value referenced by our QJsonValueRef
-                propertyEntityPair.second = entity;
+            QStringList bakedFiles;
+            for (auto& file : baker->getOutputFiles()) {
+                bakedFiles << file;
             }
+            storeCachedBake(rewriteKey, _contentOutputPath, bakedFiles, baker->getMetaTextureFileName(), BakeDependencies());
         } else {
             // this texture failed to bake - this doesn't fail the entire bake but we need to add the errors from
             // the texture to our warnings
             _warningList << baker->getWarnings();
+
+            storeCachedBake(rewriteKey, QString(), QStringList(), QString(), BakeDependencies());
         }
 
+        recordAssetBakeResult(rewriteKey, false, baker->hasErrors());
+
         // remove the baked URL from the multi hash of entities needing a re-write
         _entitiesNeedingRewrite.remove(rewriteKey);
 
@@ -740,6 +1105,10 @@ void DomainBaker::handleFinishedMaterialBaker() {
 
 void DomainBaker::checkIfRewritingComplete() {
     if (_entitiesNeedingRewrite.isEmpty()) {
+        if (_cacheWaitTimer) {
+            _cacheWaitTimer->stop();
+        }
+
         writeNewEntitiesFile();
 
         if (hasErrors()) {
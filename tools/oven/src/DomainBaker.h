@@ -17,12 +17,18 @@
 #include <QtCore/QObject>
 #include <QtCore/QUrl>
 #include <QtCore/QThread>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QTimer>
 
 #include "ModelBaker.h"
 #include "TextureBaker.h"
 #include "JSBaker.h"
 #include "MaterialBaker.h"
 
+#include "BakeCache.h"
+
+class QNetworkReply;
+
 class DomainBaker : public Baker {
     Q_OBJECT
 public:
@@ -31,7 +37,17 @@ public:
     // That means you must pass a usable running QThread when constructing a domain baker.
     DomainBaker(const QUrl& localEntitiesFileURL, const QString& domainName,
                 const QString& baseOutputPath, const QUrl& destinationPath,
-                bool shouldRebakeOriginals);
+                bool shouldRebakeOriginals, const QString& bakeCacheDirectory = QString());
+
+    struct AssetBakeResult {
+        QString asset;
+        qint64 bakeTimeMSecs { 0 };
+        bool wasCacheHit { false };
+        bool failed { false };
+    };
+
+    // one entry per model and texture, in the order they were baked or restored from the bake cache
+    const std::vector<AssetBakeResult>& getAssetBakeResults() const { return _assetBakeResults; }
 
 signals:
     void allModelsFinished();
@@ -43,6 +59,7 @@ private slots:
     void handleFinishedTextureBaker();
     void handleFinishedScriptBaker();
     void handleFinishedMaterialBaker();
+    void checkWaitingCachedBakes();
 
 private:
     void setupOutputFolder();
@@ -51,6 +68,56 @@ private:
     void checkIfRewritingComplete();
     void writeNewEntitiesFile();
 
+    // A model or texture whose baked output comes from the bake cache, either because it was already there
+    // or because another oven sharing the cache is currently baking it
+    struct CachedBake {
+        QString key;
+        QUrl bakeURL;
+        QUrl outputURLSuffix;
+        image::TextureUsage::Type textureType { image::TextureUsage::DEFAULT_TEXTURE };
+        bool isModel { true };
+    };
+
+    // A model or texture whose input, and then the files its cached bake was made from, are being fetched
+    // to find out whether the bake cache has it, once entities are enumerated
+    struct CacheLookup {
+        CachedBake cachedBake;
+        QStringList keyOptions;
+        QByteArray content; // of the input, handed to the baker if it comes to baking it
+    };
+
+    // A file fetched for a cache lookup, either the input itself or one a cached bake depends on
+    struct FetchedFile {
+        bool isDone { false };
+        bool shouldKeepContent { false };
+        QByteArray content; // only kept until the lookups waiting on it have taken it
+        QByteArray hash; // empty if it could not be fetched, like the bakers record it
+    };
+
+    void addCacheLookup(const QUrl& rewriteKey, const CachedBake& cachedBake, const QStringList& keyOptions);
+    void startCacheLookups();
+    void advanceCacheLookup(const QUrl& rewriteKey);
+    // Starts fetching url unless that was done already, returns whether it is fetched
+    bool fetchFile(const QUrl& url, bool shouldKeepContent);
+    void handleFetchedFile(const QUrl& url, QNetworkReply* reply);
+    // Starts fetching the files the cached bake depends on, returns whether they are all fetched
+    bool fetchDependencies(const QString& key, const QUrl& waitingRewriteKey = QUrl());
+    // Whether the files the cached bake read besides its input are unchanged, once they are fetched
+    bool isCachedBakeCurrent(const QString& key) const;
+
+    bool addCachedBake(const QUrl& rewriteKey, const CachedBake& cachedBake);
+    bool restoreCachedBake(const QUrl& rewriteKey, const CachedBake& cachedBake);
+    void restoreCachedBakes();
+    void storeCachedBake(const QUrl& rewriteKey, const QString& rootDirectory, const QStringList& files,
+                         const QString& mainOutputFile, const BakeDependencies& dependencies);
+
+    void startBaker(const QUrl& rewriteKey, const CachedBake& cachedBake, const QByteArray& content = QByteArray());
+    bool startModelBaker(const QUrl& bakeableModelURL, const QString& url, const QByteArray& content = QByteArray());
+    bool startTextureBaker(const QUrl& textureURL, image::TextureUsage::Type type, const QByteArray& content = QByteArray());
+
+    void rewriteEntityURLs(const QUrl& rewriteKey, const QUrl& newURL, bool copyTopLevelURLParts);
+    void recordAssetBakeResult(const QUrl& rewriteKey, bool wasCacheHit, bool failed);
+
     QUrl _localEntitiesFileURL;
     QString _domainName;
     QString _baseOutputPath;
@@ -76,6 +143,17 @@ private:
 
     bool _shouldRebakeOriginals { false };
 
+    std::unique_ptr<BakeCache> _bakeCache;
+    QHash<QUrl, CachedBake> _cachedBakes;
+    QHash<QUrl, QString> _claimedCacheKeys;
+    QHash<QUrl, CacheLookup> _cacheLookups;
+    QHash<QUrl, FetchedFile> _fetchedFiles;
+    QMultiHash<QUrl, QUrl> _cacheLookupsWaitingOnFiles;
+    QTimer* _cacheWaitTimer { nullptr };
+
+    QHash<QUrl, QElapsedTimer> _bakeTimers;
+    std::vector<AssetBakeResult> _assetBakeResults;
+
     void addModelBaker(const QString& property, const QString& url, const QJsonValueRef& jsonRef);
     void addTextureBaker(const QString& property, const QString& url, image::TextureUsage::Type type, const QJsonValueRef& jsonRef);
     void addScriptBaker(const QString& property, const QString& url, const QJsonValueRef& jsonRef);
@@ -25,10 +25,14 @@ static const QString CLI_INPUT_PARAMETER = "i";
 static const QString CLI_OUTPUT_PARAMETER = "o";
 static const QString CLI_TYPE_PARAMETER = "t";
 static const QString CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER = "disable-texture-compression";
+static const QString CLI_DESTINATION_PARAMETER = "destination";
+static const QString CLI_BAKE_CACHE_PARAMETER = "bake-cache";
 
 QUrl OvenCLIApplication::_inputUrlParameter;
 QUrl OvenCLIApplication::_outputUrlParameter;
 QString OvenCLIApplication::_typeParameter;
+QUrl OvenCLIApplication::_destinationUrlParameter;
+QString OvenCLIApplication::_bakeCacheParameter;
 
 OvenCLIApplication::OvenCLIApplication(int argc, char* argv[]) :
     QCoreApplication(argc, argv)
@@ -46,8 +50,10 @@ void OvenCLIApplication::parseCommandLine(int argc, char* argv[]) {
     parser.addOptions({
         { CLI_INPUT_PARAMETER, "Path to file that you would like to bake.", "input" },
         { CLI_OUTPUT_PARAMETER, "Path to folder that will be used as output.", "output" },
-        { CLI_TYPE_PARAMETER, "Type of asset. [model|material]"/*|js]"*/, "type" },
-        { CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER, "Disable texture compression." }
+        { CLI_TYPE_PARAMETER, "Type of asset. [model|material|domain]"/*|js]"*/, "type" },
+        { CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER, "Disable texture compression." },
+        { CLI_DESTINATION_PARAMETER, "URL that baked domain content will be served from.", "destination" },
+        { CLI_BAKE_CACHE_PARAMETER, "Path to a folder used to cache domain bakes. Ovens sharing it split the bake work between them.", "cache" }
     });
 
     auto versionOption = parser.addVersionOption();
@@ -86,6 +92,8 @@ void OvenCLIApplication::parseCommandLine(int argc, char* argv[]) {
     _outputUrlParameter = QDir::fromNativeSeparators(parser.value(CLI_OUTPUT_PARAMETER));
 
     _typeParameter = parser.isSet(CLI_TYPE_PARAMETER) ? parser.value(CLI_TYPE_PARAMETER) : QString::null;
+    _destinationUrlParameter = parser.isSet(CLI_DESTINATION_PARAMETER) ? parser.value(CLI_DESTINATION_PARAMETER) : QUrl();
+    _bakeCacheParameter = parser.isSet(CLI_BAKE_CACHE_PARAMETER) ? QDir::fromNativeSeparators(parser.value(CLI_BAKE_CACHE_PARAMETER)) : QString();
 
     if (parser.isSet(CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER)) {
         qDebug() << "Disabling texture compression";
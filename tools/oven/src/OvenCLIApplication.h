@@ -23,12 +23,17 @@ public:
 
     static void parseCommandLine(int argc, char* argv[]);
 
+    static QUrl getDestinationUrlParameter() { return _destinationUrlParameter; }
+    static QString getBakeCacheParameter() { return _bakeCacheParameter; }
+
     static OvenCLIApplication* instance() { return dynamic_cast<OvenCLIApplication*>(QCoreApplication::instance()); }
 
 private:
     static QUrl _inputUrlParameter;
     static QUrl _outputUrlParameter;
     static QString _typeParameter;
+    static QUrl _destinationUrlParameter;
+    static QString _bakeCacheParameter;
 };
 
 #endif // hifi_OvenCLIApplication_h
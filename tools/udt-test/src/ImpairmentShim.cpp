@@ -0,0 +1,131 @@
+//
+//  ImpairmentShim.cpp
+//  tools/udt-test/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ImpairmentShim.h"
+
+#include <algorithm>
+
+#include <QtCore/QDebug>
+
+using namespace std::chrono;
+
+ImpairmentShim::ImpairmentShim(quint16 port, const HifiSockAddr& target, const Settings& settings, QObject* parent) :
+    QObject(parent),
+    _target(target),
+    _settings(settings)
+{
+    _socket.bind(QHostAddress::AnyIPv4, port);
+    connect(&_socket, &QUdpSocket::readyRead, this, &ImpairmentShim::readPendingDatagrams);
+
+    // the delays are a few milliseconds, a coarse timer would add as much again
+    _releaseTimer.setSingleShot(true);
+    _releaseTimer.setTimerType(Qt::PreciseTimer);
+    connect(&_releaseTimer, &QTimer::timeout, this, &ImpairmentShim::releaseDueDatagrams);
+}
+
+ImpairmentShim::Stats ImpairmentShim::sampleStats() {
+    Stats stats = _stats;
+    _stats = Stats();
+    return stats;
+}
+
+void ImpairmentShim::readPendingDatagrams() {
+    while (_socket.hasPendingDatagrams()) {
+        QByteArray data;
+        data.resize(_socket.pendingDatagramSize());
+
+        QHostAddress senderAddress;
+        quint16 senderPort;
+        _socket.readDatagram(data.data(), data.size(), &senderAddress, &senderPort);
+
+        HifiSockAddr sender(senderAddress, senderPort);
+        if (sender == _target) {
+            if (!_peer.isNull()) {
+                impair(_toPeer, std::move(data), _peer);
+            }
+        } else {
+            _peer = sender;
+            impair(_toTarget, std::move(data), _target);
+        }
+    }
+}
+
+void ImpairmentShim::impair(Link& link, QByteArray data, const HifiSockAddr& destination) {
+    if (isLost(link)) {
+        ++_stats.lostPackets;
+        return;
+    }
+
+    auto now = clock::now();
+    auto sendTime = now;
+
+    if (_settings.rateKbps > 0) {
+        // the packet waits for the link to send those before it, and is dropped if the queue is already too long
+        auto startTime = std::max(now, link.freeAt);
+        if (startTime - now > milliseconds(_settings.queueMsecs)) {
+            ++_stats.queueDroppedPackets;
+            return;
+        }
+
+        auto transmitTime = microseconds((int64_t)data.size() * 8 * 1000 / _settings.rateKbps);
+        link.freeAt = startTime + transmitTime;
+        sendTime = link.freeAt;
+    }
+
+    auto delay = microseconds(_settings.delayMsecs * 1000);
+    if (_settings.jitterMsecs > 0) {
+        auto jitter = (2.0 * _distribution(_generator) - 1.0) * _settings.jitterMsecs * 1000;
+        delay = std::max(microseconds(0), delay + microseconds((int64_t)jitter));
+    }
+
+    _pendingDatagrams.emplace(sendTime + delay, Datagram { std::move(data), destination });
+    scheduleRelease();
+}
+
+bool ImpairmentShim::isLost(Link& link) {
+    // Gilbert-Elliott model, losses come in bursts of a mean length when the burst settings are given
+    if (link.isInBurst) {
+        if (_distribution(_generator) < 1.0 / std::max(1.0, _settings.burstLength)) {
+            link.isInBurst = false;
+        }
+    } else if (_distribution(_generator) < _settings.burstStartRate) {
+        link.isInBurst = true;
+    }
+
+    double lossRate = link.isInBurst ? _settings.burstLossRate : _settings.lossRate;
+    return _distribution(_generator) < lossRate;
+}
+
+void ImpairmentShim::releaseDueDatagrams() {
+    auto now = clock::now();
+
+    auto it = _pendingDatagrams.begin();
+    while (it != _pendingDatagrams.end() && it->first <= now) {
+        auto& datagram = it->second;
+        _socket.writeDatagram(datagram.data, datagram.destination.getAddress(), datagram.destination.getPort());
+        ++_stats.forwardedPackets;
+        it = _pendingDatagrams.erase(it);
+    }
+
+    scheduleRelease();
+}
+
+void ImpairmentShim::scheduleRelease() {
+    if (_pendingDatagrams.empty()) {
+        _releaseTimer.stop();
+        return;
+    }
+
+    auto untilDue = duration_cast<milliseconds>(_pendingDatagrams.begin()->first - clock::now());
+    int intervalMsecs = std::max(0, (int)untilDue.count());
+    if (!_releaseTimer.isActive() || _releaseTimer.remainingTime() > intervalMsecs) {
+        _releaseTimer.start(intervalMsecs);
+    }
+}
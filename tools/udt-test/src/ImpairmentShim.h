@@ -0,0 +1,98 @@
+//
+//  ImpairmentShim.h
+//  tools/udt-test/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_ImpairmentShim_h
+#define hifi_ImpairmentShim_h
+
+#include <chrono>
+#include <map>
+#include <random>
+
+#include <QtCore/QObject>
+#include <QtCore/QTimer>
+#include <QtNetwork/QUdpSocket>
+
+#include <HifiSockAddr.h>
+
+// A UDP relay that impairs the packets it forwards the way netem would, so congestion control can be tried on a bad
+// link without root access to the machine.  Packets from the target are forwarded to the last peer heard from, and
+// those from any other peer to the target, each direction with its own link.
+class ImpairmentShim : public QObject {
+    Q_OBJECT
+public:
+    using clock = std::chrono::steady_clock;
+
+    class Settings {
+    public:
+        double lossRate { 0.0 }; // chance to lose a packet outside of bursts
+        double burstStartRate { 0.0 }; // chance for a burst of losses to start at each packet
+        double burstLength { 1.0 }; // mean length of a burst, in packets
+        double burstLossRate { 1.0 }; // chance to lose a packet during a burst
+        int delayMsecs { 0 }; // one way delay
+        int jitterMsecs { 0 }; // the delay varies by up to this much either way, which reorders packets
+        int rateKbps { 0 }; // bandwidth of the link, unlimited when zero
+        int queueMsecs { 100 }; // packets that would wait longer than this for the link are dropped
+    };
+
+    class Stats {
+    public:
+        int forwardedPackets { 0 };
+        int lostPackets { 0 };
+        int queueDroppedPackets { 0 };
+    };
+
+    ImpairmentShim(quint16 port, const HifiSockAddr& target, const Settings& settings, QObject* parent = nullptr);
+
+    quint16 localPort() const { return _socket.localPort(); }
+
+    Stats sampleStats();
+
+private slots:
+    void readPendingDatagrams();
+    void releaseDueDatagrams();
+
+private:
+    class Link {
+    public:
+        bool isInBurst { false };
+        clock::time_point freeAt; // when the link is done sending the packets queued on it
+    };
+
+    class Datagram {
+    public:
+        QByteArray data;
+        HifiSockAddr destination;
+    };
+
+    void impair(Link& link, QByteArray data, const HifiSockAddr& destination);
+    bool isLost(Link& link);
+    void scheduleRelease();
+
+    QUdpSocket _socket;
+    HifiSockAddr _target;
+    HifiSockAddr _peer;
+    Settings _settings;
+
+    Link _toTarget;
+    Link _toPeer;
+
+    // datagrams waiting to be released, by the time they are due
+    std::multimap<clock::time_point, Datagram> _pendingDatagrams;
+    QTimer _releaseTimer;
+
+    std::mt19937 _generator { std::random_device()() };
+    std::uniform_real_distribution<double> _distribution { 0.0, 1.0 };
+
+    Stats _stats;
+};
+
+#endif // hifi_ImpairmentShim_h
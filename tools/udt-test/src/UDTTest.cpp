@@ -13,6 +13,7 @@
 
 #include <QtCore/QDebug>
 
+#include <udt/BBRCC.h>
 #include <udt/Constants.h>
 #include <udt/Packet.h>
 #include <udt/PacketList.h>
@@ -55,6 +56,37 @@ const QCommandLineOption MESSAGE_SEED {
 const QCommandLineOption STATS_INTERVAL {
     "stats-interval", "stats output interval (default is 100ms)", "milliseconds"
 };
+const QCommandLineOption DROP_PERCENT {
+    "drop-percent", "percentage of received data packets to drop, to simulate a lossy link (default is 0)", "percent"
+};
+const QCommandLineOption CONGESTION_CONTROL {
+    "congestion-control", "congestion control for sent packets, vegas or bbr (default is vegas)", "name"
+};
+const QCommandLineOption IMPAIR_PORT {
+    "impair-port", "relay packets between this port and the target through an impaired link instead of testing", "port"
+};
+const QCommandLineOption IMPAIR_LOSS_PERCENT {
+    "impair-loss", "percentage of relayed packets lost at random (default is 0)", "percent"
+};
+const QCommandLineOption IMPAIR_BURST_PERCENT {
+    "impair-burst", "percentage chance for a burst of relayed packets to be lost at each packet (default is 0)", "percent"
+};
+const QCommandLineOption IMPAIR_BURST_LENGTH {
+    "impair-burst-length", "mean number of packets lost in a burst (default is 1)", "packets"
+};
+const QCommandLineOption IMPAIR_DELAY {
+    "impair-delay", "one way delay of relayed packets (default is 0)", "milliseconds"
+};
+const QCommandLineOption IMPAIR_JITTER {
+    "impair-jitter", "random variation of the delay either way, reorders packets (default is 0)", "milliseconds"
+};
+const QCommandLineOption IMPAIR_RATE {
+    "impair-rate", "bandwidth of the relayed link each way (default is unlimited)", "kilobits per second"
+};
+const QCommandLineOption IMPAIR_QUEUE {
+    "impair-queue", "longest time a packet waits for the rate limited link before being dropped (default is 100ms)",
+    "milliseconds"
+};
 
 const QStringList CLIENT_STATS_TABLE_HEADERS {
     "Send (Mb/s)", "Est. Max (Mb/s)", "RTT (ms)", "CW (P)", "Period (us)",
@@ -94,6 +126,35 @@ UDTTest::UDTTest(int& argc, char** argv) :
             qDebug() << "Packets will be sent to" << _target;
         }
     }
+
+    if (_argumentParser.isSet(IMPAIR_PORT)) {
+        setupImpairmentShim();
+        return;
+    }
+
+    if (_argumentParser.isSet(CONGESTION_CONTROL)) {
+        auto name = _argumentParser.value(CONGESTION_CONTROL);
+        std::unique_ptr<udt::CongestionControlVirtualFactory> ccFactory;
+
+        if (name == "bbr") {
+            ccFactory.reset(new udt::CongestionControlFactory<udt::BBRCC>());
+        } else if (name == "vegas") {
+            ccFactory.reset(new udt::CongestionControlFactory<udt::TCPVegasCC>());
+        } else {
+            qCritical() << "Unknown congestion control" << name << "- expected vegas or bbr";
+            QMetaObject::invokeMethod(this, "quit", Qt::QueuedConnection);
+        }
+
+        if (ccFactory) {
+            qDebug() << "Using" << name << "congestion control";
+
+            if (_target.isNull()) {
+                _socket.setCongestionControlFactory(std::move(ccFactory));
+            } else {
+                _socket.setCongestionControlFactory(_target, std::move(ccFactory));
+            }
+        }
+    }
     
     if (_argumentParser.isSet(PACKET_SIZE)) {
         // parse the desired packet size
@@ -197,6 +258,17 @@ UDTTest::UDTTest(int& argc, char** argv) :
 
         });
     }
+
+    if (_argumentParser.isSet(DROP_PERCENT)) {
+        // drop received data packets at random, the sender sees them as lost and has to re-send them
+        double dropRate = _argumentParser.value(DROP_PERCENT).toDouble() / 100.0;
+        qDebug() << "Dropping" << dropRate * 100.0 << "percent of received data packets";
+
+        _socket.setPacketFilterOperator([this, dropRate](const udt::Packet& packet) {
+            return _dropDistribution(_dropGenerator) >= dropRate;
+        });
+    }
+
     _socket.setMessageFailureHandler(
         [this](HifiSockAddr from, udt::Packet::MessageNumber messageNumber) {
             _pendingMessages.erase(messageNumber);
@@ -224,7 +296,9 @@ void UDTTest::parseArguments() {
     _argumentParser.addOptions({
         PORT_OPTION, TARGET_OPTION, PACKET_SIZE, MIN_PACKET_SIZE, MAX_PACKET_SIZE,
         MAX_SEND_BYTES, MAX_SEND_PACKETS, UNRELIABLE_PACKETS, ORDERED_PACKETS,
-        MESSAGE_SIZE, MESSAGE_SEED, STATS_INTERVAL
+        MESSAGE_SIZE, MESSAGE_SEED, STATS_INTERVAL, DROP_PERCENT, CONGESTION_CONTROL,
+        IMPAIR_PORT, IMPAIR_LOSS_PERCENT, IMPAIR_BURST_PERCENT, IMPAIR_BURST_LENGTH,
+        IMPAIR_DELAY, IMPAIR_JITTER, IMPAIR_RATE, IMPAIR_QUEUE
     });
     
     if (!_argumentParser.parse(arguments())) {
@@ -239,6 +313,41 @@ void UDTTest::parseArguments() {
     }
 }
 
+void UDTTest::setupImpairmentShim() {
+    if (_target.isNull()) {
+        qCritical() << "A target is needed to relay packets to.";
+        QMetaObject::invokeMethod(this, "quit", Qt::QueuedConnection);
+        return;
+    }
+
+    static const double PERCENT = 100.0;
+
+    ImpairmentShim::Settings settings;
+    settings.lossRate = _argumentParser.value(IMPAIR_LOSS_PERCENT).toDouble() / PERCENT;
+    settings.burstStartRate = _argumentParser.value(IMPAIR_BURST_PERCENT).toDouble() / PERCENT;
+    if (_argumentParser.isSet(IMPAIR_BURST_LENGTH)) {
+        settings.burstLength = _argumentParser.value(IMPAIR_BURST_LENGTH).toDouble();
+    }
+    settings.delayMsecs = _argumentParser.value(IMPAIR_DELAY).toInt();
+    settings.jitterMsecs = _argumentParser.value(IMPAIR_JITTER).toInt();
+    settings.rateKbps = _argumentParser.value(IMPAIR_RATE).toInt();
+    if (_argumentParser.isSet(IMPAIR_QUEUE)) {
+        settings.queueMsecs = _argumentParser.value(IMPAIR_QUEUE).toInt();
+    }
+
+    _impairmentShim = new ImpairmentShim(_argumentParser.value(IMPAIR_PORT).toUShort(), _target, settings, this);
+    qDebug() << "Relaying packets from port" << _impairmentShim->localPort() << "to" << _target
+        << "- loss" << settings.lossRate * PERCENT << "% bursts" << settings.burstStartRate * PERCENT
+        << "% of" << settings.burstLength << "packets, delay" << settings.delayMsecs << "+/-" << settings.jitterMsecs
+        << "ms, rate" << settings.rateKbps << "kbps";
+
+    // the relay has its own stats, reported every second
+    static const int IMPAIRMENT_STATS_INTERVAL_MSECS = 1000;
+    QTimer* statsTimer = new QTimer(this);
+    connect(statsTimer, &QTimer::timeout, this, &UDTTest::sampleStats);
+    statsTimer->start(IMPAIRMENT_STATS_INTERVAL_MSECS);
+}
+
 void UDTTest::sendInitialPackets() {
     static const int NUM_INITIAL_PACKETS = 500;
     
@@ -364,6 +473,12 @@ void UDTTest::sampleStats() {
     static const double MS_PER_SECOND = 1000.0;
     static const double PPS_TO_MBPS = udt::MAX_PACKET_SIZE * MEGABITS_PER_BYTE;
 
+    if (_impairmentShim) {
+        auto stats = _impairmentShim->sampleStats();
+        qDebug() << "Relayed" << stats.forwardedPackets << "packets, lost" << stats.lostPackets
+            << "and dropped" << stats.queueDroppedPackets << "from a full queue";
+        return;
+    }
 
     if (!_target.isNull()) {
         if (first) {
@@ -414,7 +529,7 @@ void UDTTest::sampleStats() {
                 QString::number(stats.rtt / USECS_PER_MSEC, 'f', 2).rightJustified(SERVER_STATS_TABLE_HEADERS[++headerIndex].size()),
                 QString::number(stats.congestionWindowSize).rightJustified(SERVER_STATS_TABLE_HEADERS[++headerIndex].size()),
                 QString::number(stats.events[udt::ConnectionStats::Stats::SentACK]).rightJustified(SERVER_STATS_TABLE_HEADERS[++headerIndex].size()),
-                QString::number(stats.events[udt::ConnectionStats::Stats::Duplicate]).rightJustified(SERVER_STATS_TABLE_HEADERS[++headerIndex].size())
+                QString::number(stats.duplicatePackets).rightJustified(SERVER_STATS_TABLE_HEADERS[++headerIndex].size())
             };
             
             // output this line of values
@@ -25,6 +25,8 @@
 
 #include <ReceivedMessage.h>
 
+#include "ImpairmentShim.h"
+
 struct Message {
     udt::MessageNumber messageNumber;
     QByteArray data;
@@ -41,6 +43,7 @@ public slots:
     
 private:
     void parseArguments();
+    void setupImpairmentShim();
     void handleMessage(std::unique_ptr<Message> message);
     
     void sendInitialPackets(); // fills the queue with packets to start
@@ -71,6 +74,11 @@ private:
     int _totalQueuedBytes { 0 }; // keeps track of the number of bytes we have already queued
     
     int _statsInterval { 100 }; // recording interval for stats in milliseconds
+
+    std::mt19937 _dropGenerator { _randomDevice() }; // picks the received packets dropped to simulate loss
+    std::uniform_real_distribution<double> _dropDistribution { 0.0, 1.0 };
+
+    ImpairmentShim* _impairmentShim { nullptr }; // relays and impairs the packets between a peer and the target instead
 };
 
 #endif // hifi_UDTTest_h